@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Progressive accumulation math shared by the path tracer and the host-side tests.
+//
+// At full precision (RGBA32F) the result image holds the exact running mean of all samples.
+// At half precision (RGBA16F) two things go wrong with a plain running mean: once the weight of
+// a new sample drops below half an ulp of the stored value, round-to-nearest discards it and the
+// image stops converging; and the per-store rounding errors keep adding up with the sample count.
+// The half-precision path therefore
+//   - caps the history weight at `window` samples (the mean is rebased onto a fixed-length
+//     history), which bounds the accumulated rounding error independently of the sample count;
+//   - stores with stochastic rounding, so each store is unbiased instead of snapping back to the
+//     previous value.
+
+#ifndef ACCUMULATION_H
+#define ACCUMULATION_H
+
+#include "nvshaders/slang_types.h"
+
+#ifdef __cplusplus
+#include <cstring>
+#endif
+
+NAMESPACE_SHADERIO_BEGIN()
+
+#ifndef INLINE
+#ifdef __cplusplus
+#define INLINE inline
+#else
+#define INLINE
+#endif
+#endif
+
+// Largest finite 16-bit float. Half-precision accumulation clamps to it so a single firefly
+// cannot turn the pixel into +inf for the rest of the accumulation.
+#define ACCUM_HALF_MAX 65504.0f
+
+// Default history cap (in samples) for half-precision accumulation. With a 2^-11 relative
+// rounding step the accumulated rounding error stays around 2^-11 * sqrt(window / 12) of the
+// pixel value (~0.5% at 1024), below 8-bit display quantization after tonemapping.
+#define ACCUM_HALF_DEFAULT_WINDOW 1024
+
+#ifdef __cplusplus
+INLINE uint32_t accumAsUint(float v)
+{
+  uint32_t u;
+  std::memcpy(&u, &v, sizeof(u));
+  return u;
+}
+INLINE float accumAsFloat(uint32_t u)
+{
+  float v;
+  std::memcpy(&v, &u, sizeof(v));
+  return v;
+}
+#else
+#define accumAsUint asuint
+#define accumAsFloat asfloat
+#endif
+
+// Weight of the new batch (numSamples) blended over a history of totalSamples samples:
+// result = lerp(history, batch, weight). window <= 0 gives the exact running mean; otherwise the
+// history never counts for more than `window` samples.
+INLINE float accumulationBlendWeight(int totalSamples, int numSamples, int window)
+{
+  float history = float(totalSamples);
+  if(window > 0 && history > float(window))
+    history = float(window);
+  return float(numSamples) / (history + float(numSamples));
+}
+
+// Round v to a value exactly representable as a 16-bit float, rounding up in magnitude with
+// probability equal to the discarded fraction (u is uniform in [0,1)). The result converts to
+// half without further rounding, whatever rounding mode the hardware uses for the store.
+// Values below the half normal range are returned unchanged (their absolute error is negligible).
+INLINE float stochasticRoundToHalf(float v, float u)
+{
+  v = v > ACCUM_HALF_MAX ? ACCUM_HALF_MAX : (v < -ACCUM_HALF_MAX ? -ACCUM_HALF_MAX : v);
+
+  const uint32_t bits     = accumAsUint(v);
+  const uint32_t exponent = (bits >> 23) & 0xFFu;
+  if(exponent < 113u)  // |v| < 2^-14, smallest normal half
+    return v;
+
+  // One half-precision ulp at this magnitude: 2^(e - 10), built directly from the exponent.
+  const float ulp       = accumAsFloat((exponent - 10u) << 23);
+  const float magnitude = accumAsFloat(bits & 0x7FFFFFFFu) + u * ulp;
+  // Truncate to the 10 explicit mantissa bits of a half.
+  uint32_t rounded = accumAsUint(magnitude) & 0xFFFFE000u;
+  if(accumAsFloat(rounded) > ACCUM_HALF_MAX)
+    rounded = accumAsUint(ACCUM_HALF_MAX);
+  return accumAsFloat(rounded | (bits & 0x80000000u));
+}
+
+NAMESPACE_SHADERIO_END()
+
+#endif  // ACCUMULATION_H
@@ -172,6 +172,7 @@ enum PathtracerFlags
   ePtUseDlss          = 1 << 0,
   ePtUseOptixDenoiser = 1 << 1,
   ePtFirstFrame       = 1 << 2,
+  ePtHalfPrecision    = 1 << 3,  // Rendered image is RGBA16F: stochastic rounding on accumulation store
 };
 
 
@@ -189,6 +190,8 @@ struct PathtracePushConstant
   int                    flags                 = 0;     // Bit flags: ePtUseDlss | ePtUseOptixDenoiser | ePtFirstFrame
   float                  pixelAngle = 0.0f;    // Angular size of one pixel (radians) for ray-cone footprint LOD
   float2                 mouseCoord = {0, 0};  // Mouse coordinates (use for debug)
+  int                    accumWindow = 0;  // Accumulation history cap in samples (0: exact running mean)
+  int                    _pad        = 0;  // Padding (keeps the pointers below 8-byte aligned)
   SceneFrameInfo*        frameInfo;            // Camera info (incl. SceneFrameInfo::jitter when DLSS is active)
   SkyPhysicalParameters* skyParams;            // Sky physical parameters
   GltfScene*             gltfScene;            // GLTF scene
@@ -199,7 +202,7 @@ struct PathtracePushConstant
 struct RasterPushConstant
 {
   int                    materialID       = 0;       // Material used by the rendering instance
-  int                    renderNodeID     = 0;       // Node used by the rendering instance
+  int                    renderNodeID     = 0;       // First render node of the (instanced) draw
   int                    renderPrimID     = 0;       // Primitive used by the rendering instance
   int                    opaqueColorReady = 0;       // 1 = transmission framebuffer ready (mip chain valid)
   float2                 mouseCoord       = {0, 0};  // Mouse coordinates (use for debug)
@@ -332,6 +332,7 @@ void BenchmarkController::emitSequenceMemory(const std::vector<MemorySample>& sa
   {
     memory.push_back({{"category", sample.category},
                       {"host_used", sample.hostUsed},
+                      {"host_peak", sample.hostPeak},
                       {"device_used", sample.deviceUsed},
                       {"device_allocated", sample.deviceAllocated}});
   }
@@ -339,3 +340,24 @@ void BenchmarkController::emitSequenceMemory(const std::vector<MemorySample>& sa
 
   ++m_sequenceId;
 }
+
+//--------------------------------------------------------------------------------------------------
+// Morph/skin primitives evaluated and skipped during the sequence, keyed by the
+// same id as the memory record that follows.
+void BenchmarkController::emitSequenceDeformation(const DeformationSample& sample)
+{
+  std::cout << "BENCHMARK_DEFORM " << m_sequenceId << "; Frames " << sample.frames << "; Morph evaluated "
+            << sample.morphEvaluated << "; Morph at rest " << sample.morphAtRest << "; Morph skipped " << sample.morphSkipped
+            << "; Skin evaluated " << sample.skinEvaluated << "; Skin skipped " << sample.skinSkipped
+            << "; Vertices skipped " << sample.verticesSkipped << std::endl;
+
+  emitJsonLine({{"type", "sequence_deformation"},
+                {"id", m_sequenceId},
+                {"frames", sample.frames},
+                {"morph_evaluated", sample.morphEvaluated},
+                {"morph_at_rest", sample.morphAtRest},
+                {"morph_skipped", sample.morphSkipped},
+                {"skin_evaluated", sample.skinEvaluated},
+                {"skin_skipped", sample.skinSkipped},
+                {"vertices_skipped", sample.verticesSkipped}});
+}
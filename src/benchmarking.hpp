@@ -84,14 +84,28 @@ public:
   };
 
   // One row of memory usage at a benchmark sequence boundary. Bytes are
-  // raw counts as reported by the GPU memory tracker; the consumer is
-  // responsible for any unit conversion.
+  // raw counts as reported by the GPU and host memory trackers; the consumer
+  // is responsible for any unit conversion.
   struct MemorySample
   {
     std::string category;            // Human-readable category (e.g. "Geometry", "Images")
-    uint64_t    hostUsed{0};         // Host-visible bytes currently in use
+    uint64_t    hostUsed{0};         // Host (CPU) bytes currently in use
     uint64_t    deviceUsed{0};       // Device-local bytes currently in use
     uint64_t    deviceAllocated{0};  // Device-local bytes reserved (>= used)
+    uint64_t    hostPeak{0};         // Host (CPU) high water mark since the scene was loaded
+  };
+
+  // Morph / skin work done and skipped since the previous sequence boundary
+  // (see nvvkgltf::DeformSkipStats). Counts are summed over frames.
+  struct DeformationSample
+  {
+    uint64_t frames{0};           // Frames that evaluated the deformation inputs
+    uint64_t morphEvaluated{0};   // Morph primitives blended
+    uint64_t morphAtRest{0};      // Morph primitives reset to their base geometry
+    uint64_t morphSkipped{0};     // Morph primitives skipped (unchanged weights)
+    uint64_t skinEvaluated{0};    // Skinned primitives transformed
+    uint64_t skinSkipped{0};      // Skinned primitives skipped (unchanged joint palette)
+    uint64_t verticesSkipped{0};  // Vertices of the skipped primitives
   };
 
   explicit BenchmarkController(BenchmarkOptions& options);
@@ -120,6 +134,10 @@ public:
   // memory records with the corresponding timing/screenshot records.
   void emitSequenceMemory(const std::vector<MemorySample>& samples);
 
+  // Emit the deformation skip counters of the current sequence. Call before
+  // emitSequenceMemory(), which advances the sequence id.
+  void emitSequenceDeformation(const DeformationSample& sample);
+
 private:
   // Throttling for headless progress logs: emit at most every N frames or
   // every kHeadlessLogMinIntervalMs of wall time, whichever comes first.
@@ -947,6 +947,7 @@ void Dlss::initSr(Resources& resources)
   // Common setup runs regardless of HW availability so the rasterizer's 3-attachment pipeline
   // always has a valid motion attachment to render into.
   m_innerDepthFormat = resources.gBuffers.getDepthFormat();
+  m_srColorFormat    = resources.gBuffers.getColorFormat(Resources::eImgRendered);  // RGBA16F with --colorPrecision 1
   m_fallback         = !resources.settings.dlssSrHardwareAvailable;
 
   // Fallback path: inner GBuffer holds only the motion attachment (no depth, no extra colors).
@@ -954,7 +955,7 @@ void Dlss::initSr(Resources& resources)
   // Normal path: full inner GBuffer (color + selection + motion + matching depth).
   const std::vector<VkFormat> colorFormats = m_fallback ?
                                                  std::vector<VkFormat>{kSrMotionFormat} :
-                                                 std::vector<VkFormat>{kSrColorFormat, kSrSelectionFormat, kSrMotionFormat};
+                                                 std::vector<VkFormat>{m_srColorFormat, kSrSelectionFormat, kSrMotionFormat};
   NVVK_CHECK(m_innerGBuffer.init({.device       = resources.allocator.getDevice(),
                                   .alloc        = &resources.allocator,
                                   .colorFormats = colorFormats,
@@ -1098,7 +1099,7 @@ void Dlss::setResourcesSr()
       .type      = DlssFeature::ResourceType::eColorIn,
       .image     = m_innerGBuffer.getColorImage(kInnerColorIdx),
       .imageView = m_innerGBuffer.getColorAttachmentView(kInnerColorIdx),
-      .format    = kSrColorFormat,
+      .format    = m_srColorFormat,
   });
 
   m_dlss.setResource({
@@ -1123,7 +1124,7 @@ VkFormat Dlss::getSrFormat(SrSlot slot) const
   switch(slot)
   {
     case SrSlot::eColor:
-      return kSrColorFormat;
+      return m_srColorFormat;
     case SrSlot::eSelection:
       return kSrSelectionFormat;
     case SrSlot::eMotion:
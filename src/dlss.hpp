@@ -387,6 +387,7 @@ private:
   bool     m_dlssCreated      = false;                // m_dlss has a valid feature handle (cmdInit succeeded)
   bool     m_fallback         = false;                // SR HW/extensions unavailable; inner GBuffer carries motion only
   VkFormat m_innerDepthFormat = VK_FORMAT_UNDEFINED;  // captured from outer at init time (SR only)
+  VkFormat m_srColorFormat    = VK_FORMAT_UNDEFINED;  // captured from outer eImgRendered at init time (follows Settings::colorPrecision)
 
   // Inner GBuffer attachment indices when SR HW is available. Must stay in lockstep with the
   // colorFormats list passed to m_innerGBuffer.init() in initSr().
@@ -397,9 +398,8 @@ private:
   // In fallback mode the inner GBuffer holds only motion at index 0.
   static constexpr uint32_t kFallbackMotionIdx = 0;
 
-  // SR inner-GBuffer formats: kSrColorFormat must match Resources::eImgRendered, and kSrSelectionFormat must match Resources::eImgSelection.
+  // SR inner-GBuffer formats: the color (m_srColorFormat) matches Resources::eImgRendered, and kSrSelectionFormat must match Resources::eImgSelection.
   // This ensures secondary command buffer format compatibility and avoids conversion during DLSS post-blit.
-  static constexpr VkFormat kSrColorFormat     = VK_FORMAT_R32G32B32A32_SFLOAT;
   static constexpr VkFormat kSrSelectionFormat = VK_FORMAT_R32_SFLOAT;
   static constexpr VkFormat kSrMotionFormat    = VK_FORMAT_R16G16_SFLOAT;
 
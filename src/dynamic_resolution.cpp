@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Interaction-mode resolution controller for the path tracer. See dynamic_resolution.hpp.
+//
+
+#include "dynamic_resolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+DynamicResolution::Transition DynamicResolution::update(bool changed, double lastFrameTimeMs)
+{
+  if(!changed)
+  {
+    m_changedStreak = 0;
+    if(!m_interacting)
+      return Transition::eNone;
+    m_interacting = false;
+    return Transition::eExit;
+  }
+
+  m_changedStreak++;
+  if(!m_interacting)
+  {
+    if(m_changedStreak < m_settings.enterFrames)
+      return Transition::eNone;
+    m_interacting    = true;
+    m_skipNextSample = true;
+    m_scale          = std::clamp(m_scale, m_settings.minScale, m_settings.maxScale);
+    // The previous (full-resolution) frame time gives the starting scale directly
+    if(lastFrameTimeMs > 0.0)
+    {
+      m_scale = 1.0f;
+      adjust(lastFrameTimeMs, 1.0);
+    }
+    return Transition::eEnter;
+  }
+
+  if(m_skipNextSample)
+    m_skipNextSample = false;  // Timing lags a frame: still the full-resolution one
+  else if(lastFrameTimeMs > 0.0)
+    adjust(lastFrameTimeMs, 0.5);
+  return Transition::eNone;
+}
+
+void DynamicResolution::reset()
+{
+  m_changedStreak  = 0;
+  m_interacting    = false;
+  m_skipNextSample = false;
+}
+
+void DynamicResolution::adjust(double frameTimeMs, double gain)
+{
+  const double target = m_settings.targetFrameTimeMs;
+  if(frameTimeMs >= target * 0.8 && frameTimeMs <= target * 1.1)
+    return;  // Dead band
+
+  // Cost ~ pixels ~ scale^2: the scale that would hit the target, approached by `gain`
+  const double predicted = double(m_scale) * std::sqrt(target / frameTimeMs);
+  double       next      = double(m_scale) + gain * (predicted - double(m_scale));
+
+  const double step = std::max(double(m_settings.scaleStep), 1e-3);
+  next              = std::round(next / step) * step;
+  m_scale           = std::clamp(float(next), m_settings.minScale, m_settings.maxScale);
+}
+
+void DynamicResolution::scaledSize(uint32_t width, uint32_t height, float scale, uint32_t& outWidth, uint32_t& outHeight)
+{
+  scale     = std::clamp(scale, 0.0f, 1.0f);
+  outWidth  = std::max(1u, static_cast<uint32_t>(std::lround(double(width) * scale)));
+  outHeight = std::max(1u, static_cast<uint32_t>(std::lround(double(height) * scale)));
+}
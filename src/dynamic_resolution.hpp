@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/*
+ * DynamicResolution - Frame-time controller for the path tracer's interaction mode
+ *
+ * While the view changes every frame (camera or gizmo drag, animation), accumulation restarts each
+ * frame and full-resolution tracing only makes navigation sluggish. The path tracer then renders
+ * at scale() of the output resolution and upscales for display. The scale follows the measured
+ * trace time: the cost is taken as proportional to the pixel count (scale^2), and outside a dead
+ * band around the target the scale moves halfway to the one predicted to hit it, like
+ * PathTracer::updateAdaptiveSampling() does for samples per pixel.
+ *
+ * Interaction starts after `enterFrames` consecutive changed frames (a single edit keeps full
+ * resolution) and ends on the first frame without change: update() then returns eExit and the
+ * caller restarts accumulation at full resolution. The starting scale is predicted from the last
+ * full-resolution frame time (or, without timing, the scale the previous interaction settled on).
+ *
+ * No GPU dependency: update() is driven by (changed, frame time) pairs, so recorded traces can be
+ * replayed in tests.
+ */
+
+#include <cstdint>
+
+class DynamicResolution
+{
+public:
+  struct Settings
+  {
+    double targetFrameTimeMs = 1000.0 / 30.0;  // Trace time to reach while interacting
+    float  minScale          = 0.25f;          // Per axis
+    float  maxScale          = 1.0f;           // Per axis; interaction at 1.0 is plain full resolution
+    float  scaleStep         = 1.0f / 32.0f;   // Quantization, so small timing noise does not move the scale
+    int    enterFrames       = 2;              // Consecutive changed frames before switching to reduced resolution
+  };
+
+  enum class Transition
+  {
+    eNone,
+    eEnter,  // First reduced-resolution frame
+    eExit,   // Back to full resolution: restart accumulation
+  };
+
+  DynamicResolution() = default;
+  explicit DynamicResolution(const Settings& settings)
+      : m_settings(settings)
+  {
+  }
+
+  // Call once per frame, before rendering. `changed`: the frame restarted accumulation (camera,
+  // gizmo, scene edit). `lastFrameTimeMs`: GPU trace time of the previous frame, <= 0 if unknown.
+  Transition update(bool changed, double lastFrameTimeMs);
+  void       reset();  // Leave interaction, keep the learned scale
+
+  [[nodiscard]] bool  isInteracting() const { return m_interacting; }
+  [[nodiscard]] float scale() const { return m_interacting ? m_scale : 1.0f; }  // Scale to render this frame
+  [[nodiscard]] float interactionScale() const { return m_scale; }
+
+  // Rendering size for `scale` of a width x height output, at least 1x1.
+  static void scaledSize(uint32_t width, uint32_t height, float scale, uint32_t& outWidth, uint32_t& outHeight);
+
+  Settings& settings() { return m_settings; }
+
+private:
+  void adjust(double frameTimeMs, double gain);
+
+  Settings m_settings;
+  float    m_scale          = 0.5f;
+  int      m_changedStreak  = 0;
+  bool     m_interacting    = false;
+  bool     m_skipNextSample = false;  // First timing after entering was measured at full resolution
+};
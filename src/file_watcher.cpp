@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// inotify watches on the folders of the files, or periodic stat() elsewhere. See file_watcher.hpp.
+//
+
+#include "file_watcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <system_error>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace nvvkgltf {
+
+FileWatcher::~FileWatcher()
+{
+  clear();
+}
+
+//--------------------------------------------------------------------------------------------------
+// One inotify watch per folder: editors replace files by renaming a temporary over them, which a
+// watch on the file itself would miss (it follows the old inode).
+void FileWatcher::watch(const std::vector<fs::path>& files)
+{
+  clear();
+
+  for(const fs::path& file : files)
+  {
+    std::error_code ec;
+    const fs::path  absolute = fs::absolute(file, ec).lexically_normal();
+    if(ec || std::find(m_files.begin(), m_files.end(), absolute) != m_files.end())
+      continue;
+    m_files.push_back(absolute);
+    m_states.push_back(stat(absolute));
+  }
+  m_lastStat = Clock::now();
+
+#if defined(__linux__)
+  m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if(m_inotify < 0)
+    return;  // stat() fallback
+  for(const fs::path& file : m_files)
+    m_fileNames[file.parent_path()].push_back(file.filename().string());
+  for(const auto& [folder, names] : m_fileNames)
+  {
+    const int wd = inotify_add_watch(m_inotify, folder.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_MODIFY);
+    if(wd < 0)
+    {
+      // A missing or unreadable folder: watch everything by stat() instead
+      close(m_inotify);
+      m_inotify = -1;
+      m_folders.clear();
+      m_fileNames.clear();
+      return;
+    }
+    m_folders[wd] = folder;
+  }
+#endif
+}
+
+void FileWatcher::clear()
+{
+#if defined(__linux__)
+  if(m_inotify >= 0)
+    close(m_inotify);  // Removes the watches
+#endif
+  m_inotify = -1;
+  m_folders.clear();
+  m_fileNames.clear();
+  m_files.clear();
+  m_states.clear();
+  m_pending.clear();
+}
+
+std::vector<fs::path> FileWatcher::poll(std::chrono::milliseconds settle)
+{
+  const Clock::time_point now = Clock::now();
+  if(m_inotify >= 0)
+    readNotifications(now);
+  else if(now - m_lastStat >= kStatInterval)
+    statFiles(now);
+
+  // Without notifications a change is only seen at the next stat(): it must be quiet that long too
+  const std::chrono::milliseconds quiet = m_inotify >= 0 ? settle : std::max(settle, kStatInterval);
+
+  std::vector<fs::path> settled;
+  for(const fs::path& file : m_files)
+  {
+    auto it = m_pending.find(file);
+    if(it != m_pending.end() && now - it->second >= quiet)
+    {
+      settled.push_back(file);
+      m_pending.erase(it);
+    }
+  }
+  return settled;
+}
+
+FileWatcher::FileState FileWatcher::stat(const fs::path& file)
+{
+  FileState       state;
+  std::error_code ec;
+  state.writeTime = fs::last_write_time(file, ec);
+  if(ec)
+    return state;
+  state.size   = fs::file_size(file, ec);
+  state.exists = !ec;
+  return state;
+}
+
+// Every event of a watched file restarts its settle time
+void FileWatcher::readNotifications(Clock::time_point now)
+{
+#if defined(__linux__)
+  alignas(inotify_event) std::array<char, 4096> buffer;
+  for(;;)
+  {
+    const ssize_t length = read(m_inotify, buffer.data(), buffer.size());
+    if(length <= 0)
+      break;  // EAGAIN: nothing left
+    for(ssize_t offset = 0; offset < length;)
+    {
+      const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+      offset += ssize_t(sizeof(inotify_event) + event->len);
+      auto folder = m_folders.find(event->wd);
+      if(folder == m_folders.end() || event->len == 0)
+        continue;
+      const std::vector<std::string>& names = m_fileNames[folder->second];
+      if(std::find(names.begin(), names.end(), std::string(event->name)) != names.end())
+        m_pending[folder->second / event->name] = now;
+    }
+  }
+#else
+  (void)now;
+#endif
+}
+
+void FileWatcher::statFiles(Clock::time_point now)
+{
+  m_lastStat = now;
+  for(size_t i = 0; i < m_files.size(); i++)
+  {
+    const FileState state = stat(m_files[i]);
+    if(state.exists != m_states[i].exists || state.writeTime != m_states[i].writeTime || state.size != m_states[i].size)
+    {
+      m_states[i]           = state;
+      m_pending[m_files[i]] = now;
+    }
+  }
+}
+
+}  // namespace nvvkgltf
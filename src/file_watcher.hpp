@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::FileWatcher
+
+>  Reports the files of a set that were written, replaced or created since the last poll().
+
+On Linux the folders of the files are watched with inotify, so poll() only reads the pending
+events. Elsewhere (or when inotify is not available) poll() compares the modification time and
+size of each file, at most every `kStatInterval`.
+
+Exporters often write a file in several steps (truncate, write, rename over the original), so a
+file is only reported once it has not changed for `settle`. poll() never blocks; it is meant to be
+called once per frame from the thread that owns the watcher.
+
+ -------------------------------------------------------------------------------------------------*/
+class FileWatcher
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kDefaultSettle{250};
+  static constexpr std::chrono::milliseconds kStatInterval{500};
+
+  FileWatcher() = default;
+  ~FileWatcher();
+  FileWatcher(const FileWatcher&)            = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  // Replaces the watched set. Files that do not exist yet are reported when they are created.
+  void watch(const std::vector<std::filesystem::path>& files);
+  void clear();
+
+  // Files changed since the last call and quiet for `settle`, in the order they were passed to watch()
+  [[nodiscard]] std::vector<std::filesystem::path> poll(std::chrono::milliseconds settle = kDefaultSettle);
+
+  [[nodiscard]] bool                                      empty() const { return m_files.empty(); }
+  [[nodiscard]] bool                                      usesNotifications() const { return m_inotify >= 0; }
+  [[nodiscard]] const std::vector<std::filesystem::path>& files() const { return m_files; }
+
+private:
+  struct FileState
+  {
+    std::filesystem::file_time_type writeTime{};
+    uintmax_t                       size   = 0;
+    bool                            exists = false;
+  };
+
+  static FileState stat(const std::filesystem::path& file);
+  void             readNotifications(Clock::time_point now);
+  void             statFiles(Clock::time_point now);
+
+  std::vector<std::filesystem::path>                 m_files;    // Absolute, as given to watch()
+  std::vector<FileState>                             m_states;   // Per file, stat() fallback only
+  std::map<std::filesystem::path, Clock::time_point> m_pending;  // Changed file -> time of its last change
+  Clock::time_point                                  m_lastStat{};
+
+  int                                                       m_inotify = -1;
+  std::unordered_map<int, std::filesystem::path>            m_folders;    // inotify watch -> folder
+  std::map<std::filesystem::path, std::vector<std::string>> m_fileNames;  // Folder -> watched file names
+};
+
+}  // namespace nvvkgltf
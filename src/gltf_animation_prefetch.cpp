@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Channel evaluation and world matrices of the next animation frames, from a copy of the clip. See gltf_animation_prefetch.hpp.
+//
+
+#include "gltf_animation_prefetch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#include "gltf_scene_animation.hpp"
+
+namespace nvvkgltf {
+
+//--------------------------------------------------------------------------------------------------
+// What the frame tasks read. The pose model has a node per channel target (TRS and matrix; `mesh`
+// is its pose mesh for weights channels, -1 otherwise) and a mesh per weights target (weights only).
+struct AnimationPrefetch::Shadow
+{
+  struct MovedNode
+  {
+    int       parent = -1;        // Index in movedNodes, -1 if the parent does not move
+    int       dirty  = -1;        // Index in dirtyNodes, -1 if only an ancestor moves
+    glm::mat4 local{1.0f};        // Local matrix if not dirty
+    glm::mat4 parentWorld{1.0f};  // World matrix of the parent if it does not move (identity for roots)
+  };
+
+  AnimationSystem*           channels = nullptr;  // Evaluates the clip copy below, without reading its own state
+  AnimationSystem::Animation clip;
+  tinygltf::Model            poseModel;
+  std::vector<int>           channelPoseNodes;  // Per clip channel, -1 if its target is not a node
+  std::vector<int>           poseNodes;         // Scene node of each pose node
+  std::vector<int>           poseMeshes;        // Scene mesh of each pose mesh
+
+  std::vector<int>       dirtyNodes;      // In the order updateAnimation() marks them
+  std::vector<int>       dirtyPoseNodes;  // -1 for the skinned nodes, which only move with their joints
+  std::vector<glm::mat4> dirtyLocals;     // Local matrix of the skinned nodes
+
+  bool                   prepareMatrices = false;  // World matrices and render nodes prepared too
+  std::vector<int>       movedNodes;               // Dirty nodes of the current scene and their descendants, parents first
+  std::vector<MovedNode> moved;                    // Parallel to movedNodes
+  std::vector<int>       movedRenderNodes;         // Ascending, as updateNodeWorldMatrices() collects them
+  std::vector<int>       renderNodeSources;        // Index in movedNodes of each moved render node
+};
+
+namespace {
+bool sameBits(const glm::mat4& a, const glm::mat4& b)
+{
+  return std::memcmp(&a, &b, sizeof(glm::mat4)) == 0;
+}
+}  // namespace
+
+AnimationPrefetch::~AnimationPrefetch()
+{
+  stop();
+}
+
+bool AnimationPrefetch::canPrefetch(const Scene& scene, int animation)
+{
+  const tinygltf::Model& model = scene.getModel();
+  if(animation < 0 || animation >= static_cast<int>(model.animations.size()))
+    return false;
+  for(const tinygltf::AnimationChannel& channel : model.animations[animation].channels)
+  {
+    if(channel.target_path == "pointer")
+      return false;
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Everything derived from the targets of the clip is computed here once: the dirty nodes with skin
+// expansion (AnimationSystem::addSkinnedNodes, as updateAnimation()), and the subtrees they move
+// with their render nodes (as updateWorldMatricesParallel()). Costs one pass over the nodes.
+void AnimationPrefetch::start(Scene& scene, int animation, float step, uint32_t depth)
+{
+  stop();
+  if(!canPrefetch(scene, animation) || depth == 0)
+    return;
+
+  AnimationSystem&       system   = scene.animation();
+  const tinygltf::Model& model    = scene.getModel();
+  const size_t           numNodes = model.nodes.size();
+  if(animation >= static_cast<int>(system.m_animations.size()))
+    return;
+
+  auto shadow      = std::make_unique<Shadow>();
+  shadow->channels = &system;
+  shadow->clip     = system.m_animations[animation];
+
+  // Pose nodes and meshes of the channel targets; the targets are the first dirty nodes
+  std::vector<int>  poseNodeOf(numNodes, -1);
+  std::vector<int>  poseMeshOf(model.meshes.size(), -1);
+  std::vector<bool> dirtyBits(numNodes, false);
+  for(const AnimationSystem::AnimationChannel& channel : shadow->clip.channels)
+  {
+    const int node = channel.node;
+    if(node < 0 || node >= static_cast<int>(numNodes))
+    {
+      shadow->channelPoseNodes.push_back(-1);
+      continue;
+    }
+    if(poseNodeOf[node] < 0)
+    {
+      const tinygltf::Node& gltfNode = model.nodes[node];
+      tinygltf::Node        pose;
+      pose.translation = gltfNode.translation;
+      pose.rotation    = gltfNode.rotation;
+      pose.scale       = gltfNode.scale;
+      pose.matrix      = gltfNode.matrix;
+      pose.mesh        = -1;
+      poseNodeOf[node] = static_cast<int>(shadow->poseNodes.size());
+      shadow->poseNodes.push_back(node);
+      shadow->poseModel.nodes.push_back(std::move(pose));
+    }
+    const int mesh = model.nodes[node].mesh;
+    if(channel.path == AnimationSystem::AnimationChannel::eWeights && mesh >= 0 && mesh < static_cast<int>(model.meshes.size()))
+    {
+      if(poseMeshOf[mesh] < 0)
+      {
+        tinygltf::Mesh pose;
+        pose.weights     = model.meshes[mesh].weights;
+        poseMeshOf[mesh] = static_cast<int>(shadow->poseMeshes.size());
+        shadow->poseMeshes.push_back(mesh);
+        shadow->poseModel.meshes.push_back(std::move(pose));
+      }
+      shadow->poseModel.nodes[poseNodeOf[node]].mesh = poseMeshOf[mesh];
+    }
+    shadow->channelPoseNodes.push_back(poseNodeOf[node]);
+    if(!dirtyBits[node])
+    {
+      dirtyBits[node] = true;
+      shadow->dirtyNodes.push_back(node);
+    }
+  }
+  system.addSkinnedNodes(dirtyBits, shadow->dirtyNodes);
+
+  std::vector<int> dirtyIndex(numNodes, -1);
+  for(size_t i = 0; i < shadow->dirtyNodes.size(); i++)
+  {
+    const int node   = shadow->dirtyNodes[i];
+    dirtyIndex[node] = static_cast<int>(i);
+    shadow->dirtyPoseNodes.push_back(poseNodeOf[node]);
+    shadow->dirtyLocals.push_back(poseNodeOf[node] < 0 ? tinygltf::utils::getNodeMatrix(model.nodes[node]) : glm::mat4(1.0f));
+  }
+
+  // Moved subtrees, walked in topological order like updateWorldMatricesParallel(). Instanced nodes
+  // generate their render nodes from batches: left to updateNodeWorldMatrices().
+  const std::vector<int>&          topoOrder = scene.getTopoNodeOrder();
+  const std::vector<int>&          parents   = scene.getNodeParents();
+  const RenderNodeRegistry&        registry  = scene.getRenderNodeRegistry();
+  std::vector<int>                 movedIndex(numNodes, -1);
+  std::vector<std::pair<int, int>> renderNodes;  // (render node, moved node)
+  shadow->prepareMatrices = !topoOrder.empty();
+  for(int node : topoOrder)
+  {
+    const int parent      = parents[node];
+    const int movedParent = parent >= 0 ? movedIndex[parent] : -1;
+    if(dirtyIndex[node] < 0 && movedParent < 0)
+      continue;
+
+    Shadow::MovedNode moved{.parent = movedParent, .dirty = dirtyIndex[node]};
+    if(moved.dirty < 0)
+      moved.local = tinygltf::utils::getNodeMatrix(model.nodes[node]);
+    if(movedParent < 0 && parent >= 0)
+      moved.parentWorld = scene.getNodesWorldMatrices()[parent];
+    movedIndex[node] = static_cast<int>(shadow->movedNodes.size());
+    shadow->movedNodes.push_back(node);
+    shadow->moved.push_back(moved);
+
+    if(model.nodes[node].mesh >= 0)
+    {
+      if(!registry.getInstanceBatchesForNode(node).empty())
+      {
+        shadow->prepareMatrices = false;
+        break;
+      }
+      for(int renderNode : registry.getRenderNodesForNode(node))
+        renderNodes.emplace_back(renderNode, movedIndex[node]);
+    }
+  }
+  if(shadow->prepareMatrices)
+  {
+    std::sort(renderNodes.begin(), renderNodes.end());
+    for(const auto& [renderNode, source] : renderNodes)
+    {
+      shadow->movedRenderNodes.push_back(renderNode);
+      shadow->renderNodeSources.push_back(source);
+    }
+  }
+  else
+  {
+    shadow->movedNodes.clear();
+    shadow->moved.clear();
+  }
+
+  m_shadow             = std::move(shadow);
+  m_token              = CancellationToken();
+  m_nodeCount          = numNodes;
+  m_meshCount          = model.meshes.size();
+  m_sceneGraphRevision = scene.getSceneGraphRevision();
+  m_animation          = animation;
+  m_step               = step;
+  m_depth              = depth;
+  for(uint32_t i = 0; i < depth; i++)
+    queueFrame();
+}
+
+void AnimationPrefetch::stop()
+{
+  m_token.cancel();
+  for(const Slot& slot : m_slots)
+    TaskScheduler::shared().wait(slot.task);
+  m_slots.clear();
+  m_shadow.reset();
+  m_animation = -1;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Each frame depends on the one before it: they share the shadow and step its clip in turn. The
+// channels write the pose model only; the matrices are computed in the order the scene does.
+void AnimationPrefetch::queueFrame()
+{
+  auto frame = std::make_shared<PreparedFrame>();
+
+  TaskDesc desc{.name = "Prefetch animation frame", .priority = TaskPriority::eInteractive, .token = m_token};
+  if(!m_slots.empty())
+    desc.dependencies.push_back(m_slots.back().task);
+
+  TaskHandle task = TaskScheduler::shared().submit(
+      [shadow = m_shadow.get(), step = m_step, frame]() {
+        AnimationSystem::Animation& clip = shadow->clip;
+        clip.info.incrementTime(step);
+        frame->time = clip.info.currentTime;
+
+        tinygltf::Model& poses = shadow->poseModel;
+        for(size_t i = 0; i < clip.channels.size(); i++)
+        {
+          const AnimationSystem::AnimationChannel& channel  = clip.channels[i];
+          const int                                poseNode = shadow->channelPoseNodes[i];
+          if(poseNode >= 0)
+            shadow->channels->processAnimationChannel(poses, &poses.nodes[poseNode], clip.samplers[channel.samplerIndex],
+                                                      channel, frame->time);
+        }
+
+        frame->poses.reserve(shadow->poseNodes.size());
+        for(size_t i = 0; i < shadow->poseNodes.size(); i++)
+        {
+          const tinygltf::Node& pose = poses.nodes[i];
+          frame->poses.push_back({shadow->poseNodes[i], pose.translation, pose.rotation, pose.scale});
+        }
+        frame->meshWeights.reserve(shadow->poseMeshes.size());
+        for(size_t i = 0; i < shadow->poseMeshes.size(); i++)
+          frame->meshWeights.push_back({shadow->poseMeshes[i], poses.meshes[i].weights});
+
+        if(shadow->prepareMatrices)
+        {
+          std::vector<glm::mat4>& locals = frame->localMatrices;
+          locals.resize(shadow->dirtyNodes.size());
+          for(size_t i = 0; i < locals.size(); i++)
+          {
+            const int poseNode = shadow->dirtyPoseNodes[i];
+            locals[i]          = poseNode >= 0 ? tinygltf::utils::getNodeMatrix(poses.nodes[poseNode]) : shadow->dirtyLocals[i];
+          }
+
+          std::vector<glm::mat4>& worlds = frame->worldMatrices;
+          worlds.resize(shadow->moved.size());
+          for(size_t i = 0; i < worlds.size(); i++)
+          {
+            const Shadow::MovedNode& moved     = shadow->moved[i];
+            const glm::mat4&         parentMat = moved.parent >= 0 ? worlds[moved.parent] : moved.parentWorld;
+            worlds[i]                          = parentMat * (moved.dirty >= 0 ? locals[moved.dirty] : moved.local);
+          }
+
+          frame->renderNodeWorldMatrices.reserve(shadow->renderNodeSources.size());
+          for(int source : shadow->renderNodeSources)
+            frame->renderNodeWorldMatrices.push_back(worlds[source]);
+        }
+
+        frame->valid = true;
+      },
+      std::move(desc));
+
+  m_slots.push_back({std::move(task), std::move(frame)});
+}
+
+//--------------------------------------------------------------------------------------------------
+// The matrices start() copied (local matrices of the moved nodes the clip does not pose, world
+// matrices above the moved subtrees) are still the scene's, i.e. none of those nodes was edited.
+bool AnimationPrefetch::staticMatricesCurrent(const Scene& scene) const
+{
+  const Shadow& shadow = *m_shadow;
+  if(!shadow.prepareMatrices)
+    return true;
+
+  const std::vector<glm::mat4>& locals  = scene.getNodesLocalMatrices();
+  const std::vector<glm::mat4>& worlds  = scene.getNodesWorldMatrices();
+  const std::vector<int>&       parents = scene.getNodeParents();
+  for(size_t i = 0; i < shadow.dirtyNodes.size(); i++)
+  {
+    if(shadow.dirtyPoseNodes[i] < 0 && !sameBits(locals[shadow.dirtyNodes[i]], shadow.dirtyLocals[i]))
+      return false;
+  }
+  for(size_t i = 0; i < shadow.movedNodes.size(); i++)
+  {
+    const Shadow::MovedNode& moved  = shadow.moved[i];
+    const int                parent = parents[shadow.movedNodes[i]];
+    if(moved.dirty < 0 && !sameBits(locals[shadow.movedNodes[i]], moved.local))
+      return false;
+    if(moved.parent < 0 && parent >= 0 && !sameBits(worlds[parent], moved.parentWorld))
+      return false;
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Marking the nodes in the order updateAnimation() did keeps the dirty sets of `scene` identical,
+// including the lights of the marked nodes. The matrices are those updateNodeWorldMatrices() would
+// compute as long as no other node is dirty.
+std::optional<bool> AnimationPrefetch::apply(Scene& scene, int animation, float time, bool* worldMatricesUpdated)
+{
+  if(worldMatricesUpdated)
+    *worldMatricesUpdated = false;
+  if(!isRunning() || animation != m_animation || m_slots.empty())
+  {
+    stop();
+    return std::nullopt;
+  }
+
+  Slot slot = std::move(m_slots.front());
+  m_slots.pop_front();
+  TaskScheduler::shared().wait(slot.task);
+  const PreparedFrame& frame = *slot.frame;
+  if(!frame.valid || std::bit_cast<uint32_t>(frame.time) != std::bit_cast<uint32_t>(time))
+  {
+    stop();
+    return std::nullopt;
+  }
+
+  tinygltf::Model& model = scene.getModel();
+  if(model.nodes.size() != m_nodeCount || model.meshes.size() != m_meshCount
+     || scene.getSceneGraphRevision() != m_sceneGraphRevision || !staticMatricesCurrent(scene))
+  {
+    stop();  // Edited since start()
+    return std::nullopt;
+  }
+
+  const Shadow& shadow       = *m_shadow;
+  const bool    withMatrices = worldMatricesUpdated && shadow.prepareMatrices && scene.getDirtyFlags().nodes.empty();
+  for(const NodePose& pose : frame.poses)
+  {
+    tinygltf::Node& node = model.nodes[pose.node];
+    node.translation     = pose.translation;
+    node.rotation        = pose.rotation;
+    node.scale           = pose.scale;
+  }
+  for(const MeshWeights& mesh : frame.meshWeights)
+    model.meshes[mesh.mesh].weights = mesh.weights;
+  for(int node : shadow.dirtyNodes)
+    scene.markNodeDirty(node);
+  if(withMatrices)
+  {
+    scene.setNodeMatrices(shadow.dirtyNodes, frame.localMatrices, shadow.movedNodes, frame.worldMatrices,
+                          shadow.movedRenderNodes, frame.renderNodeWorldMatrices);
+    *worldMatricesUpdated = true;
+  }
+
+  queueFrame();
+  return !shadow.dirtyNodes.empty();
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "gltf_scene.hpp"
+#include "task_scheduler.hpp"
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::AnimationPrefetch
+
+>  Evaluates the animation channels and world matrices of the next frames on the task scheduler,
+   ahead of rendering.
+
+Headless animation renders advance the clip by a fixed step per frame, so the times of the next
+frames are known. start() copies what the clip needs (the "shadow"): its samplers and channels, the
+TRS of the nodes it targets and the weights of their meshes - no buffers, no other nodes. It also
+computes once what updateAnimation() and updateNodeWorldMatrices() derive from the same targets
+every frame: the nodes marked dirty (with skin expansion), the nodes they move in the current
+scene, and the render nodes and lights of those. It then queues one task per frame, each stepping
+the shadow clip with AnimationInfo::incrementTime(), evaluating its channels, and computing the
+local and world matrices of the moved nodes and their render nodes. The tasks are chained, and at
+most `depth` frames are queued or waiting to be used.
+
+apply() hands the prepared frame to the rendered scene: poses copied, the same nodes marked dirty in
+the same order, the same return value as updateAnimation(), and, if the caller asks for them, the
+matrices and render-node dirty set of updateNodeWorldMatrices() (Scene::setNodeMatrices()). The
+rendered scene ends up exactly as if it had done both itself. If the frame asked for is not the
+next prepared one (other clip, time reset, other step, nodes added, removed or re-parented, a
+non-animated node of the moved subtrees edited), apply() stops and returns nullopt: the caller
+evaluates in line, and may start() again from there.
+
+The matrices are not prepared when other nodes are dirty too (edits of that frame), or when the
+moved subtrees hold EXT_mesh_gpu_instancing batches; the caller then runs updateNodeWorldMatrices().
+GPU sync and deformation (joint palettes, morph weights) build on the matrices of the frame and
+write the state that the frame being recorded reads: they stay on the render thread.
+
+Clips with KHR_animation_pointer channels are not prefetched (canPrefetch()): the pointer system
+keeps its own state across frames and writes materials, lights and cameras.
+ -------------------------------------------------------------------------------------------------*/
+class AnimationPrefetch
+{
+public:
+  AnimationPrefetch() = default;
+  ~AnimationPrefetch();
+  AnimationPrefetch(const AnimationPrefetch&)            = delete;
+  AnimationPrefetch& operator=(const AnimationPrefetch&) = delete;
+
+  // True if `animation` of `scene` can be evaluated ahead (node TRS and weights channels only)
+  static bool canPrefetch(const Scene& scene, int animation);
+
+  // Prepare the frames of `animation` that follow the one `scene` holds: its clip time plus `step`,
+  // plus two steps, ... Restarts if already running. `scene` must outlive the prefetch or stop() it.
+  void start(Scene& scene, int animation, float step, uint32_t depth);
+  void stop();  // Cancels and waits for the queued frames
+
+  [[nodiscard]] bool     isRunning() const { return m_shadow != nullptr; }
+  [[nodiscard]] int      getAnimation() const { return m_animation; }
+  [[nodiscard]] float    getStep() const { return m_step; }
+  [[nodiscard]] uint32_t getDepth() const { return m_depth; }
+
+  // Applies the prepared frame of `animation` at `time` to `scene` and returns what
+  // AnimationSystem::updateAnimation() would have; nullopt (and stopped) if that frame is not the
+  // next one prepared. Waits if it is still being evaluated. With `worldMatricesUpdated`, the frame's
+  // matrices are applied too when they can be, and it tells whether Scene::updateNodeWorldMatrices()
+  // was done.
+  [[nodiscard]] std::optional<bool> apply(Scene& scene, int animation, float time, bool* worldMatricesUpdated = nullptr);
+
+private:
+  struct Shadow;  // See gltf_animation_prefetch.cpp
+
+  struct NodePose
+  {
+    int                 node = -1;
+    std::vector<double> translation;
+    std::vector<double> rotation;
+    std::vector<double> scale;
+  };
+
+  struct MeshWeights
+  {
+    int                 mesh = -1;
+    std::vector<double> weights;
+  };
+
+  struct PreparedFrame
+  {
+    float                    time = 0.0f;
+    std::vector<NodePose>    poses;                    // Nodes targeted by the channels
+    std::vector<MeshWeights> meshWeights;              // Meshes of the nodes targeted by weights channels
+    std::vector<glm::mat4>   localMatrices;            // Of Shadow::dirtyNodes, if prepared
+    std::vector<glm::mat4>   worldMatrices;            // Of Shadow::movedNodes, if prepared
+    std::vector<glm::mat4>   renderNodeWorldMatrices;  // Of Shadow::movedRenderNodes, if prepared
+    bool                     valid = false;            // Set by the task; false if it was cancelled
+  };
+
+  struct Slot
+  {
+    TaskHandle                     task;
+    std::shared_ptr<PreparedFrame> frame;
+  };
+
+  void               queueFrame();                                   // Chains the next frame after the last queued one
+  [[nodiscard]] bool staticMatricesCurrent(const Scene& scene) const;  // Nodes start() did not pose, not edited since
+
+  std::unique_ptr<Shadow> m_shadow;  // Its pose model and clip are only touched by the queued tasks while they run
+  CancellationToken       m_token;
+  std::deque<Slot>        m_slots;                   // Oldest first
+  size_t                  m_nodeCount          = 0;  // Of the scene the shadow was copied from
+  size_t                  m_meshCount          = 0;
+  uint64_t                m_sceneGraphRevision = 0;
+  int                     m_animation          = -1;
+  float                   m_step               = 0.0f;
+  uint32_t                m_depth              = 0;
+};
+
+}  // namespace nvvkgltf
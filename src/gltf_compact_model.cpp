@@ -71,7 +71,7 @@ void collectPrimitiveAccessors(const tinygltf::Primitive& primitive, std::set<in
 }
 
 //--------------------------------------------------------------------------------------------------
-// Phase 1: Collect all accessor indices referenced by meshes, skins, and animations.
+// Phase 1: Collect all accessor indices referenced by meshes, instancing nodes, skins, and animations.
 //--------------------------------------------------------------------------------------------------
 std::set<int> collectUsedAccessors(const tinygltf::Model& model)
 {
@@ -85,6 +85,18 @@ std::set<int> collectUsedAccessors(const tinygltf::Model& model)
     }
   }
 
+  for(const auto& node : model.nodes)
+  {
+    auto it = node.extensions.find(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+    if(it == node.extensions.end() || !it->second.Has("attributes") || !it->second.Get("attributes").IsObject())
+      continue;
+    for(const auto& [name, value] : it->second.Get("attributes").Get<tinygltf::Value::Object>())
+    {
+      if((value.IsInt() || value.IsNumber()) && value.GetNumberAsInt() >= 0)
+        usedAccessors.insert(value.GetNumberAsInt());
+    }
+  }
+
   for(const auto& skin : model.skins)
   {
     if(skin.inverseBindMatrices >= 0)
@@ -302,7 +314,7 @@ std::vector<tinygltf::Accessor> buildCompactAccessors(const tinygltf::Model&  mo
 }
 
 //--------------------------------------------------------------------------------------------------
-// Phase 8: Update all accessor references in meshes, skins, animations, and images.
+// Phase 8: Update all accessor references in meshes, instancing nodes, skins, animations, and images.
 //--------------------------------------------------------------------------------------------------
 void updateModelReferences(tinygltf::Model& model, const std::vector<int>& accessorRemap, const std::vector<int>& bufferViewRemap)
 {
@@ -333,6 +345,20 @@ void updateModelReferences(tinygltf::Model& model, const std::vector<int>& acces
     }
   }
 
+  for(auto& node : model.nodes)
+  {
+    auto it = node.extensions.find(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+    if(it == node.extensions.end() || !it->second.Has("attributes") || !it->second.Get("attributes").IsObject())
+      continue;
+    auto& attrs = it->second.Get<tinygltf::Value::Object>()["attributes"].Get<tinygltf::Value::Object>();
+    for(auto& [name, value] : attrs)
+    {
+      const int accessorIdx = (value.IsInt() || value.IsNumber()) ? value.GetNumberAsInt() : -1;
+      if(accessorIdx >= 0 && accessorIdx < static_cast<int>(accessorRemap.size()))
+        value = tinygltf::Value(accessorRemap[accessorIdx]);
+    }
+  }
+
   for(auto& skin : model.skins)
   {
     if(skin.inverseBindMatrices >= 0 && skin.inverseBindMatrices < static_cast<int>(accessorRemap.size()))
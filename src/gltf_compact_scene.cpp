@@ -926,6 +926,7 @@ bool Scene::compactModel()
 
   // Compact geometry (accessors → bufferViews → buffers) now that orphaned meshes are gone.
   // Merges all surviving data into a single buffer[0].
+  waitForSaves();
   ::compactModel(m_model);
 
   logCompactionResults(origMesh, origMat, origTex, origImg, origSamp, origSkin, origCam, origAnim, origLight, m_model,
@@ -56,9 +56,9 @@
 
 #include "nvshaders/functions.h.slang"
 
-#include <nvutils/parallel_work.hpp>
 #include <nvutils/timers.hpp>
 #include <nvutils/logger.hpp>
+#include "task_scheduler.hpp"
 #include "tinygltf_utils.hpp"
 
 #include "gltf_compact_model.hpp"
@@ -669,7 +669,7 @@ bool recomputeTangents(tinygltf::Model& model, bool forceCreation, bool mikktspa
   else
   {
     // Simple method: fully parallel
-    nvutils::parallel_batches<1>(primitives.size(), [&](uint64_t primID) {
+    nvvkgltf::parallelFor<1>(primitives.size(), [&](uint64_t primID) {
       tinygltf::utils::simpleCreateTangents(model, *primitives[primID]);
     });
   }
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Task-table layout of the batched morph and skin dispatches, and the CPU reference of the joint
+// palette. See gltf_deform_batch.hpp.
+//
+
+#include "gltf_deform_batch.hpp"
+
+#include <algorithm>
+
+namespace nvvkgltf {
+
+void DeformBatchTable::clear()
+{
+  skinTasks.clear();
+  skinFirstVertex.clear();
+  palette.clear();
+  paletteInverseBind.clear();
+  morphTasks.clear();
+  morphFirstVertex.clear();
+  paletteLookup.clear();
+  skinVertexCount  = 0;
+  morphVertexCount = 0;
+  morphWeightCount = 0;
+}
+
+size_t DeformBatchTable::addSkin(uint32_t                   vertexCount,
+                                 int                        skinID,
+                                 int                        refNodeID,
+                                 std::span<const int>       jointNodes,
+                                 std::span<const glm::mat4> inverseBindMatrices)
+{
+  const auto [it, inserted] = paletteLookup.try_emplace(std::make_pair(skinID, refNodeID), static_cast<uint32_t>(palette.size()));
+  if(inserted)
+  {
+    for(size_t i = 0; i < jointNodes.size(); i++)
+    {
+      palette.push_back({.jointNode = jointNodes[i], .refNode = refNodeID});
+      paletteInverseBind.push_back(i < inverseBindMatrices.size() ? inverseBindMatrices[i] : glm::mat4(1));
+    }
+  }
+
+  shaderio::SkinBatchTask task{};
+  task.firstVertex   = skinVertexCount;
+  task.vertexCount   = vertexCount;
+  task.paletteOffset = it->second;
+  task.numJoints     = static_cast<uint32_t>(jointNodes.size());
+  skinTasks.push_back(task);
+  skinFirstVertex.push_back(task.firstVertex);
+  skinVertexCount += vertexCount;
+  return skinTasks.size() - 1;
+}
+
+size_t DeformBatchTable::addMorph(uint32_t vertexCount, uint32_t numTargets)
+{
+  shaderio::MorphBatchTask task{};
+  task.firstVertex   = morphVertexCount;
+  task.vertexCount   = vertexCount;
+  task.weightsOffset = morphWeightCount;
+  task.numTargets    = numTargets;
+  morphTasks.push_back(task);
+  morphFirstVertex.push_back(task.firstVertex);
+  morphVertexCount += vertexCount;
+  morphWeightCount += numTargets;
+  return morphTasks.size() - 1;
+}
+
+int DeformBatchTable::findTask(std::span<const uint32_t> firstVertex, uint32_t totalVertexCount, uint32_t vertex)
+{
+  if(vertex >= totalVertexCount || firstVertex.empty())
+    return -1;
+  const auto it = std::upper_bound(firstVertex.begin(), firstVertex.end(), vertex);
+  return static_cast<int>(it - firstVertex.begin()) - 1;
+}
+
+void DeformBatchTable::evaluatePalette(std::span<const glm::mat4> worldMatrices,
+                                       std::span<glm::mat4>       jointMatrices,
+                                       std::span<glm::mat3>       normalMatrices) const
+{
+  const int numNodes = static_cast<int>(worldMatrices.size());
+  int       invRefID = -1;  // Entries of one palette share the reference node: invert it once
+  glm::mat4 invRef{1};
+  for(size_t i = 0; i < palette.size(); i++)
+  {
+    const shaderio::JointPaletteEntry& entry = palette[i];
+    if(entry.jointNode < 0 || entry.jointNode >= numNodes || entry.refNode < 0 || entry.refNode >= numNodes)
+    {
+      jointMatrices[i]  = glm::mat4(1);
+      normalMatrices[i] = glm::mat3(1);
+      continue;
+    }
+    if(entry.refNode != invRefID)
+    {
+      invRefID = entry.refNode;
+      invRef   = glm::inverse(worldMatrices[invRefID]);
+    }
+    jointMatrices[i]  = invRef * worldMatrices[entry.jointNode] * paletteInverseBind[i];
+    normalMatrices[i] = glm::transpose(glm::inverse(glm::mat3(jointMatrices[i])));
+  }
+}
+
+}  // namespace nvvkgltf
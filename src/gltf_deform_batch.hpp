@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "shaders/animation_io.h.slang"
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# struct nvvkgltf::DeformBatchTable
+
+>  Layout of the batched morph and skin dispatches: every deformed primitive is a task covering a
+   slice of one global vertex range, so a single dispatch deforms all of them.
+
+Built once per scene by AnimationVk::createGpuBuffers(). The tasks only carry the layout here
+(first vertex, counts, palette and weight offsets); AnimationVk fills in the buffer addresses.
+
+Skinned primitives that share a skin and a reference node share one palette: the joint and
+normal matrices are computed once per (skin, reference node) pair, on the GPU by
+joint_palette.comp.slang from the node world matrices, or on the CPU by evaluatePalette().
+
+findTask() and evaluatePalette() are the CPU reference of the shaders.
+
+ -------------------------------------------------------------------------------------------------*/
+struct DeformBatchTable
+{
+  std::vector<shaderio::SkinBatchTask>     skinTasks;
+  std::vector<uint32_t>                    skinFirstVertex;     // skinTasks[i].firstVertex, searched by the skin pass
+  std::vector<shaderio::JointPaletteEntry> palette;             // One per joint of each (skin, reference node) pair
+  std::vector<glm::mat4>                   paletteInverseBind;  // Parallel to palette
+  std::vector<shaderio::MorphBatchTask>    morphTasks;
+  std::vector<uint32_t>                    morphFirstVertex;  // morphTasks[i].firstVertex, searched by the morph pass
+  uint32_t                                 skinVertexCount  = 0;
+  uint32_t                                 morphVertexCount = 0;
+  uint32_t                                 morphWeightCount = 0;
+
+  [[nodiscard]] bool empty() const { return skinTasks.empty() && morphTasks.empty(); }
+  void               clear();
+
+  // Append a skinned primitive and return its task index. jointNodes / inverseBindMatrices are the
+  // skin's; a missing inverse bind matrix is identity. The palette is shared with earlier tasks of
+  // the same (skinID, refNodeID).
+  size_t addSkin(uint32_t vertexCount, int skinID, int refNodeID, std::span<const int> jointNodes, std::span<const glm::mat4> inverseBindMatrices);
+
+  // Append a morphed primitive and return its task index.
+  size_t addMorph(uint32_t vertexCount, uint32_t numTargets);
+
+  // Task owning global vertex `vertex`: the last task whose first vertex is <= vertex (the shaders'
+  // binary search). -1 if `vertex` is past totalVertexCount.
+  [[nodiscard]] static int findTask(std::span<const uint32_t> firstVertex, uint32_t totalVertexCount, uint32_t vertex);
+
+  // The tasks flagged in `changed`, repacked back to back (firstVertex rewritten) so a dispatch covers
+  // the changed primitives only. Returns their total vertex count.
+  template <typename Task>
+  static uint32_t selectTasks(std::span<const Task>    tasks,
+                              std::span<const uint8_t> changed,
+                              std::vector<Task>&       selected,
+                              std::vector<uint32_t>&   selectedFirstVertex)
+  {
+    selected.clear();
+    selectedFirstVertex.clear();
+    uint32_t vertexCount = 0;
+    for(size_t i = 0; i < tasks.size() && i < changed.size(); i++)
+    {
+      if(!changed[i])
+        continue;
+      Task task        = tasks[i];
+      task.firstVertex = vertexCount;
+      selected.push_back(task);
+      selectedFirstVertex.push_back(vertexCount);
+      vertexCount += task.vertexCount;
+    }
+    return vertexCount;
+  }
+
+  // Joint matrix (inverse(world[refNode]) * world[jointNode] * IBM) and normal matrix of every palette
+  // entry; invalid nodes give identity.
+  void evaluatePalette(std::span<const glm::mat4> worldMatrices, std::span<glm::mat4> jointMatrices, std::span<glm::mat3> normalMatrices) const;
+
+  std::map<std::pair<int, int>, uint32_t> paletteLookup;  // (skinID, refNodeID) -> first palette entry
+};
+
+}  // namespace nvvkgltf
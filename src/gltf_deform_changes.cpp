@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Change detection of morph weights and joint palettes between frames. See gltf_deform_changes.hpp.
+//
+
+#include "gltf_deform_changes.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nvvkgltf {
+
+namespace {
+
+bool nearlyEqual(const glm::mat4& a, const glm::mat4& b, float tolerance)
+{
+  for(int c = 0; c < 4; c++)
+    for(int r = 0; r < 4; r++)
+    {
+      const float x = a[c][r];
+      const float y = b[c][r];
+      if(std::fabs(x - y) > tolerance * std::max({1.0f, std::fabs(x), std::fabs(y)}))
+        return false;
+    }
+  return true;
+}
+
+}  // namespace
+
+void DeformChangeTracker::reset(size_t morphCount, size_t skinCount)
+{
+  m_morph.assign(morphCount, {});
+  m_skin.assign(skinCount, {});
+}
+
+void DeformChangeTracker::invalidate()
+{
+  for(MorphState& state : m_morph)
+  {
+    state.valid  = false;
+    state.change = Change::eChanged;
+  }
+  for(SkinState& state : m_skin)
+  {
+    state.valid  = false;
+    state.change = Change::eChanged;
+  }
+}
+
+bool DeformChangeTracker::morphInputsChanged(size_t index, std::span<const float> weights) const
+{
+  if(index >= m_morph.size())
+    return true;
+  const MorphState& state = m_morph[index];
+  return !state.valid || !std::equal(weights.begin(), weights.end(), state.weights.begin(), state.weights.end());
+}
+
+bool DeformChangeTracker::skinInputsChanged(size_t index, std::span<const glm::mat4> palette) const
+{
+  if(index >= m_skin.size())
+    return true;
+  const SkinState& state = m_skin[index];
+  if(!state.valid || state.palette.size() != palette.size())
+    return true;
+  for(size_t i = 0; i < palette.size(); i++)
+    if(!nearlyEqual(palette[i], state.palette[i], paletteTolerance))
+      return true;
+  return false;
+}
+
+void DeformChangeTracker::commitMorph(size_t index, std::span<const float> weights, bool changed, uint32_t vertexCount)
+{
+  if(index >= m_morph.size())
+    return;
+  MorphState& state = m_morph[index];
+  if(!changed && state.valid)
+  {
+    state.change = Change::eUnchanged;
+    m_stats.morphUnchanged++;
+    m_stats.verticesSkipped += vertexCount;
+    return;
+  }
+
+  const bool rest = std::all_of(weights.begin(), weights.end(), [](float w) { return w == 0.0f; });
+  state.weights.assign(weights.begin(), weights.end());
+  state.valid  = true;
+  state.change = rest ? Change::eRest : Change::eChanged;
+  (rest ? m_stats.morphAtRest : m_stats.morphEvaluated)++;
+}
+
+void DeformChangeTracker::commitSkin(size_t index, std::span<const glm::mat4> palette, bool changed, uint32_t vertexCount)
+{
+  if(index >= m_skin.size())
+    return;
+  SkinState& state = m_skin[index];
+  if(!changed && state.valid)
+  {
+    state.change = Change::eUnchanged;
+    m_stats.skinUnchanged++;
+    m_stats.verticesSkipped += vertexCount;
+    return;
+  }
+
+  // Keep the palette the output was deformed with: small drifts accumulate against it, not per frame
+  state.palette.assign(palette.begin(), palette.end());
+  state.valid  = true;
+  state.change = Change::eChanged;
+  m_stats.skinEvaluated++;
+}
+
+DeformChangeTracker::Change DeformChangeTracker::morphChange(size_t index) const
+{
+  return index < m_morph.size() ? m_morph[index].change : Change::eChanged;
+}
+
+DeformChangeTracker::Change DeformChangeTracker::skinChange(size_t index) const
+{
+  return index < m_skin.size() ? m_skin[index].change : Change::eChanged;
+}
+
+DeformSkipStats DeformChangeTracker::takeStats()
+{
+  const DeformSkipStats stats = m_stats;
+  m_stats                     = {};
+  return stats;
+}
+
+}  // namespace nvvkgltf
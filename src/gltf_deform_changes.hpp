@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace nvvkgltf {
+
+// Deformation work done and avoided, accumulated until AnimationSystem::takeDeformationStats()
+struct DeformSkipStats
+{
+  uint64_t frames          = 0;  // Frames that evaluated deformation inputs
+  uint64_t morphEvaluated  = 0;  // Morph primitive blends (weights changed)
+  uint64_t morphAtRest     = 0;  // Morph primitives reset to their base geometry (weights became all zero)
+  uint64_t morphUnchanged  = 0;  // Morph primitives skipped, blend and BLAS refit
+  uint64_t skinEvaluated   = 0;  // Skinned primitives transformed
+  uint64_t skinUnchanged   = 0;  // Skinned primitives skipped, skinning and BLAS refit
+  uint64_t verticesSkipped = 0;  // Vertices of the skipped primitives
+};
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::DeformChangeTracker
+
+>  Per-primitive change detection of the deformation inputs: morph weights and joint palettes.
+
+A paused character or an idle loop holding a pose feeds the same weights and joint matrices to
+the deformation every frame. The tracker keeps the inputs each morph primitive and skin task was
+last deformed with; when the new inputs match, the primitive keeps its vertex buffers and BLAS.
+
+- Morph: the weights are compared exactly. All-zero weights report eRest once: the output is the
+  base geometry and no blending is needed.
+- Skin: the palette (joint world matrices relative to the reference node, before the inverse bind
+  matrices) is compared with a relative tolerance, so rigidly moving the whole character does not
+  count as a change.
+
+Callers first ask whether the inputs changed, combine the answers (a primitive that is both morphed
+and skinned is deformed in place by both passes, so either change reruns both), then commit.
+Everything reports eChanged until the first commit and after invalidate().
+
+ -------------------------------------------------------------------------------------------------*/
+class DeformChangeTracker
+{
+public:
+  enum class Change : uint8_t
+  {
+    eChanged,    // Deform with the new inputs
+    eRest,       // Morph weights all zero: the output is the base geometry
+    eUnchanged,  // Same inputs as the last deformation: skip, including the BLAS refit
+  };
+
+  void reset(size_t morphCount, size_t skinCount);  // Resize, everything changed
+  void invalidate();                                // Vertex buffers were rewritten: everything changed
+
+  [[nodiscard]] bool morphInputsChanged(size_t index, std::span<const float> weights) const;
+  [[nodiscard]] bool skinInputsChanged(size_t index, std::span<const glm::mat4> palette) const;
+
+  // Record this frame's decision; `changed` false keeps the stored inputs
+  void commitMorph(size_t index, std::span<const float> weights, bool changed, uint32_t vertexCount);
+  void commitSkin(size_t index, std::span<const glm::mat4> palette, bool changed, uint32_t vertexCount);
+  void countFrame() { m_stats.frames++; }
+
+  [[nodiscard]] Change morphChange(size_t index) const;
+  [[nodiscard]] Change skinChange(size_t index) const;
+  [[nodiscard]] bool   morphChanged(size_t index) const { return morphChange(index) != Change::eUnchanged; }
+  [[nodiscard]] bool   skinChanged(size_t index) const { return skinChange(index) != Change::eUnchanged; }
+
+  [[nodiscard]] const DeformSkipStats& stats() const { return m_stats; }
+  DeformSkipStats                      takeStats();  // Return and restart the accumulation
+
+  float paletteTolerance = 1e-6f;  // Relative, per matrix element
+
+private:
+  struct MorphState
+  {
+    std::vector<float> weights;
+    bool               valid  = false;
+    Change             change = Change::eChanged;
+  };
+  struct SkinState
+  {
+    std::vector<glm::mat4> palette;
+    bool                   valid  = false;
+    Change                 change = Change::eChanged;
+  };
+
+  std::vector<MorphState> m_morph;
+  std::vector<SkinState>  m_skin;
+  DeformSkipStats         m_stats;
+};
+
+}  // namespace nvvkgltf
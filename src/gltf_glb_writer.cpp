@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// GLB writer streaming the buffers straight from the model to disk. See gltf_glb_writer.hpp.
+//
+
+#include "gltf_glb_writer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include <tinygltf/json.hpp>
+#include <tinygltf/tiny_gltf.h>
+
+#include "tinygltf_utils.hpp"
+
+namespace fs = std::filesystem;
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr uint32_t kGlbMagic      = 0x46546C67;  // "glTF"
+constexpr uint32_t kGlbVersion    = 2;
+constexpr uint32_t kChunkTypeJson = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kChunkTypeBin  = 0x004E4942;  // "BIN\0"
+constexpr uint64_t kGlbHeaderSize = 12;
+constexpr uint64_t kChunkHeader   = 8;
+constexpr uint64_t kGlbMaxSize    = 0xFFFFFFFFull;  // GLB lengths are uint32
+
+uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// GLB is little-endian, as are all the platforms the renderer runs on
+void writeU32(std::ofstream& out, uint32_t value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writePadding(std::ofstream& out, uint64_t count, char value)
+{
+  std::array<char, kGlbBufferAlignment> padding;
+  padding.fill(value);
+  while(count > 0)
+  {
+    const uint64_t n = std::min<uint64_t>(count, padding.size());
+    out.write(padding.data(), static_cast<std::streamsize>(n));
+    count -= n;
+  }
+}
+
+// The meshopt extension of a buffer view, if any
+tinygltf::Value* findMeshoptExtension(tinygltf::BufferView& view)
+{
+  for(const char* name : {KHR_MESHOPT_COMPRESSION_EXTENSION_NAME, EXT_MESHOPT_COMPRESSION_EXTENSION_NAME})
+  {
+    auto it = view.extensions.find(name);
+    if(it != view.extensions.end() && it->second.IsObject())
+      return &it->second;
+  }
+  return nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+// The JSON chunk, serialized by tinygltf from the model with its buffers replaced by a single empty
+// one (plus the meshopt fallback buffers) and the buffer views rebased on it. The buffers are moved
+// out and back, so no payload is copied; only the JSON text is built in memory. tinygltf embeds the
+// (empty) buffers as data URIs, which are replaced by their byte lengths.
+bool serializeJsonChunk(tinygltf::Model& model, const GlbBinLayout& layout, std::string& json, std::string* error)
+{
+  std::vector<tinygltf::Buffer>     buffers = std::move(model.buffers);
+  std::vector<tinygltf::BufferView> views   = model.bufferViews;
+
+  const auto rebase = [&](int& buffer, size_t& byteOffset) {
+    if(buffer < 0 || size_t(buffer) >= buffers.size())
+      return;
+    byteOffset += static_cast<size_t>(layout.bufferOffsets[buffer]);
+    buffer = layout.bufferIndices[buffer];
+  };
+  for(tinygltf::BufferView& view : model.bufferViews)
+  {
+    rebase(view.buffer, view.byteOffset);
+    if(tinygltf::Value* ext = findMeshoptExtension(view))
+    {
+      int    buffer     = ext->Has("buffer") ? ext->Get("buffer").GetNumberAsInt() : -1;
+      size_t byteOffset = ext->Has("byteOffset") ? size_t(ext->Get("byteOffset").GetNumberAsDouble()) : 0;
+      rebase(buffer, byteOffset);
+      auto& object     = ext->Get<tinygltf::Value::Object>();
+      object["buffer"] = tinygltf::Value(buffer);
+      // The BIN chunk can reach 4 GiB: offsets past INT_MAX are written as (exact) doubles
+      object["byteOffset"] = byteOffset <= size_t(std::numeric_limits<int>::max()) ? tinygltf::Value(static_cast<int>(byteOffset)) :
+                                                                                     tinygltf::Value(static_cast<double>(byteOffset));
+    }
+  }
+  model.buffers.clear();
+  std::vector<uint64_t> fallbackLengths;
+  if(!buffers.empty())
+  {
+    tinygltf::Buffer merged;
+    merged.name       = buffers[0].name;
+    merged.extras     = buffers[0].extras;
+    merged.extensions = buffers[0].extensions;
+    model.buffers.push_back(std::move(merged));
+  }
+  for(size_t i = 0; i < buffers.size(); i++)
+  {
+    if(layout.bufferIndices[i] == 0)
+      continue;  // Merged in the BIN chunk
+    const tinygltf::Buffer& buffer = buffers[i];
+    tinygltf::Buffer        fallback;
+    fallback.name       = buffer.name;
+    fallback.extras     = buffer.extras;
+    fallback.extensions = buffer.extensions;
+    model.buffers.push_back(std::move(fallback));
+    fallbackLengths.push_back(buffer.byteLength);
+  }
+
+  std::ostringstream stream;
+  tinygltf::TinyGLTF tcontext;
+  const bool         serialized = tcontext.WriteGltfSceneToStream(&model, stream, false, false);
+
+  model.buffers     = std::move(buffers);
+  model.bufferViews = std::move(views);
+
+  if(!serialized)
+  {
+    if(error)
+      *error = "glTF serialization failed";
+    return false;
+  }
+
+  nlohmann::json doc = nlohmann::json::parse(stream.str(), nullptr, false);
+  if(doc.is_discarded())
+  {
+    if(error)
+      *error = "invalid glTF JSON";
+    return false;
+  }
+  if(auto it = doc.find("buffers"); it != doc.end() && it->is_array() && !it->empty())
+  {
+    for(size_t i = 0; i < it->size(); i++)
+    {
+      nlohmann::json& buffer = (*it)[i];
+      buffer.erase("uri");
+      buffer["byteLength"] = i == 0 ? layout.dataSize : fallbackLengths[i - 1];
+    }
+  }
+  json = doc.dump();
+  return true;
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Buffers back to back, each start aligned so the accessor alignment within a buffer is kept
+GlbBinLayout planGlbBinChunk(const tinygltf::Model& model)
+{
+  GlbBinLayout layout;
+  layout.bufferOffsets.reserve(model.buffers.size());
+  layout.bufferIndices.reserve(model.buffers.size());
+  uint64_t offset    = 0;
+  int      fallbacks = 0;
+  for(const tinygltf::Buffer& buffer : model.buffers)
+  {
+    if(isMeshoptFallbackBuffer(buffer))
+    {
+      layout.bufferOffsets.push_back(0);
+      layout.bufferIndices.push_back(++fallbacks);
+      continue;
+    }
+    offset = alignUp(offset, kGlbBufferAlignment);
+    layout.bufferOffsets.push_back(offset);
+    layout.bufferIndices.push_back(0);
+    offset += buffer.data.size();
+  }
+  layout.dataSize  = offset;
+  layout.chunkSize = alignUp(offset, 4);
+  return layout;
+}
+
+bool isMeshoptFallbackBuffer(const tinygltf::Buffer& buffer)
+{
+  if(!buffer.data.empty())
+    return false;
+  for(const char* name : {KHR_MESHOPT_COMPRESSION_EXTENSION_NAME, EXT_MESHOPT_COMPRESSION_EXTENSION_NAME})
+  {
+    auto it = buffer.extensions.find(name);
+    if(it != buffer.extensions.end() && it->second.Has("fallback") && it->second.Get("fallback").IsBool()
+       && it->second.Get("fallback").Get<bool>())
+      return true;
+  }
+  return false;
+}
+
+bool canStreamGlb(const tinygltf::Model& model)
+{
+  if(model.buffers.size() <= 1)
+    return true;
+  // Extensions may hold their own buffer indices/offsets, which the merge into a single buffer
+  // would not rebase. Meshopt views naming a valid source buffer are rebased like the views.
+  for(const tinygltf::BufferView& view : model.bufferViews)
+  {
+    for(const auto& [name, value] : view.extensions)
+    {
+      if(name != KHR_MESHOPT_COMPRESSION_EXTENSION_NAME && name != EXT_MESHOPT_COMPRESSION_EXTENSION_NAME)
+        return false;
+      const int buffer = value.Has("buffer") ? value.Get("buffer").GetNumberAsInt() : -1;
+      if(buffer < 0 || size_t(buffer) >= model.buffers.size())
+        return false;
+    }
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Header, JSON chunk, then the BIN chunk written buffer by buffer. Nothing but the JSON text and a
+// few bytes of padding is allocated, whatever the size of the buffers.
+bool writeGlbStreamed(tinygltf::Model& model, const fs::path& filename, std::string* error, const tinygltf::Model* payloads)
+{
+  const tinygltf::Model& source = payloads ? *payloads : model;
+  if(source.buffers.size() != model.buffers.size())
+  {
+    if(error)
+      *error = "buffer data does not match the model";
+    return false;
+  }
+  const GlbBinLayout layout = planGlbBinChunk(source);
+
+  std::string json;
+  if(!serializeJsonChunk(model, layout, json, error))
+    return false;
+
+  const uint64_t jsonChunkSize = alignUp(json.size(), 4);
+  const uint64_t totalSize =
+      kGlbHeaderSize + kChunkHeader + jsonChunkSize + (layout.chunkSize > 0 ? kChunkHeader + layout.chunkSize : 0);
+  if(totalSize > kGlbMaxSize)
+  {
+    if(error)
+      *error = "scene exceeds the 4 GiB limit of GLB files";
+    return false;
+  }
+
+  fs::path temp = filename;
+  temp += ".tmp";
+  {
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    if(!out)
+    {
+      if(error)
+        *error = "cannot open " + temp.string();
+      return false;
+    }
+
+    writeU32(out, kGlbMagic);
+    writeU32(out, kGlbVersion);
+    writeU32(out, static_cast<uint32_t>(totalSize));
+
+    writeU32(out, static_cast<uint32_t>(jsonChunkSize));
+    writeU32(out, kChunkTypeJson);
+    out.write(json.data(), static_cast<std::streamsize>(json.size()));
+    writePadding(out, jsonChunkSize - json.size(), ' ');
+
+    if(layout.chunkSize > 0)
+    {
+      writeU32(out, static_cast<uint32_t>(layout.chunkSize));
+      writeU32(out, kChunkTypeBin);
+      uint64_t position = 0;
+      for(size_t i = 0; i < model.buffers.size(); i++)
+      {
+        if(layout.bufferIndices[i] != 0)
+          continue;  // Meshopt fallback: no data in the file
+        const std::vector<unsigned char>& data = source.buffers[i].data;
+        writePadding(out, layout.bufferOffsets[i] - position, 0);
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        position = layout.bufferOffsets[i] + data.size();
+      }
+      writePadding(out, layout.chunkSize - position, 0);
+    }
+
+    out.flush();
+    if(!out)
+    {
+      if(error)
+        *error = "write error on " + temp.string();
+      out.close();
+      std::error_code ignored;
+      fs::remove(temp, ignored);
+      return false;
+    }
+  }
+
+  std::error_code ec;
+  fs::rename(temp, filename, ec);
+  if(ec)
+  {
+    if(error)
+      *error = ec.message();
+    fs::remove(temp, ec);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace tinygltf {
+class Model;
+struct Buffer;
+}
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# Streaming GLB writer
+
+>  Writes a .glb without assembling the binary chunk in memory.
+
+tinygltf's WriteGltfSceneToFile copies buffer 0 into a BIN vector and then builds the whole file
+before writing it. Saving a large scene therefore needs about twice its size in memory. This
+writer works in three steps:
+- The JSON chunk is serialized by tinygltf, with the buffer payloads moved out of the model. Only
+  the JSON is held in memory.
+- The BIN chunk layout (planGlbBinChunk) is computed from the buffer sizes, so every chunk length
+  is known before the first byte is written.
+- The header, the JSON chunk and then each buffer are written straight from the model to disk,
+  with the spec padding (spaces after the JSON, zeros in the BIN chunk).
+
+A GLB has a single BIN chunk. All buffers are placed in it one after another, each start aligned
+to kGlbBufferAlignment, and the buffer views are rebased to buffer 0. The written file therefore
+has one buffer (with the name and extras of the first one). External .bin references and base64
+data URIs are not kept, because their content is embedded.
+
+EXT/KHR_meshopt_compression fallback buffers (no data, only a byteLength) are the exception: they
+stay separate buffers after the merged one, and the compressed source of each meshopt buffer view
+is rebased in the merged buffer like the view itself.
+
+The file is written to "<name>.tmp" and renamed once complete.
+
+ -------------------------------------------------------------------------------------------------*/
+
+constexpr uint64_t kGlbBufferAlignment = 16;  // Start of each merged buffer in the BIN chunk
+
+struct GlbBinLayout
+{
+  std::vector<uint64_t> bufferOffsets;  // Per model buffer: byte offset in the BIN chunk (0 for fallback buffers)
+  std::vector<int>      bufferIndices;  // Per model buffer: index in the written file (0: merged in the BIN chunk)
+  uint64_t              dataSize  = 0;  // Bytes of buffer data, including alignment gaps
+  uint64_t              chunkSize = 0;  // dataSize padded to 4 bytes (0: no BIN chunk)
+};
+
+// Where each buffer of `model` goes in the BIN chunk
+[[nodiscard]] GlbBinLayout planGlbBinChunk(const tinygltf::Model& model);
+
+// Meshopt fallback buffer: no data of its own, filled by decoding the views that reference it
+[[nodiscard]] bool isMeshoptFallbackBuffer(const tinygltf::Buffer& buffer);
+
+// False if the streaming writer can't represent `model` (buffer views with extensions other than
+// EXT/KHR_meshopt_compression when there are several buffers); use tinygltf then
+[[nodiscard]] bool canStreamGlb(const tinygltf::Model& model);
+
+// Write `model` as a .glb. The model is modified while the JSON is serialized and restored before
+// returning. Fails (error set) if the file would exceed the 4 GiB GLB limit. The buffer data is
+// read from `payloads` when given (same buffers as `model`, which may have none).
+bool writeGlbStreamed(tinygltf::Model&             model,
+                      const std::filesystem::path& filename,
+                      std::string*                 error    = nullptr,
+                      const tinygltf::Model*       payloads = nullptr);
+
+}  // namespace nvvkgltf
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Image copy of Scene::save: serial planning, parallel content-checked copies. See gltf_image_export.hpp.
+//
+
+#include "gltf_image_export.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <tinygltf/tiny_gltf.h>
+
+#include <nvutils/file_operations.hpp>
+
+#include "task_scheduler.hpp"
+
+namespace fs = std::filesystem;
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime  = 1099511628211ull;
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Same decisions, in the same image order, as the former serial copy loop of Scene::save, so the
+// saved URIs do not depend on how the copies run.
+ImageExportPlan planImageExport(const tinygltf::Model& model, std::span<const fs::path> searchPaths, const fs::path& dstDir)
+{
+  ImageExportPlan plan;
+  plan.uris.resize(model.images.size());
+  plan.copyJob.assign(model.images.size(), -1);
+
+  const std::vector<fs::path>     paths(searchPaths.begin(), searchPaths.end());
+  std::unordered_set<std::string> usedRelativeNames;
+  // Deduplicate by resolved source file: multiple image entries that point at the same file on
+  // disk (e.g. one texture shared by several materials, or reused across a merged scene) share a
+  // single destination URI instead of being copied once per entry.
+  struct Decision
+  {
+    std::string uri;
+    int         copyJob = -1;
+  };
+  std::unordered_map<std::string, Decision> bySource;
+
+  for(size_t i = 0; i < model.images.size(); i++)
+  {
+    const tinygltf::Image& image = model.images[i];
+    if(image.uri.empty())
+      continue;
+    if(image.uri.size() >= 5 && image.uri.compare(0, 5, "data:") == 0)
+      continue;  // data URI: no file to copy
+    std::string uriDecoded;
+    tinygltf::URIDecode(image.uri, &uriDecoded, nullptr);
+    const fs::path pathDecoded = nvutils::pathFromUtf8(uriDecoded);
+    const fs::path srcFile     = nvutils::findFile(pathDecoded, paths, false);
+    if(srcFile.empty())
+      continue;
+
+    // Key on the canonical path, falling back to the located path if canonicalization fails -- the
+    // key is then always non-empty and stable for that file.
+    std::error_code   ec;
+    const fs::path    canonical = fs::weakly_canonical(srcFile, ec);
+    const std::string srcKey    = (ec ? srcFile : canonical).generic_string();
+
+    if(auto it = bySource.find(srcKey); it != bySource.end())
+    {
+      plan.uris[i]    = it->second.uri;
+      plan.copyJob[i] = it->second.copyJob;
+      continue;
+    }
+
+    // If the source already resolves to where the current URI points relative to the destination,
+    // leave it in place (no copy, URI unchanged) and reserve its relative name so a later copy
+    // cannot target the same path and overwrite it. An absolute URI is never kept: it would write
+    // a non-portable path, so it falls through to be copied and rewritten relative.
+    const fs::path naturalDst = dstDir / pathDecoded;
+    if(!pathDecoded.is_absolute() && fs::exists(naturalDst, ec) && fs::equivalent(srcFile, naturalDst, ec))
+    {
+      usedRelativeNames.insert(pathDecoded.generic_string());
+      bySource.emplace(srcKey, Decision{image.uri, -1});
+      plan.uris[i] = image.uri;
+      continue;
+    }
+
+    const std::string name      = pathDecoded.filename().string();
+    const std::string base      = pathDecoded.stem().string();
+    const std::string ext       = pathDecoded.extension().string();
+    std::string       candidate = "images/" + name;
+    int               suffix    = 0;
+    while(usedRelativeNames.count(candidate))
+      candidate = "images/" + base + "_" + std::to_string(++suffix) + ext;
+    usedRelativeNames.insert(candidate);
+
+    const fs::path dstRelative = fs::path(candidate);
+    const fs::path dstFile     = dstDir / dstRelative;
+    Decision       decision{dstRelative.generic_string(), -1};  // forward slashes for glTF
+    if(srcFile != dstFile)
+    {
+      decision.copyJob = static_cast<int>(plan.copies.size());
+      plan.copies.push_back({srcFile, dstFile});
+    }
+    plan.uris[i]    = decision.uri;
+    plan.copyJob[i] = decision.copyJob;
+    bySource.emplace(srcKey, std::move(decision));
+  }
+  return plan;
+}
+
+//--------------------------------------------------------------------------------------------------
+// A parallelFor on the shared scheduler; the calling thread works too. Destination folders are
+// created up front so the workers only copy.
+ImageCopyStats copyImages(std::span<const ImageCopyJob> jobs, uint32_t maxConcurrency, std::vector<ImageCopyOutcome>* outcomes, const ImageCopyControl& control)
+{
+  std::vector<ImageCopyOutcome> results(jobs.size(), ImageCopyOutcome::eFailed);
+
+  std::set<fs::path> folders;
+  for(const ImageCopyJob& job : jobs)
+    folders.insert(job.destination.parent_path());
+  for(const fs::path& folder : folders)
+  {
+    std::error_code ec;
+    fs::create_directories(folder, ec);
+  }
+
+  // One copy per batch: files differ widely in size
+  TaskScheduler::shared().parallelFor<1>(
+      jobs.size(),
+      [&](uint64_t i) {
+        if(control.cancel && control.cancel->load())
+          return;
+        results[i] = copyFileIfChanged(jobs[i].source, jobs[i].destination);
+        if(control.completed)
+          ++*control.completed;
+      },
+      currentTaskPriority(), maxConcurrency);
+
+  ImageCopyStats stats;
+  for(ImageCopyOutcome outcome : results)
+  {
+    switch(outcome)
+    {
+      case ImageCopyOutcome::eCopied:
+        stats.copied++;
+        break;
+      case ImageCopyOutcome::eReused:
+        stats.reused++;
+        break;
+      case ImageCopyOutcome::eFailed:
+        stats.failed++;
+        break;
+    }
+  }
+  if(outcomes)
+    *outcomes = std::move(results);
+  return stats;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Size first (cheap), then the content of both files. The temporary name is unique per
+// destination, and destinations are unique within a save, so concurrent jobs never share one.
+ImageCopyOutcome copyFileIfChanged(const fs::path& source, const fs::path& destination, std::string* error)
+{
+  std::error_code ec;
+  const uintmax_t srcSize = fs::file_size(source, ec);
+  if(ec)
+  {
+    if(error)
+      *error = ec.message();
+    return ImageCopyOutcome::eFailed;
+  }
+
+  const uintmax_t dstSize = fs::file_size(destination, ec);
+  if(!ec && dstSize == srcSize && sameFileContent(source, destination))
+    return ImageCopyOutcome::eReused;
+
+  fs::path temp = destination;
+  temp += ".tmp";
+  fs::copy_file(source, temp, fs::copy_options::overwrite_existing, ec);
+  if(!ec)
+    fs::rename(temp, destination, ec);
+  if(ec)
+  {
+    if(error)
+      *error = ec.message();
+    std::error_code ignored;
+    fs::remove(temp, ignored);
+    return ImageCopyOutcome::eFailed;
+  }
+  return ImageCopyOutcome::eCopied;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Both files read chunk by chunk, side by side: a changed image is usually told apart in the first
+// chunk, and an equal one costs a single pass over each file.
+bool sameFileContent(const fs::path& a, const fs::path& b)
+{
+  std::ifstream fileA(a, std::ios::binary);
+  std::ifstream fileB(b, std::ios::binary);
+  if(!fileA || !fileB)
+    return false;
+
+  std::vector<char> chunkA(1 << 16);
+  std::vector<char> chunkB(chunkA.size());
+  while(fileA && fileB)
+  {
+    fileA.read(chunkA.data(), static_cast<std::streamsize>(chunkA.size()));
+    fileB.read(chunkB.data(), static_cast<std::streamsize>(chunkB.size()));
+    const std::streamsize count = fileA.gcount();
+    if(count != fileB.gcount() || !std::equal(chunkA.begin(), chunkA.begin() + count, chunkB.begin()))
+      return false;
+  }
+  return !fileA.bad() && !fileB.bad() && fileA.eof() && fileB.eof();
+}
+
+bool hashFileContent(const fs::path& path, uint64_t& hash)
+{
+  std::ifstream file(path, std::ios::binary);
+  if(!file)
+    return false;
+
+  hash = kFnvOffset;
+  std::vector<char> chunk(1 << 16);
+  while(file)
+  {
+    file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    const std::streamsize count = file.gcount();
+    for(std::streamsize i = 0; i < count; i++)
+      hash = (hash ^ static_cast<uint8_t>(chunk[i])) * kFnvPrime;
+  }
+  return !file.bad();
+}
+
+}  // namespace nvvkgltf
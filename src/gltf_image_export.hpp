@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace tinygltf {
+class Model;
+}
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# Image export for Scene::save
+
+>  Copies the image files a .gltf references next to the saved file, in two steps.
+
+Planning (planImageExport) is serial and only looks at paths: it resolves each image URI with the
+load search paths, deduplicates entries that point at the same file, keeps images that already
+resolve next to the destination, and names the others "images/<name>[_N].<ext>" in image order.
+The plan is therefore identical however the copies are executed.
+
+Copying (copyImages) is pure file I/O and runs on a bounded number of threads. Each copy:
+- is skipped when the destination already holds the same content (size, then a byte comparison), so
+  saving again into the same folder rewrites nothing;
+- otherwise goes to a temporary file next to the destination, renamed over it once complete, so
+  an interrupted save never leaves a truncated image behind.
+
+Images embedded in the model (data URIs, buffer views) are left to the glTF writer.
+
+ -------------------------------------------------------------------------------------------------*/
+
+struct ImageCopyJob
+{
+  std::filesystem::path source;
+  std::filesystem::path destination;
+};
+
+struct ImageExportPlan
+{
+  std::vector<std::string>  uris;     // Per model image: URI to write, empty keeps the current one
+  std::vector<int>          copyJob;  // Per model image: index in `copies` the URI depends on, or -1
+  std::vector<ImageCopyJob> copies;   // One per distinct source file that must be copied
+};
+
+enum class ImageCopyOutcome : uint8_t
+{
+  eCopied,  // Destination written
+  eReused,  // Destination already had the same content
+  eFailed,
+};
+
+struct ImageCopyStats
+{
+  uint32_t copied = 0;
+  uint32_t reused = 0;
+  uint32_t failed = 0;
+};
+
+// Decide the URI of every image of `model` saved into `dstDir` (see above)
+[[nodiscard]] ImageExportPlan planImageExport(const tinygltf::Model&                 model,
+                                              std::span<const std::filesystem::path> searchPaths,
+                                              const std::filesystem::path&           dstDir);
+
+// Optional hooks of copyImages(), shared with the thread that started it
+struct ImageCopyControl
+{
+  const std::atomic<bool>* cancel    = nullptr;  // Set: jobs not started yet are skipped (eFailed)
+  std::atomic<uint32_t>*   completed = nullptr;  // Incremented after each job
+};
+
+// Run the copies on up to maxConcurrency threads, the caller included (0: every scheduler worker). outcomes, if not null,
+// receives one entry per job.
+ImageCopyStats copyImages(std::span<const ImageCopyJob>  jobs,
+                          uint32_t                       maxConcurrency = 0,
+                          std::vector<ImageCopyOutcome>* outcomes       = nullptr,
+                          const ImageCopyControl&        control        = {});
+
+// Copy one file through a temporary file, unless the destination already has the same content
+ImageCopyOutcome copyFileIfChanged(const std::filesystem::path& source, const std::filesystem::path& destination, std::string* error = nullptr);
+
+// True if both files can be read and hold the same bytes; stops at the first differing chunk
+[[nodiscard]] bool sameFileContent(const std::filesystem::path& a, const std::filesystem::path& b);
+
+// 64-bit FNV-1a of the file content; false if the file can't be read
+bool hashFileContent(const std::filesystem::path& path, uint64_t& hash);
+
+}  // namespace nvvkgltf
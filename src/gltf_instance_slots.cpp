@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// TLAS instance slot policy: capacity headroom, compaction threshold. See gltf_instance_slots.hpp.
+//
+
+#include "gltf_instance_slots.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nvvkgltf {
+
+uint32_t InstanceSlotAllocator::capacityFor(uint32_t count) const
+{
+  const auto grown = static_cast<uint32_t>(std::ceil(double(count) * double(std::max(m_policy.growthFactor, 1.0f))));
+  return std::max({grown, count, m_policy.minCapacity});
+}
+
+float InstanceSlotAllocator::fragmentation() const
+{
+  return m_capacity == 0 ? 0.0f : float(parkedCount()) / float(capacity());
+}
+
+bool InstanceSlotAllocator::needsCompaction() const
+{
+  // Below the minimum capacity there is nothing to give back
+  return capacity() > m_policy.minCapacity && capacityFor(m_activeCount) < capacity()
+         && fragmentation() > m_policy.compactThreshold;
+}
+
+void InstanceSlotAllocator::clear()
+{
+  m_capacity    = 0;
+  m_activeCount = 0;
+}
+
+void InstanceSlotAllocator::reset(uint32_t count)
+{
+  m_capacity    = capacityFor(count);
+  m_activeCount = count;
+}
+
+InstanceSlotAllocator::Change InstanceSlotAllocator::resize(uint32_t count)
+{
+  if(count > capacity())
+  {
+    reset(count);
+    return Change::eReallocate;
+  }
+
+  m_activeCount = count;
+  if(needsCompaction())
+  {
+    reset(count);  // Active slots are always packed: compaction only shrinks the capacity
+    return Change::eReallocate;
+  }
+  return Change::eInPlace;
+}
+
+}  // namespace nvvkgltf
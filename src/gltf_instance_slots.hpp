@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/*
+ * InstanceSlotAllocator - Slot policy for the TLAS instance buffer
+ *
+ * The instance buffer and the TLAS are sized for capacity() slots, with headroom over the number
+ * of active instances. SceneRtx keys the slots by render node id, so the active slots are always
+ * [0, activeCount()); the slots past them are parked (the instance is written inactive: mask 0, no
+ * BLAS). Adding and removing render nodes therefore reallocates nothing until the capacity is
+ * exceeded, or until parked slots make up more than the compaction threshold, at which point the
+ * capacity shrinks back to the headroom of the active count.
+ *
+ * Pure CPU bookkeeping: SceneRtx decides from the returned Change what to write and whether the
+ * TLAS must be recreated.
+ */
+
+#include <cstdint>
+
+namespace nvvkgltf {
+
+class InstanceSlotAllocator
+{
+public:
+  struct Policy
+  {
+    float    growthFactor     = 1.5f;  // Capacity = active * growthFactor when (re)allocating
+    uint32_t minCapacity      = 64;    // Never allocate fewer slots than this
+    float    compactThreshold = 0.5f;  // Compact when parked slots exceed this fraction of the capacity
+  };
+
+  // What a resize() did to the storage.
+  enum class Change
+  {
+    eInPlace,     // Capacity unchanged: write the changed slots and rebuild the TLAS in place
+    eReallocate,  // Capacity changed (grown, or shrunk by compaction): recreate buffer and TLAS
+  };
+
+  InstanceSlotAllocator() = default;
+  explicit InstanceSlotAllocator(const Policy& policy)
+      : m_policy(policy)
+  {
+  }
+
+  // Slots [0, count) active, the rest of a fresh capacity parked.
+  void reset(uint32_t count);
+  void clear();
+
+  // Make exactly the slots [0, count) active. Grows when count exceeds the capacity, compacts when
+  // too many slots are parked afterwards.
+  Change resize(uint32_t count);
+
+  [[nodiscard]] uint32_t capacity() const { return m_capacity; }
+  [[nodiscard]] uint32_t activeCount() const { return m_activeCount; }
+  [[nodiscard]] uint32_t parkedCount() const { return m_capacity - m_activeCount; }
+  [[nodiscard]] bool     isActive(uint32_t slot) const { return slot < m_activeCount; }
+  [[nodiscard]] float    fragmentation() const;  // Parked fraction of the capacity
+  [[nodiscard]] bool     needsCompaction() const;
+  [[nodiscard]] uint32_t capacityFor(uint32_t count) const;
+
+private:
+  Policy   m_policy;
+  uint32_t m_capacity    = 0;
+  uint32_t m_activeCount = 0;
+};
+
+}  // namespace nvvkgltf
@@ -32,6 +32,7 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "nvutils/logger.hpp"
+#include "host_memory_tracker.hpp"
 #include "tinygltf_utils.hpp"
 
 // Layout guardrails for the GPU material struct. These must hold regardless of which
@@ -288,4 +289,9 @@ void MaterialCache::clear()
   m_textureInfos.clear();
 }
 
+uint64_t MaterialCache::sizeInBytes() const
+{
+  return containerBytes(m_shadeMaterials) + containerBytes(m_textureInfos);
+}
+
 }  // namespace nvvkgltf
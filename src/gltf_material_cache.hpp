@@ -73,6 +73,8 @@ public:
 
   void clear();
 
+  [[nodiscard]] uint64_t sizeInBytes() const;  // Heap size of the cached materials and texture infos
+
   const std::vector<shaderio::GltfShadeMaterial>& getShadeMaterials() const { return m_shadeMaterials; }
   const std::vector<shaderio::GltfTextureInfo>&   getTextureInfos() const { return m_textureInfos; }
 
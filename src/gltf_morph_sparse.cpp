@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Sparse morph target storage: compaction at load, target-major CPU blend and the vertex-major
+// layout of the compute shader. See gltf_morph_sparse.hpp.
+//
+
+#include "gltf_morph_sparse.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <tinygltf/tiny_gltf.h>
+
+#include "tinygltf_utils.hpp"
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr uint32_t kNoIndex = std::numeric_limits<uint32_t>::max();
+
+uint32_t nextIndex(const SparseMorphTargets::Deltas& deltas, size_t cursor)
+{
+  return cursor < deltas.indices.size() ? deltas.indices[cursor] : kNoIndex;
+}
+
+// Deltas of one target attribute. Sparse-only float accessors keep their (index, value) pairs;
+// everything else (dense, sparse on top of a buffer view, quantized) is decoded and compacted.
+SparseMorphTargets::Deltas readDeltas(const tinygltf::Model& model, int accessorIndex, uint32_t vertexCount)
+{
+  if(accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size()))
+    return {};
+  const tinygltf::Accessor& accessor = model.accessors[accessorIndex];
+  if(accessor.count != vertexCount)
+    return {};
+
+  if(accessor.bufferView < 0 && accessor.sparse.isSparse && accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT
+     && accessor.type == TINYGLTF_TYPE_VEC3)
+  {
+    SparseMorphTargets::Deltas deltas;
+    deltas.indices.reserve(accessor.sparse.count);
+    deltas.values.reserve(accessor.sparse.count);
+    tinygltf::utils::forEachSparseValue<glm::vec3>(model, accessor, 0, accessor.count, [&](size_t index, const glm::vec3* value) {
+      deltas.indices.push_back(static_cast<uint32_t>(index));
+      deltas.values.push_back(*value);
+    });
+    return deltas;
+  }
+
+  std::vector<glm::vec3> temp;
+  return SparseMorphTargets::compact(tinygltf::utils::getAccessorData(model, accessor, &temp));
+}
+
+}  // namespace
+
+void SparseMorphTargets::clear()
+{
+  vertexCount = 0;
+  targets.clear();
+}
+
+SparseMorphTargets::Deltas SparseMorphTargets::compact(std::span<const glm::vec3> dense)
+{
+  Deltas deltas;
+  for(size_t v = 0; v < dense.size(); v++)
+  {
+    if(dense[v] == glm::vec3(0.0f))
+      continue;
+    deltas.indices.push_back(static_cast<uint32_t>(v));
+    deltas.values.push_back(dense[v]);
+  }
+  return deltas;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Merge the three ascending index lists into one entry per touched vertex.
+void SparseMorphTargets::addTarget(const Deltas& positions, const Deltas& normals, const Deltas& tangents)
+{
+  Target target;
+  bool   anyNormal  = false;
+  bool   anyTangent = false;
+  size_t p = 0, n = 0, t = 0;
+  while(true)
+  {
+    const uint32_t v = std::min({nextIndex(positions, p), nextIndex(normals, n), nextIndex(tangents, t)});
+    if(v == kNoIndex || v >= vertexCount)
+      break;  // Indices are ascending: the rest is out of range too
+
+    glm::vec3 pos(0.0f), nrm(0.0f), tan(0.0f);
+    if(nextIndex(positions, p) == v)
+      pos = positions.values[p++];
+    if(nextIndex(normals, n) == v)
+      nrm = normals.values[n++];
+    if(nextIndex(tangents, t) == v)
+      tan = tangents.values[t++];
+    if(pos == glm::vec3(0.0f) && nrm == glm::vec3(0.0f) && tan == glm::vec3(0.0f))
+      continue;
+
+    anyNormal |= nrm != glm::vec3(0.0f);
+    anyTangent |= tan != glm::vec3(0.0f);
+    target.indices.push_back(v);
+    target.positions.push_back(pos);
+    target.normals.push_back(nrm);
+    target.tangents.push_back(tan);
+  }
+
+  if(!anyNormal)
+    target.normals = {};
+  if(!anyTangent)
+    target.tangents = {};
+  targets.push_back(std::move(target));
+}
+
+void SparseMorphTargets::addTarget(const tinygltf::Model& model, int positionAccessor, int normalAccessor, int tangentAccessor)
+{
+  addTarget(readDeltas(model, positionAccessor, vertexCount), readDeltas(model, normalAccessor, vertexCount),
+            readDeltas(model, tangentAccessor, vertexCount));
+}
+
+//--------------------------------------------------------------------------------------------------
+// Scatter each active target over the vertices it touches. Targets are visited in order, so the
+// per-vertex accumulation order matches VertexMajor::apply().
+void SparseMorphTargets::apply(std::span<const float> weights,
+                               std::span<glm::vec3>   positions,
+                               std::span<glm::vec3>   normals,
+                               std::span<glm::vec4>   tangents) const
+{
+  const size_t count = std::min(weights.size(), targets.size());
+  for(size_t ti = 0; ti < count; ti++)
+  {
+    const float weight = weights[ti];
+    if(weight == 0.0f)
+      continue;
+
+    const Target& target = targets[ti];
+    for(size_t e = 0; e < target.indices.size(); e++)
+    {
+      const uint32_t v = target.indices[e];
+      if(v < positions.size())
+        positions[v] += weight * target.positions[e];
+      if(!target.normals.empty() && v < normals.size())
+        normals[v] += weight * target.normals[e];
+      if(!target.tangents.empty() && v < tangents.size())
+        tangents[v] = glm::vec4(glm::vec3(tangents[v]) + weight * target.tangents[e], tangents[v].w);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Transpose to CSR: count entries per vertex, prefix-sum, then fill in target order.
+SparseMorphTargets::VertexMajor SparseMorphTargets::toVertexMajor(uint32_t numTargets, bool withNormals, bool withTangents) const
+{
+  const size_t targetCount = std::min<size_t>(numTargets, targets.size());
+  withNormals &= hasNormals();
+  withTangents &= hasTangents();
+
+  VertexMajor result;
+  result.rowStart.assign(size_t(vertexCount) + 1, 0);
+  for(size_t ti = 0; ti < targetCount; ti++)
+    for(uint32_t v : targets[ti].indices)
+      result.rowStart[v + 1]++;
+  for(uint32_t v = 0; v < vertexCount; v++)
+    result.rowStart[v + 1] += result.rowStart[v];
+
+  const size_t entryCount = result.rowStart.back();
+  result.targets.resize(entryCount);
+  result.positions.resize(entryCount);
+  if(withNormals)
+    result.normals.resize(entryCount, glm::vec3(0.0f));
+  if(withTangents)
+    result.tangents.resize(entryCount, glm::vec3(0.0f));
+
+  std::vector<uint32_t> cursor(result.rowStart.begin(), result.rowStart.end() - 1);
+  for(size_t ti = 0; ti < targetCount; ti++)
+  {
+    const Target& target = targets[ti];
+    for(size_t e = 0; e < target.indices.size(); e++)
+    {
+      const uint32_t slot    = cursor[target.indices[e]]++;
+      result.targets[slot]   = static_cast<uint32_t>(ti);
+      result.positions[slot] = target.positions[e];
+      if(withNormals && !target.normals.empty())
+        result.normals[slot] = target.normals[e];
+      if(withTangents && !target.tangents.empty())
+        result.tangents[slot] = target.tangents[e];
+    }
+  }
+  return result;
+}
+
+void SparseMorphTargets::VertexMajor::apply(std::span<const float> weights,
+                                            std::span<glm::vec3>   outPositions,
+                                            std::span<glm::vec3>   outNormals,
+                                            std::span<glm::vec4>   outTangents) const
+{
+  for(size_t v = 0; v + 1 < rowStart.size(); v++)
+  {
+    for(uint32_t e = rowStart[v]; e < rowStart[v + 1]; e++)
+    {
+      const float weight = targets[e] < weights.size() ? weights[targets[e]] : 0.0f;
+      if(weight == 0.0f)
+        continue;
+      if(v < outPositions.size())
+        outPositions[v] += weight * positions[e];
+      if(!normals.empty() && v < outNormals.size())
+        outNormals[v] += weight * normals[e];
+      if(!tangents.empty() && v < outTangents.size())
+        outTangents[v] = glm::vec4(glm::vec3(outTangents[v]) + weight * tangents[e], outTangents[v].w);
+    }
+  }
+}
+
+size_t SparseMorphTargets::VertexMajor::sizeInBytes() const
+{
+  return rowStart.size() * sizeof(uint32_t) + targets.size() * sizeof(uint32_t)
+         + (positions.size() + normals.size() + tangents.size()) * sizeof(glm::vec3);
+}
+
+bool SparseMorphTargets::hasNormals() const
+{
+  return std::any_of(targets.begin(), targets.end(), [](const Target& target) { return !target.normals.empty(); });
+}
+
+bool SparseMorphTargets::hasTangents() const
+{
+  return std::any_of(targets.begin(), targets.end(), [](const Target& target) { return !target.tangents.empty(); });
+}
+
+size_t SparseMorphTargets::nonZeroCount() const
+{
+  size_t count = 0;
+  for(const Target& target : targets)
+    count += target.indices.size();
+  return count;
+}
+
+size_t SparseMorphTargets::sizeInBytes() const
+{
+  size_t bytes = 0;
+  for(const Target& target : targets)
+    bytes += target.indices.size() * sizeof(uint32_t)
+             + (target.positions.size() + target.normals.size() + target.tangents.size()) * sizeof(glm::vec3);
+  return bytes;
+}
+
+size_t SparseMorphTargets::denseSizeInBytes() const
+{
+  const size_t attributes = 1 + (hasNormals() ? 1 : 0) + (hasTangents() ? 1 : 0);
+  return targets.size() * size_t(vertexCount) * attributes * sizeof(glm::vec3);
+}
+
+}  // namespace nvvkgltf
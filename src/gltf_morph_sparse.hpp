@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace tinygltf {
+class Model;
+}
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# struct nvvkgltf::SparseMorphTargets
+
+>  Morph target deltas of one primitive, keeping only the vertices a target actually moves.
+
+Blend shapes typically touch a small part of the mesh (a face region of a full body), yet glTF
+readers usually expand every target to vertexCount deltas. Here each target keeps the ascending
+list of vertices with a non-zero position, normal or tangent delta. glTF sparse accessors are
+read as (index, value) pairs without expanding them; dense accessors are compacted at load.
+
+Two layouts are used:
+- Target-major (`targets`): the CPU blend scatters each target with a non-zero weight, so its cost
+  is the number of non-zero deltas of the active targets (apply()).
+- Vertex-major (VertexMajor, CSR): built for the compute shader, one thread per vertex walks its
+  own entries in target order, so each thread writes only its vertex (morph.comp.slang).
+
+Both accumulate the targets of a vertex in the same order, so they give identical results.
+
+ -------------------------------------------------------------------------------------------------*/
+struct SparseMorphTargets
+{
+  // (index, delta) pairs of one attribute, indices ascending
+  struct Deltas
+  {
+    std::vector<uint32_t>  indices;
+    std::vector<glm::vec3> values;
+  };
+
+  struct Target
+  {
+    std::vector<uint32_t>  indices;    // Ascending vertices with a non-zero delta
+    std::vector<glm::vec3> positions;  // Parallel to indices
+    std::vector<glm::vec3> normals;    // Parallel to indices, empty if the target has no normal deltas
+    std::vector<glm::vec3> tangents;   // Parallel to indices, empty if the target has no tangent deltas
+  };
+
+  // Compute shader layout: the entries of vertex v are rowStart[v] .. rowStart[v + 1] - 1
+  struct VertexMajor
+  {
+    std::vector<uint32_t>  rowStart;   // vertexCount + 1
+    std::vector<uint32_t>  targets;    // Target of each entry, ascending per vertex
+    std::vector<glm::vec3> positions;  // Per entry
+    std::vector<glm::vec3> normals;    // Per entry, empty without normal deltas
+    std::vector<glm::vec3> tangents;   // Per entry, empty without tangent deltas
+
+    // CPU reference of morph.comp.slang: add the weighted deltas of every vertex (no normalization)
+    void apply(std::span<const float> weights, std::span<glm::vec3> positions, std::span<glm::vec3> normals,
+               std::span<glm::vec4> tangents) const;
+    [[nodiscard]] size_t sizeInBytes() const;
+  };
+
+  uint32_t            vertexCount = 0;
+  std::vector<Target> targets;
+
+  void clear();
+
+  // Non-zero entries of a dense attribute (all vertices)
+  [[nodiscard]] static Deltas compact(std::span<const glm::vec3> dense);
+
+  // Append a target from its per-attribute deltas (any may be empty). Vertices whose deltas are
+  // all zero, or out of range, are dropped.
+  void addTarget(const Deltas& positions, const Deltas& normals, const Deltas& tangents);
+
+  // Append a target from glTF accessors (-1: attribute absent). Sparse-only float accessors are
+  // read as pairs; anything else is decoded and compacted. Accessors whose count is not
+  // vertexCount are ignored.
+  void addTarget(const tinygltf::Model& model, int positionAccessor, int normalAccessor, int tangentAccessor);
+
+  // Add the weighted deltas of the first weights.size() targets; zero weights are skipped.
+  // normals / tangents may be empty to skip those attributes.
+  void apply(std::span<const float> weights, std::span<glm::vec3> positions, std::span<glm::vec3> normals,
+             std::span<glm::vec4> tangents) const;
+
+  // Vertex-major copy of the first numTargets targets, with normal/tangent deltas only if requested
+  [[nodiscard]] VertexMajor toVertexMajor(uint32_t numTargets, bool withNormals, bool withTangents) const;
+
+  [[nodiscard]] bool   hasNormals() const;
+  [[nodiscard]] bool   hasTangents() const;
+  [[nodiscard]] size_t nonZeroCount() const;  // Stored (vertex, target) entries
+  [[nodiscard]] size_t sizeInBytes() const;   // Target-major storage
+  // Storage of the same targets expanded to vertexCount deltas per target and attribute
+  [[nodiscard]] size_t denseSizeInBytes() const;
+};
+
+}  // namespace nvvkgltf
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// CPU reference evaluator for GPU node animation playback. Mirrors node_animation.comp.slang
+// line for line so tests can validate the table layout and the interpolation math without a GPU.
+//
+
+#include "gltf_node_animation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <tinygltf/tiny_gltf.h>
+
+namespace nvvkgltf {
+
+namespace {
+
+// Index i of the key segment [i, i + 1] holding `time`: last key <= time, clamped to a valid pair.
+uint32_t findKeySegment(const float* keyTimes, uint32_t keyCount, float time)
+{
+  const float* it = std::upper_bound(keyTimes, keyTimes + keyCount, time);
+  uint32_t     i  = (it == keyTimes) ? 0u : static_cast<uint32_t>(it - keyTimes) - 1u;
+  return std::min(i, keyCount - 2u);
+}
+
+// Shortest-path spherical interpolation, falling back to lerp for nearly parallel quaternions (glm::slerp).
+glm::vec4 slerpQuat(const glm::vec4& q0, glm::vec4 q1, float t)
+{
+  float cosTheta = glm::dot(q0, q1);
+  if(cosTheta < 0.0f)
+  {
+    q1       = -q1;
+    cosTheta = -cosTheta;
+  }
+  if(cosTheta > 1.0f - std::numeric_limits<float>::epsilon())
+    return glm::mix(q0, q1, t);
+  const float angle = std::acos(cosTheta);
+  return (std::sin((1.0f - t) * angle) * q0 + std::sin(t * angle) * q1) / std::sin(angle);
+}
+
+// Cubic Hermite spline (glTF 2.0, 3.8.4.4); key k stores (in-tangent, value, out-tangent) at 3k.
+glm::vec4 cubicSpline(const glm::vec4* values, uint32_t i, float t, float keyDelta)
+{
+  const float tSq = t * t;
+  const float tCb = tSq * t;
+  const float cV1 = -2.0f * tCb + 3.0f * tSq;
+  const float cV0 = 1.0f - cV1;
+  const float cA  = keyDelta * (tCb - tSq);
+  const float cB  = keyDelta * (tCb - 2.0f * tSq + t);
+
+  const glm::vec4& v0 = values[i * 3 + 1];
+  const glm::vec4& b  = values[i * 3 + 2];
+  const glm::vec4& a  = values[(i + 1) * 3 + 0];
+  const glm::vec4& v1 = values[(i + 1) * 3 + 1];
+  return v0 * cV0 + a * cA + b * cB + v1 * cV1;
+}
+
+}  // namespace
+
+void NodeAnimationTable::clear()
+{
+  targets.clear();
+  tracks.clear();
+  keyTimes.clear();
+  keyValues.clear();
+}
+
+glm::vec4 NodeAnimationTable::sampleTrack(int trackIndex, bool isRotation, float time) const
+{
+  const shaderio::NodeAnimTrack& track  = tracks[trackIndex];
+  const float*                   times  = keyTimes.data() + track.keyOffset;
+  const glm::vec4*               values = keyValues.data() + track.valueOffset;
+  const uint32_t                 i      = findKeySegment(times, track.keyCount, time);
+
+  const float inputStart = times[i];
+  const float keyDelta   = times[i + 1] - inputStart;
+  const float t = (std::abs(keyDelta) < std::numeric_limits<float>::epsilon()) ? 0.0f : std::clamp((time - inputStart) / keyDelta, 0.0f, 1.0f);
+
+  if(track.interpolation == NODE_ANIM_INTERP_STEP)
+    return values[i];
+
+  if(track.interpolation == NODE_ANIM_INTERP_CUBICSPLINE)
+  {
+    const glm::vec4 v = cubicSpline(values, i, t, keyDelta);
+    return isRotation ? glm::normalize(v) : v;
+  }
+
+  return isRotation ? glm::normalize(slerpQuat(values[i], values[i + 1], t)) : glm::mix(values[i], values[i + 1], t);
+}
+
+void NodeAnimationTable::evaluateTrs(size_t targetIndex, float time, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const
+{
+  const shaderio::NodeAnimTarget& target = targets[targetIndex];
+
+  translation = (target.trackTranslation >= 0) ? glm::vec3(sampleTrack(target.trackTranslation, false, time)) :
+                                                 glm::vec3(target.restTranslation);
+  const glm::vec4 q = (target.trackRotation >= 0) ? sampleTrack(target.trackRotation, true, time) : target.restRotation;
+  rotation          = glm::quat(q.w, q.x, q.y, q.z);
+  scale = (target.trackScale >= 0) ? glm::vec3(sampleTrack(target.trackScale, false, time)) : glm::vec3(target.restScale);
+}
+
+glm::mat4 NodeAnimationTable::evaluateLocalMatrix(size_t targetIndex, float time) const
+{
+  glm::vec3 t, s;
+  glm::quat q;
+  evaluateTrs(targetIndex, time, t, q, s);
+
+  // T * R * S, composed column by column exactly like composeLocalMatrix() in the shader.
+  const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+  glm::mat4 m;
+  m[0] = glm::vec4(glm::vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)) * s.x, 0.0f);
+  m[1] = glm::vec4(glm::vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)) * s.y, 0.0f);
+  m[2] = glm::vec4(glm::vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)) * s.z, 0.0f);
+  m[3] = glm::vec4(t, 1.0f);
+  return m;
+}
+
+void NodeAnimationTable::evaluate(float time, std::span<glm::mat4> localMatrices) const
+{
+  for(size_t i = 0; i < targets.size(); ++i)
+  {
+    const int nodeID = targets[i].nodeID;
+    if(nodeID >= 0 && static_cast<size_t>(nodeID) < localMatrices.size())
+      localMatrices[nodeID] = evaluateLocalMatrix(i, time);
+  }
+}
+
+void NodeAnimationTable::applyToNodes(tinygltf::Model& model, float time) const
+{
+  for(size_t i = 0; i < targets.size(); ++i)
+  {
+    const shaderio::NodeAnimTarget& target = targets[i];
+    if(target.nodeID < 0 || static_cast<size_t>(target.nodeID) >= model.nodes.size())
+      continue;
+
+    glm::vec3 t, s;
+    glm::quat q;
+    evaluateTrs(i, time, t, q, s);
+
+    // Only the animated paths are written, like AnimationSystem::updateAnimation.
+    tinygltf::Node& node = model.nodes[target.nodeID];
+    if(target.trackTranslation >= 0)
+      node.translation = {t.x, t.y, t.z};
+    if(target.trackRotation >= 0)
+      node.rotation = {q.x, q.y, q.z, q.w};
+    if(target.trackScale >= 0)
+      node.scale = {s.x, s.y, s.z};
+  }
+}
+
+}  // namespace nvvkgltf
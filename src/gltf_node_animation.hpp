@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "shaders/node_animation_io.h.slang"
+
+namespace tinygltf {
+class Model;
+}
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# struct nvvkgltf::NodeAnimationTable
+
+>  Flattened keyframe data of one animation whose channels are all node translation / rotation /
+   scale. Built by AnimationSystem::prepareGpuNodeAnimation(), uploaded once by TransformComputeVk
+   and evaluated per frame by node_animation.comp.slang.
+
+The evaluate functions are the CPU reference of that shader: same arrays, same segment search,
+same interpolation and matrix composition. They are also how the CPU catches up with a GPU-played
+animation (applyToNodes) when the editor or a CPU sync needs the current node TRS.
+
+Times outside a track's key range are clamped to its first / last key.
+
+ -------------------------------------------------------------------------------------------------*/
+struct NodeAnimationTable
+{
+  std::vector<shaderio::NodeAnimTarget> targets;    // One per animated node
+  std::vector<shaderio::NodeAnimTrack>  tracks;     // One per animated TRS path
+  std::vector<float>                    keyTimes;   // All tracks' key times, concatenated
+  std::vector<glm::vec4>                keyValues;  // All tracks' key values, concatenated
+
+  [[nodiscard]] bool empty() const { return targets.empty(); }
+  void               clear();
+
+  // Value of one track at `time` (xyz for translation/scale, quaternion xyzw for rotation).
+  [[nodiscard]] glm::vec4 sampleTrack(int trackIndex, bool isRotation, float time) const;
+
+  // Node TRS of one target at `time`; un-animated paths return the rest value.
+  void evaluateTrs(size_t targetIndex, float time, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const;
+
+  // Local matrix (T * R * S) of one target at `time`.
+  [[nodiscard]] glm::mat4 evaluateLocalMatrix(size_t targetIndex, float time) const;
+
+  // Write the local matrix of every target into localMatrices[nodeID] (what the compute pass does).
+  void evaluate(float time, std::span<glm::mat4> localMatrices) const;
+
+  // Write the TRS of every target back into the model nodes.
+  void applyToNodes(tinygltf::Model& model, float time) const;
+};
+
+}  // namespace nvvkgltf
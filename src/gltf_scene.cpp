@@ -37,10 +37,10 @@
 
 #include <nvutils/file_operations.hpp>
 #include <nvutils/logger.hpp>
-#include <nvutils/parallel_work.hpp>
 #include <nvutils/timers.hpp>
 
 #include "gltf_scene.hpp"
+#include "task_scheduler.hpp"
 #include "gltf_scene_animation.hpp"
 #include "gltf_scene_editor.hpp"
 #include "gltf_scene_validator.hpp"
@@ -48,10 +48,12 @@
 #include "gltf_animation_pointer.hpp"
 #include "gltf_scene_merger.hpp"
 #include "gltf_compact_model.hpp"
-#include "version.hpp"
 
 namespace {
 
+// Instances per thread when expanding an EXT_mesh_gpu_instancing batch; smaller batches stay serial.
+constexpr size_t kInstanceBatchGrain = 4096;
+
 //--------------------------------------------------------------------------------------------------
 // Load .gltf or .glb into model using shared TinyGLTF config (no external file limit, image bytes stored raw).
 // Returns true on success. On failure, outError and outWarn are set for caller to log.
@@ -144,8 +146,87 @@ bool loadGltfFile(const std::filesystem::path& filename,
   return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+// Copy of `model` without the buffer data and the pixels of the images stored in buffer views
+// (tinygltf doesn't write those). They are moved out around the copy and put back.
+tinygltf::Model copyWithoutPayloads(tinygltf::Model& model)
+{
+  std::vector<std::vector<unsigned char>> buffers(model.buffers.size());
+  std::vector<std::vector<unsigned char>> pixels(model.images.size());
+  for(size_t i = 0; i < model.buffers.size(); i++)
+    buffers[i] = std::move(model.buffers[i].data);
+  for(size_t i = 0; i < model.images.size(); i++)
+  {
+    if(model.images[i].bufferView >= 0)
+      pixels[i] = std::move(model.images[i].image);
+  }
+
+  tinygltf::Model copy = model;
+
+  for(size_t i = 0; i < model.buffers.size(); i++)
+    model.buffers[i].data = std::move(buffers[i]);
+  for(size_t i = 0; i < model.images.size(); i++)
+  {
+    if(model.images[i].bufferView >= 0)
+      model.images[i].image = std::move(pixels[i]);
+  }
+  return copy;
+}
+
 }  // namespace
 
+//--------------------------------------------------------------------------------------------------
+// RenderNodeArrays
+//--------------------------------------------------------------------------------------------------
+
+void nvvkgltf::RenderNodeArrays::reserve(size_t count)
+{
+  m_worldMatrices.reserve(count);
+  m_materialIDs.reserve(count);
+  m_renderPrimIDs.reserve(count);
+  m_refNodeIDs.reserve(count);
+  m_skinIDs.reserve(count);
+  m_visible.reserve(count);
+}
+
+void nvvkgltf::RenderNodeArrays::push_back(const RenderNode& node)
+{
+  m_worldMatrices.push_back(node.worldMatrix);
+  m_materialIDs.push_back(node.materialID);
+  m_renderPrimIDs.push_back(node.renderPrimID);
+  m_refNodeIDs.push_back(node.refNodeID);
+  m_skinIDs.push_back(node.skinID);
+  m_visible.push_back(node.visible ? 1 : 0);
+}
+
+void nvvkgltf::RenderNodeArrays::clear()
+{
+  m_worldMatrices.clear();
+  m_materialIDs.clear();
+  m_renderPrimIDs.clear();
+  m_refNodeIDs.clear();
+  m_skinIDs.clear();
+  m_visible.clear();
+}
+
+uint64_t nvvkgltf::RenderNodeArrays::sizeInBytes() const
+{
+  return containerBytes(m_worldMatrices) + containerBytes(m_materialIDs) + containerBytes(m_renderPrimIDs)
+         + containerBytes(m_refNodeIDs) + containerBytes(m_skinIDs) + containerBytes(m_visible);
+}
+
+nvvkgltf::RenderNodeArrays::Ref nvvkgltf::RenderNodeArrays::operator[](size_t i)
+{
+  assert(i < size());
+  return {m_worldMatrices[i], m_materialIDs[i], m_renderPrimIDs[i], m_refNodeIDs[i], m_skinIDs[i], m_visible[i]};
+}
+
+nvvkgltf::RenderNodeArrays::ConstRef nvvkgltf::RenderNodeArrays::operator[](size_t i) const
+{
+  assert(i < size());
+  return {m_worldMatrices[i], m_materialIDs[i], m_renderPrimIDs[i], m_refNodeIDs[i], m_skinIDs[i], m_visible[i]};
+}
+
 //--------------------------------------------------------------------------------------------------
 // RenderNodeRegistry
 //--------------------------------------------------------------------------------------------------
@@ -163,6 +244,46 @@ int nvvkgltf::RenderNodeRegistry::addRenderNode(const RenderNode& node, int node
   return renderNodeID;
 }
 
+int nvvkgltf::RenderNodeRegistry::addInstanceBatch(const RenderNode& node, int nodeID, int primIndex, std::span<const glm::mat4> instanceLocals)
+{
+  const int batchIndex = static_cast<int>(m_instanceBatches.size());
+  m_instanceBatches.push_back({nodeID, primIndex, static_cast<int>(m_renderNodes.size()), static_cast<int>(instanceLocals.size())});
+  auto it = m_nodeToInstanceBatches.try_emplace(nodeID, batchIndex, 0).first;
+  assert(it->second.first + it->second.second == batchIndex && "Batches of a node must be added one after the other");
+  it->second.second++;
+
+  RenderNode instance = node;
+  for(const glm::mat4& local : instanceLocals)
+  {
+    instance.worldMatrix = node.worldMatrix * local;
+    addRenderNode(instance, nodeID, primIndex);
+  }
+  return batchIndex;
+}
+
+std::span<const nvvkgltf::InstanceBatch> nvvkgltf::RenderNodeRegistry::getInstanceBatchesForNode(int nodeID) const
+{
+  auto it = m_nodeToInstanceBatches.find(nodeID);
+  if(it == m_nodeToInstanceBatches.end())
+    return {};
+  return std::span(m_instanceBatches).subspan(it->second.first, it->second.second);
+}
+
+const nvvkgltf::InstanceBatch* nvvkgltf::RenderNodeRegistry::findInstanceBatch(int renderNodeID) const
+{
+  if(m_instanceBatches.empty())
+    return nullptr;
+  auto nodeAndPrim = getNodeAndPrim(renderNodeID);
+  if(!nodeAndPrim)
+    return nullptr;
+  for(const InstanceBatch& batch : getInstanceBatchesForNode(nodeAndPrim->first))
+  {
+    if(batch.contains(renderNodeID))
+      return &batch;
+  }
+  return nullptr;
+}
+
 int nvvkgltf::RenderNodeRegistry::getRenderNodeID(int nodeID, int primIndex) const
 {
   auto it = m_nodeAndPrimToRenderNode.find(makeKey(nodeID, primIndex));
@@ -203,6 +324,18 @@ void nvvkgltf::RenderNodeRegistry::clear()
   m_nodeAndPrimToRenderNode.clear();
   m_renderNodeToNodeAndPrim.clear();
   m_nodeToRenderNodes.clear();
+  m_instanceBatches.clear();
+  m_nodeToInstanceBatches.clear();
+}
+
+uint64_t nvvkgltf::RenderNodeRegistry::sizeInBytes() const
+{
+  uint64_t bytes = m_renderNodes.sizeInBytes() + containerBytes(m_nodeAndPrimToRenderNode)
+                   + containerBytes(m_renderNodeToNodeAndPrim) + containerBytes(m_nodeToRenderNodes)
+                   + containerBytes(m_instanceBatches) + containerBytes(m_nodeToInstanceBatches);
+  for(const auto& [nodeID, renderNodes] : m_nodeToRenderNodes)
+    bytes += containerBytes(renderNodes);
+  return bytes;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -252,9 +385,15 @@ nvvkgltf::Scene::Scene()
       "KHR_texture_basisu",
 #endif
   };
+
+  // Created up front: the const validator() is used by prepareReference(), which runs concurrently
+  m_validator = std::make_unique<SceneValidator>(*this);
 }
 
-nvvkgltf::Scene::~Scene() = default;
+nvvkgltf::Scene::~Scene()
+{
+  waitForSaves();
+}
 
 nvvkgltf::SceneEditor& nvvkgltf::Scene::editor()
 {
@@ -279,15 +418,11 @@ const nvvkgltf::AnimationSystem& nvvkgltf::Scene::animation() const
 
 nvvkgltf::SceneValidator& nvvkgltf::Scene::validator()
 {
-  if(!m_validator)
-    m_validator = std::make_unique<SceneValidator>(*this);
   return *m_validator;
 }
 
 const nvvkgltf::SceneValidator& nvvkgltf::Scene::validator() const
 {
-  if(!m_validator)
-    m_validator = std::make_unique<SceneValidator>(*this);
   return *m_validator;
 }
 
@@ -301,6 +436,7 @@ bool nvvkgltf::Scene::load(const std::filesystem::path& filename)
   const std::string    filenameUtf8 = nvutils::utf8FromPath(filename);
 
   m_validSceneParsed = false;
+  waitForSaves();
 
   std::error_code ec;
   m_filename = std::filesystem::absolute(filename, ec);
@@ -518,10 +654,25 @@ bool nvvkgltf::Scene::decompressMeshoptExtension()
 //
 bool nvvkgltf::Scene::save(const std::filesystem::path& filename, bool selfContained)
 {
-  namespace fs = std::filesystem;
-
   nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
 
+  std::optional<SceneSaveSnapshot> snapshot = makeSaveSnapshot(filename, selfContained);
+  if(!snapshot)
+    return false;
+
+  if(writeSceneSnapshot(*snapshot) != SceneSaveStatus::eSaved)
+    return false;
+  onSaved(snapshot->filename);
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Validate, then copy what save() writes, so the caller may write it on another thread while the
+// scene keeps changing. The buffers are shared with the snapshot: changes to them wait for the
+// write (waitForSaves()). The external-asset transforms rewrite the buffers, and get a full copy.
+//
+std::optional<nvvkgltf::SceneSaveSnapshot> nvvkgltf::Scene::makeSaveSnapshot(const std::filesystem::path& filename, bool selfContained)
+{
   // VALIDATE BEFORE SAVE
   auto validation = validator().validateBeforeSave();
   validation.print();
@@ -529,163 +680,61 @@ bool nvvkgltf::Scene::save(const std::filesystem::path& filename, bool selfConta
   if(!validation.valid)
   {
     LOGW("Cannot save - validation failed\n");
-    return false;  // STRICT: refuse to save invalid model
+    return std::nullopt;  // STRICT: refuse to save invalid model
+  }
+
+  SceneSaveSnapshot snapshot;
+  if(m_referencedAssets.empty())
+  {
+    waitForSaves();  // The payloads are moved out around the copy
+    snapshot.model        = copyWithoutPayloads(m_model);
+    snapshot.payloads     = &m_model;
+    snapshot.payloadLease = m_saveReaders->acquire();
   }
+  else
+    snapshot.model = m_model;
+  snapshot.requestedFilename    = filename;
+  snapshot.filename             = filename;
+  snapshot.binary               = nvutils::extensionMatches(filename, ".glb");
+  snapshot.imageSearchPaths     = m_imageSearchPaths;
+  snapshot.imageSaveConcurrency = m_imageSaveConcurrency;
+
+  // Make sure the extension is correct
+  if(!nvutils::extensionMatches(filename, ".gltf") && !snapshot.binary)
+    snapshot.filename.replace_extension(".gltf");
 
-  // glTF 2.1: when the scene references external assets, transform a copy of the model before
-  // writing (the live scene is left untouched). Two forms:
+  // glTF 2.1: when the scene references external assets, transform the copy (the live scene is
+  // left untouched). Two forms:
   //   - selfContained=false (default): re-externalize -- write the complex-scene form (the
   //     files/externalAssets tables + instance nodes) instead of the flattened runtime model.
   //   - selfContained=true: flatten -- keep the merged content inline and strip every external
   //     reference, producing a portable file that can be shared without the referenced assets.
-  // Everything below (image copy, generator tag, extension reconciliation, serialization) then
-  // operates on `outModel`.
-  tinygltf::Model  transformedModel;
-  tinygltf::Model* outModelPtr = &m_model;
   if(!m_referencedAssets.empty())
   {
-    transformedModel = m_model;
     if(selfContained)
-      nvvkgltf::flattenExternalAssets(transformedModel);
+      nvvkgltf::flattenExternalAssets(snapshot.model);
     else
-      nvvkgltf::removeExternalAssetContent(transformedModel);
-    outModelPtr = &transformedModel;
+      nvvkgltf::removeExternalAssetContent(snapshot.model);
   }
-  tinygltf::Model& outModel = *outModelPtr;
-
-  std::filesystem::path saveFilename = filename;
-
-  // Make sure the extension is correct
-  if(!nvutils::extensionMatches(filename, ".gltf") && !nvutils::extensionMatches(filename, ".glb"))
-  {
-    // replace the extension
-    saveFilename = saveFilename.replace_extension(".gltf");
-  }
-
-  const bool saveBinary = nvutils::extensionMatches(filename, ".glb");
-
-  // Copy the images to the destination folder using the same search paths as for loading.
-  // Images that already resolve next to the saved file (at their current relative URI) are left
-  // in place -- this keeps a "save in place" (or a save-as into a folder that already contains the
-  // referenced images) from needlessly duplicating them into an "images/" subfolder. Only images
-  // that would not be found relative to the destination are copied there and have their URI
-  // rewritten.
-  if(!outModel.images.empty() && !saveBinary && !getImageSearchPaths().empty())
-  {
-    const std::vector<fs::path>&    searchPaths = getImageSearchPaths();
-    fs::path                        dstPath     = filename.parent_path();
-    int                             numCopied   = 0;
-    std::unordered_set<std::string> usedRelativeNames;
-    // Deduplicate by resolved source file: multiple image entries that point at the same file on
-    // disk (e.g. one texture shared by several materials, or reused across a merged scene) share a
-    // single destination URI instead of being copied once per entry.
-    std::unordered_map<std::string, std::string> uriBySource;
-    for(size_t i = 0; i < outModel.images.size(); i++)
-    {
-      auto& image = outModel.images[i];
-      if(image.uri.empty())
-        continue;
-      if(image.uri.size() >= 5 && image.uri.compare(0, 5, "data:") == 0)
-        continue;  // data URI: no file to copy
-      std::string uri_decoded;
-      tinygltf::URIDecode(image.uri, &uri_decoded, nullptr);
-      fs::path pathDecoded = nvutils::pathFromUtf8(uri_decoded);
-      fs::path srcFile     = nvutils::findFile(pathDecoded, searchPaths, false);
-      if(srcFile.empty())
-        continue;
-
-      // Reuse the URI already decided for this source file so a file referenced more than once is
-      // never duplicated on disk. Key on the canonical path, falling back to the located path if
-      // canonicalization fails -- the key is then always non-empty and stable for that file.
-      std::error_code   ec;
-      const fs::path    canonical = fs::weakly_canonical(srcFile, ec);
-      const std::string srcKey    = (ec ? srcFile : canonical).generic_string();
-
-      if(auto it = uriBySource.find(srcKey); it != uriBySource.end())
-      {
-        image.uri = it->second;
-        continue;
-      }
-
-      // If the source already resolves to where the current URI points relative to the destination,
-      // leave it in place (no copy, URI unchanged) and reserve its relative name so a later copy
-      // cannot target the same path and overwrite it. An absolute URI is never kept: it would write
-      // a non-portable path, so it falls through to be copied and rewritten relative.
-      fs::path naturalDst = dstPath / pathDecoded;
-      if(!pathDecoded.is_absolute() && fs::exists(naturalDst, ec) && fs::equivalent(srcFile, naturalDst, ec))
-      {
-        usedRelativeNames.insert(pathDecoded.generic_string());
-        uriBySource.emplace(srcKey, image.uri);
-        continue;
-      }
-
-      std::string name      = pathDecoded.filename().string();
-      std::string base      = pathDecoded.stem().string();
-      std::string ext       = pathDecoded.extension().string();
-      std::string candidate = "images/" + name;
-      int         suffix    = 0;
-      while(usedRelativeNames.count(candidate))
-        candidate = "images/" + base + "_" + std::to_string(++suffix) + ext;
-      usedRelativeNames.insert(candidate);
-      fs::path dstRelative = fs::path(candidate);
-      fs::path dstFile     = dstPath / dstRelative;
-      if(srcFile != dstFile)
-      {
-        fs::create_directories(dstFile.parent_path());
-        try
-        {
-          if(fs::copy_file(srcFile, dstFile, fs::copy_options::overwrite_existing))
-            numCopied++;
-        }
-        catch(const fs::filesystem_error& e)
-        {
-          LOGW("%sError copying image: %s\n", st.indent().c_str(), e.what());
-          continue;
-        }
-      }
-      image.uri = dstRelative.generic_string();  // forward slashes for glTF
-      uriBySource.emplace(srcKey, image.uri);
-    }
-    if(numCopied > 0)
-      LOGI("%sImages copied: %d\n", st.indent().c_str(), numCopied);
-  }
-
-  // Append generator tag if not already present
-  constexpr const char* generatorPrefix = "NVIDIA vk_gltf_renderer";
-  if(outModel.asset.generator.find(generatorPrefix) == std::string::npos)
-  {
-    if(!outModel.asset.generator.empty())
-      outModel.asset.generator += " + ";
-    outModel.asset.generator += std::string(generatorPrefix) + " " APP_VERSION_STRING;
-  }
-
-  // Reconcile top-level extensionsUsed / extensionsRequired with what the model actually
-  // contains, so the written asset complies with the glTF 2.0 "Specifying Extensions" rules
-  // (tinygltf writes these arrays verbatim). This prunes stale entries left by edits/merges
-  // and adds any extension that became used since load.
-  tinygltf::utils::syncExtensionsUsed(outModel);
-
-  // Save the glTF file
-  tinygltf::TinyGLTF tcontext;
-  const std::string  saveFilenameUtf8 = nvutils::utf8FromPath(saveFilename);
-  bool result = tcontext.WriteGltfSceneToFile(&outModel, saveFilenameUtf8, saveBinary, saveBinary, true, saveBinary);
-  LOGI("%sSaved: %s\n", st.indent().c_str(), saveFilenameUtf8.c_str());
+  return snapshot;
+}
 
-  // After a successful .gltf save, treat the save location as the new canonical home of the scene.
-  // This ensures that subsequent operations (e.g. merging another scene) can resolve images that
-  // were copied into the save directory's "images/" subfolder.
-  if(result)
-  {
-    std::error_code pathEc;
-    fs::path        saveDir = fs::absolute(saveFilename.parent_path(), pathEc);
-    if(pathEc)
-      saveDir = saveFilename.parent_path();
-    m_filename = saveFilename;
-    if(std::find(m_imageSearchPaths.begin(), m_imageSearchPaths.end(), saveDir) == m_imageSearchPaths.end())
-      m_imageSearchPaths.push_back(saveDir);
-  }
+//--------------------------------------------------------------------------------------------------
+// After a successful save, treat the save location as the new canonical home of the scene.
+// This ensures that subsequent operations (e.g. merging another scene) can resolve images that
+// were copied into the save directory's "images/" subfolder.
+//
+void nvvkgltf::Scene::onSaved(const std::filesystem::path& savedFilename)
+{
+  namespace fs = std::filesystem;
 
-  return result;
+  std::error_code pathEc;
+  fs::path        saveDir = fs::absolute(savedFilename.parent_path(), pathEc);
+  if(pathEc)
+    saveDir = savedFilename.parent_path();
+  m_filename = savedFilename;
+  if(std::find(m_imageSearchPaths.begin(), m_imageSearchPaths.end(), saveDir) == m_imageSearchPaths.end())
+    m_imageSearchPaths.push_back(saveDir);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -733,6 +782,7 @@ void nvvkgltf::Scene::resolveImageURIs()
 //
 void nvvkgltf::Scene::takeModel(tinygltf::Model&& model)
 {
+  waitForSaves();
   m_model = std::move(model);
   m_imageSearchPaths.clear();
   m_referencedAssets.clear();
@@ -741,6 +791,57 @@ void nvvkgltf::Scene::takeModel(tinygltf::Model&& model)
   parseScene();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Host memory of the scene. tinygltf objects are counted at their struct size: names, extras and
+// extensions are not walked (small next to buffers and images).
+//
+void nvvkgltf::Scene::reportHostMemory(HostMemoryTracker& tracker) const
+{
+  uint64_t bufferBytes = containerBytes(m_model.buffers);
+  for(const tinygltf::Buffer& buffer : m_model.buffers)
+    bufferBytes += containerBytes(buffer.data);
+
+  uint64_t imageBytes = containerBytes(m_model.images);
+  for(const tinygltf::Image& image : m_model.images)
+    imageBytes += containerBytes(image.image);
+
+  uint64_t objectBytes = containerBytes(m_model.accessors) + containerBytes(m_model.bufferViews)
+                         + containerBytes(m_model.materials) + containerBytes(m_model.meshes) + containerBytes(m_model.nodes)
+                         + containerBytes(m_model.textures) + containerBytes(m_model.samplers) + containerBytes(m_model.skins)
+                         + containerBytes(m_model.animations) + containerBytes(m_model.cameras)
+                         + containerBytes(m_model.lights) + containerBytes(m_model.scenes);
+  for(const tinygltf::Mesh& mesh : m_model.meshes)
+    objectBytes += containerBytes(mesh.primitives);
+  for(const tinygltf::Node& node : m_model.nodes)
+    objectBytes += containerBytes(node.children);
+  for(const tinygltf::Skin& skin : m_model.skins)
+    objectBytes += containerBytes(skin.joints);
+  for(const tinygltf::Animation& animation : m_model.animations)
+    objectBytes += containerBytes(animation.channels) + containerBytes(animation.samplers);
+
+  uint64_t renderBytes = m_renderNodeRegistry.sizeInBytes() + containerBytes(m_renderPrimitives)
+                         + containerBytes(m_renderPrimCenterObj) + containerBytes(m_cameras) + containerBytes(m_lights)
+                         + containerBytes(m_materialBucketKey) + containerBytes(m_variantTable.renderNodes)
+                         + containerBytes(m_variantTable.rows) + containerBytes(m_variantTable.materials);
+  for(const std::vector<uint32_t>& shaded : m_shadedNodesCache)
+    renderBytes += containerBytes(shaded);
+
+  uint64_t graphBytes = containerBytes(m_nodesLocalMatrices) + containerBytes(m_nodesWorldMatrices)
+                        + containerBytes(m_nodeParents) + containerBytes(m_topoLevels.nodeOrder)
+                        + containerBytes(m_topoLevels.levels) + containerBytes(m_gpuInstanceLocalMatrices)
+                        + containerBytes(m_gpuStaleNodes);
+  for(const auto& [nodeID, locals] : m_gpuInstanceLocalMatrices)
+    graphBytes += containerBytes(locals);
+
+  tracker.set("Model/Buffers", bufferBytes);
+  tracker.set("Model/Images", imageBytes);
+  tracker.set("Model/Objects", objectBytes);
+  tracker.set("RenderNodes", renderBytes);
+  tracker.set("SceneGraph", graphBytes);
+  if(m_animation)
+    m_animation->reportHostMemory(tracker);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Merge another glTF scene into this one. The imported scene is wrapped under a new root node.
 // If maxTextureCount is set and the combined textures would exceed it, returns false.
@@ -751,6 +852,9 @@ int nvvkgltf::Scene::mergeScene(const std::filesystem::path& filename, std::opti
   nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
   const std::string    filenameUtf8 = nvutils::utf8FromPath(filename);
 
+  const AppendSnapshot appendSnapshot = snapshotForAppend();
+  m_pendingAppend.reset();
+
   // Invalidate current scene until we know the merge succeeded
   m_validSceneParsed = false;
 
@@ -776,6 +880,7 @@ int nvvkgltf::Scene::mergeScene(const std::filesystem::path& filename, std::opti
   const size_t animationCountBeforeMerge = m_model.animations.size();
   const size_t importedAnimationCount    = importedModel.animations.size();
 
+  waitForSaves();
   int wrapperNodeIdx = SceneMerger::merge(m_model, importedModel, filename.stem().string(), maxTextureCount);
   if(wrapperNodeIdx < 0)
   {
@@ -796,6 +901,7 @@ int nvvkgltf::Scene::mergeScene(const std::filesystem::path& filename, std::opti
 
   parseScene();
   m_validSceneParsed = !m_model.nodes.empty();
+  recordAppend(appendSnapshot);
 
   // First animation index that belongs to the merged file (clips are appended). Used by the renderer
   // to select merged motion; otherwise currentAnimation often stays on a base-scene clip (index 0).
@@ -815,6 +921,84 @@ int nvvkgltf::Scene::takeMergePreferredAnimationIndex()
   return v;
 }
 
+//--------------------------------------------------------------------------------------------------
+std::optional<nvvkgltf::SceneAppendInfo> nvvkgltf::Scene::takeLastAppend()
+{
+  std::optional<SceneAppendInfo> v = m_pendingAppend;
+  m_pendingAppend.reset();
+  return v;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Capture the array sizes and the parsed state an import must leave untouched for recordAppend().
+//
+nvvkgltf::Scene::AppendSnapshot nvvkgltf::Scene::snapshotForAppend() const
+{
+  AppendSnapshot snapshot;
+  snapshot.valid                       = m_validSceneParsed;
+  snapshot.info.meshes.begin           = static_cast<uint32_t>(m_model.meshes.size());
+  snapshot.info.images.begin           = static_cast<uint32_t>(m_model.images.size());
+  snapshot.info.textures.begin         = static_cast<uint32_t>(m_model.textures.size());
+  snapshot.info.materials.begin        = static_cast<uint32_t>(m_model.materials.size());
+  snapshot.info.renderPrimitives.begin = static_cast<uint32_t>(m_renderPrimitives.size());
+  snapshot.info.renderNodes.begin      = static_cast<uint32_t>(m_renderNodeRegistry.getRenderNodes().size());
+  snapshot.info.lights.begin           = static_cast<uint32_t>(m_lights.size());
+  if(snapshot.valid)
+  {
+    const RenderNodeArrays& renderNodes = m_renderNodeRegistry.getRenderNodes();
+    snapshot.renderPrimitives           = m_renderPrimitives;
+    snapshot.renderPrimIDs.assign(renderNodes.renderPrimIDs().begin(), renderNodes.renderPrimIDs().end());
+    snapshot.materialIDs.assign(renderNodes.materialIDs().begin(), renderNodes.materialIDs().end());
+  }
+  return snapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+// After an import re-parsed the scene: if every array only grew and the render primitives and
+// render nodes that existed before are unchanged (same order, mesh, counts, primitive and
+// material), publish the appended ranges for takeLastAppend(). Otherwise leave it empty, which
+// tells the renderer to rebuild the GPU scene.
+//
+void nvvkgltf::Scene::recordAppend(const AppendSnapshot& snapshot)
+{
+  m_pendingAppend.reset();
+  if(!snapshot.valid || !m_validSceneParsed)
+    return;
+
+  SceneAppendInfo info      = snapshot.info;
+  info.meshes.end           = static_cast<uint32_t>(m_model.meshes.size());
+  info.images.end           = static_cast<uint32_t>(m_model.images.size());
+  info.textures.end         = static_cast<uint32_t>(m_model.textures.size());
+  info.materials.end        = static_cast<uint32_t>(m_model.materials.size());
+  info.renderPrimitives.end = static_cast<uint32_t>(m_renderPrimitives.size());
+  info.renderNodes.end      = static_cast<uint32_t>(m_renderNodeRegistry.getRenderNodes().size());
+  info.lights.end           = static_cast<uint32_t>(m_lights.size());
+
+  for(const SceneAppendInfo::Range* range : {&info.meshes, &info.images, &info.textures, &info.materials,
+                                             &info.renderPrimitives, &info.renderNodes, &info.lights})
+  {
+    if(range->end < range->begin)
+      return;
+  }
+
+  for(size_t i = 0; i < snapshot.renderPrimitives.size(); i++)
+  {
+    const RenderPrimitive& prev = snapshot.renderPrimitives[i];
+    const RenderPrimitive& cur  = m_renderPrimitives[i];
+    if(prev.meshID != cur.meshID || prev.vertexCount != cur.vertexCount || prev.indexCount != cur.indexCount)
+      return;
+  }
+
+  const RenderNodeArrays&    renderNodes   = m_renderNodeRegistry.getRenderNodes();
+  const std::span<const int> renderPrimIDs = renderNodes.renderPrimIDs();
+  const std::span<const int> materialIDs   = renderNodes.materialIDs();
+  if(!std::equal(snapshot.renderPrimIDs.begin(), snapshot.renderPrimIDs.end(), renderPrimIDs.begin())
+     || !std::equal(snapshot.materialIDs.begin(), snapshot.materialIDs.end(), materialIDs.begin()))
+    return;
+
+  m_pendingAppend = info;
+}
+
 //--------------------------------------------------------------------------------------------------
 // True if the mesh is used by any read-only (referenced external-asset) node.
 //--------------------------------------------------------------------------------------------------
@@ -870,12 +1054,15 @@ int nvvkgltf::Scene::nearestSelectableAncestor(int nodeIndex) const
 // glTF 2.1: recursively merge (in place) every external asset referenced by `model`, so it becomes
 // self-contained before being merged into the scene. Applies file aliases (inner-URI redirection)
 // and guards against reference cycles using `ancestry` (canonical paths currently on the chain).
-// The referencing nodes have their externalAsset/mesh/camera links cleared once resolved.
+// The referencing nodes have their externalAsset/mesh/camera links cleared once resolved. The
+// directories of the merged files are appended to `imageSearchPaths`; no scene state is touched,
+// so models can be flattened on worker threads (see prepareReference).
 //--------------------------------------------------------------------------------------------------
-void nvvkgltf::Scene::flattenReferencedModel(tinygltf::Model&             model,
-                                             const std::filesystem::path& modelDir,
-                                             std::vector<std::string>&    ancestry,
-                                             int                          depth)
+void nvvkgltf::Scene::flattenReferencedModel(tinygltf::Model&                    model,
+                                             const std::filesystem::path&        modelDir,
+                                             std::vector<std::string>&           ancestry,
+                                             int                                 depth,
+                                             std::vector<std::filesystem::path>& imageSearchPaths) const
 {
   constexpr int kMaxExternalAssetDepth = 16;  // backstop beyond the cycle guard
   if(model.externalAssets.empty() || model.files.empty() || model.nodes.empty())
@@ -942,14 +1129,14 @@ void nvvkgltf::Scene::flattenReferencedModel(tinygltf::Model&             model,
 
     // Recurse first so the child is fully self-contained before we merge it in.
     ancestry.push_back(canonKey);
-    flattenReferencedModel(childModel, childPath.parent_path(), ancestry, depth + 1);
+    flattenReferencedModel(childModel, childPath.parent_path(), ancestry, depth + 1, imageSearchPaths);
     ancestry.pop_back();
 
     // Images of the merged asset resolve from its own directory.
     std::filesystem::path importDir = std::filesystem::absolute(childPath.parent_path(), ec);
     if(ec)
       importDir = childPath.parent_path();
-    m_imageSearchPaths.push_back(importDir);
+    imageSearchPaths.push_back(importDir);
 
     const std::vector<int>& refNodes = nodesByFile[fileIdx];
 
@@ -1094,7 +1281,7 @@ bool nvvkgltf::Scene::resolveExternalAssets()
 
     // #4: recursively resolve the child's own external assets so it is self-contained before merging.
     ancestry.push_back(canonKey);
-    flattenReferencedModel(childModel, childPath.parent_path(), ancestry, 1);
+    flattenReferencedModel(childModel, childPath.parent_path(), ancestry, 1, m_imageSearchPaths);
     ancestry.pop_back();
 
     const std::vector<int>& refNodes = nodesByFile[fileIdx];
@@ -1171,14 +1358,49 @@ int nvvkgltf::Scene::recordReferencedAsset(int firstNode, int lastNode, int inst
   return refIdx;
 }
 
+//--------------------------------------------------------------------------------------------------
+// The loading half of referenceScene(): parse, validate and flatten the file into a standalone
+// model. Reads only the scene's filename and supported extensions, so several files can be
+// prepared concurrently while nothing modifies the scene.
+//--------------------------------------------------------------------------------------------------
+nvvkgltf::Scene::PreparedReference nvvkgltf::Scene::prepareReference(const std::filesystem::path& filename) const
+{
+  PreparedReference prepared;
+  prepared.filename = filename;
+
+  std::string error, warn;
+  if(!loadGltfFile(filename, prepared.model, &error, &warn))
+  {
+    LOGW("Reference: failed to load '%s' (%s)\n", nvutils::utf8FromPath(filename).c_str(),
+         error.empty() ? "unknown error" : error.c_str());
+    return prepared;
+  }
+  if(!validator().validateModelExtensions(prepared.model, "referenced asset"))
+    return prepared;
+
+  // glTF 2.1: recursively resolve the referenced asset's own external assets so it is self-contained
+  // before merging it under the instance node (guards against cycles back to this scene / the file).
+  std::error_code          ec;
+  std::vector<std::string> ancestry;
+  ancestry.push_back(nvutils::utf8FromPath(std::filesystem::weakly_canonical(std::filesystem::absolute(m_filename, ec), ec)));
+  ancestry.push_back(nvutils::utf8FromPath(std::filesystem::weakly_canonical(std::filesystem::absolute(filename, ec), ec)));
+  flattenReferencedModel(prepared.model, filename.parent_path(), ancestry, 1, prepared.imageSearchPaths);
+
+  prepared.valid = true;
+  return prepared;
+}
+
 //--------------------------------------------------------------------------------------------------
 // glTF 2.1: add another glTF as a referenced external asset (read-only), instead of embedding it.
 // Repeated references to the same file share geometry (placed by duplicating an existing instance).
 //--------------------------------------------------------------------------------------------------
-int nvvkgltf::Scene::referenceScene(const std::filesystem::path& filename)
+int nvvkgltf::Scene::referenceScene(const std::filesystem::path& filename, PreparedReference* prepared)
 {
   nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
 
+  const AppendSnapshot appendSnapshot = snapshotForAppend();
+  m_pendingAppend.reset();
+
   if(m_model.scenes.empty())
     m_model.scenes.emplace_back();
 
@@ -1213,34 +1435,29 @@ int nvvkgltf::Scene::referenceScene(const std::filesystem::path& filename)
       {
         const int dup = editor().duplicateNode(n);  // shares geometry; copies read-only markers + link
         if(dup >= 0)
+        {
+          recordAppend(appendSnapshot);  // Adds render nodes only; meshes, materials and BLAS are shared
           LOGI("%sReferenced '%s' as a shared instance (node %d)\n", st.indent().c_str(),
                nvutils::utf8FromPath(filename.filename()).c_str(), dup);
+        }
         return dup;
       }
     }
     // File entry exists but no live instance remains: fall through and merge fresh (reusing the file).
   }
 
-  // Load + validate the child file.
-  tinygltf::Model childModel;
-  std::string     error, warn;
-  if(!loadGltfFile(filename, childModel, &error, &warn))
+  // Load + validate + flatten the child file, unless the caller already did (e.g. concurrently)
+  PreparedReference loaded;
+  if(!prepared || prepared->filename != filename)
   {
-    LOGW("%sReference: failed to load '%s' (%s)\n", st.indent().c_str(), nvutils::utf8FromPath(filename).c_str(),
-         error.empty() ? "unknown error" : error.c_str());
-    return -1;
+    loaded   = prepareReference(filename);
+    prepared = &loaded;
   }
-  if(!validator().validateModelExtensions(childModel, "referenced asset"))
+  if(!prepared->valid)
     return -1;
-
-  // glTF 2.1: recursively resolve the referenced asset's own external assets so it is self-contained
-  // before merging it under the instance node (guards against cycles back to this scene / the file).
-  {
-    std::vector<std::string> ancestry;
-    ancestry.push_back(nvutils::utf8FromPath(std::filesystem::weakly_canonical(std::filesystem::absolute(m_filename, ec), ec)));
-    ancestry.push_back(nvutils::utf8FromPath(absTarget));
-    flattenReferencedModel(childModel, filename.parent_path(), ancestry, 1);
-  }
+  tinygltf::Model childModel = std::move(prepared->model);
+  prepared->valid            = false;  // Consumed
+  m_imageSearchPaths.insert(m_imageSearchPaths.end(), prepared->imageSearchPaths.begin(), prepared->imageSearchPaths.end());
 
   // File entry: store a path relative to the scene's location when possible (portable), else absolute.
   std::string storedUri;
@@ -1302,6 +1519,7 @@ int nvvkgltf::Scene::referenceScene(const std::filesystem::path& filename)
   }
   sceneNodes.push_back(instanceNode);
 
+  waitForSaves();
   nvvkgltf::MergeResult mr = SceneMerger::mergeIntoNode(m_model, childModel, instanceNode);
   if(!mr.valid())
   {
@@ -1326,6 +1544,7 @@ int nvvkgltf::Scene::referenceScene(const std::filesystem::path& filename)
   resolveImageURIs();
   parseScene();
   m_validSceneParsed = !m_model.nodes.empty();
+  recordAppend(appendSnapshot);
 
   LOGI("%sReferenced '%s' (%d nodes)\n", st.indent().c_str(), nvutils::utf8FromPath(filename.filename()).c_str(),
        mr.lastNode - mr.firstNode);
@@ -1356,18 +1575,8 @@ void nvvkgltf::Scene::parseScene()
   // Snapshot state before rebuild so we can diff afterward and set precise dirty flags.
   // Full state (worldMatrix, materialID, renderPrimID, visible) is captured because
   // clearParsedData() wipes pre-existing dirty flags -- the diff must detect everything.
-  struct RenderNodeSnapshot
-  {
-    glm::mat4 worldMatrix;
-    int       materialID;
-    int       renderPrimID;
-    bool      visible;
-  };
-  const auto&                     prevRNList = m_renderNodeRegistry.getRenderNodes();
-  std::vector<RenderNodeSnapshot> prevRN;
-  prevRN.reserve(prevRNList.size());
-  for(const auto& rn : prevRNList)
-    prevRN.push_back({rn.worldMatrix, rn.materialID, rn.renderPrimID, rn.visible});
+  const nvvkgltf::RenderNodeArrays prevRN = m_renderNodeRegistry.getRenderNodes();  // Column-wise copy
+
   const size_t prevMatCount   = m_model.materials.size();
   const size_t prevPrimCount  = m_renderPrimitives.size();
   const size_t prevLightCount = m_lights.size();
@@ -1378,7 +1587,8 @@ void nvvkgltf::Scene::parseScene()
   clearParsedData();
   setSceneElementsDefaultNames();
   // Create tangents from model meshes so primitive keys are stable (no render nodes yet).
-  createMissingTangentsForModel();
+  if(m_createMissingTangents)
+    createMissingTangentsForModel();
 
   // Build the list of unique RenderPrimitives in deterministic order (by mesh index, then primitive index).
   // CRITICAL: There is a direct correlation between BLAS and primitive index. BLAS are built once
@@ -1433,6 +1643,10 @@ void nvvkgltf::Scene::parseScene()
   // We are updating the scene to the first state, animation, skinning, morph, ..
   updateRenderNodesFull();
 
+  // Variant switches only touch the render nodes resolved here
+  if(!m_variants.empty())
+    buildVariantMaterialTable();
+
   // Marking GPU elements dirty is deferred until the end of parseScene so that we can diff against the rebuilt state and set precise dirty flags.
   // Compare rebuilt state to snapshot and set precise dirty flags.
   // Two-pass for render nodes: count first, then only populate hash sets if below kFullUpdateRatio changed.
@@ -1449,10 +1663,13 @@ void nvvkgltf::Scene::parseScene()
       std::vector<int> dirtyIndices;
       dirtyIndices.reserve(std::min(fullUpdateThreshold + 1, newRN.size()));
 
+      const auto newWorld = newRN.worldMatrices(), prevWorld = prevRN.worldMatrices();
+      const auto newMat = newRN.materialIDs(), prevMat = prevRN.materialIDs();
+      const auto newPrim = newRN.renderPrimIDs(), prevPrim = prevRN.renderPrimIDs();
+      const auto newVis = newRN.visibility(), prevVis = prevRN.visibility();
       for(size_t i = 0; i < newRN.size(); i++)
       {
-        if(newRN[i].worldMatrix != prevRN[i].worldMatrix || newRN[i].materialID != prevRN[i].materialID
-           || newRN[i].renderPrimID != prevRN[i].renderPrimID || newRN[i].visible != prevRN[i].visible)
+        if(newWorld[i] != prevWorld[i] || newMat[i] != prevMat[i] || newPrim[i] != prevPrim[i] || newVis[i] != prevVis[i])
         {
           dirtyIndices.push_back(static_cast<int>(i));
           if(dirtyIndices.size() > fullUpdateThreshold)
@@ -1600,8 +1817,9 @@ void nvvkgltf::Scene::createSceneCamera()
 // and only computes matrix multiplications for nodes in dirty subtrees. Falls back to a serial
 // filtered-root recursive walk when topological levels aren't built yet.
 //
-// Both paths insert affected render nodes into renderNodesVk/Rtx (preserving pre-existing
-// flags from other sources), so callers never need a separate updateRenderNodeDirtyFromNodes().
+// Both paths insert affected render nodes into renderNodesVk/Rtx, or set allRenderNodesVk/Rtx when
+// most of them moved (preserving pre-existing flags from other sources), so callers never need a
+// separate updateRenderNodeDirtyFromNodes().
 //
 void nvvkgltf::Scene::updateNodeWorldMatrices()
 {
@@ -1622,6 +1840,37 @@ void nvvkgltf::Scene::updateNodeWorldMatrices()
     updateWorldMatricesSerial();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Same writes as updateWorldMatricesParallel() for a dirty set without instance batches, from
+// matrices prepared elsewhere; the render-node list is already in the order it collects them.
+//
+void nvvkgltf::Scene::setNodeMatrices(std::span<const int>       dirtyNodes,
+                                      std::span<const glm::mat4> localMatrices,
+                                      std::span<const int>       movedNodes,
+                                      std::span<const glm::mat4> worldMatrices,
+                                      std::span<const int>       movedRenderNodes,
+                                      std::span<const glm::mat4> renderNodeWorldMatrices)
+{
+  assert(dirtyNodes.size() == localMatrices.size() && movedNodes.size() == worldMatrices.size()
+         && movedRenderNodes.size() == renderNodeWorldMatrices.size());
+
+  for(size_t i = 0; i < dirtyNodes.size(); i++)
+    m_nodesLocalMatrices[dirtyNodes[i]] = localMatrices[i];
+
+  for(size_t i = 0; i < movedNodes.size(); i++)
+  {
+    const int nodeID             = movedNodes[i];
+    m_nodesWorldMatrices[nodeID] = worldMatrices[i];
+    if(m_model.nodes[nodeID].light >= 0)
+      m_lights[m_model.nodes[nodeID].light].worldMatrix = worldMatrices[i];
+  }
+
+  std::span<glm::mat4> rnWorldMatrices = m_renderNodeRegistry.getRenderNodes().worldMatrices();
+  for(size_t i = 0; i < movedRenderNodes.size(); i++)
+    rnWorldMatrices[movedRenderNodes[i]] = renderNodeWorldMatrices[i];
+  markMovedRenderNodesDirty(movedRenderNodes, {});
+}
+
 //--------------------------------------------------------------------------------------------------
 // Fold the nodes the GPU transform path moved on-device into the dirty set so the next
 // updateNodeWorldMatrices() recomputes only those subtrees (restoring the CPU mirror the CPU sync path
@@ -1709,7 +1958,9 @@ void nvvkgltf::Scene::updateWorldMatricesSerial()
       filteredDirtyNodes.push_back(nodeID);
   }
 
-  const bool hasGpuInstancing = !m_gpuInstanceLocalMatrices.empty();  // Special case (KHR_instancing)
+  std::span<glm::mat4>       rnWorldMatrices = m_renderNodeRegistry.getRenderNodes().worldMatrices();
+  std::vector<int>           movedRenderNodes;
+  std::vector<InstanceBatch> movedBatches;
 
   // Lambda for recursive world matrix update walk. Captures filteredDirtyNodes by reference and walks the entire subtree of each entry.
   std::function<void(int)> updateMatrix;
@@ -1723,31 +1974,22 @@ void nvvkgltf::Scene::updateWorldMatricesSerial()
     // so this avoids expensive hash-map lookups for the vast majority of nodes)
     if(node.mesh >= 0)
     {
-      const glm::mat4* instMatrices = nullptr;
-      size_t           instCount    = 0;
-
-      // Special case for KHR_instancing: look up instance matrices for this node if they exist, and apply them to each render node.
-      if(hasGpuInstancing)
+      // EXT_mesh_gpu_instancing: the instance world matrices are generated from the node's batches.
+      std::span<const InstanceBatch> batches = m_renderNodeRegistry.getInstanceBatchesForNode(nodeID);
+      for(const InstanceBatch& batch : batches)
       {
-        auto instIt = m_gpuInstanceLocalMatrices.find(nodeID);
-        if(instIt != m_gpuInstanceLocalMatrices.end() && !instIt->second.empty())
-        {
-          instMatrices = instIt->second.data();
-          instCount    = instIt->second.size();
-        }
+        updateInstanceBatchMatrices(batch, m_nodesWorldMatrices[nodeID]);
+        movedBatches.push_back(batch);
       }
 
-      // Find all render nodes for this node and update their world matrices.
-      // If "instance matrices" exist, multiply them with the node's world matrix; otherwise use the node's world matrix directly.
-      size_t idx = 0;
-      for(int renderNodeID : m_renderNodeRegistry.getRenderNodesForNode(nodeID))
+      // Otherwise, all render nodes for this node take the node's world matrix.
+      if(batches.empty())
       {
-        m_renderNodeRegistry.getRenderNodes()[renderNodeID].worldMatrix =
-            (instMatrices && instCount > 0) ? m_nodesWorldMatrices[nodeID] * instMatrices[idx % instCount] :
-                                              m_nodesWorldMatrices[nodeID];
-        m_dirtyFlags.renderNodesVk.insert(renderNodeID);
-        m_dirtyFlags.renderNodesRtx.insert(renderNodeID);
-        idx++;
+        for(int renderNodeID : m_renderNodeRegistry.getRenderNodesForNode(nodeID))
+        {
+          rnWorldMatrices[renderNodeID] = m_nodesWorldMatrices[nodeID];
+          movedRenderNodes.push_back(renderNodeID);
+        }
       }
     }
 
@@ -1760,6 +2002,8 @@ void nvvkgltf::Scene::updateWorldMatricesSerial()
 
   for(int nodeID : filteredDirtyNodes)
     updateMatrix(nodeID);
+
+  markMovedRenderNodesDirty(movedRenderNodes, movedBatches);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1792,11 +2036,15 @@ void nvvkgltf::Scene::updateWorldMatricesParallel()
   std::vector<uint8_t> subtreeDirty(numNodes, 0);
   std::vector<uint8_t> rnDirtyBits(numRenderNodes, 0);
 
-  const bool hasGpuInstancing = !m_gpuInstanceLocalMatrices.empty();
+  // EXT_mesh_gpu_instancing nodes are skipped by the level walk; their batches are expanded after it.
+  const bool hasInstanceBatches = !m_renderNodeRegistry.getInstanceBatches().empty();
+
+  // Only the world-matrix column is written; workers touch one contiguous array instead of whole render nodes.
+  std::span<glm::mat4> rnWorldMatrices = m_renderNodeRegistry.getRenderNodes().worldMatrices();
 
   for(const auto& [offset, count] : m_topoLevels.levels)
   {
-    nvutils::parallel_batches(static_cast<uint64_t>(count), [&](uint64_t i) {
+    nvvkgltf::parallelFor(static_cast<uint64_t>(count), [&](uint64_t i) {
       int                   nodeID = m_topoLevels.nodeOrder[offset + i];
       int                   parent = m_nodeParents[nodeID];
       const tinygltf::Node& node   = m_model.nodes[nodeID];
@@ -1810,30 +2058,13 @@ void nvvkgltf::Scene::updateWorldMatricesParallel()
       glm::mat4 parentMat          = parent >= 0 ? m_nodesWorldMatrices[parent] : glm::mat4(1.0f);
       m_nodesWorldMatrices[nodeID] = parentMat * m_nodesLocalMatrices[nodeID];
 
-      if(node.mesh >= 0)
+      if(node.mesh >= 0 && !(hasInstanceBatches && !m_renderNodeRegistry.getInstanceBatchesForNode(nodeID).empty()))
       {
-        const glm::mat4* instMatrices = nullptr;
-        size_t           instCount    = 0;
-
-        if(hasGpuInstancing)  // Special case for KHR_instancing: look up instance matrices for this node if they exist, and apply them to each render node.
-        {
-          auto instIt = m_gpuInstanceLocalMatrices.find(nodeID);
-          if(instIt != m_gpuInstanceLocalMatrices.end() && !instIt->second.empty())
-          {
-            instMatrices = instIt->second.data();
-            instCount    = instIt->second.size();
-          }
-        }
-
         // Find all render nodes for this node and update their world matrices.
-        size_t idx = 0;
         for(int renderNodeID : m_renderNodeRegistry.getRenderNodesForNode(nodeID))
         {
-          m_renderNodeRegistry.getRenderNodes()[renderNodeID].worldMatrix =
-              (instMatrices && instCount > 0) ? m_nodesWorldMatrices[nodeID] * instMatrices[idx % instCount] :
-                                                m_nodesWorldMatrices[nodeID];
-          rnDirtyBits[renderNodeID] = 1;
-          idx++;
+          rnWorldMatrices[renderNodeID] = m_nodesWorldMatrices[nodeID];
+          rnDirtyBits[renderNodeID]     = 1;
         }
       }
 
@@ -1842,15 +2073,84 @@ void nvvkgltf::Scene::updateWorldMatricesParallel()
     });
   }
 
+  // Instance batches under a dirty subtree: each one is a single record, expanded with all threads.
+  std::vector<InstanceBatch> movedBatches;
+  for(const InstanceBatch& batch : m_renderNodeRegistry.getInstanceBatches())
+  {
+    if(subtreeDirty[batch.nodeID])
+    {
+      updateInstanceBatchMatrices(batch, m_nodesWorldMatrices[batch.nodeID]);
+      movedBatches.push_back(batch);
+    }
+  }
+
   // Convert dirty bits to dirty sets (preserving pre-existing flags).
   // The downstream syncFromScene/syncTopLevelAS decide bulk vs surgical upload
   // based on the dirty ratio
+  std::vector<int> movedRenderNodes;
   for(size_t i = 0; i < numRenderNodes; ++i)
   {
     if(rnDirtyBits[i])
+      movedRenderNodes.push_back(static_cast<int>(i));
+  }
+  markMovedRenderNodesDirty(movedRenderNodes, movedBatches);
+}
+
+//--------------------------------------------------------------------------------------------------
+// World matrices of an EXT_mesh_gpu_instancing batch: the node's world matrix times each instance
+// transform. Large batches are split across threads.
+//
+void nvvkgltf::Scene::updateInstanceBatchMatrices(const InstanceBatch& batch, const glm::mat4& nodeWorld)
+{
+  auto instIt = m_gpuInstanceLocalMatrices.find(batch.nodeID);
+  if(instIt == m_gpuInstanceLocalMatrices.end() || instIt->second.size() < size_t(batch.instanceCount))
+    return;
+
+  const glm::mat4*     locals = instIt->second.data();
+  std::span<glm::mat4> world =
+      m_renderNodeRegistry.getRenderNodes().worldMatrices().subspan(batch.firstRenderNode, batch.instanceCount);
+  if(world.size() < kInstanceBatchGrain)
+  {
+    for(size_t i = 0; i < world.size(); i++)
+      world[i] = nodeWorld * locals[i];
+  }
+  else
+  {
+    nvvkgltf::parallelFor<kInstanceBatchGrain>(world.size(), [&](uint64_t i) { world[i] = nodeWorld * locals[i]; });
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Record the render nodes whose world matrix was just rewritten, for SceneVk and SceneRtx. Once they
+// reach kFullUpdateRatio of all render nodes both would do a full upload, so the all-dirty flags are
+// set instead of inserting every index (a moved batch of a million instances costs one flag).
+//
+void nvvkgltf::Scene::markMovedRenderNodesDirty(std::span<const int> renderNodeIDs, std::span<const InstanceBatch> batches)
+{
+  size_t count = renderNodeIDs.size();
+  for(const InstanceBatch& batch : batches)
+    count += batch.instanceCount;
+  if(count == 0)
+    return;
+
+  if(float(count) >= float(m_renderNodeRegistry.getRenderNodes().size()) * kFullUpdateRatio)
+  {
+    m_dirtyFlags.allRenderNodesVk  = true;
+    m_dirtyFlags.allRenderNodesRtx = true;
+    return;
+  }
+
+  for(int renderNodeID : renderNodeIDs)
+  {
+    m_dirtyFlags.renderNodesVk.insert(renderNodeID);
+    m_dirtyFlags.renderNodesRtx.insert(renderNodeID);
+  }
+  for(const InstanceBatch& batch : batches)
+  {
+    for(int i = 0; i < batch.instanceCount; i++)
     {
-      m_dirtyFlags.renderNodesVk.insert(static_cast<int>(i));
-      m_dirtyFlags.renderNodesRtx.insert(static_cast<int>(i));
+      m_dirtyFlags.renderNodesVk.insert(batch.firstRenderNode + i);
+      m_dirtyFlags.renderNodesRtx.insert(batch.firstRenderNode + i);
     }
   }
 }
@@ -1949,7 +2249,10 @@ void nvvkgltf::Scene::traverseSceneWithVisibility(const std::function<void(int n
 // the node's parent,  and the render node indices for each node.
 void nvvkgltf::Scene::updateRenderNodesFull()
 {
-  std::vector<nvvkgltf::RenderNode>& renderNodes = m_renderNodeRegistry.getRenderNodes();
+  nvvkgltf::RenderNodeArrays& renderNodes     = m_renderNodeRegistry.getRenderNodes();
+  std::span<glm::mat4>        rnWorldMatrices = renderNodes.worldMatrices();
+  std::span<int>              rnMaterialIDs   = renderNodes.materialIDs();
+  std::span<uint8_t>          rnVisibility    = renderNodes.visibility();
 
   traverseSceneWithVisibility([&](int nodeID, const glm::mat4& worldMat, bool visible) {
     tinygltf::Node& tnode = m_model.nodes[nodeID];
@@ -1961,29 +2264,28 @@ void nvvkgltf::Scene::updateRenderNodesFull()
 
     if(tnode.mesh > -1)
     {
-      const tinygltf::Mesh&   mesh         = m_model.meshes[tnode.mesh];
-      const std::vector<int>& rnIDs        = m_renderNodeRegistry.getRenderNodesForNode(nodeID);
-      auto                    instIt       = m_gpuInstanceLocalMatrices.find(nodeID);
-      size_t                  numInstances = (instIt != m_gpuInstanceLocalMatrices.end()) ? instIt->second.size() : 0;
-      size_t                  instIdx      = 0;
+      const tinygltf::Mesh&          mesh    = m_model.meshes[tnode.mesh];
+      const std::vector<int>&        rnIDs   = m_renderNodeRegistry.getRenderNodesForNode(nodeID);
+      std::span<const InstanceBatch> batches = m_renderNodeRegistry.getInstanceBatchesForNode(nodeID);
+
+      // EXT_mesh_gpu_instancing: world matrices generated from the batches
+      for(const InstanceBatch& batch : batches)
+        updateInstanceBatchMatrices(batch, worldMat);
 
       for(int rnID : rnIDs)
       {
         if(rnID >= 0 && static_cast<size_t>(rnID) < renderNodes.size())
         {
-          if(numInstances > 0)
-            renderNodes[rnID].worldMatrix = worldMat * instIt->second[instIdx % numInstances];
-          else
-            renderNodes[rnID].worldMatrix = worldMat;
+          if(batches.empty())
+            rnWorldMatrices[rnID] = worldMat;
 
-          renderNodes[rnID].visible = visible;
-          auto nodeAndPrim          = m_renderNodeRegistry.getNodeAndPrim(rnID);
+          rnVisibility[rnID] = visible ? 1 : 0;
+          auto nodeAndPrim   = m_renderNodeRegistry.getNodeAndPrim(rnID);
           if(nodeAndPrim && nodeAndPrim->first == nodeID && nodeAndPrim->second >= 0
              && static_cast<size_t>(nodeAndPrim->second) < mesh.primitives.size())
           {
-            renderNodes[rnID].materialID = getMaterialVariantIndex(mesh.primitives[nodeAndPrim->second], m_currentVariant);
+            rnMaterialIDs[rnID] = getMaterialVariantIndex(mesh.primitives[nodeAndPrim->second], m_currentVariant);
           }
-          instIdx++;
         }
       }
     }
@@ -2035,40 +2337,87 @@ void nvvkgltf::Scene::rebuildRenderNodesAndLights()
 // VARIANT MANAGEMENT
 //--------------------------------------------------------------------------------------------------
 
+// Switch variant with a linear pass over the render nodes that have variant mappings (render nodes
+// without any keep their material). The table is rebuilt only when the render nodes or the scene
+// graph changed since it was resolved.
 void nvvkgltf::Scene::setCurrentVariant(int variant)
 {
   m_currentVariant = variant;
 
-  bool anyMaterialIdChanged = false;
-  for(int nodeID = 0; nodeID < static_cast<int>(m_model.nodes.size()); nodeID++)
+  std::span<int> rnMaterialIDs = m_renderNodeRegistry.getRenderNodes().materialIDs();
+  if(m_variantTable.sceneGraphRevision != m_sceneGraphRevision || m_variantTable.renderNodeCount != rnMaterialIDs.size())
+    buildVariantMaterialTable();
+
+  const VariantMaterialTable& table  = m_variantTable;
+  const size_t                stride = size_t(table.variantCount) + 1;
+  const size_t column = (variant >= 0 && variant < table.variantCount) ? size_t(variant) : size_t(table.variantCount);
+
+  std::vector<int> changed;
+  for(size_t i = 0; i < table.renderNodes.size(); i++)
+  {
+    const int rnID     = table.renderNodes[i];
+    const int newMatId = table.materials[size_t(table.rows[i]) * stride + column];
+    if(rnMaterialIDs[rnID] != newMatId)
+    {
+      rnMaterialIDs[rnID] = newMatId;
+      changed.push_back(rnID);
+    }
+  }
+  if(changed.empty())
+    return;
+
+  // Same ratio SceneVk uses to pick a full upload: past it, one flag instead of every index
+  if(float(changed.size()) >= float(rnMaterialIDs.size()) * kFullUpdateRatio)
+    m_dirtyFlags.allRenderNodesVk = true;
+  else
+    m_dirtyFlags.renderNodesVk.insert(changed.begin(), changed.end());
+
+  ++m_sceneGraphRevision;  // GPU RenderNodeGpuMapping SSBO must pick up new material IDs
+  m_variantTable.sceneGraphRevision = m_sceneGraphRevision;  // Only material IDs changed: the table still holds
+}
+
+//--------------------------------------------------------------------------------------------------
+// Resolve KHR_materials_variants once for the current render nodes: one row per mesh primitive with
+// mappings, holding the material of every variant, shared by all the render nodes drawing it.
+//
+void nvvkgltf::Scene::buildVariantMaterialTable()
+{
+  VariantMaterialTable& table = m_variantTable;
+  table.renderNodes.clear();
+  table.rows.clear();
+  table.materials.clear();
+  table.variantCount       = static_cast<int>(m_variants.size());
+  table.renderNodeCount    = m_renderNodeRegistry.getRenderNodes().size();
+  table.sceneGraphRevision = m_sceneGraphRevision;
+  if(m_variants.empty())
+    return;
+
+  std::unordered_map<uint64_t, int> rowOfPrimitive;  // (mesh, primitive) -> row
+  for(int rnID = 0; rnID < static_cast<int>(table.renderNodeCount); rnID++)
   {
-    const std::vector<int>& rnIds = m_renderNodeRegistry.getRenderNodesForNode(nodeID);
-    if(rnIds.empty())
+    auto nodeAndPrim = m_renderNodeRegistry.getNodeAndPrim(rnID);
+    if(!nodeAndPrim || nodeAndPrim->first < 0 || m_model.nodes[nodeAndPrim->first].mesh < 0)
       continue;
-    tinygltf::Node& tnode = m_model.nodes[nodeID];
-    if(tnode.mesh > -1)
+    const int             meshID = m_model.nodes[nodeAndPrim->first].mesh;
+    const tinygltf::Mesh& mesh   = m_model.meshes[meshID];
+    const int primIdx = (nodeAndPrim->second >= 0 && static_cast<size_t>(nodeAndPrim->second) < mesh.primitives.size()) ?
+                            nodeAndPrim->second :
+                            0;
+    const tinygltf::Primitive& primitive = mesh.primitives[primIdx];
+    if(primitive.extensions.find(KHR_MATERIALS_VARIANTS_EXTENSION_NAME) == primitive.extensions.end())
+      continue;
+
+    const uint64_t key = (static_cast<uint64_t>(meshID) << 32) | static_cast<uint32_t>(primIdx);
+    auto [it, inserted] = rowOfPrimitive.try_emplace(key, static_cast<int>(rowOfPrimitive.size()));
+    if(inserted)
     {
-      tinygltf::Mesh& mesh = m_model.meshes[tnode.mesh];
-      for(int rnID : rnIds)
-      {
-        auto nodeAndPrim = m_renderNodeRegistry.getNodeAndPrim(rnID);
-        int  primIdx =
-            (nodeAndPrim && nodeAndPrim->second >= 0 && static_cast<size_t>(nodeAndPrim->second) < mesh.primitives.size()) ?
-                 nodeAndPrim->second :
-                 0;
-        int beforeMatID = m_renderNodeRegistry.getRenderNodes()[rnID].materialID;
-        int newMatId    = getMaterialVariantIndex(mesh.primitives[primIdx], m_currentVariant);
-        if(beforeMatID != newMatId)
-        {
-          anyMaterialIdChanged = true;
-          m_dirtyFlags.renderNodesVk.insert(rnID);
-        }
-        m_renderNodeRegistry.getRenderNodes()[rnID].materialID = newMatId;
-      }
+      for(int v = 0; v < table.variantCount; v++)
+        table.materials.push_back(getMaterialVariantIndex(primitive, v));
+      table.materials.push_back(std::max(0, primitive.material));
     }
+    table.renderNodes.push_back(rnID);
+    table.rows.push_back(it->second);
   }
-  if(anyMaterialIdChanged)
-    ++m_sceneGraphRevision;  // GPU RenderNodeGpuMapping SSBO must pick up new material IDs
 }
 
 
@@ -2082,6 +2431,7 @@ void nvvkgltf::Scene::clearParsedData()
   m_renderPrimitives.clear();
   m_renderPrimCenterObj.clear();
   m_variants.clear();
+  m_variantTable = {};
   m_nodeParents.clear();
   m_nodesLocalMatrices.clear();
   m_gpuInstanceLocalMatrices.clear();
@@ -2305,7 +2655,7 @@ nvutils::Bbox nvvkgltf::Scene::getSceneBounds() const
   if(!m_sceneBounds.isEmpty())
     return m_sceneBounds;
 
-  for(const nvvkgltf::RenderNode& rnode : m_renderNodeRegistry.getRenderNodes())
+  for(const auto& rnode : m_renderNodeRegistry.getRenderNodes())
   {
     glm::vec3 minValues = {0.f, 0.f, 0.f};
     glm::vec3 maxValues = {0.f, 0.f, 0.f};
@@ -2383,8 +2733,9 @@ bool nvvkgltf::Scene::handleRenderNode(int nodeID, glm::mat4 worldMatrix, const
 
 // Handle GPU instancing : EXT_mesh_gpu_instancing
 // Called once per primitive; the per-instance local transforms are shared across primitives
-// of the same node and cached in m_gpuInstanceLocalMatrices for use by updateRenderNodesFull
-// and updateNodeWorldMatrices.
+// of the same node and cached in m_gpuInstanceLocalMatrices. Each primitive becomes one
+// InstanceBatch, from which updateRenderNodesFull and updateNodeWorldMatrices regenerate the
+// instance world matrices.
 size_t nvvkgltf::Scene::handleGpuInstancing(const tinygltf::Value& attributes,
                                             nvvkgltf::RenderNode   renderNode,
                                             glm::mat4              worldMatrix,
@@ -2412,14 +2763,9 @@ size_t nvvkgltf::Scene::handleGpuInstancing(const tinygltf::Value& attributes,
     }
   }
 
-  const std::vector<glm::mat4>& localMatrices = it->second;
-  for(size_t i = 0; i < localMatrices.size(); i++)
-  {
-    nvvkgltf::RenderNode instNode = renderNode;
-    instNode.worldMatrix          = worldMatrix * localMatrices[i];
-    m_renderNodeRegistry.addRenderNode(instNode, nodeID, primIndex);
-  }
-  return localMatrices.size();
+  renderNode.worldMatrix = worldMatrix;
+  m_renderNodeRegistry.addInstanceBatch(renderNode, nodeID, primIndex, it->second);
+  return it->second.size();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -2450,6 +2796,8 @@ void nvvkgltf::Scene::createMissingTangentsForModel()
     }
   }
 
+  if(!keyToPrimitives.empty())
+    waitForSaves();  // The tangents are appended to the buffers
   for(auto& [key, primitives] : keyToPrimitives)
   {
     if(primitives.empty())
@@ -2469,10 +2817,10 @@ void nvvkgltf::Scene::createMissingTangentsForModel()
 std::unordered_set<int> nvvkgltf::Scene::getMaterialRenderNodes(const std::unordered_set<int>& materialVariantNodeIDs) const
 {
   std::unordered_set<int> renderNodes;
-  const auto&             rnodes = m_renderNodeRegistry.getRenderNodes();
-  for(size_t i = 0; i < rnodes.size(); i++)
+  std::span<const int>    materialIDs = m_renderNodeRegistry.getRenderNodes().materialIDs();
+  for(size_t i = 0; i < materialIDs.size(); i++)
   {
-    if(materialVariantNodeIDs.contains(rnodes[i].materialID))
+    if(materialVariantNodeIDs.contains(materialIDs[i]))
     {
       renderNodes.insert(int(i));
     }
@@ -2518,8 +2866,8 @@ uint8_t nvvkgltf::Scene::computeMaterialBucketKey(const tinygltf::Material& mat)
 //
 void nvvkgltf::Scene::reconcileShadedNodesCache() const
 {
-  const size_t materialCount = m_model.materials.size();
-  const auto&  renderNodes   = m_renderNodeRegistry.getRenderNodes();
+  const size_t         materialCount = m_model.materials.size();
+  std::span<const int> materialIDs   = m_renderNodeRegistry.getRenderNodes().materialIDs();
 
   bool needsRebuild = !m_shadedCacheValid;
 
@@ -2579,9 +2927,10 @@ void nvvkgltf::Scene::reconcileShadedNodesCache() const
       m_hasTransmissionCache = true;
   }
 
-  for(uint32_t i = 0; i < renderNodes.size(); ++i)
+  // Bucketing reads the material column only.
+  for(uint32_t i = 0; i < materialIDs.size(); ++i)
   {
-    const int matID = renderNodes[i].materialID;
+    const int matID = materialIDs[i];
     if(matID < 0 || static_cast<size_t>(matID) >= materialCount)
       continue;
     const uint8_t key             = m_materialBucketKey[matID];
@@ -27,7 +27,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -38,6 +40,8 @@
 
 #include "tinygltf_utils.hpp"
 #include "gltf_animation_pointer.hpp"
+#include "gltf_scene_save.hpp"
+#include "host_memory_tracker.hpp"
 
 
 namespace nvvkgltf {
@@ -57,6 +61,93 @@ struct RenderNode
   bool      visible      = true;
 };
 
+// Render nodes stored as parallel arrays (structure of arrays), one column per RenderNode field.
+// Per-frame passes (world-matrix writes, visibility, material bucketing, GPU upload) walk only the
+// columns they need. RenderNode stays the value type used to add nodes; operator[] and iteration
+// return a view whose members reference the columns, so `nodes[i].worldMatrix = m` and
+// `const auto& rn = nodes[i]` keep working for code that handles one render node at a time.
+class RenderNodeArrays
+{
+public:
+  template <bool IsConst>
+  struct BasicRef
+  {
+    template <typename T>
+    using Field = std::conditional_t<IsConst, const T&, T&>;
+
+    Field<glm::mat4> worldMatrix;
+    Field<int>       materialID;
+    Field<int>       renderPrimID;
+    Field<int>       refNodeID;
+    Field<int>       skinID;
+    Field<uint8_t>   visible;  // 0 or 1; uint8_t so each node has its own byte (see visibility())
+
+    operator RenderNode() const { return {worldMatrix, materialID, renderPrimID, refNodeID, skinID, visible != 0}; }
+  };
+  using Ref      = BasicRef<false>;
+  using ConstRef = BasicRef<true>;
+
+  template <bool IsConst>
+  class BasicIterator
+  {
+  public:
+    using Owner = std::conditional_t<IsConst, const RenderNodeArrays, RenderNodeArrays>;
+    BasicIterator(Owner* owner, size_t index)
+        : m_owner(owner)
+        , m_index(index)
+    {
+    }
+    BasicRef<IsConst> operator*() const { return (*m_owner)[m_index]; }
+    BasicIterator&    operator++()
+    {
+      ++m_index;
+      return *this;
+    }
+    bool operator==(const BasicIterator& other) const { return m_index == other.m_index; }
+    bool operator!=(const BasicIterator& other) const { return m_index != other.m_index; }
+
+  private:
+    Owner* m_owner = nullptr;
+    size_t m_index = 0;
+  };
+
+  [[nodiscard]] size_t size() const { return m_worldMatrices.size(); }
+  [[nodiscard]] bool   empty() const { return m_worldMatrices.empty(); }
+
+  void reserve(size_t count);
+  void push_back(const RenderNode& node);
+  void clear();
+
+  [[nodiscard]] uint64_t sizeInBytes() const;  // Heap size of the columns
+
+  Ref      operator[](size_t i);
+  ConstRef operator[](size_t i) const;
+
+  BasicIterator<false> begin() { return {this, 0}; }
+  BasicIterator<false> end() { return {this, size()}; }
+  BasicIterator<true>  begin() const { return {this, 0}; }
+  BasicIterator<true>  end() const { return {this, size()}; }
+
+  // Columns, indexed by renderNodeID. Mutable spans allow concurrent writes to distinct indices.
+  std::span<const glm::mat4> worldMatrices() const { return m_worldMatrices; }
+  std::span<glm::mat4>       worldMatrices() { return m_worldMatrices; }
+  std::span<const int>       materialIDs() const { return m_materialIDs; }
+  std::span<int>             materialIDs() { return m_materialIDs; }
+  std::span<const int>       renderPrimIDs() const { return m_renderPrimIDs; }
+  std::span<const int>       refNodeIDs() const { return m_refNodeIDs; }
+  std::span<const int>       skinIDs() const { return m_skinIDs; }
+  std::span<const uint8_t>   visibility() const { return m_visible; }
+  std::span<uint8_t>         visibility() { return m_visible; }
+
+private:
+  std::vector<glm::mat4> m_worldMatrices;
+  std::vector<int>       m_materialIDs;
+  std::vector<int>       m_renderPrimIDs;
+  std::vector<int>       m_refNodeIDs;
+  std::vector<int>       m_skinIDs;
+  std::vector<uint8_t>   m_visible;  // Not std::vector<bool>: parallel writers need one byte per node
+};
+
 // The RenderPrimitive is a unique primitive in the scene
 struct RenderPrimitive
 {
@@ -79,6 +170,29 @@ struct ReferencedAsset
   std::vector<int> subtreeNodes;             // merged-in node indices (read-only)
 };
 
+// What a mergeScene()/referenceScene() appended, as [begin, end) index ranges into the parsed
+// arrays. Only reported when everything that existed before the import kept its index, so GPU
+// resources built for the old ranges stay valid and only the new ranges need uploading.
+struct SceneAppendInfo
+{
+  struct Range
+  {
+    uint32_t begin = 0;
+    uint32_t end   = 0;
+
+    [[nodiscard]] uint32_t count() const { return end - begin; }
+    [[nodiscard]] bool     empty() const { return end == begin; }
+  };
+
+  Range meshes;
+  Range images;
+  Range textures;
+  Range materials;
+  Range renderPrimitives;
+  Range renderNodes;
+  Range lights;
+};
+
 struct RenderCamera
 {
   enum CameraType
@@ -111,6 +225,23 @@ struct RenderLight
   int       nodeID      = -1;
 };
 
+// EXT_mesh_gpu_instancing: the instances of one primitive of an instanced node. They occupy a
+// contiguous range of render nodes, instance i being render node firstRenderNode + i, whose world
+// matrix is the node's world matrix times the node's i-th instance transform. World-matrix updates,
+// dirty tracking and raster draws work on the range instead of on each instance.
+struct InstanceBatch
+{
+  int nodeID          = -1;
+  int primIndex       = -1;
+  int firstRenderNode = 0;
+  int instanceCount   = 0;
+
+  [[nodiscard]] bool contains(int renderNodeID) const
+  {
+    return renderNodeID >= firstRenderNode && renderNodeID < firstRenderNode + instanceCount;
+  }
+};
+
 // Centralized registry for renderNode mappings (nodeID/primID <-> renderNodeID).
 // Provides O(1) bidirectional lookups and sparse storage for nodes with meshes.
 class RenderNodeRegistry
@@ -118,6 +249,10 @@ class RenderNodeRegistry
 public:
   // Add a render node; returns the new renderNodeID.
   int addRenderNode(const RenderNode& node, int nodeID, int primIndex);
+  // Add the render nodes of an instanced primitive, one per instance transform (world matrix =
+  // node.worldMatrix * instanceLocals[i]); returns the batch index. The primitives of a node must
+  // be added one after the other, so its batches stay contiguous.
+  int addInstanceBatch(const RenderNode& node, int nodeID, int primIndex, std::span<const glm::mat4> instanceLocals);
 
   // Lookups
   int getRenderNodeID(int nodeID, int primIndex) const;  // (nodeID, primID) -> RenderNodeID, -1 if not found
@@ -127,15 +262,22 @@ public:
   // Batch: collect all renderNodeIDs for node and its descendants. getChildren(nodeID) returns child node indices.
   void getAllRenderNodesForNodeRecursive(int nodeID, std::function<std::vector<int>(int)> getChildren, std::vector<int>& outRenderNodeIDs) const;
 
+  // EXT_mesh_gpu_instancing batches, all of them or those of one node (one per primitive)
+  const std::vector<InstanceBatch>& getInstanceBatches() const { return m_instanceBatches; }
+  std::span<const InstanceBatch>    getInstanceBatchesForNode(int nodeID) const;
+  const InstanceBatch*              findInstanceBatch(int renderNodeID) const;  // nullptr if not an instance
+
   // Clear all mappings and the flat array.
   void clear();
 
-  // Direct access to flat array (for GPU upload).
-  const std::vector<RenderNode>& getRenderNodes() const { return m_renderNodes; }
-  std::vector<RenderNode>&       getRenderNodes() { return m_renderNodes; }
+  [[nodiscard]] uint64_t sizeInBytes() const;  // Columns, mappings and batches
+
+  // Direct access to the render-node columns (for GPU upload and per-frame passes).
+  const RenderNodeArrays& getRenderNodes() const { return m_renderNodes; }
+  RenderNodeArrays&       getRenderNodes() { return m_renderNodes; }
 
 private:
-  std::vector<RenderNode> m_renderNodes;
+  RenderNodeArrays m_renderNodes;
 
   // Forward: (nodeID, primIndex) -> renderNodeID
   std::unordered_map<uint64_t, int> m_nodeAndPrimToRenderNode;
@@ -146,6 +288,10 @@ private:
   // Grouped by node: nodeID -> [renderNodeIDs] (sparse, only nodes with meshes)
   std::unordered_map<int, std::vector<int>> m_nodeToRenderNodes;
 
+  // EXT_mesh_gpu_instancing batches; nodeID -> (first batch, batch count)
+  std::vector<InstanceBatch>                   m_instanceBatches;
+  std::unordered_map<int, std::pair<int, int>> m_nodeToInstanceBatches;
+
   // Empty vector returned when node has no render nodes
   static const std::vector<int> s_emptyRenderNodes;
 
@@ -263,15 +409,46 @@ public:
   // (default) re-externalizes them (small file, keeps references), while selfContained=true bakes
   // the merged content inline and drops all external references (portable, shareable file).
   [[nodiscard]] bool save(const std::filesystem::path& filename, bool selfContained = false);
+  // The two halves of save() for a background save: validate and copy the model here (the buffers
+  // are shared, see waitForSaves()), write the snapshot on any thread (writeSceneSnapshot /
+  // AsyncSceneSave), then report the written file back with onSaved(). std::nullopt if validation
+  // fails.
+  [[nodiscard]] std::optional<SceneSaveSnapshot> makeSaveSnapshot(const std::filesystem::path& filename, bool selfContained = false);
+  void onSaved(const std::filesystem::path& savedFilename);
+  // Snapshots being written read the buffers of the model. Changes to them wait for those saves:
+  // the scene's own (load, merge, compaction, generated tangents, ...) do, and so must the code that
+  // resizes or writes buffer data through getModel().
+  void               waitForSaves() const { m_saveReaders->wait(); }
+  [[nodiscard]] bool isSaving() const { return m_saveReaders->busy(); }
+  // Threads copying the referenced image files during save() (0: hardware concurrency)
+  void setImageSaveConcurrency(uint32_t threads) { m_imageSaveConcurrency = threads; }
+  // Generate TANGENT for normal-mapped primitives without one when parsing (default). Offline
+  // tools turn it off to write a file without the generated tangents.
+  void setCreateMissingTangents(bool create) { m_createMissingTangents = create; }
   // Merge another glTF into this scene. Optional maxTextureCount validates combined texture limit (e.g. GPU descriptor limit).
   [[nodiscard]] int mergeScene(const std::filesystem::path& filename, std::optional<uint32_t> maxTextureCount = std::nullopt);  // Returns wrapper node index, or -1 on failure
   // glTF 2.1: add another glTF as a referenced external asset (read-only, re-externalized on save)
   // instead of embedding it. Repeated references to the same file share geometry. Returns the new
-  // instance node index, or -1 on failure.
-  [[nodiscard]] int referenceScene(const std::filesystem::path& filename);
+  // instance node index, or -1 on failure. `prepared`, if given for the same file, supplies the
+  // already loaded model (consumed) instead of loading it here.
+  struct PreparedReference
+  {
+    std::filesystem::path              filename;
+    tinygltf::Model                    model;             // Flattened: its own external assets merged in
+    std::vector<std::filesystem::path> imageSearchPaths;  // Directories of the nested files merged in
+    bool                               valid = false;     // Loaded and validated, not yet consumed
+  };
+  [[nodiscard]] int referenceScene(const std::filesystem::path& filename, PreparedReference* prepared = nullptr);
+  // Load, validate and flatten a file for referenceScene(). Touches no scene state: several files
+  // may be prepared concurrently as long as the scene isn't modified meanwhile.
+  [[nodiscard]] PreparedReference prepareReference(const std::filesystem::path& filename) const;
   // After mergeScene(), returns the animation list index of the first clip from the merged file (for UI default); -1 if none.
   // Consumed once by the renderer so the animation dropdown selects merged motion instead of staying on a base-scene clip.
   [[nodiscard]] int                      takeMergePreferredAnimationIndex();
+  // After mergeScene()/referenceScene(), the ranges the import appended; nullopt when the import
+  // shifted existing primitives or render nodes (or the scene was empty), so GPU resources must be
+  // rebuilt. Consumed once by the renderer.
+  [[nodiscard]] std::optional<SceneAppendInfo> takeLastAppend();
   void                                   takeModel(tinygltf::Model&& model);  // Use pre-loaded model
   std::unordered_set<std::string>&       supportedExtensions() { return m_supportedExtensions; }
   const std::unordered_set<std::string>& supportedExtensions() const { return m_supportedExtensions; }
@@ -288,6 +465,11 @@ public:
   tinygltf::Model&       getModel() { return m_model; }
   [[nodiscard]] bool     valid() const { return m_validSceneParsed; }
 
+  // Measure the CPU-side data into `tracker`: the glTF model ("Model/Buffers", "Model/Images",
+  // "Model/Objects"), render nodes and primitives ("RenderNodes"), node transforms and caches
+  // ("SceneGraph"), and the animation system's categories if it was created.
+  void reportHostMemory(HostMemoryTracker& tracker) const;
+
   //--------------------------------------------------------------------------------------------------
   // External Assets (glTF 2.1)
   //--------------------------------------------------------------------------------------------------
@@ -357,6 +539,16 @@ public:
   void                          updateNodeWorldMatrices();
   void                          updateLocalMatricesAndLights();
   glm::mat4                     computeNodeWorldMatrix(int nodeID) const;
+  // updateNodeWorldMatrices() with matrices computed off the render thread (AnimationPrefetch): the
+  // local matrices of `dirtyNodes`, the world matrices of `movedNodes` (the dirty nodes of the current
+  // scene and their descendants, none instanced) and of their lights, and those of `movedRenderNodes`
+  // (ascending), which are marked dirty.
+  void setNodeMatrices(std::span<const int>       dirtyNodes,
+                       std::span<const glm::mat4> localMatrices,
+                       std::span<const int>       movedNodes,
+                       std::span<const glm::mat4> worldMatrices,
+                       std::span<const int>       movedRenderNodes,
+                       std::span<const glm::mat4> renderNodeWorldMatrices);
 
   // The GPU transform path propagates world matrices on-device only, leaving the CPU mirror
   // (m_nodesWorldMatrices / RenderNode.worldMatrix) stale for the nodes it moved. That path records
@@ -391,6 +583,20 @@ public:
   [[nodiscard]] int               getCurrentVariant() const { return m_currentVariant; }
   [[nodiscard]] std::unordered_set<int> getMaterialRenderNodes(const std::unordered_set<int>& materialVariantNodeIDs) const;
 
+  // KHR_materials_variants resolved for the current render nodes (see buildVariantMaterialTable):
+  // only the render nodes whose primitive has variant mappings, each pointing at its primitive's row
+  // of `materials` (the material of every variant, then the primitive's own material for "no variant").
+  struct VariantMaterialTable
+  {
+    std::vector<int> renderNodes;                 // Render nodes with variant mappings
+    std::vector<int> rows;                        // Parallel to renderNodes: row in materials
+    std::vector<int> materials;                   // rows x (variantCount + 1)
+    int              variantCount       = 0;
+    size_t           renderNodeCount    = 0;      // Registry size and scene-graph revision
+    uint64_t         sceneGraphRevision = ~0ull;  // the table was built for
+  };
+  [[nodiscard]] const VariantMaterialTable& getVariantMaterialTable() const { return m_variantTable; }
+
   //--------------------------------------------------------------------------------------------------
   // Camera Management
   //--------------------------------------------------------------------------------------------------
@@ -410,13 +616,13 @@ public:
   // Render Node Management
   //--------------------------------------------------------------------------------------------------
 
-  const std::vector<nvvkgltf::RenderNode>& getRenderNodes() const { return m_renderNodeRegistry.getRenderNodes(); }
-  const RenderNodeRegistry&                getRenderNodeRegistry() const { return m_renderNodeRegistry; }
-  RenderNodeRegistry&                      getRenderNodeRegistry() { return m_renderNodeRegistry; }
-  [[nodiscard]] bool                       collectRenderNodeIndices(const std::unordered_set<int>& nodeIndices,
-                                                                    std::unordered_set<int>&       outRenderNodeIndices,
-                                                                    bool                           includeDescendants = true,
-                                                                    float                          fullUpdateRatio = kFullUpdateRatio) const;
+  const nvvkgltf::RenderNodeArrays& getRenderNodes() const { return m_renderNodeRegistry.getRenderNodes(); }
+  const RenderNodeRegistry&         getRenderNodeRegistry() const { return m_renderNodeRegistry; }
+  RenderNodeRegistry&               getRenderNodeRegistry() { return m_renderNodeRegistry; }
+  [[nodiscard]] bool                collectRenderNodeIndices(const std::unordered_set<int>& nodeIndices,
+                                                             std::unordered_set<int>&       outRenderNodeIndices,
+                                                             bool                           includeDescendants = true,
+                                                             float                          fullUpdateRatio = kFullUpdateRatio) const;
   // Uses m_dirtyFlags.nodes to populate renderNodesVk/Rtx
   void              updateRenderNodeDirtyFromNodes(bool includeDescendants = true);
   [[nodiscard]] int getRenderNodeForPrimitive(int nodeIndex, int primitiveIndex) const;
@@ -490,9 +696,17 @@ public:
     std::unordered_set<int> lights;                              // Light indices (glTF light array)
     std::unordered_set<int> nodes;                               // Node indices (for transform updates)
     bool                    allRenderNodesDirty        = false;  // Full RN upload (count change or massive reorder)
+    bool                    allRenderNodesVk           = false;  // Every RN record stale, same structure (see below)
+    bool                    allRenderNodesRtx          = false;  // Every TLAS instance stale, same structure
     bool                    primitivesChanged          = false;  // BLAS rebuild needed (primitive set changed)
     bool                    tlasVisibilityNeedsCpuSync = false;  // KHR_node_visibility: SceneEditor::updateVisibility
 
+    // allRenderNodesVk/Rtx stand for "every index in renderNodesVk/Rtx": world-matrix updates set
+    // them instead of inserting indices once the moved render nodes reach kFullUpdateRatio (e.g. the
+    // parent of a large instance batch moved), since SceneVk/SceneRtx would do a full upload anyway.
+    [[nodiscard]] bool renderNodesVkDirty() const { return allRenderNodesVk || !renderNodesVk.empty(); }
+    [[nodiscard]] bool renderNodesRtxDirty() const { return allRenderNodesRtx || !renderNodesRtx.empty(); }
+
     void clear()
     {
       renderNodesVk.clear();
@@ -501,13 +715,15 @@ public:
       lights.clear();
       nodes.clear();
       allRenderNodesDirty        = false;
+      allRenderNodesVk           = false;
+      allRenderNodesRtx          = false;
       primitivesChanged          = false;
       tlasVisibilityNeedsCpuSync = false;
     }
 
     [[nodiscard]] bool isEmpty() const
     {
-      return renderNodesVk.empty() && renderNodesRtx.empty() && materials.empty() && lights.empty() && nodes.empty()
+      return !renderNodesVkDirty() && !renderNodesRtxDirty() && materials.empty() && lights.empty() && nodes.empty()
              && !allRenderNodesDirty && !primitivesChanged && !tlasVisibilityNeedsCpuSync;
     }
   };
@@ -539,6 +755,18 @@ private:
 
   void parseScene();
   void clearParsedData();
+  // Append tracking for mergeScene()/referenceScene(): sizes and parsed state before the import,
+  // then the ranges it added if the existing prefix is unchanged (see takeLastAppend()).
+  struct AppendSnapshot
+  {
+    bool                         valid = false;
+    SceneAppendInfo              info;  // Only the begin fields are set
+    std::vector<RenderPrimitive> renderPrimitives;
+    std::vector<int>             renderPrimIDs;
+    std::vector<int>             materialIDs;
+  };
+  AppendSnapshot snapshotForAppend() const;
+  void           recordAppend(const AppendSnapshot& snapshot);
   // glTF 2.1: resolve every node.externalAsset by loading the referenced file and merging it in
   // under that node. Tags merged-in subtrees read-only and records provenance. Returns true if at
   // least one external asset was merged (so the caller can re-run post-merge passes).
@@ -546,7 +774,11 @@ private:
   // glTF 2.1: recursively merge (in place) every external asset referenced by `model`, making it
   // self-contained before it is merged into the scene. Applies file aliases and guards against
   // reference cycles via `ancestry` (canonical paths currently being resolved up the chain).
-  void flattenReferencedModel(tinygltf::Model& model, const std::filesystem::path& modelDir, std::vector<std::string>& ancestry, int depth);
+  void flattenReferencedModel(tinygltf::Model&                    model,
+                              const std::filesystem::path&        modelDir,
+                              std::vector<std::string>&           ancestry,
+                              int                                 depth,
+                              std::vector<std::filesystem::path>& imageSearchPaths) const;
   // Tag the appended node range [firstNode, lastNode) read-only and record provenance. Shared by
   // load-time resolveExternalAssets() and runtime referenceScene(). Returns the m_referencedAssets index.
   int recordReferencedAsset(int firstNode, int lastNode, int instanceNode, int externalAssetIndex, int fileIndex, const std::string& uri);
@@ -562,6 +794,7 @@ private:
 
   PrimitiveKeyMap buildPrimitiveKeyMap();
   int             getMaterialVariantIndex(const tinygltf::Primitive& primitive, int currentVariant);
+  void            buildVariantMaterialTable();
   void createRenderNodesForNode(int nodeID, const glm::mat4& worldMatrix, bool visible, const PrimitiveKeyMap& primMap);
   bool handleRenderNode(int nodeID, glm::mat4 worldMatrix, const PrimitiveKeyMap& primMap);
   size_t handleGpuInstancing(const tinygltf::Value& attributes, nvvkgltf::RenderNode renderNode, glm::mat4 worldMatrix, int nodeID, int primIndex);
@@ -621,6 +854,8 @@ private:
   tinygltf::Model                    m_model;             // The glTF model (source of truth)
   std::filesystem::path              m_filename;          // Loaded file path
   std::vector<std::filesystem::path> m_imageSearchPaths;  // Base dirs for image resolution (base first, then imports)
+  uint32_t                           m_imageSaveConcurrency = 8;  // File copies are I/O bound: a few in flight is enough
+  bool                               m_createMissingTangents = true;
   std::unordered_set<std::string>    m_supportedExtensions;  // Extensions to load
   bool                               m_validSceneParsed = false;
 
@@ -628,6 +863,8 @@ private:
   // from the per-node extras marker (kExternalAssetContentKey), not tracked by index here.
   std::vector<nvvkgltf::ReferencedAsset> m_referencedAssets;
 
+  std::shared_ptr<SavePayloadReaders> m_saveReaders = std::make_shared<SavePayloadReaders>();  // Leases of the save snapshots
+
   //--------------------------------------------------------------------------------------------------
   // Data Members: Render Data (Built from Model)
   //--------------------------------------------------------------------------------------------------
@@ -677,6 +914,8 @@ private:
   void       buildTopologicalLevels();
   void       updateWorldMatricesSerial();    // Filtered-root recursive walk (small dirty sets)
   void       updateWorldMatricesParallel();  // Level-by-level parallel (large dirty sets)
+  void       updateInstanceBatchMatrices(const InstanceBatch& batch, const glm::mat4& nodeWorld);
+  void       markMovedRenderNodesDirty(std::span<const int> renderNodeIDs, std::span<const InstanceBatch> batches);
 
   std::unordered_map<int, std::vector<glm::mat4>> m_gpuInstanceLocalMatrices;  // nodeID -> per-instance local transforms (EXT_mesh_gpu_instancing)
 
@@ -686,6 +925,7 @@ private:
 
   std::vector<std::string> m_variants;  // KHR_materials_variants
   int                      m_currentVariant = 0;
+  VariantMaterialTable     m_variantTable;  // Variant -> material per mapped render node
 
   //--------------------------------------------------------------------------------------------------
   // Data Members: Scene State
@@ -709,9 +949,12 @@ private:
   // Set by mergeScene when imported file contributes new animations (first new clip index). Cleared by takeMergePreferredAnimationIndex.
   int m_pendingMergePreferredAnimationIndex = -1;
 
+  // Set by mergeScene/referenceScene when the import only appended. Cleared by takeLastAppend.
+  std::optional<SceneAppendInfo> m_pendingAppend;
+
   std::unique_ptr<SceneEditor>             m_editor;
   mutable std::unique_ptr<AnimationSystem> m_animation;
-  mutable std::unique_ptr<SceneValidator>  m_validator;
+  std::unique_ptr<SceneValidator>          m_validator;  // Created by the constructor, see validator() const
 };
 
 }  // namespace nvvkgltf
@@ -35,8 +35,8 @@
 #include <tinygltf/tiny_gltf.h>
 
 #include <nvutils/logger.hpp>
-#include <nvutils/parallel_work.hpp>
 
+#include "task_scheduler.hpp"
 #include "tinygltf_utils.hpp"
 
 namespace nvvkgltf {
@@ -58,8 +58,55 @@ void AnimationSystem::clear()
   m_morphPrimitives.clear();
   m_skinTasks.clear();
   m_morphResults.clear();
+  m_morphStorageStats = {};
+  m_deformChanges.reset(0, 0);
   m_skinToNodeIndices.clear();
   m_animationPointer.reset();
+  invalidateGpuNodeAnimation();
+  m_gpuNodeAnimPending = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Host memory of the parsed animations. The CPU fallback outputs (SkinTask::result,
+// MorphResult::blended*) only count once the CPU path sized them.
+void AnimationSystem::reportHostMemory(HostMemoryTracker& tracker) const
+{
+  uint64_t keyframeBytes = containerBytes(m_animations);
+  for(const Animation& animation : m_animations)
+  {
+    keyframeBytes += containerBytes(animation.samplers) + containerBytes(animation.channels);
+    for(const AnimationSampler& sampler : animation.samplers)
+    {
+      keyframeBytes += containerBytes(sampler.inputs) + containerBytes(sampler.outputsVec2) + containerBytes(sampler.outputsVec3)
+                       + containerBytes(sampler.outputsVec4) + containerBytes(sampler.outputsFloat);
+      for(const std::vector<float>& outputs : sampler.outputsFloat)
+        keyframeBytes += containerBytes(outputs);
+    }
+  }
+
+  uint64_t skinBytes = containerBytes(m_skinTasks) + containerBytes(m_deformPalette) + containerBytes(m_skinInputsChanged)
+                       + containerBytes(m_jointMatrices) + containerBytes(m_normalMatrices) + containerBytes(m_skinToNodeIndices);
+  for(const SkinTask& task : m_skinTasks)
+  {
+    skinBytes += containerBytes(task.weights) + containerBytes(task.joints) + containerBytes(task.basePositions)
+                 + containerBytes(task.baseNormals) + containerBytes(task.baseTangents) + containerBytes(task.inverseBindMatrices)
+                 + containerBytes(task.result.positions) + containerBytes(task.result.normals) + containerBytes(task.result.tangents);
+  }
+  for(const std::vector<int>& nodes : m_skinToNodeIndices)
+    skinBytes += containerBytes(nodes);
+
+  uint64_t morphBytes = containerBytes(m_morphResults) + containerBytes(m_morphPrimitives) + containerBytes(m_deformWeights)
+                        + containerBytes(m_morphInputsChanged);
+  for(const MorphResult& mr : m_morphResults)
+  {
+    morphBytes += containerBytes(mr.basePositions) + containerBytes(mr.baseNormals) + containerBytes(mr.baseTangents)
+                  + mr.deltas.sizeInBytes() + containerBytes(mr.blendedPositions) + containerBytes(mr.blendedNormals)
+                  + containerBytes(mr.blendedTangents);
+  }
+
+  tracker.set("Animation/Keyframes", keyframeBytes);
+  tracker.set("Animation/Skin", skinBytes);
+  tracker.set("Animation/Morph", morphBytes);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -83,9 +130,12 @@ void AnimationSystem::resetPointer()
 //           and inverse bind matrices, then pre-allocates output vectors for each skinned primitive.
 void AnimationSystem::parseAnimations()
 {
+  invalidateGpuNodeAnimation();
+  m_gpuNodeAnimPending = false;
   parseSamplersAndChannels();
   parseMorphPrimitives();
   parseSkinTasks();
+  m_deformChanges.reset(m_morphResults.size(), m_skinTasks.size());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -198,11 +248,13 @@ void AnimationSystem::parseSamplersAndChannels()
 
 //--------------------------------------------------------------------------------------------------
 // Scan all render primitives for morph targets. For each primitive that has targets and
-// mesh weights, cache the base positions/normals/tangents for blending.
+// mesh weights, cache the base positions/normals/tangents for blending and the non-zero target
+// deltas (SparseMorphTargets), then report the storage saved over dense deltas.
 void AnimationSystem::parseMorphPrimitives()
 {
   m_morphPrimitives.clear();
   m_morphResults.clear();
+  m_morphStorageStats = {};
   for(size_t renderPrimID = 0; renderPrimID < m_scene.getRenderPrimitives().size(); renderPrimID++)
   {
     const auto&                renderPrimitive = m_scene.getRenderPrimitive(renderPrimID);
@@ -258,9 +310,33 @@ void AnimationSystem::parseMorphPrimitives()
         }
       }
 
+      mr.deltas.vertexCount = static_cast<uint32_t>(mr.basePositions.size());
+      for(const auto& target : primitive.targets)
+      {
+        auto accessorOf = [&](const char* name, bool wanted) {
+          auto it = target.find(name);
+          return (wanted && it != target.end()) ? it->second : -1;
+        };
+        mr.deltas.addTarget(mdl, accessorOf("POSITION", true), accessorOf("NORMAL", !mr.baseNormals.empty()),
+                            accessorOf("TANGENT", !mr.baseTangents.empty()));
+      }
+
+      m_morphStorageStats.nonZeroDeltas += mr.deltas.nonZeroCount();
+      m_morphStorageStats.denseDeltas += mr.deltas.targets.size() * size_t(mr.deltas.vertexCount);
+      m_morphStorageStats.sparseBytes += mr.deltas.sizeInBytes();
+      m_morphStorageStats.denseBytes += mr.deltas.denseSizeInBytes();
       m_morphResults.push_back(std::move(mr));
     }
   }
+
+  if(m_morphStorageStats.denseDeltas > 0)
+  {
+    const MorphStorageStats& stats = m_morphStorageStats;
+    LOGI("Morph targets: %zu of %zu deltas non-zero, %.2f MB sparse instead of %.2f MB dense (%.2f MB saved)\n",
+         stats.nonZeroDeltas, stats.denseDeltas, double(stats.sparseBytes) / (1024.0 * 1024.0),
+         double(stats.denseBytes) / (1024.0 * 1024.0),
+         double(std::max(stats.denseBytes, stats.sparseBytes) - stats.sparseBytes) / (1024.0 * 1024.0));
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -337,6 +413,40 @@ void AnimationSystem::buildSkinToNodeMap()
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// Skinned meshes follow their joints: the nodes using a skin with a dirty joint are dirty too.
+// Appended in skin order, for AnimationPrefetch to mark them in the same order as updateAnimation().
+void AnimationSystem::addSkinnedNodes(std::vector<bool>& dirtyBits, std::vector<int>& dirtyList) const
+{
+  const tinygltf::Model& model    = m_scene.getModel();
+  const size_t           numNodes = dirtyBits.size();
+
+  // Use precomputed skin-to-node map instead of O(skins*nodes) brute-force scan
+  for(size_t skinIdx = 0; skinIdx < model.skins.size(); ++skinIdx)
+  {
+    const auto& skin          = model.skins[skinIdx];
+    bool        jointAnimated = false;
+    for(int jointNodeId : skin.joints)
+    {
+      if(jointNodeId >= 0 && static_cast<size_t>(jointNodeId) < numNodes && dirtyBits[jointNodeId])
+      {
+        jointAnimated = true;
+        break;
+      }
+    }
+    if(!jointAnimated || skinIdx >= m_skinToNodeIndices.size())
+      continue;
+    for(int nodeIdx : m_skinToNodeIndices[skinIdx])
+    {
+      if(!dirtyBits[nodeIdx])
+      {
+        dirtyBits[nodeIdx] = true;
+        dirtyList.push_back(nodeIdx);
+      }
+    }
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Advance a single animation and apply its results to the scene.
 //
@@ -376,7 +486,7 @@ bool AnimationSystem::updateAnimation(uint32_t animationIndex)
 
     if(channel.path == AnimationChannel::PathType::ePointer)
     {
-      processAnimationChannel(nullptr, sampler, channel, time);
+      processAnimationChannel(m_model, nullptr, sampler, channel, time);
       continue;
     }
 
@@ -384,7 +494,7 @@ bool AnimationSystem::updateAnimation(uint32_t animationIndex)
       continue;
 
     tinygltf::Node& gltfNode = m_model.nodes[channel.node];
-    processAnimationChannel(&gltfNode, sampler, channel, time);
+    processAnimationChannel(m_model, &gltfNode, sampler, channel, time);
     setDirty(channel.node);
     if(channel.path == AnimationChannel::PathType::eWeights)
       hadWeightsChannel = true;
@@ -399,27 +509,7 @@ bool AnimationSystem::updateAnimation(uint32_t animationIndex)
     m_scene.editor().updateVisibility(nodeIndex);
   }
 
-  // Use precomputed skin-to-node map instead of O(skins*nodes) brute-force scan
-  for(size_t skinIdx = 0; skinIdx < m_model.skins.size(); ++skinIdx)
-  {
-    const auto& skin          = m_model.skins[skinIdx];
-    bool        jointAnimated = false;
-    for(int jointNodeId : skin.joints)
-    {
-      if(jointNodeId >= 0 && static_cast<size_t>(jointNodeId) < numNodes && dirtyBits[jointNodeId])
-      {
-        jointAnimated = true;
-        break;
-      }
-    }
-    if(!jointAnimated)
-      continue;
-    if(skinIdx < m_skinToNodeIndices.size())
-    {
-      for(int nodeIdx : m_skinToNodeIndices[skinIdx])
-        setDirty(nodeIdx);
-    }
-  }
+  addSkinnedNodes(dirtyBits, dirtyList);
 
   for(int nodeIdx : dirtyList)
     m_scene.markNodeDirty(nodeIdx);
@@ -437,12 +527,236 @@ bool AnimationSystem::updateAnimation(uint32_t animationIndex)
   return !dirtyList.empty() || hadPointerDirty || hadWeightsChannel;
 }
 
+//========== GPU Node Animation ==========
+
+//--------------------------------------------------------------------------------------------------
+// Return the keyframe table for GPU playback of the given animation, building it on first use.
+// The result (including "not eligible") is cached until invalidateGpuNodeAnimation() or a re-parse.
+const NodeAnimationTable* AnimationSystem::prepareGpuNodeAnimation(uint32_t animationIndex)
+{
+  if(animationIndex >= m_animations.size())
+    return nullptr;
+
+  if(m_gpuNodeAnimIndex != static_cast<int>(animationIndex))
+  {
+    // The previous table may still have unsynced GPU results; bring the model up to date first.
+    syncGpuNodeAnimationToCpu();
+
+    m_gpuNodeAnimEligible = buildNodeAnimationTable(animationIndex, m_gpuNodeAnim);
+    m_gpuNodeAnimIndex    = static_cast<int>(animationIndex);
+    ++m_gpuNodeAnimRevision;
+  }
+  return m_gpuNodeAnimEligible ? &m_gpuNodeAnim : nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Drop the cached table, e.g. after the rest TRS of an animated node was edited.
+void AnimationSystem::invalidateGpuNodeAnimation()
+{
+  m_gpuNodeAnim.clear();
+  m_gpuNodeAnimIndex    = -1;
+  m_gpuNodeAnimEligible = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Only the rest TRS of the targets are baked into the table: other dirty nodes (and the animated
+// paths the GPU or syncGpuNodeAnimationToCpu() write) leave it valid, and keep the uploaded buffers.
+void AnimationSystem::invalidateGpuNodeAnimation(const std::unordered_set<int>& dirtyNodes)
+{
+  if(dirtyNodes.empty() || m_gpuNodeAnimIndex < 0 || m_gpuNodeAnimIndex >= static_cast<int>(m_animations.size()))
+    return;
+
+  bool stale = false;
+  if(!m_gpuNodeAnimEligible)
+  {
+    // An edit of a target (e.g. matrix to TRS) may make the animation eligible
+    for(const AnimationChannel& channel : m_animations[m_gpuNodeAnimIndex].channels)
+      stale = stale || dirtyNodes.contains(channel.node);
+  }
+  else
+  {
+    const tinygltf::Model& model = m_scene.getModel();
+    for(const shaderio::NodeAnimTarget& target : m_gpuNodeAnim.targets)
+    {
+      if(stale || !dirtyNodes.contains(target.nodeID) || static_cast<size_t>(target.nodeID) >= model.nodes.size())
+        continue;
+      const tinygltf::Node& node = model.nodes[target.nodeID];
+      glm::vec3             t, s;
+      glm::quat             r;
+      tinygltf::utils::getNodeTRS(node, t, r, s);
+      stale = node.matrix.size() == 16 || (target.trackTranslation < 0 && glm::vec3(target.restTranslation) != t)
+              || (target.trackRotation < 0 && target.restRotation != glm::vec4(r.x, r.y, r.z, r.w))
+              || (target.trackScale < 0 && glm::vec3(target.restScale) != s);
+    }
+  }
+  if(!stale)
+    return;
+
+  // The table is still needed to write back what the GPU played
+  syncGpuNodeAnimationToCpu();
+  invalidateGpuNodeAnimation();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Catch the model up with what the GPU played: evaluate the table at the animation's current time
+// with the CPU reference and write the animated TRS paths into the nodes.
+bool AnimationSystem::syncGpuNodeAnimationToCpu()
+{
+  if(!m_gpuNodeAnimPending)
+    return false;
+  m_gpuNodeAnimPending = false;
+
+  if(!m_gpuNodeAnimEligible || m_gpuNodeAnimIndex < 0 || m_gpuNodeAnimIndex >= static_cast<int>(m_animations.size()))
+    return false;
+
+  m_gpuNodeAnim.applyToNodes(m_scene.getModel(), m_animations[m_gpuNodeAnimIndex].info.currentTime);
+  for(const shaderio::NodeAnimTarget& target : m_gpuNodeAnim.targets)
+    m_scene.markNodeDirty(target.nodeID);
+  return true;
+}
+
+bool AnimationSystem::getGpuNodeAnimationTrs(int node, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const
+{
+  if(!m_gpuNodeAnimPending || !m_gpuNodeAnimEligible || m_gpuNodeAnimIndex < 0
+     || m_gpuNodeAnimIndex >= static_cast<int>(m_animations.size()))
+    return false;
+
+  for(size_t i = 0; i < m_gpuNodeAnim.targets.size(); ++i)
+  {
+    if(m_gpuNodeAnim.targets[i].nodeID == node)
+    {
+      m_gpuNodeAnim.evaluateTrs(i, m_animations[m_gpuNodeAnimIndex].info.currentTime, translation, rotation, scale);
+      return true;
+    }
+  }
+  return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Flatten the channels of one animation into a NodeAnimationTable. Returns false (table unusable)
+// when the animation cannot be played on the GPU alone:
+//  - a channel animates weights or a KHR_animation_pointer property (CPU-side state);
+//  - an animated node uses a matrix instead of TRS (the CPU path ignores animation there too);
+//  - an animated node or one of its descendants is a skin joint, is skinned, or carries a light or
+//    camera: those consumers read CPU world matrices every frame.
+// Channels the CPU path would skip (bad node, fewer than two keys, short output) are skipped too.
+bool AnimationSystem::buildNodeAnimationTable(uint32_t animationIndex, NodeAnimationTable& table) const
+{
+  table.clear();
+
+  const tinygltf::Model& model     = m_scene.getModel();
+  const size_t           numNodes  = model.nodes.size();
+  const Animation&       animation = m_animations[animationIndex];
+
+  std::vector<int> targetOfNode(numNodes, -1);
+  for(const AnimationChannel& channel : animation.channels)
+  {
+    if(channel.path != AnimationChannel::eTranslation && channel.path != AnimationChannel::eRotation
+       && channel.path != AnimationChannel::eScale)
+      return false;
+    if(channel.node < 0 || static_cast<size_t>(channel.node) >= numNodes || channel.samplerIndex >= animation.samplers.size())
+      continue;
+    if(model.nodes[channel.node].matrix.size() == 16)
+      return false;
+
+    const AnimationSampler& sampler      = animation.samplers[channel.samplerIndex];
+    const bool              isRotation   = channel.path == AnimationChannel::eRotation;
+    const bool              isCubic      = sampler.interpolation == AnimationSampler::eCubicSpline;
+    const size_t            valuesPerKey = isCubic ? 3 : 1;
+    const size_t            numKeys      = sampler.inputs.size();
+    const size_t            numValues    = isRotation ? sampler.outputsVec4.size() : sampler.outputsVec3.size();
+    if(numKeys < 2 || numValues < numKeys * valuesPerKey)
+      continue;
+
+    int& targetIndex = targetOfNode[channel.node];
+    if(targetIndex < 0)
+    {
+      glm::vec3 t, s;
+      glm::quat r;
+      tinygltf::utils::getNodeTRS(model.nodes[channel.node], t, r, s);
+
+      shaderio::NodeAnimTarget target{};
+      target.restTranslation  = glm::vec4(t, 0.0f);
+      target.restRotation     = glm::vec4(r.x, r.y, r.z, r.w);
+      target.restScale        = glm::vec4(s, 0.0f);
+      target.nodeID           = channel.node;
+      target.trackTranslation = -1;
+      target.trackRotation    = -1;
+      target.trackScale       = -1;
+      targetIndex             = static_cast<int>(table.targets.size());
+      table.targets.push_back(target);
+    }
+
+    shaderio::NodeAnimTrack track{};
+    track.keyOffset     = static_cast<uint32_t>(table.keyTimes.size());
+    track.keyCount      = static_cast<uint32_t>(numKeys);
+    track.valueOffset   = static_cast<uint32_t>(table.keyValues.size());
+    track.interpolation = isCubic ? NODE_ANIM_INTERP_CUBICSPLINE :
+                          (sampler.interpolation == AnimationSampler::eStep) ? NODE_ANIM_INTERP_STEP :
+                                                                               NODE_ANIM_INTERP_LINEAR;
+
+    table.keyTimes.insert(table.keyTimes.end(), sampler.inputs.begin(), sampler.inputs.end());
+    const size_t storedValues = numKeys * valuesPerKey;
+    if(isRotation)
+      table.keyValues.insert(table.keyValues.end(), sampler.outputsVec4.begin(), sampler.outputsVec4.begin() + storedValues);
+    else
+      for(size_t v = 0; v < storedValues; ++v)
+        table.keyValues.emplace_back(sampler.outputsVec3[v], 0.0f);
+
+    // Later channels on the same path win, as they do on the CPU
+    const int                 trackIndex = static_cast<int>(table.tracks.size());
+    shaderio::NodeAnimTarget& target     = table.targets[targetIndex];
+    if(channel.path == AnimationChannel::eTranslation)
+      target.trackTranslation = trackIndex;
+    else if(isRotation)
+      target.trackRotation = trackIndex;
+    else
+      target.trackScale = trackIndex;
+    table.tracks.push_back(track);
+  }
+
+  if(table.empty())
+    return false;
+
+  // Rigid only: walk every animated subtree and reject CPU-side consumers of world matrices.
+  std::vector<bool> isJoint(numNodes, false);
+  for(const tinygltf::Skin& skin : model.skins)
+    for(int joint : skin.joints)
+      if(joint >= 0 && static_cast<size_t>(joint) < numNodes)
+        isJoint[joint] = true;
+
+  std::vector<bool> visited(numNodes, false);
+  std::vector<int>  stack;
+  for(const shaderio::NodeAnimTarget& target : table.targets)
+    stack.push_back(target.nodeID);
+  while(!stack.empty())
+  {
+    const int nodeID = stack.back();
+    stack.pop_back();
+    if(visited[nodeID])
+      continue;
+    visited[nodeID] = true;
+
+    const tinygltf::Node& node = model.nodes[nodeID];
+    if(isJoint[nodeID] || node.skin >= 0 || node.light >= 0 || node.camera >= 0)
+      return false;
+    for(int child : node.children)
+      if(child >= 0 && static_cast<size_t>(child) < numNodes)
+        stack.push_back(child);
+  }
+  return true;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Evaluate a single animation channel at the given time. Finds the keyframe segment that
 // contains `time`, computes the interpolation factor, and dispatches to the appropriate
 // interpolation handler (linear, step, or cubic spline). Returns true if the channel was
 // animated (i.e. time fell within the sampler's keyframe range).
-bool AnimationSystem::processAnimationChannel(tinygltf::Node* gltfNode, AnimationSampler& sampler, const AnimationChannel& channel, float time)
+bool AnimationSystem::processAnimationChannel(tinygltf::Model&        model,
+                                              tinygltf::Node*         gltfNode,
+                                              AnimationSampler&       sampler,
+                                              const AnimationChannel& channel,
+                                              float                   time)
 {
   if(sampler.inputs.size() < 2)
     return false;
@@ -465,7 +779,7 @@ bool AnimationSystem::processAnimationChannel(tinygltf::Node* gltfNode, Animatio
   switch(sampler.interpolation)
   {
     case AnimationSampler::InterpolationType::eLinear:
-      handleLinearInterpolation(gltfNode, sampler, channel, t, i);
+      handleLinearInterpolation(model, gltfNode, sampler, channel, t, i);
       break;
     case AnimationSampler::InterpolationType::eStep:
       handleStepInterpolation(gltfNode, sampler, channel, i);
@@ -518,14 +832,13 @@ T computeCubicInterpolation(const T* values, float t, float keyDelta, size_t ind
 // Apply linear interpolation for a channel at the given keyframe index with factor t.
 // Rotation uses quaternion slerp; translation, scale, and weights use component-wise lerp.
 // Pointer channels delegate to the AnimationPointerSystem based on output dimensionality.
-void AnimationSystem::handleLinearInterpolation(tinygltf::Node*         gltfNode,
+void AnimationSystem::handleLinearInterpolation(tinygltf::Model&        model,
+                                                tinygltf::Node*         gltfNode,
                                                 AnimationSampler&       sampler,
                                                 const AnimationChannel& channel,
                                                 float                   t,
                                                 size_t                  index)
 {
-  tinygltf::Model& m_model = m_scene.getModel();
-
   switch(channel.path)
   {
     case AnimationChannel::PathType::eRotation: {
@@ -555,11 +868,11 @@ void AnimationSystem::handleLinearInterpolation(tinygltf::Node*         gltfNode
       break;
     }
     case AnimationChannel::PathType::eWeights: {
-      if(gltfNode && gltfNode->mesh >= 0 && (size_t)gltfNode->mesh < m_model.meshes.size()
+      if(gltfNode && gltfNode->mesh >= 0 && (size_t)gltfNode->mesh < model.meshes.size()
          && index + 1 < sampler.outputsFloat.size()
          && sampler.outputsFloat[index].size() == sampler.outputsFloat[index + 1].size())
       {
-        tinygltf::Mesh& mesh = m_model.meshes[gltfNode->mesh];
+        tinygltf::Mesh& mesh = model.meshes[gltfNode->mesh];
         if(mesh.weights.size() != sampler.outputsFloat[index].size())
           mesh.weights.resize(sampler.outputsFloat[index].size());
         for(size_t j = 0; j < mesh.weights.size(); j++)
@@ -720,18 +1033,23 @@ void MorphResult::ensureCpuOutput()
 // For each SkinTask, computes per-joint matrices as: inverse(nodeWorld) * jointWorld * IBM,
 // then derives normal matrices via inverse-transpose of the upper 3x3.  Vertices are
 // transformed in parallel batches using up to 4 joint influences per vertex.  Results are
-// written directly into the SkinTask::result vectors.
+// written directly into the SkinTask::result vectors. Tasks whose palette did not change since the
+// last updateDeformationChanges() keep their previous result.
 void AnimationSystem::computeSkinning()
 {
   const tinygltf::Model&        model        = m_scene.getModel();
   const std::vector<glm::mat4>& nodeMatrices = m_scene.getNodesWorldMatrices();
 
-  for(SkinTask& task : m_skinTasks)
+  for(size_t si = 0; si < m_skinTasks.size(); si++)
   {
+    SkinTask& task = m_skinTasks[si];
     if(task.skinID < 0 || task.skinID >= static_cast<int>(model.skins.size()))
       continue;
     if(task.refNodeID < 0 || task.refNodeID >= static_cast<int>(nodeMatrices.size()))
       continue;
+    // Same palette as the last skinning: the output is still valid
+    if(m_deformChanges.skinChange(si) == DeformChangeTracker::Change::eUnchanged && task.result.positions.size() == task.weights.size())
+      continue;
 
     task.ensureCpuOutput();
 
@@ -777,7 +1095,7 @@ void AnimationSystem::computeSkinning()
     const auto&     jointMatrices = m_jointMatrices;
     const auto&     normalMats    = m_normalMatrices;
 
-    nvutils::parallel_batches<2048>(vertexCount, [&](uint64_t v) {
+    nvvkgltf::parallelFor<2048>(vertexCount, [&](uint64_t v) {
       const glm::vec4&  w = task.weights[v];
       const glm::ivec4& j = task.joints[v];
 
@@ -822,27 +1140,34 @@ const SkinningResult& AnimationSystem::getSkinningResult(size_t skinTaskIndex) c
 //--------------------------------------------------------------------------------------------------
 // CPU morph target blending fallback: accumulate weighted deltas from all active morph targets.
 //
-// For each morph primitive, starts from the cached base geometry and adds position, normal,
-// and tangent deltas scaled by their respective mesh weights. Deltas are read directly from
-// glTF accessors; blending is parallelized per-vertex. Normals are re-normalized after
-// accumulation. Results are stored in MorphResult::blendedPositions/Normals/Tangents.
+// For each morph primitive, starts from the cached base geometry and scatters the sparse position,
+// normal, and tangent deltas (cached at parse time) of every target with a non-zero mesh weight,
+// so the cost follows the number of non-zero deltas rather than vertexCount * targets. Normals are
+// re-normalized after accumulation. Results are stored in MorphResult::blendedPositions/Normals/Tangents.
+// Primitives whose weights did not change since the last updateDeformationChanges() are skipped, and
+// all-zero weights just copy the base geometry.
 void AnimationSystem::computeMorphTargets()
 {
   const tinygltf::Model& model = m_scene.getModel();
 
+  std::vector<float> weights;
   for(size_t mi = 0; mi < m_morphResults.size(); mi++)
   {
     MorphResult& mr = m_morphResults[mi];
     if(mr.renderPrimID < 0 || mr.basePositions.empty())
       continue;
 
+    // Same weights as the last blend: the output is still valid
+    const DeformChangeTracker::Change change = m_deformChanges.morphChange(mi);
+    if(change == DeformChangeTracker::Change::eUnchanged && mr.blendedPositions.size() == mr.basePositions.size())
+      continue;
+
     mr.ensureCpuOutput();
 
     const RenderPrimitive& renderPrimitive = m_scene.getRenderPrimitive(mr.renderPrimID);
     if(renderPrimitive.meshID < 0 || renderPrimitive.meshID >= static_cast<int>(model.meshes.size()))
       continue;
-    const tinygltf::Primitive& primitive = *renderPrimitive.pPrimitive;
-    const tinygltf::Mesh&      mesh      = model.meshes[renderPrimitive.meshID];
+    const tinygltf::Mesh& mesh = model.meshes[renderPrimitive.meshID];
 
     const bool hasNormals  = !mr.baseNormals.empty();
     const bool hasTangents = !mr.baseTangents.empty();
@@ -853,70 +1178,101 @@ void AnimationSystem::computeMorphTargets()
     if(hasTangents)
       std::copy(mr.baseTangents.begin(), mr.baseTangents.end(), mr.blendedTangents.begin());
 
-    for(size_t targetIndex = 0; targetIndex < primitive.targets.size(); ++targetIndex)
-    {
-      if(targetIndex >= mesh.weights.size())
-        continue;
-      float weight = float(mesh.weights[targetIndex]);
-      if(weight == 0.0f)
-        continue;
+    if(change == DeformChangeTracker::Change::eRest)
+      continue;  // All weights zero: the base geometry is the result
 
-      const auto& target = primitive.targets[targetIndex];
+    weights.assign(mesh.weights.begin(), mesh.weights.end());
+    mr.deltas.apply(weights, mr.blendedPositions, mr.blendedNormals, mr.blendedTangents);
 
-      auto posFind = target.find("POSITION");
-      if(posFind != target.end())
-      {
-        int idx = posFind->second;
-        if(idx >= 0 && idx < static_cast<int>(model.accessors.size()))
-        {
-          const std::span<const glm::vec3> deltas = tinygltf::utils::getAccessorData(model, model.accessors[idx], &m_morphTempVec3);
-          if(deltas.size() == mr.blendedPositions.size())
-            nvutils::parallel_batches(mr.blendedPositions.size(),
-                                      [&](uint64_t v) { mr.blendedPositions[v] += weight * deltas[v]; });
-        }
-      }
+    if(hasNormals)
+      nvvkgltf::parallelFor(mr.blendedNormals.size(),
+                                [&](uint64_t v) { mr.blendedNormals[v] = glm::normalize(mr.blendedNormals[v]); });
+  }
+}
 
-      if(hasNormals)
-      {
-        auto nrmFind = target.find("NORMAL");
-        if(nrmFind != target.end())
-        {
-          int idx = nrmFind->second;
-          if(idx >= 0 && idx < static_cast<int>(model.accessors.size()))
-          {
-            const std::span<const glm::vec3> deltas =
-                tinygltf::utils::getAccessorData(model, model.accessors[idx], &m_morphTempVec3);
-            if(deltas.size() == mr.blendedNormals.size())
-              nvutils::parallel_batches(mr.blendedNormals.size(),
-                                        [&](uint64_t v) { mr.blendedNormals[v] += weight * deltas[v]; });
-          }
-        }
-      }
+//--------------------------------------------------------------------------------------------------
+// Weights of the morph targets of a primitive, as blended this frame.
+void AnimationSystem::gatherMorphWeights(const MorphResult& mr, std::vector<float>& weights) const
+{
+  weights.clear();
+  const tinygltf::Model& model = m_scene.getModel();
+  if(mr.renderPrimID < 0)
+    return;
+  const int meshID = m_scene.getRenderPrimitive(mr.renderPrimID).meshID;
+  if(meshID < 0 || meshID >= static_cast<int>(model.meshes.size()))
+    return;
+  const std::vector<double>& meshWeights = model.meshes[meshID].weights;
+  weights.assign(meshWeights.begin(), meshWeights.begin() + std::min(meshWeights.size(), mr.deltas.targets.size()));
+}
 
-      if(hasTangents)
-      {
-        auto tanFind = target.find("TANGENT");
-        if(tanFind != target.end())
-        {
-          int idx = tanFind->second;
-          if(idx >= 0 && idx < static_cast<int>(model.accessors.size()))
-          {
-            const std::span<const glm::vec3> deltas =
-                tinygltf::utils::getAccessorData(model, model.accessors[idx], &m_morphTempVec3);
-            if(deltas.size() == mr.blendedTangents.size())
-              nvutils::parallel_batches(mr.blendedTangents.size(), [&](uint64_t v) {
-                mr.blendedTangents[v] =
-                    glm::vec4(glm::vec3(mr.blendedTangents[v]) + weight * deltas[v], mr.blendedTangents[v].w);
-              });
-          }
-        }
-      }
+//--------------------------------------------------------------------------------------------------
+// Joint world matrices relative to the reference node: the part of the joint matrices that varies
+// per frame (the inverse bind matrices are constant). Invalid joints give identity.
+void AnimationSystem::gatherSkinPalette(const SkinTask& task, std::vector<glm::mat4>& palette) const
+{
+  palette.clear();
+  const tinygltf::Model&        model        = m_scene.getModel();
+  const std::vector<glm::mat4>& nodeMatrices = m_scene.getNodesWorldMatrices();
+  if(task.skinID < 0 || task.skinID >= static_cast<int>(model.skins.size()))
+    return;
+  if(task.refNodeID < 0 || task.refNodeID >= static_cast<int>(nodeMatrices.size()))
+    return;
+
+  const glm::mat4 invNode = glm::inverse(nodeMatrices[task.refNodeID]);
+  for(int jointNodeID : model.skins[task.skinID].joints)
+  {
+    const bool valid = jointNodeID >= 0 && jointNodeID < static_cast<int>(nodeMatrices.size());
+    palette.push_back(valid ? invNode * nodeMatrices[jointNodeID] : glm::mat4(1));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Compare this frame's morph weights and joint palettes with the ones each primitive was last
+// deformed with. A primitive that is both morphed and skinned is deformed in place by both passes
+// (the skin pass reads the morph output), so a change of either input reruns both.
+void AnimationSystem::updateDeformationChanges(bool compareSkin)
+{
+  m_morphInputsChanged.assign(m_morphResults.size(), 1);
+  m_skinInputsChanged.assign(m_skinTasks.size(), 1);
+
+  for(size_t mi = 0; mi < m_morphResults.size(); mi++)
+  {
+    gatherMorphWeights(m_morphResults[mi], m_deformWeights);
+    m_morphInputsChanged[mi] = m_deformChanges.morphInputsChanged(mi, m_deformWeights);
+  }
+  for(size_t si = 0; si < m_skinTasks.size(); si++)
+  {
+    if(compareSkin)
+    {
+      gatherSkinPalette(m_skinTasks[si], m_deformPalette);
+      m_skinInputsChanged[si] = m_deformChanges.skinInputsChanged(si, m_deformPalette);
     }
 
-    if(hasNormals)
-      nvutils::parallel_batches(mr.blendedNormals.size(),
-                                [&](uint64_t v) { mr.blendedNormals[v] = glm::normalize(mr.blendedNormals[v]); });
+    if(const MorphResult* morph = findMorphResult(m_skinTasks[si].renderPrimID))
+    {
+      const size_t mi          = static_cast<size_t>(morph - m_morphResults.data());
+      const bool   changed     = m_morphInputsChanged[mi] || m_skinInputsChanged[si];
+      m_morphInputsChanged[mi] = changed;
+      m_skinInputsChanged[si]  = changed;
+    }
+  }
+
+  for(size_t mi = 0; mi < m_morphResults.size(); mi++)
+  {
+    gatherMorphWeights(m_morphResults[mi], m_deformWeights);
+    m_deformChanges.commitMorph(mi, m_deformWeights, m_morphInputsChanged[mi] != 0,
+                                static_cast<uint32_t>(m_morphResults[mi].basePositions.size()));
+  }
+  for(size_t si = 0; si < m_skinTasks.size(); si++)
+  {
+    if(compareSkin)
+      gatherSkinPalette(m_skinTasks[si], m_deformPalette);
+    else
+      m_deformPalette.clear();  // Nothing to compare against next frame either
+    m_deformChanges.commitSkin(si, m_deformPalette, m_skinInputsChanged[si] != 0,
+                               static_cast<uint32_t>(m_skinTasks[si].weights.size()));
   }
+  m_deformChanges.countFrame();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -23,6 +23,9 @@
 #include <vector>
 
 #include "gltf_animation_pointer.hpp"
+#include "gltf_deform_changes.hpp"
+#include "gltf_morph_sparse.hpp"
+#include "gltf_node_animation.hpp"
 #include "gltf_scene.hpp"
 
 namespace nvvkgltf {
@@ -65,6 +68,7 @@ struct MorphResult
   std::vector<glm::vec3> basePositions;     // Cached at parse time
   std::vector<glm::vec3> baseNormals;       // Cached at parse time (empty if absent)
   std::vector<glm::vec4> baseTangents;      // Cached at parse time (empty if absent)
+  SparseMorphTargets     deltas;            // Non-zero target deltas, cached at parse time
   std::vector<glm::vec3> blendedPositions;  // CPU fallback output (deferred allocation)
   std::vector<glm::vec3> blendedNormals;    // CPU fallback output (deferred allocation)
   std::vector<glm::vec4> blendedTangents;   // CPU fallback output (deferred allocation)
@@ -103,18 +107,66 @@ public:
   void                                    computeMorphTargets();
   const MorphResult&                      getMorphResult(size_t morphTaskIndex) const;
 
+  // Morph target storage of the scene: sparse (what is kept) vs. expanded to every vertex
+  struct MorphStorageStats
+  {
+    size_t nonZeroDeltas = 0;  // (vertex, target) pairs kept
+    size_t denseDeltas   = 0;  // vertexCount * targets, summed over primitives
+    size_t sparseBytes   = 0;
+    size_t denseBytes    = 0;
+  };
+  const MorphStorageStats& getMorphStorageStats() const { return m_morphStorageStats; }
+
+  // Measure keyframes ("Animation/Keyframes"), skinning ("Animation/Skin") and morph
+  // ("Animation/Morph") data, cached inputs and CPU fallback outputs, into `tracker`
+  void reportHostMemory(HostMemoryTracker& tracker) const;
+
   const std::vector<SkinTask>& getSkinTasks() const { return m_skinTasks; }
   bool                         hasSkinning() const { return !m_skinTasks.empty(); }
   void                         computeSkinning();
   const SkinningResult&        getSkinningResult(size_t skinTaskIndex) const;
 
+  // Per-primitive change detection of the deformation inputs (see DeformChangeTracker). Call once per
+  // frame before deforming, on the CPU or GPU path; computeMorphTargets(), computeSkinning(), the
+  // compute dispatch and the BLAS refit then skip the primitives whose weights / palette did not change.
+  // compareSkin=false when the palettes come from device-only world matrices (GPU transform path): the
+  // CPU ones may be stale, so every skin task counts as changed.
+  void                       updateDeformationChanges(bool compareSkin = true);
+  void                       invalidateDeformation() { m_deformChanges.invalidate(); }  // Vertex buffers were rewritten
+  const DeformChangeTracker& getDeformationChanges() const { return m_deformChanges; }
+  DeformSkipStats            takeDeformationStats() { return m_deformChanges.takeStats(); }
+
+  // GPU playback of rigid node animation (see NodeAnimationTable). Returns the keyframe table of the
+  // animation if every channel is a node translation/rotation/scale and no animated subtree feeds a
+  // CPU-side consumer (skin, joint, light, camera); nullptr otherwise. Cached until invalidated.
+  const NodeAnimationTable* prepareGpuNodeAnimation(uint32_t animationIndex);
+  void                      invalidateGpuNodeAnimation();
+  // Drop the cached table only if one of `dirtyNodes` is an animated node whose rest TRS (un-animated
+  // paths) changed or that switched to a matrix. Syncs pending GPU results into the model first.
+  void invalidateGpuNodeAnimation(const std::unordered_set<int>& dirtyNodes);
+  uint64_t                  getGpuNodeAnimationRevision() const { return m_gpuNodeAnimRevision; }  // Bumped per rebuild
+  // The animation was evaluated on the GPU this frame: the model's node TRS now lag behind.
+  void markGpuNodeAnimationPlayed() { m_gpuNodeAnimPending = true; }
+  // Write the GPU-played node TRS back into the model and mark those nodes dirty. Call before
+  // anything reads node transforms on the CPU (editor, CPU sync path). Returns false if nothing was pending.
+  bool syncGpuNodeAnimationToCpu();
+  // TRS of `node` as the GPU played it, without writing the model or marking anything dirty (gizmo
+  // display). Returns false if the model TRS of the node are current.
+  bool getGpuNodeAnimationTrs(int node, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const;
+
 private:
+  friend class AnimationPrefetch;  // Evaluates copies of the clips ahead, see gltf_animation_prefetch.hpp
+
   Scene& m_scene;
 
   // Look up the morph result for a given render primitive (nullptr if the primitive is not
   // morphed). Used by computeSkinning() to compose morph -> skin for primitives that are both.
   const MorphResult* findMorphResult(int renderPrimID) const;
 
+  // Deformation inputs compared by updateDeformationChanges()
+  void gatherMorphWeights(const MorphResult& mr, std::vector<float>& weights) const;
+  void gatherSkinPalette(const SkinTask& task, std::vector<glm::mat4>& palette) const;
+
   struct AnimationChannel
   {
     enum PathType
@@ -160,9 +212,14 @@ private:
   std::vector<SkinTask>            m_skinTasks;
 
   std::vector<MorphResult> m_morphResults;
+  MorphStorageStats        m_morphStorageStats;
 
-  // Reused across morph targets each frame to avoid per-target allocations
-  std::vector<glm::vec3> m_morphTempVec3;
+  // Deformation change detection and its per-frame scratch
+  DeformChangeTracker    m_deformChanges;
+  std::vector<float>     m_deformWeights;
+  std::vector<glm::mat4> m_deformPalette;
+  std::vector<uint8_t>   m_morphInputsChanged;
+  std::vector<uint8_t>   m_skinInputsChanged;
 
   // Reused across skin tasks each frame (only normalMatrices and jointMatrices need per-frame workspace)
   std::vector<glm::mat3> m_normalMatrices;
@@ -172,14 +229,34 @@ private:
   // Built once in parseSkinTasks() to replace the O(skins*nodes) scan in updateAnimation().
   std::vector<std::vector<int>> m_skinToNodeIndices;
 
+  // GPU node animation: table of the last prepared animation (ineligible results are cached too)
+  NodeAnimationTable m_gpuNodeAnim;
+  int                m_gpuNodeAnimIndex    = -1;  // Animation m_gpuNodeAnim was built for (-1: none)
+  bool               m_gpuNodeAnimEligible = false;
+  bool               m_gpuNodeAnimPending  = false;  // Node TRS in the model lag behind the GPU
+  uint64_t           m_gpuNodeAnimRevision = 0;
+
   void parseSamplersAndChannels();
   void parseMorphPrimitives();
   void parseSkinTasks();
   void buildSkinToNodeMap();
+  // Adds to the dirty nodes the nodes using a skin with a dirty joint
+  void addSkinnedNodes(std::vector<bool>& dirtyBits, std::vector<int>& dirtyList) const;
+  bool buildNodeAnimationTable(uint32_t animationIndex, NodeAnimationTable& table) const;
 
-  bool processAnimationChannel(tinygltf::Node* gltfNode, AnimationSampler& sampler, const AnimationChannel& channel, float time);
+  // `model` holds the meshes of the weights channels (the scene's, or a prefetch copy)
+  bool processAnimationChannel(tinygltf::Model&        model,
+                               tinygltf::Node*         gltfNode,
+                               AnimationSampler&       sampler,
+                               const AnimationChannel& channel,
+                               float                   time);
   float calculateInterpolationFactor(float inputStart, float inputEnd, float time);
-  void handleLinearInterpolation(tinygltf::Node* gltfNode, AnimationSampler& sampler, const AnimationChannel& channel, float t, size_t index);
+  void  handleLinearInterpolation(tinygltf::Model&        model,
+                                  tinygltf::Node*         gltfNode,
+                                  AnimationSampler&       sampler,
+                                  const AnimationChannel& channel,
+                                  float                   t,
+                                  size_t                  index);
   void handleStepInterpolation(tinygltf::Node* gltfNode, AnimationSampler& sampler, const AnimationChannel& channel, size_t index);
   void handleCubicSplineInterpolation(tinygltf::Node*         gltfNode,
                                       AnimationSampler&       sampler,
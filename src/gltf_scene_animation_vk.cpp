@@ -21,11 +21,13 @@
 // GPU-accelerated skeletal skinning and morph target blending via compute
 // shaders. Static per-primitive data (base geometry, skin weights/joints,
 // inverse bind matrices, morph deltas) is uploaded once at scene load as
-// GPU SSBOs. Each frame, only the small per-skin joint matrices and
-// per-morph weights are uploaded; compute shaders then write the results
-// directly into the existing SceneVk vertex buffers via BDA pointers.
+// GPU SSBOs, with the task tables of the batched dispatches. Each frame,
+// the morph weights are uploaded (and the joint palettes, unless they are
+// computed on the GPU); one morph and one skin dispatch then write the
+// results directly into the existing SceneVk vertex buffers via BDA pointers.
 //
 
+#include <algorithm>
 #include <cassert>
 #include <span>
 #include <unordered_set>
@@ -43,6 +45,7 @@
 // Pre-compiled compute shaders (generated by CMake's compile_slang)
 #include "_autogen/skinning.comp.slang.h"
 #include "_autogen/morph.comp.slang.h"
+#include "_autogen/joint_palette.comp.slang.h"
 
 
 namespace nvvkgltf {
@@ -50,6 +53,9 @@ namespace nvvkgltf {
 namespace {
 constexpr const char* kMemCategorySkinning = "Skinning";
 constexpr const char* kMemCategoryMorphing = "Morphing";
+
+// Per-dispatch workgroup count; larger batches are split (maxComputeWorkGroupCount[0] is at least 65535)
+constexpr uint32_t kMaxGroupsPerDispatch = 65535;
 }  // namespace
 
 //--------------------------------------------------------------------------------------------------
@@ -73,58 +79,45 @@ void AnimationVk::deinit()
 }
 
 //--------------------------------------------------------------------------------------------------
-// Create the skinning and morph compute pipelines. Each uses only push constants
-// (no descriptor sets) since all buffer addresses are passed via BDA pointers.
+// Create one compute pipeline that uses only push constants (no descriptor sets): all buffer
+// addresses are passed via BDA pointers.
+static void createPushConstantPipeline(VkDevice          device,
+                                       const uint32_t*   code,
+                                       size_t            codeSize,
+                                       uint32_t          pushConstantSize,
+                                       VkPipelineLayout& layout,
+                                       VkPipeline&       pipeline)
+{
+  VkPushConstantRange pushRange{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = pushConstantSize};
+  VkPipelineLayoutCreateInfo layoutInfo{.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+                                        .pushConstantRangeCount = 1,
+                                        .pPushConstantRanges    = &pushRange};
+  NVVK_CHECK(vkCreatePipelineLayout(device, &layoutInfo, nullptr, &layout));
+  NVVK_DBG_NAME(layout);
+
+  VkShaderModuleCreateInfo shaderInfo{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO, .codeSize = codeSize, .pCode = code};
+
+  VkComputePipelineCreateInfo pipeInfo{.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+                                       .stage  = {.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                                                  .pNext = &shaderInfo,
+                                                  .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+                                                  .pName = "main"},
+                                       .layout = layout};
+  NVVK_CHECK(vkCreateComputePipelines(device, nullptr, 1, &pipeInfo, nullptr, &pipeline));
+  NVVK_DBG_NAME(pipeline);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Create the batched skinning and morph pipelines and the joint palette pipeline.
 void AnimationVk::createPipelines()
 {
   VkDevice device = m_alloc->getDevice();
-
-  // Skinning pipeline (push constants only, no descriptor sets)
-  {
-    VkPushConstantRange pushRange{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(shaderio::SkinPushConstant)};
-    VkPipelineLayoutCreateInfo layoutInfo{.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-                                          .pushConstantRangeCount = 1,
-                                          .pPushConstantRanges    = &pushRange};
-    NVVK_CHECK(vkCreatePipelineLayout(device, &layoutInfo, nullptr, &m_skinPipelineLayout));
-    NVVK_DBG_NAME(m_skinPipelineLayout);
-
-    VkShaderModuleCreateInfo shaderInfo{.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-                                        .codeSize = skinning_comp_slang_sizeInBytes,
-                                        .pCode    = skinning_comp_slang};
-
-    VkComputePipelineCreateInfo pipeInfo{.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-                                         .stage  = {.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-                                                    .pNext = &shaderInfo,
-                                                    .stage = VK_SHADER_STAGE_COMPUTE_BIT,
-                                                    .pName = "main"},
-                                         .layout = m_skinPipelineLayout};
-    NVVK_CHECK(vkCreateComputePipelines(device, nullptr, 1, &pipeInfo, nullptr, &m_skinPipeline));
-    NVVK_DBG_NAME(m_skinPipeline);
-  }
-
-  // Morph pipeline
-  {
-    VkPushConstantRange pushRange{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(shaderio::MorphPushConstant)};
-    VkPipelineLayoutCreateInfo layoutInfo{.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-                                          .pushConstantRangeCount = 1,
-                                          .pPushConstantRanges    = &pushRange};
-    NVVK_CHECK(vkCreatePipelineLayout(device, &layoutInfo, nullptr, &m_morphPipelineLayout));
-    NVVK_DBG_NAME(m_morphPipelineLayout);
-
-    VkShaderModuleCreateInfo shaderInfo{.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-                                        .codeSize = morph_comp_slang_sizeInBytes,
-                                        .pCode    = morph_comp_slang};
-
-    VkComputePipelineCreateInfo pipeInfo{.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-                                         .stage  = {.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-                                                    .pNext = &shaderInfo,
-                                                    .stage = VK_SHADER_STAGE_COMPUTE_BIT,
-                                                    .pName = "main"},
-                                         .layout = m_morphPipelineLayout};
-
-    NVVK_CHECK(vkCreateComputePipelines(device, nullptr, 1, &pipeInfo, nullptr, &m_morphPipeline));
-    NVVK_DBG_NAME(m_morphPipeline);
-  }
+  createPushConstantPipeline(device, skinning_comp_slang, skinning_comp_slang_sizeInBytes,
+                             sizeof(shaderio::SkinBatchPushConstant), m_skinPipelineLayout, m_skinPipeline);
+  createPushConstantPipeline(device, morph_comp_slang, morph_comp_slang_sizeInBytes,
+                             sizeof(shaderio::MorphBatchPushConstant), m_morphPipelineLayout, m_morphPipeline);
+  createPushConstantPipeline(device, joint_palette_comp_slang, joint_palette_comp_slang_sizeInBytes,
+                             sizeof(shaderio::JointPalettePushConstant), m_palettePipelineLayout, m_palettePipeline);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -136,14 +129,20 @@ void AnimationVk::destroyPipelines()
     vkDestroyPipeline(device, m_skinPipeline, nullptr);
   if(m_morphPipeline)
     vkDestroyPipeline(device, m_morphPipeline, nullptr);
+  if(m_palettePipeline)
+    vkDestroyPipeline(device, m_palettePipeline, nullptr);
   if(m_skinPipelineLayout)
     vkDestroyPipelineLayout(device, m_skinPipelineLayout, nullptr);
   if(m_morphPipelineLayout)
     vkDestroyPipelineLayout(device, m_morphPipelineLayout, nullptr);
-  m_skinPipeline        = {};
-  m_morphPipeline       = {};
-  m_skinPipelineLayout  = {};
-  m_morphPipelineLayout = {};
+  if(m_palettePipelineLayout)
+    vkDestroyPipelineLayout(device, m_palettePipelineLayout, nullptr);
+  m_skinPipeline          = {};
+  m_morphPipeline         = {};
+  m_palettePipeline       = {};
+  m_skinPipelineLayout    = {};
+  m_morphPipelineLayout   = {};
+  m_palettePipelineLayout = {};
 }
 
 //========== Buffer Helpers ==========
@@ -175,8 +174,9 @@ nvvk::Buffer AnimationVk::createBufferFromSpan(nvvk::StagingUploader& staging, s
 
 //--------------------------------------------------------------------------------------------------
 // Upload all static animation data to GPU SSBOs. Called once when the scene is loaded or rebuilt.
-// For skinning: base geometry, skin weights, joint indices, and inverse bind matrices per primitive.
-// For morphing: base geometry and all morph target deltas packed sequentially per primitive.
+// For skinning: base geometry, skin weights and joint indices per primitive; joint nodes and inverse
+// bind matrices per palette. For morphing: base geometry and the non-zero morph target deltas of
+// each primitive, grouped per vertex. Also builds the batch task table (see DeformBatchTable).
 void AnimationVk::createGpuBuffers(nvvk::StagingUploader& staging, const Scene& scn)
 {
   destroyGpuBuffers();
@@ -185,62 +185,69 @@ void AnimationVk::createGpuBuffers(nvvk::StagingUploader& staging, const Scene&
   const auto& morphResults = scn.animation().getMorphPrimitives();
   const auto& model        = scn.getModel();
 
-  // Skin GPU buffers: one set of SSBOs per unique skinned primitive (SkinTask).
-  // Also compute offsets for the packed per-frame joint/normal matrix buffers.
-  size_t totalJointMatBytes  = 0;
-  size_t totalNormalMatBytes = 0;
+  // Skin GPU buffers: one set of SSBOs per unique skinned primitive (SkinTask), and one task per
+  // skinned primitive in the batch table. Tasks of the same skin and reference node share a palette.
+  m_batch.clear();
+  m_batchUploaded = false;
   m_skinGpuData.resize(skinTasks.size());
+  std::vector<int> jointNodes;
   for(size_t i = 0; i < skinTasks.size(); i++)
   {
     const SkinTask& task = skinTasks[i];
     SkinGpuData&    gpu  = m_skinGpuData[i];
 
-    size_t numJoints =
-        (task.skinID >= 0 && task.skinID < static_cast<int>(model.skins.size())) ? model.skins[task.skinID].joints.size() : 0;
+    const bool validSkin = task.skinID >= 0 && task.skinID < static_cast<int>(model.skins.size());
+    size_t     numJoints = validSkin ? model.skins[task.skinID].joints.size() : 0;
 
     if(task.inverseBindMatrices.size() < numJoints)
     {
-      const char* skinName = (task.skinID >= 0) ? model.skins[task.skinID].name.c_str() : "?";
+      const char* skinName = validSkin ? model.skins[task.skinID].name.c_str() : "?";
       LOGW("Skin '%s': inverseBindMatrices count (%zu) < joint count (%zu); missing entries default to identity\n",
            skinName, task.inverseBindMatrices.size(), numJoints);
     }
 
-    gpu.basePositions       = createBufferFromSpan(staging, std::span<const glm::vec3>(task.basePositions));
-    gpu.baseNormals         = createBufferFromSpan(staging, std::span<const glm::vec3>(task.baseNormals));
-    gpu.baseTangents        = createBufferFromSpan(staging, std::span<const glm::vec4>(task.baseTangents));
-    gpu.weights             = createBufferFromSpan(staging, std::span<const glm::vec4>(task.weights));
-    gpu.joints              = createBufferFromSpan(staging, std::span<const glm::ivec4>(task.joints));
-    gpu.inverseBindMatrices = createBufferFromSpan(staging, std::span<const glm::mat4>(task.inverseBindMatrices));
+    gpu.basePositions = createBufferFromSpan(staging, std::span<const glm::vec3>(task.basePositions));
+    gpu.baseNormals   = createBufferFromSpan(staging, std::span<const glm::vec3>(task.baseNormals));
+    gpu.baseTangents  = createBufferFromSpan(staging, std::span<const glm::vec4>(task.baseTangents));
+    gpu.weights       = createBufferFromSpan(staging, std::span<const glm::vec4>(task.weights));
+    gpu.joints        = createBufferFromSpan(staging, std::span<const glm::ivec4>(task.joints));
 
     m_memoryTracker.track(kMemCategorySkinning, gpu.basePositions.allocation);
     m_memoryTracker.track(kMemCategorySkinning, gpu.baseNormals.allocation);
     m_memoryTracker.track(kMemCategorySkinning, gpu.baseTangents.allocation);
     m_memoryTracker.track(kMemCategorySkinning, gpu.weights.allocation);
     m_memoryTracker.track(kMemCategorySkinning, gpu.joints.allocation);
-    m_memoryTracker.track(kMemCategorySkinning, gpu.inverseBindMatrices.allocation);
 
-    gpu.jointMatOffset  = totalJointMatBytes;
-    gpu.normalMatOffset = totalNormalMatBytes;
-    totalJointMatBytes += numJoints * sizeof(glm::mat4);
-    totalNormalMatBytes += numJoints * sizeof(glm::mat3);
+    if(!validSkin || task.refNodeID < 0 || task.refNodeID >= static_cast<int>(model.nodes.size()))
+      continue;
+    if(!gpu.basePositions.buffer || !gpu.weights.buffer || !gpu.joints.buffer)
+      continue;
+
+    // Joints outside the node range get an identity palette entry
+    jointNodes.assign(model.skins[task.skinID].joints.begin(), model.skins[task.skinID].joints.end());
+    for(int& jointNode : jointNodes)
+      jointNode = (jointNode >= 0 && jointNode < static_cast<int>(model.nodes.size())) ? jointNode : -1;
+
+    gpu.batchTask = static_cast<int>(m_batch.addSkin(static_cast<uint32_t>(task.weights.size()), task.skinID, task.refNodeID,
+                                                     jointNodes, task.inverseBindMatrices));
   }
 
-  // Pre-allocate packed per-frame buffers for all skin tasks' joint + normal matrices
-  if(totalJointMatBytes > 0)
+  // Palette: static joint/reference nodes + IBMs, per-frame joint/normal matrices
+  if(!m_batch.palette.empty())
   {
-    NVVK_CHECK(m_alloc->createBuffer(m_jointMatricesBuffer, totalJointMatBytes, kSsboUsage));
+    m_paletteEntriesBuffer = createBufferFromSpan(staging, std::span<const shaderio::JointPaletteEntry>(m_batch.palette));
+    m_paletteInverseBindBuffer = createBufferFromSpan(staging, std::span<const glm::mat4>(m_batch.paletteInverseBind));
+    NVVK_CHECK(m_alloc->createBuffer(m_jointMatricesBuffer, m_batch.palette.size() * sizeof(glm::mat4), kSsboUsage));
+    NVVK_CHECK(m_alloc->createBuffer(m_normalMatricesBuffer, m_batch.palette.size() * sizeof(glm::mat3), kSsboUsage));
+    m_memoryTracker.track(kMemCategorySkinning, m_paletteEntriesBuffer.allocation);
+    m_memoryTracker.track(kMemCategorySkinning, m_paletteInverseBindBuffer.allocation);
     m_memoryTracker.track(kMemCategorySkinning, m_jointMatricesBuffer.allocation);
-  }
-  if(totalNormalMatBytes > 0)
-  {
-    NVVK_CHECK(m_alloc->createBuffer(m_normalMatricesBuffer, totalNormalMatBytes, kSsboUsage));
     m_memoryTracker.track(kMemCategorySkinning, m_normalMatricesBuffer.allocation);
   }
 
-  // Morph GPU buffers: base geometry + packed deltas for all targets per morph primitive.
-  // Delta layout in GPU memory: [target0_vertex0..target0_vertexN, target1_vertex0..target1_vertexN, ...]
-  size_t      totalMorphWeightsBytes = 0;
-  const auto& morphResultsVec        = scn.animation().getMorphPrimitives();
+  // Morph GPU buffers: base geometry + the non-zero deltas of all targets per morph primitive, in
+  // the vertex-major layout of SparseMorphTargets::VertexMajor (each thread reads its own vertex's entries).
+  const auto& morphResultsVec = scn.animation().getMorphPrimitives();
   m_morphGpuData.resize(morphResultsVec.size());
   for(size_t mi = 0; mi < morphResultsVec.size(); mi++)
   {
@@ -255,91 +262,62 @@ void AnimationVk::createGpuBuffers(nvvk::StagingUploader& staging, const Scene&
     m_memoryTracker.track(kMemCategoryMorphing, gpu.baseNormals.allocation);
     m_memoryTracker.track(kMemCategoryMorphing, gpu.baseTangents.allocation);
 
-    // Pack all morph target deltas sequentially: [target0_v0..target0_vN, target1_v0..target1_vN, ...]
     if(mr.renderPrimID >= 0)
     {
-      const RenderPrimitive&     renderPrim = scn.getRenderPrimitive(mr.renderPrimID);
-      const tinygltf::Primitive& primitive  = *renderPrim.pPrimitive;
-      const tinygltf::Mesh&      mesh       = model.meshes[renderPrim.meshID];
-
-      uint32_t numTargets = static_cast<uint32_t>(std::min(primitive.targets.size(), mesh.weights.size()));
-      std::vector<glm::vec3> allPosDeltas;
-      std::vector<glm::vec3> allNrmDeltas;
-      std::vector<glm::vec3> allTanDeltas;
-
-      bool hasNormalDeltas  = false;
-      bool hasTangentDeltas = false;
-
-      for(uint32_t t = 0; t < numTargets; t++)
-      {
-        const auto& target = primitive.targets[t];
-
-        // Position deltas
-        auto posFind = target.find("POSITION");
-        if(posFind != target.end() && posFind->second >= 0 && posFind->second < static_cast<int>(model.accessors.size()))
-        {
-          std::vector<glm::vec3> temp;
-          std::span<const glm::vec3> deltas = tinygltf::utils::getAccessorData(model, model.accessors[posFind->second], &temp);
-          allPosDeltas.insert(allPosDeltas.end(), deltas.begin(), deltas.end());
-        }
-        else
-        {
-          allPosDeltas.resize(allPosDeltas.size() + mr.basePositions.size(), glm::vec3(0));
-        }
-
-        // Normal deltas
-        auto nrmFind = target.find("NORMAL");
-        if(nrmFind != target.end() && nrmFind->second >= 0 && nrmFind->second < static_cast<int>(model.accessors.size()))
-        {
-          std::vector<glm::vec3> temp;
-          std::span<const glm::vec3> deltas = tinygltf::utils::getAccessorData(model, model.accessors[nrmFind->second], &temp);
-          allNrmDeltas.insert(allNrmDeltas.end(), deltas.begin(), deltas.end());
-          hasNormalDeltas = true;
-        }
-        else
-        {
-          allNrmDeltas.resize(allNrmDeltas.size() + mr.basePositions.size(), glm::vec3(0));
-        }
-
-        // Tangent deltas
-        auto tanFind = target.find("TANGENT");
-        if(tanFind != target.end() && tanFind->second >= 0 && tanFind->second < static_cast<int>(model.accessors.size()))
-        {
-          std::vector<glm::vec3> temp;
-          std::span<const glm::vec3> deltas = tinygltf::utils::getAccessorData(model, model.accessors[tanFind->second], &temp);
-          allTanDeltas.insert(allTanDeltas.end(), deltas.begin(), deltas.end());
-          hasTangentDeltas = true;
-        }
-        else
-        {
-          allTanDeltas.resize(allTanDeltas.size() + mr.basePositions.size(), glm::vec3(0));
-        }
-      }
-
-      gpu.numTargets    = numTargets;
-      gpu.weightsOffset = totalMorphWeightsBytes;
-      totalMorphWeightsBytes += numTargets * sizeof(float);
-      gpu.positionDeltas = createBufferFromSpan(staging, std::span<const glm::vec3>(allPosDeltas));
+      const RenderPrimitive& renderPrim = scn.getRenderPrimitive(mr.renderPrimID);
+      const tinygltf::Mesh&  mesh       = model.meshes[renderPrim.meshID];
+
+      const uint32_t numTargets = static_cast<uint32_t>(std::min(mr.deltas.targets.size(), mesh.weights.size()));
+      const SparseMorphTargets::VertexMajor deltas =
+          mr.deltas.toVertexMajor(numTargets, !mr.baseNormals.empty(), !mr.baseTangents.empty());
+
+      gpu.numTargets     = numTargets;
+      gpu.deltaRowStart  = createBufferFromSpan(staging, std::span<const uint32_t>(deltas.rowStart));
+      gpu.deltaTargets   = createBufferFromSpan(staging, std::span<const uint32_t>(deltas.targets));
+      gpu.positionDeltas = createBufferFromSpan(staging, std::span<const glm::vec3>(deltas.positions));
+      gpu.normalDeltas   = createBufferFromSpan(staging, std::span<const glm::vec3>(deltas.normals));
+      gpu.tangentDeltas  = createBufferFromSpan(staging, std::span<const glm::vec3>(deltas.tangents));
+      m_memoryTracker.track(kMemCategoryMorphing, gpu.deltaRowStart.allocation);
+      m_memoryTracker.track(kMemCategoryMorphing, gpu.deltaTargets.allocation);
       m_memoryTracker.track(kMemCategoryMorphing, gpu.positionDeltas.allocation);
-      if(hasNormalDeltas && !mr.baseNormals.empty())
-      {
-        gpu.normalDeltas = createBufferFromSpan(staging, std::span<const glm::vec3>(allNrmDeltas));
-        m_memoryTracker.track(kMemCategoryMorphing, gpu.normalDeltas.allocation);
-      }
-      if(hasTangentDeltas && !mr.baseTangents.empty())
-      {
-        gpu.tangentDeltas = createBufferFromSpan(staging, std::span<const glm::vec3>(allTanDeltas));
-        m_memoryTracker.track(kMemCategoryMorphing, gpu.tangentDeltas.allocation);
-      }
+      m_memoryTracker.track(kMemCategoryMorphing, gpu.normalDeltas.allocation);
+      m_memoryTracker.track(kMemCategoryMorphing, gpu.tangentDeltas.allocation);
+
+      if(numTargets > 0 && !mr.basePositions.empty())
+        gpu.batchTask = static_cast<int>(m_batch.addMorph(static_cast<uint32_t>(mr.basePositions.size()), numTargets));
     }
   }
 
   // Pre-allocate packed per-frame buffer for all morph tasks' weights
-  if(totalMorphWeightsBytes > 0)
+  if(m_batch.morphWeightCount > 0)
   {
-    NVVK_CHECK(m_alloc->createBuffer(m_morphWeightsBuffer, totalMorphWeightsBytes, kSsboUsage));
+    NVVK_CHECK(m_alloc->createBuffer(m_morphWeightsBuffer, m_batch.morphWeightCount * sizeof(float), kSsboUsage));
     m_memoryTracker.track(kMemCategoryMorphing, m_morphWeightsBuffer.allocation);
   }
+
+  // Task tables: sized now, contents uploaded on the first dispatch (they reference SceneVk's vertex buffers)
+  if(!m_batch.skinTasks.empty())
+  {
+    NVVK_CHECK(m_alloc->createBuffer(m_skinTasksBuffer, m_batch.skinTasks.size() * sizeof(shaderio::SkinBatchTask), kSsboUsage));
+    m_skinFirstVertexBuffer = createBufferFromSpan(staging, std::span<const uint32_t>(m_batch.skinFirstVertex));
+    NVVK_CHECK(m_alloc->createBuffer(m_skinSelectedTasksBuffer, m_batch.skinTasks.size() * sizeof(shaderio::SkinBatchTask), kSsboUsage));
+    NVVK_CHECK(m_alloc->createBuffer(m_skinSelectedFirstVertexBuffer, m_batch.skinTasks.size() * sizeof(uint32_t), kSsboUsage));
+    m_memoryTracker.track(kMemCategorySkinning, m_skinTasksBuffer.allocation);
+    m_memoryTracker.track(kMemCategorySkinning, m_skinFirstVertexBuffer.allocation);
+    m_memoryTracker.track(kMemCategorySkinning, m_skinSelectedTasksBuffer.allocation);
+    m_memoryTracker.track(kMemCategorySkinning, m_skinSelectedFirstVertexBuffer.allocation);
+  }
+  if(!m_batch.morphTasks.empty())
+  {
+    NVVK_CHECK(m_alloc->createBuffer(m_morphTasksBuffer, m_batch.morphTasks.size() * sizeof(shaderio::MorphBatchTask), kSsboUsage));
+    m_morphFirstVertexBuffer = createBufferFromSpan(staging, std::span<const uint32_t>(m_batch.morphFirstVertex));
+    NVVK_CHECK(m_alloc->createBuffer(m_morphSelectedTasksBuffer, m_batch.morphTasks.size() * sizeof(shaderio::MorphBatchTask), kSsboUsage));
+    NVVK_CHECK(m_alloc->createBuffer(m_morphSelectedFirstVertexBuffer, m_batch.morphTasks.size() * sizeof(uint32_t), kSsboUsage));
+    m_memoryTracker.track(kMemCategoryMorphing, m_morphTasksBuffer.allocation);
+    m_memoryTracker.track(kMemCategoryMorphing, m_morphFirstVertexBuffer.allocation);
+    m_memoryTracker.track(kMemCategoryMorphing, m_morphSelectedTasksBuffer.allocation);
+    m_memoryTracker.track(kMemCategoryMorphing, m_morphSelectedFirstVertexBuffer.allocation);
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -374,7 +352,6 @@ void AnimationVk::destroyGpuBuffers()
     destroySkin(gpu.baseTangents);
     destroySkin(gpu.weights);
     destroySkin(gpu.joints);
-    destroySkin(gpu.inverseBindMatrices);
   }
   m_skinGpuData.clear();
 
@@ -383,6 +360,8 @@ void AnimationVk::destroyGpuBuffers()
     destroyMorph(gpu.basePositions);
     destroyMorph(gpu.baseNormals);
     destroyMorph(gpu.baseTangents);
+    destroyMorph(gpu.deltaRowStart);
+    destroyMorph(gpu.deltaTargets);
     destroyMorph(gpu.positionDeltas);
     destroyMorph(gpu.normalDeltas);
     destroyMorph(gpu.tangentDeltas);
@@ -391,102 +370,205 @@ void AnimationVk::destroyGpuBuffers()
 
   destroySkin(m_jointMatricesBuffer);
   destroySkin(m_normalMatricesBuffer);
+  destroySkin(m_skinTasksBuffer);
+  destroySkin(m_skinFirstVertexBuffer);
+  destroySkin(m_skinSelectedTasksBuffer);
+  destroySkin(m_skinSelectedFirstVertexBuffer);
+  destroySkin(m_paletteEntriesBuffer);
+  destroySkin(m_paletteInverseBindBuffer);
   destroyMorph(m_morphWeightsBuffer);
+  destroyMorph(m_morphTasksBuffer);
+  destroyMorph(m_morphFirstVertexBuffer);
+  destroyMorph(m_morphSelectedTasksBuffer);
+  destroyMorph(m_morphSelectedFirstVertexBuffer);
+  m_batch.clear();
+  m_batchUploaded = false;
 }
 
 //========== Per-Frame Dispatch ==========
 
 //--------------------------------------------------------------------------------------------------
-// Record compute shader dispatches for the current animation frame.
-//
-// For each morph primitive: uploads the current morph weights, then dispatches the morph compute
-// shader which blends base geometry + weighted deltas -> output vertex buffer.
-//
-// For each skinned primitive: computes joint matrices on CPU (invNode * worldJoint * IBM), uploads
-// them via staging, then dispatches the skinning compute shader which transforms base geometry
-// using 4 joint influences per vertex -> output vertex buffer.
-//
-// All output is written directly into SceneVk's existing vertex buffers via BDA pointers.
-// A shared per-frame matrix/weights buffer is reused across tasks with proper barriers.
-//
-// After all dispatches, a final barrier ensures the written vertex data is visible to
-// subsequent vertex input and acceleration structure build stages.
-void AnimationVk::dispatchAnimation(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk)
+// Fill the buffer and vertex-buffer addresses of the batch tasks and upload both task tables.
+// Primitives that are BOTH morphed and skinned compose morph -> skin: their skin task reads the
+// morphed vertex buffers (morph pass output) as its base geometry instead of the static skin base.
+void AnimationVk::uploadBatchTasks(nvvk::StagingUploader& staging, const Scene& scn, const SceneVk& scnVk)
 {
-  const tinygltf::Model&        model        = scn.getModel();
-  const std::vector<glm::mat4>& nodeMatrices = scn.getNodesWorldMatrices();
-  const auto&                   vertexBufs   = scnVk.vertexBuffers();
-  const auto&                   skinTasks    = scn.animation().getSkinTasks();
-
-  // Primitives that are BOTH morphed and skinned must compose morph -> skin: the skin pass
-  // reads the morphed vertex buffers (Phase 2 output) as its base geometry rather than the
-  // static skin base. Build the set of morph-target primitive IDs to detect this overlap.
+  const auto& vertexBufs = scnVk.vertexBuffers();
+  const auto& skinTasks  = scn.animation().getSkinTasks();
+
   std::unordered_set<int> morphPrimIDs;
   for(size_t mi = 0; mi < m_morphGpuData.size(); mi++)
   {
+    const MorphGpuData& gpu = m_morphGpuData[mi];
+    if(gpu.batchTask < 0)
+      continue;
+
     const MorphResult& mr = scn.animation().getMorphResult(mi);
-    if(mr.renderPrimID >= 0 && !mr.basePositions.empty() && m_morphGpuData[mi].numTargets > 0)
-      morphPrimIDs.insert(mr.renderPrimID);
+    const auto&        vb = vertexBufs[mr.renderPrimID];
+    morphPrimIDs.insert(mr.renderPrimID);
+
+    shaderio::MorphBatchTask& task = m_batch.morphTasks[gpu.batchTask];
+    task.basePositions             = reinterpret_cast<glm::vec3*>(gpu.basePositions.address);
+    task.baseNormals    = gpu.baseNormals.buffer ? reinterpret_cast<glm::vec3*>(gpu.baseNormals.address) : nullptr;
+    task.baseTangents   = gpu.baseTangents.buffer ? reinterpret_cast<glm::vec4*>(gpu.baseTangents.address) : nullptr;
+    task.deltaRowStart  = reinterpret_cast<uint32_t*>(gpu.deltaRowStart.address);
+    task.deltaTargets   = reinterpret_cast<uint32_t*>(gpu.deltaTargets.address);
+    task.positionDeltas = reinterpret_cast<glm::vec3*>(gpu.positionDeltas.address);
+    task.normalDeltas   = gpu.normalDeltas.buffer ? reinterpret_cast<glm::vec3*>(gpu.normalDeltas.address) : nullptr;
+    task.tangentDeltas  = gpu.tangentDeltas.buffer ? reinterpret_cast<glm::vec3*>(gpu.tangentDeltas.address) : nullptr;
+    task.outPositions   = reinterpret_cast<glm::vec3*>(vb.position.address);
+    task.outNormals = (vb.normal.buffer && gpu.baseNormals.buffer) ? reinterpret_cast<glm::vec3*>(vb.normal.address) : nullptr;
+    task.outTangents = (vb.tangent.buffer && gpu.baseTangents.buffer) ? reinterpret_cast<glm::vec4*>(vb.tangent.address) : nullptr;
   }
 
-  // === Phase 1: Batch-upload all per-frame data (morph weights + joint/normal matrices) ===
-
-  // Pack all morph weights into the pre-allocated buffer at per-task offsets
-  for(size_t mi = 0; mi < m_morphGpuData.size(); mi++)
+  for(size_t ti = 0; ti < m_skinGpuData.size(); ti++)
   {
-    const MorphGpuData& gpu = m_morphGpuData[mi];
-    const MorphResult&  mr  = scn.animation().getMorphResult(mi);
-    if(mr.renderPrimID < 0 || mr.basePositions.empty() || gpu.numTargets == 0)
+    const SkinGpuData& gpu = m_skinGpuData[ti];
+    if(gpu.batchTask < 0)
       continue;
 
-    const auto&           renderPrim = scn.getRenderPrimitive(mr.renderPrimID);
-    const tinygltf::Mesh& mesh       = model.meshes[renderPrim.meshID];
+    const int   renderPrimID = skinTasks[ti].renderPrimID;
+    const auto& vb           = vertexBufs[renderPrimID];
+    const bool  isMorphed    = morphPrimIDs.count(renderPrimID) != 0;
+
+    shaderio::SkinBatchTask& task = m_batch.skinTasks[gpu.batchTask];
+    task.basePositions = isMorphed ? reinterpret_cast<glm::vec3*>(vb.position.address) :
+                                     reinterpret_cast<glm::vec3*>(gpu.basePositions.address);
+    task.baseNormals   = (isMorphed && vb.normal.buffer) ? reinterpret_cast<glm::vec3*>(vb.normal.address) :
+                         gpu.baseNormals.buffer          ? reinterpret_cast<glm::vec3*>(gpu.baseNormals.address) :
+                                                           nullptr;
+    task.baseTangents  = (isMorphed && vb.tangent.buffer) ? reinterpret_cast<glm::vec4*>(vb.tangent.address) :
+                         gpu.baseTangents.buffer          ? reinterpret_cast<glm::vec4*>(gpu.baseTangents.address) :
+                                                            nullptr;
+    task.weights       = reinterpret_cast<glm::vec4*>(gpu.weights.address);
+    task.joints        = reinterpret_cast<glm::ivec4*>(gpu.joints.address);
+    task.outPositions  = reinterpret_cast<glm::vec3*>(vb.position.address);
+    task.outNormals    = vb.normal.buffer ? reinterpret_cast<glm::vec3*>(vb.normal.address) : nullptr;
+    task.outTangents   = vb.tangent.buffer ? reinterpret_cast<glm::vec4*>(vb.tangent.address) : nullptr;
+  }
 
-    std::vector<float> weights(gpu.numTargets, 0.0f);
-    uint32_t           safeCount = std::min(gpu.numTargets, static_cast<uint32_t>(mesh.weights.size()));
-    if(safeCount < gpu.numTargets)
-    {
-      LOGW("Morph prim %zu: mesh.weights count (%zu) < gpu.numTargets (%u); extra targets will use weight 0\n", mi,
-           mesh.weights.size(), gpu.numTargets);
-    }
-    for(uint32_t t = 0; t < safeCount; t++)
-      weights[t] = static_cast<float>(mesh.weights[t]);
+  if(!m_batch.morphTasks.empty())
+    staging.appendBuffer(m_morphTasksBuffer, 0, std::span(m_batch.morphTasks));
+  if(!m_batch.skinTasks.empty())
+    staging.appendBuffer(m_skinTasksBuffer, 0, std::span(m_batch.skinTasks));
+  m_batchUploaded = true;
+}
 
-    assert(gpu.weightsOffset + weights.size() * sizeof(float) <= m_morphWeightsBuffer.bufferSize);
-    staging.appendBuffer(m_morphWeightsBuffer, gpu.weightsOffset, std::span(weights));
-  }
+//--------------------------------------------------------------------------------------------------
+// Dispatch range of one pass. With every task changed (the common animated case) the static table is
+// used as is; otherwise the changed tasks are repacked and uploaded with this frame's data.
+template <typename Task>
+AnimationVk::PassRange AnimationVk::selectPassTasks(nvvk::StagingUploader& staging,
+                                                    const std::vector<Task>& tasks,
+                                                    uint32_t                 totalVertexCount,
+                                                    const nvvk::Buffer&      tasksBuffer,
+                                                    const nvvk::Buffer&      firstVertexBuffer,
+                                                    const nvvk::Buffer&      selectedTasksBuffer,
+                                                    const nvvk::Buffer&      selectedFirstVertexBuffer,
+                                                    std::vector<Task>&       selected)
+{
+  if(std::all_of(m_taskChanged.begin(), m_taskChanged.end(), [](uint8_t changed) { return changed != 0; }))
+    return {tasksBuffer.address, firstVertexBuffer.address, static_cast<uint32_t>(tasks.size()), totalVertexCount};
+
+  PassRange range;
+  range.vertexCount = DeformBatchTable::selectTasks(std::span<const Task>(tasks), m_taskChanged, selected, m_selectedFirstVertex);
+  range.taskCount   = static_cast<uint32_t>(selected.size());
+  if(range.taskCount == 0)
+    return range;
+
+  staging.appendBuffer(selectedTasksBuffer, 0, std::span(selected));
+  staging.appendBuffer(selectedFirstVertexBuffer, 0, std::span(m_selectedFirstVertex));
+  range.tasks       = selectedTasksBuffer.address;
+  range.firstVertex = selectedFirstVertexBuffer.address;
+  return range;
+}
 
-  // Compute and pack all joint + normal matrices into pre-allocated buffers at per-task offsets
-  for(size_t ti = 0; ti < skinTasks.size(); ti++)
-  {
-    const SkinTask&    task = skinTasks[ti];
-    const SkinGpuData& gpu  = m_skinGpuData[ti];
+//--------------------------------------------------------------------------------------------------
+// Record the compute dispatches for the current animation frame.
+//
+// Per frame the CPU uploads the morph weights of all primitives in one transfer, plus the joint
+// palettes when worldMatrices is 0 (evaluated from the CPU node world matrices). Otherwise the
+// palette pass computes them on the GPU from the node world matrices at worldMatrices.
+//
+// Then one morph dispatch blends base geometry + weighted deltas of every morphed primitive, and
+// one skin dispatch transforms every skinned primitive with 4 joint influences per vertex. Both
+// write directly into SceneVk's existing vertex buffers via BDA pointers.
+//
+// Only the primitives whose weights or joint palette changed since the last frame are dispatched
+// (AnimationSystem::updateDeformationChanges); the others keep last frame's vertex buffers.
+//
+// After all dispatches, a final barrier ensures the written vertex data is visible to
+// subsequent vertex input and acceleration structure build stages.
+void AnimationVk::dispatchAnimation(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk, VkDeviceAddress worldMatrices)
+{
+  const tinygltf::Model& model = scn.getModel();
 
-    if(task.skinID < 0 || task.skinID >= static_cast<int>(model.skins.size()))
-      continue;
-    if(task.refNodeID < 0 || task.refNodeID >= static_cast<int>(nodeMatrices.size()))
-      continue;
+  if(!m_batchUploaded)
+    uploadBatchTasks(staging, scn, scnVk);
 
-    const tinygltf::Skin& skin      = model.skins[task.skinID];
-    const size_t          numJoints = skin.joints.size();
+  // === Phase 0: Changed primitives ===
+  const bool gpuPalette = worldMatrices != 0;
+  scn.animation().updateDeformationChanges(!gpuPalette);
+  const DeformChangeTracker& changes = scn.animation().getDeformationChanges();
+
+  m_taskChanged.assign(m_batch.morphTasks.size(), 0);
+  for(size_t mi = 0; mi < m_morphGpuData.size(); mi++)
+    if(m_morphGpuData[mi].batchTask >= 0 && changes.morphChanged(mi))
+      m_taskChanged[m_morphGpuData[mi].batchTask] = 1;
+  const PassRange morphRange = selectPassTasks(staging, m_batch.morphTasks, m_batch.morphVertexCount, m_morphTasksBuffer,
+                                               m_morphFirstVertexBuffer, m_morphSelectedTasksBuffer,
+                                               m_morphSelectedFirstVertexBuffer, m_selectedMorphTasks);
+
+  m_taskChanged.assign(m_batch.skinTasks.size(), 0);
+  for(size_t si = 0; si < m_skinGpuData.size(); si++)
+    if(m_skinGpuData[si].batchTask >= 0 && changes.skinChanged(si))
+      m_taskChanged[m_skinGpuData[si].batchTask] = 1;
+  const PassRange skinRange = selectPassTasks(staging, m_batch.skinTasks, m_batch.skinVertexCount, m_skinTasksBuffer,
+                                              m_skinFirstVertexBuffer, m_skinSelectedTasksBuffer,
+                                              m_skinSelectedFirstVertexBuffer, m_selectedSkinTasks);
+
+  if(morphRange.vertexCount == 0 && skinRange.vertexCount == 0)
+  {
+    staging.cmdUploadAppended(cmd);  // Task tables of the first dispatch, if any
+    return;
+  }
 
-    std::vector<glm::mat4> jointMats(numJoints);
-    std::vector<glm::mat3> normalMats(numJoints);
-    glm::mat4              invNode = glm::inverse(nodeMatrices[task.refNodeID]);
-    for(size_t i = 0; i < numJoints; ++i)
+  // === Phase 1: Batch-upload all per-frame data (morph weights, CPU joint palettes) ===
+
+  if(morphRange.vertexCount > 0)
+  {
+    std::vector<float> weights(m_batch.morphWeightCount, 0.0f);
+    for(size_t mi = 0; mi < m_morphGpuData.size(); mi++)
     {
-      int jointNodeID = skin.joints[i];
-      if(jointNodeID < 0 || jointNodeID >= static_cast<int>(nodeMatrices.size()))
+      const MorphGpuData& gpu = m_morphGpuData[mi];
+      if(gpu.batchTask < 0)
         continue;
-      jointMats[i] = invNode * nodeMatrices[jointNodeID]
-                     * (i < task.inverseBindMatrices.size() ? task.inverseBindMatrices[i] : glm::mat4(1));
-      normalMats[i] = glm::transpose(glm::inverse(glm::mat3(jointMats[i])));
+
+      const MorphResult&    mr         = scn.animation().getMorphResult(mi);
+      const auto&           renderPrim = scn.getRenderPrimitive(mr.renderPrimID);
+      const tinygltf::Mesh& mesh       = model.meshes[renderPrim.meshID];
+
+      uint32_t safeCount = std::min(gpu.numTargets, static_cast<uint32_t>(mesh.weights.size()));
+      if(safeCount < gpu.numTargets)
+      {
+        LOGW("Morph prim %zu: mesh.weights count (%zu) < gpu.numTargets (%u); extra targets will use weight 0\n", mi,
+             mesh.weights.size(), gpu.numTargets);
+      }
+      const uint32_t weightsOffset = m_batch.morphTasks[gpu.batchTask].weightsOffset;
+      for(uint32_t t = 0; t < safeCount; t++)
+        weights[weightsOffset + t] = static_cast<float>(mesh.weights[t]);
     }
+    staging.appendBuffer(m_morphWeightsBuffer, 0, std::span(weights));
+  }
 
-    assert(gpu.jointMatOffset + jointMats.size() * sizeof(glm::mat4) <= m_jointMatricesBuffer.bufferSize);
-    assert(gpu.normalMatOffset + normalMats.size() * sizeof(glm::mat3) <= m_normalMatricesBuffer.bufferSize);
-    staging.appendBuffer(m_jointMatricesBuffer, gpu.jointMatOffset, std::span(jointMats));
-    staging.appendBuffer(m_normalMatricesBuffer, gpu.normalMatOffset, std::span(normalMats));
+  const bool skinning = skinRange.vertexCount > 0 && !m_batch.palette.empty();
+  if(skinning && !gpuPalette)
+  {
+    m_cpuJointMatrices.resize(m_batch.palette.size());
+    m_cpuNormalMatrices.resize(m_batch.palette.size());
+    m_batch.evaluatePalette(scn.getNodesWorldMatrices(), m_cpuJointMatrices, m_cpuNormalMatrices);
+    staging.appendBuffer(m_jointMatricesBuffer, 0, std::span(m_cpuJointMatrices));
+    staging.appendBuffer(m_normalMatricesBuffer, 0, std::span(m_cpuNormalMatrices));
   }
 
   // Single transfer + single barrier for all per-frame data
@@ -494,91 +576,69 @@ void AnimationVk::dispatchAnimation(VkCommandBuffer cmd, nvvk::StagingUploader&
   nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
                          VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
 
-  // === Phase 2: Dispatch all morph compute shaders ===
-  if(!m_morphGpuData.empty())
+  // === Phase 2: Joint palettes on the GPU (independent of the morph pass) ===
+  if(skinning && gpuPalette)
   {
-    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_morphPipeline);
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_palettePipeline);
+
+    shaderio::JointPalettePushConstant pc{};
+    pc.entries             = reinterpret_cast<shaderio::JointPaletteEntry*>(m_paletteEntriesBuffer.address);
+    pc.inverseBindMatrices = reinterpret_cast<glm::mat4*>(m_paletteInverseBindBuffer.address);
+    pc.worldMatrices       = reinterpret_cast<glm::mat4*>(worldMatrices);
+    pc.jointMatrices       = reinterpret_cast<glm::mat4*>(m_jointMatricesBuffer.address);
+    pc.normalMatrices      = reinterpret_cast<glm::mat3*>(m_normalMatricesBuffer.address);
+    pc.entryCount          = static_cast<uint32_t>(m_batch.palette.size());
+
+    vkCmdPushConstants(cmd, m_palettePipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pc), &pc);
+    vkCmdDispatch(cmd, (pc.entryCount + ANIMATION_WORKGROUP_SIZE - 1) / ANIMATION_WORKGROUP_SIZE, 1, 1);
+  }
 
-    for(size_t mi = 0; mi < m_morphGpuData.size(); mi++)
-    {
-      const MorphGpuData& gpu = m_morphGpuData[mi];
-      const MorphResult&  mr  = scn.animation().getMorphResult(mi);
-      if(mr.renderPrimID < 0 || mr.basePositions.empty() || gpu.numTargets == 0)
-        continue;
+  // === Phase 3: One morph dispatch over all morphed primitives ===
+  if(morphRange.vertexCount > 0)
+  {
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_morphPipeline);
 
-      const auto& vb = vertexBufs[mr.renderPrimID];
-
-      shaderio::MorphPushConstant pc{};
-      pc.basePositions  = reinterpret_cast<glm::vec3*>(gpu.basePositions.address);
-      pc.baseNormals    = gpu.baseNormals.buffer ? reinterpret_cast<glm::vec3*>(gpu.baseNormals.address) : nullptr;
-      pc.baseTangents   = gpu.baseTangents.buffer ? reinterpret_cast<glm::vec4*>(gpu.baseTangents.address) : nullptr;
-      pc.positionDeltas = reinterpret_cast<glm::vec3*>(gpu.positionDeltas.address);
-      pc.normalDeltas   = gpu.normalDeltas.buffer ? reinterpret_cast<glm::vec3*>(gpu.normalDeltas.address) : nullptr;
-      pc.tangentDeltas  = gpu.tangentDeltas.buffer ? reinterpret_cast<glm::vec3*>(gpu.tangentDeltas.address) : nullptr;
-      pc.morphWeights   = reinterpret_cast<float*>(m_morphWeightsBuffer.address + gpu.weightsOffset);
-      pc.outPositions   = reinterpret_cast<glm::vec3*>(vb.position.address);
-      pc.outNormals = (vb.normal.buffer && gpu.baseNormals.buffer) ? reinterpret_cast<glm::vec3*>(vb.normal.address) : nullptr;
-      pc.outTangents = (vb.tangent.buffer && gpu.baseTangents.buffer) ? reinterpret_cast<glm::vec4*>(vb.tangent.address) : nullptr;
-      pc.vertexCount = static_cast<uint32_t>(mr.basePositions.size());
-      pc.numTargets  = gpu.numTargets;
+    shaderio::MorphBatchPushConstant pc{};
+    pc.tasks           = reinterpret_cast<shaderio::MorphBatchTask*>(morphRange.tasks);
+    pc.taskFirstVertex = reinterpret_cast<uint32_t*>(morphRange.firstVertex);
+    pc.morphWeights    = reinterpret_cast<float*>(m_morphWeightsBuffer.address);
+    pc.taskCount       = morphRange.taskCount;
+    pc.vertexCount     = morphRange.vertexCount;
 
+    for(pc.baseVertex = 0; pc.baseVertex < pc.vertexCount; pc.baseVertex += kMaxGroupsPerDispatch * ANIMATION_WORKGROUP_SIZE)
+    {
+      const uint32_t groups = std::min((pc.vertexCount - pc.baseVertex + ANIMATION_WORKGROUP_SIZE - 1) / ANIMATION_WORKGROUP_SIZE,
+                                       kMaxGroupsPerDispatch);
       vkCmdPushConstants(cmd, m_morphPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pc), &pc);
-      vkCmdDispatch(cmd, (pc.vertexCount + ANIMATION_WORKGROUP_SIZE - 1) / ANIMATION_WORKGROUP_SIZE, 1, 1);
+      vkCmdDispatch(cmd, groups, 1, 1);
     }
-
-    // Morph writes may feed the skin pass (for primitives that are both morphed and skinned),
-    // which reads the same vertex buffers. Ensure morph is complete before skinning reads them.
-    if(!m_skinGpuData.empty())
-      nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
-                             VK_ACCESS_2_SHADER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
   }
 
-  // === Phase 3: Dispatch all skinning compute shaders ===
-  if(!m_skinGpuData.empty())
+  // Morph writes may feed the skin pass (for primitives that are both morphed and skinned), which
+  // reads the same vertex buffers; the GPU palette feeds it too.
+  if(skinRange.vertexCount > 0 && (morphRange.vertexCount > 0 || (gpuPalette && skinning)))
+    nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                           VK_ACCESS_2_SHADER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+
+  // === Phase 4: One skin dispatch over all skinned primitives ===
+  if(skinRange.vertexCount > 0)
   {
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_skinPipeline);
 
-    for(size_t ti = 0; ti < skinTasks.size(); ti++)
-    {
-      const SkinTask&    task = skinTasks[ti];
-      const SkinGpuData& gpu  = m_skinGpuData[ti];
-
-      if(task.skinID < 0 || task.skinID >= static_cast<int>(model.skins.size()))
-        continue;
-      if(task.refNodeID < 0 || task.refNodeID >= static_cast<int>(nodeMatrices.size()))
-        continue;
-      if(!gpu.basePositions.buffer || !gpu.weights.buffer || !gpu.joints.buffer)
-        continue;
-
-      const tinygltf::Skin& skin = model.skins[task.skinID];
-      const auto&           vb   = vertexBufs[task.renderPrimID];
-
-      // If this primitive is also morphed, Phase 2 already wrote the morphed geometry into the
-      // vertex buffers; skin must transform that (morph -> skin composition) instead of the
-      // static base. Otherwise use the static per-primitive base buffers.
-      const bool isMorphed = morphPrimIDs.count(task.renderPrimID) != 0;
-
-      shaderio::SkinPushConstant pc{};
-      pc.basePositions  = isMorphed ? reinterpret_cast<glm::vec3*>(vb.position.address) :
-                                      reinterpret_cast<glm::vec3*>(gpu.basePositions.address);
-      pc.baseNormals    = (isMorphed && vb.normal.buffer) ? reinterpret_cast<glm::vec3*>(vb.normal.address) :
-                          gpu.baseNormals.buffer          ? reinterpret_cast<glm::vec3*>(gpu.baseNormals.address) :
-                                                            nullptr;
-      pc.baseTangents   = (isMorphed && vb.tangent.buffer) ? reinterpret_cast<glm::vec4*>(vb.tangent.address) :
-                          gpu.baseTangents.buffer          ? reinterpret_cast<glm::vec4*>(gpu.baseTangents.address) :
-                                                             nullptr;
-      pc.weights        = reinterpret_cast<glm::vec4*>(gpu.weights.address);
-      pc.joints         = reinterpret_cast<glm::ivec4*>(gpu.joints.address);
-      pc.jointMatrices  = reinterpret_cast<glm::mat4*>(m_jointMatricesBuffer.address + gpu.jointMatOffset);
-      pc.normalMatrices = reinterpret_cast<glm::mat3*>(m_normalMatricesBuffer.address + gpu.normalMatOffset);
-      pc.outPositions   = reinterpret_cast<glm::vec3*>(vb.position.address);
-      pc.outNormals     = vb.normal.buffer ? reinterpret_cast<glm::vec3*>(vb.normal.address) : nullptr;
-      pc.outTangents    = vb.tangent.buffer ? reinterpret_cast<glm::vec4*>(vb.tangent.address) : nullptr;
-      pc.vertexCount    = static_cast<uint32_t>(task.weights.size());
-      pc.numJoints      = static_cast<uint32_t>(skin.joints.size());
+    shaderio::SkinBatchPushConstant pc{};
+    pc.tasks           = reinterpret_cast<shaderio::SkinBatchTask*>(skinRange.tasks);
+    pc.taskFirstVertex = reinterpret_cast<uint32_t*>(skinRange.firstVertex);
+    pc.jointMatrices   = reinterpret_cast<glm::mat4*>(m_jointMatricesBuffer.address);
+    pc.normalMatrices  = reinterpret_cast<glm::mat3*>(m_normalMatricesBuffer.address);
+    pc.taskCount       = skinRange.taskCount;
+    pc.vertexCount     = skinRange.vertexCount;
 
+    for(pc.baseVertex = 0; pc.baseVertex < pc.vertexCount; pc.baseVertex += kMaxGroupsPerDispatch * ANIMATION_WORKGROUP_SIZE)
+    {
+      const uint32_t groups = std::min((pc.vertexCount - pc.baseVertex + ANIMATION_WORKGROUP_SIZE - 1) / ANIMATION_WORKGROUP_SIZE,
+                                       kMaxGroupsPerDispatch);
       vkCmdPushConstants(cmd, m_skinPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pc), &pc);
-      vkCmdDispatch(cmd, (pc.vertexCount + ANIMATION_WORKGROUP_SIZE - 1) / ANIMATION_WORKGROUP_SIZE, 1, 1);
+      vkCmdDispatch(cmd, groups, 1, 1);
     }
   }
 
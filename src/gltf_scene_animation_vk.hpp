@@ -23,6 +23,7 @@
 #include <nvvk/resource_allocator.hpp>
 #include <nvvk/staging.hpp>
 
+#include "gltf_deform_batch.hpp"
 #include "gltf_scene.hpp"
 #include "gltf_scene_vk.hpp"
 #include "gpu_memory_tracker.hpp"
@@ -33,12 +34,17 @@
 
 >  GPU-accelerated skeletal skinning and morph target blending via compute shaders.
 
-Manages two compute pipelines (skinning + morph) and the GPU SSBOs that feed them.
-Static data (base geometry, skin weights, joint indices, IBMs, morph deltas) is uploaded
-once at scene load via `createGpuBuffers()`. Each frame, `dispatchAnimation()` computes
-joint matrices on CPU, uploads the small per-frame data (joint matrices, morph weights),
-and dispatches compute shaders that write transformed vertices directly into SceneVk's
-existing vertex buffers via buffer device addresses (BDA push constants).
+Manages three compute pipelines (skinning, morph, joint palette) and the GPU SSBOs that feed
+them. Static data (base geometry, skin weights, joint indices, IBMs, morph deltas) is uploaded
+once at scene load via `createGpuBuffers()`, together with a DeformBatchTable: every morphed and
+every skinned primitive is a task of one global vertex range, so `dispatchAnimation()` records a
+single morph dispatch and a single skin dispatch whatever the primitive count. The shaders write
+the deformed vertices directly into SceneVk's existing vertex buffers via buffer device addresses.
+
+Joint palettes (one per skin and reference node) are computed on the GPU from the node world
+matrices of TransformComputeVk when its buffer is passed to `dispatchAnimation()` (the world
+matrices must be current on the device, see GltfRenderer::updateAnimation); otherwise they are
+evaluated on the CPU and uploaded. Per frame the CPU then only uploads the morph weights.
 
 The CPU fallback path in `SceneVk::uploadPrimitives()` is preserved and selectable via
 `SceneGpu::useComputeAnimation`.
@@ -61,7 +67,15 @@ public:
   void destroyGpuBuffers();                                                 // Release static + workspace SSBOs
 
   // --- Per-frame animation (call each frame when animation is active) ---
-  void dispatchAnimation(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk);
+  // worldMatrices: device address of the current node world matrices (TransformComputeVk), or 0 to
+  // evaluate the joint palettes on the CPU from Scene::getNodesWorldMatrices().
+  void dispatchAnimation(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk, VkDeviceAddress worldMatrices = 0);
+
+  const DeformBatchTable& getBatchTable() const { return m_batch; }
+
+  // SceneVk recreated vertex buffers (e.g. new tangent buffers): the next dispatch refills and
+  // re-uploads the task tables, which hold their device addresses.
+  void invalidateBatchTasks() { m_batchUploaded = false; }
 
   [[nodiscard]] bool isInitialized() const { return m_alloc != nullptr && m_skinPipeline != VK_NULL_HANDLE; }
 
@@ -73,8 +87,10 @@ private:
 
   VkPipeline       m_skinPipeline{};
   VkPipeline       m_morphPipeline{};
+  VkPipeline       m_palettePipeline{};
   VkPipelineLayout m_skinPipelineLayout{};
   VkPipelineLayout m_morphPipelineLayout{};
+  VkPipelineLayout m_palettePipelineLayout{};
 
   // Per-SkinTask GPU buffers (static, uploaded once)
   struct SkinGpuData
@@ -84,9 +100,7 @@ private:
     nvvk::Buffer baseTangents;
     nvvk::Buffer weights;
     nvvk::Buffer joints;
-    nvvk::Buffer inverseBindMatrices;
-    size_t       jointMatOffset  = 0;  // Byte offset into packed m_jointMatricesBuffer
-    size_t       normalMatOffset = 0;  // Byte offset into packed m_normalMatricesBuffer
+    int          batchTask = -1;  // Index in m_batch.skinTasks, -1 if the task is not deformed
   };
   std::vector<SkinGpuData> m_skinGpuData;
 
@@ -96,24 +110,72 @@ private:
     nvvk::Buffer basePositions;
     nvvk::Buffer baseNormals;
     nvvk::Buffer baseTangents;
-    nvvk::Buffer positionDeltas;  // all targets packed: [numTargets * vertexCount]
+    nvvk::Buffer deltaRowStart;   // Non-zero deltas per vertex (SparseMorphTargets::VertexMajor)
+    nvvk::Buffer deltaTargets;
+    nvvk::Buffer positionDeltas;
     nvvk::Buffer normalDeltas;
     nvvk::Buffer tangentDeltas;
-    uint32_t     numTargets    = 0;
-    size_t       weightsOffset = 0;  // Byte offset into packed m_morphWeightsBuffer
+    uint32_t     numTargets = 0;
+    int          batchTask  = -1;  // Index in m_batch.morphTasks, -1 if the primitive is not deformed
   };
   std::vector<MorphGpuData> m_morphGpuData;
 
-  // Packed per-frame buffers: all tasks' matrices/weights in one buffer, uploaded in a single transfer.
-  // Each task's data is at its stored byte offset. Allocated once at createGpuBuffers() to the total size.
+  // Batched dispatch tables. The tasks reference SceneVk's vertex buffers, so they are filled and
+  // uploaded on the first dispatch after createGpuBuffers().
+  DeformBatchTable m_batch;
+  bool             m_batchUploaded = false;
+  nvvk::Buffer     m_skinTasksBuffer;
+  nvvk::Buffer     m_skinFirstVertexBuffer;
+  nvvk::Buffer     m_morphTasksBuffer;
+  nvvk::Buffer     m_morphFirstVertexBuffer;
+  nvvk::Buffer     m_paletteEntriesBuffer;
+  nvvk::Buffer     m_paletteInverseBindBuffer;
+
+  // Per-frame task subsets when only some primitives changed (DeformChangeTracker): the changed tasks
+  // repacked back to back, so the dispatches cover those vertices only.
+  nvvk::Buffer                          m_skinSelectedTasksBuffer;
+  nvvk::Buffer                          m_skinSelectedFirstVertexBuffer;
+  nvvk::Buffer                          m_morphSelectedTasksBuffer;
+  nvvk::Buffer                          m_morphSelectedFirstVertexBuffer;
+  std::vector<shaderio::SkinBatchTask>  m_selectedSkinTasks;
+  std::vector<shaderio::MorphBatchTask> m_selectedMorphTasks;
+  std::vector<uint32_t>                 m_selectedFirstVertex;
+  std::vector<uint8_t>                  m_taskChanged;
+
+  // Per-frame buffers: joint/normal matrix palette (GPU or CPU written) and the packed morph weights.
   nvvk::Buffer m_jointMatricesBuffer;
   nvvk::Buffer m_normalMatricesBuffer;
   nvvk::Buffer m_morphWeightsBuffer;
 
+  // CPU palette scratch, reused across frames
+  std::vector<glm::mat4> m_cpuJointMatrices;
+  std::vector<glm::mat3> m_cpuNormalMatrices;
+
   GpuMemoryTracker m_memoryTracker;
 
   void createPipelines();
   void destroyPipelines();
+  void uploadBatchTasks(nvvk::StagingUploader& staging, const Scene& scn, const SceneVk& scnVk);
+
+  // Tasks and vertex range one pass dispatches this frame
+  struct PassRange
+  {
+    VkDeviceAddress tasks       = 0;
+    VkDeviceAddress firstVertex = 0;
+    uint32_t        taskCount   = 0;
+    uint32_t        vertexCount = 0;
+  };
+  // The whole table when every task in m_taskChanged is set, otherwise the changed tasks uploaded to
+  // the selection buffers.
+  template <typename Task>
+  PassRange selectPassTasks(nvvk::StagingUploader& staging,
+                            const std::vector<Task>& tasks,
+                            uint32_t                 totalVertexCount,
+                            const nvvk::Buffer&      tasksBuffer,
+                            const nvvk::Buffer&      firstVertexBuffer,
+                            const nvvk::Buffer&      selectedTasksBuffer,
+                            const nvvk::Buffer&      selectedFirstVertexBuffer,
+                            std::vector<Task>&       selected);
 
   template <typename T>
   nvvk::Buffer createBufferFromSpan(nvvk::StagingUploader& staging, std::span<const T> data, const char* debugName = nullptr);
@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Content hashes, diff and in-place update of a reloaded scene. See gltf_scene_diff.hpp.
+//
+
+#include "gltf_scene_diff.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <utility>
+
+#include <fmt/format.h>
+#include <nvutils/file_operations.hpp>
+#include <nvutils/logger.hpp>
+
+#include "gltf_image_export.hpp"
+#include "tinygltf_utils.hpp"
+
+namespace fs = std::filesystem;
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr const char* kLightsPunctual = "KHR_lights_punctual";
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime  = 1099511628211ull;
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t hash = kFnvOffset)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for(size_t i = 0; i < size; i++)
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  return hash;
+}
+
+template <typename T>
+uint64_t hashValue(const T& value, uint64_t hash)
+{
+  return hashBytes(&value, sizeof(T), hash);
+}
+
+uint64_t hashString(const std::string& text, uint64_t hash)
+{
+  return hashBytes(text.data(), text.size(), hashValue(text.size(), hash));
+}
+
+// `length` bytes at `offset` in a buffer view, nullptr when out of range
+const unsigned char* viewBytes(const tinygltf::Model& model, int viewIndex, size_t offset, size_t length)
+{
+  if(viewIndex < 0 || viewIndex >= int(model.bufferViews.size()))
+    return nullptr;
+  const tinygltf::BufferView& view = model.bufferViews[viewIndex];
+  if(view.buffer < 0 || view.buffer >= int(model.buffers.size()) || offset + length > view.byteLength)
+    return nullptr;
+  const std::vector<unsigned char>& data = model.buffers[view.buffer].data;
+  if(view.byteOffset + offset + length > data.size())
+    return nullptr;
+  return data.data() + view.byteOffset + offset;
+}
+
+// The layout and the elements of an accessor (stride-aware), and its sparse substitutions
+uint64_t hashAccessor(const tinygltf::Model& model, int index, uint64_t hash)
+{
+  if(index < 0 || index >= int(model.accessors.size()))
+    return hashValue(-1, hash);
+
+  const tinygltf::Accessor& accessor = model.accessors[index];
+  hash = hashValue(accessor.count, hash);
+  hash = hashValue(accessor.componentType, hash);
+  hash = hashValue(accessor.type, hash);
+  hash = hashValue(accessor.normalized, hash);
+
+  const size_t element = size_t(tinygltf::GetComponentSizeInBytes(accessor.componentType))
+                         * size_t(tinygltf::GetNumComponentsInType(accessor.type));
+  if(accessor.bufferView >= 0 && accessor.count > 0 && element > 0)
+  {
+    const tinygltf::BufferView& view   = model.bufferViews[accessor.bufferView];
+    const size_t                stride = view.byteStride ? view.byteStride : element;
+    const unsigned char* data = viewBytes(model, accessor.bufferView, accessor.byteOffset, (accessor.count - 1) * stride + element);
+    if(!data)
+      return hashValue(-2, hash);  // Invalid: never equal to valid content
+    for(size_t i = 0; i < accessor.count; i++)
+      hash = hashBytes(data + i * stride, element, hash);
+  }
+
+  if(accessor.sparse.isSparse)
+  {
+    const size_t count     = size_t(accessor.sparse.count);
+    const size_t indexSize = size_t(tinygltf::GetComponentSizeInBytes(accessor.sparse.indices.componentType));
+    const unsigned char* indices = viewBytes(model, accessor.sparse.indices.bufferView, accessor.sparse.indices.byteOffset, count * indexSize);
+    const unsigned char* values = viewBytes(model, accessor.sparse.values.bufferView, accessor.sparse.values.byteOffset, count * element);
+    if(!indices || !values)
+      return hashValue(-2, hash);
+    hash = hashBytes(indices, count * indexSize, hashValue(count, hash));
+    hash = hashBytes(values, count * element, hash);
+  }
+  return hash;
+}
+
+// Geometry and material of every primitive; the layout is compared separately (primitiveLayoutEqual)
+uint64_t hashMesh(const tinygltf::Model& model, const tinygltf::Mesh& mesh)
+{
+  uint64_t hash = kFnvOffset;
+  for(const tinygltf::Primitive& primitive : mesh.primitives)
+  {
+    hash = hashValue(primitive.material, hash);
+    hash = hashAccessor(model, primitive.indices, hash);
+    for(const auto& [name, index] : primitive.attributes)
+      hash = hashAccessor(model, index, hashString(name, hash));
+    for(const auto& target : primitive.targets)
+      for(const auto& [name, index] : target)
+        hash = hashAccessor(model, index, hashString(name, hash));
+  }
+  return hash;
+}
+
+// Where SceneVk looks for images: the scene's search paths, else the folder of the scene
+std::vector<fs::path> searchPaths(const Scene& scene)
+{
+  std::vector<fs::path> paths = scene.getImageSearchPaths();
+  if(paths.empty())
+  {
+    std::error_code ec;
+    fs::path        baseDir = fs::absolute(scene.getFilename().parent_path(), ec);
+    if(!ec)
+      paths.push_back(baseDir);
+  }
+  return paths;
+}
+
+bool isDataUri(const std::string& uri)
+{
+  return uri.size() >= 5 && uri.compare(0, 5, "data:") == 0;
+}
+
+// File of a relative or absolute URI, empty for data URIs and files that can't be found
+fs::path findUri(const std::string& uri, const std::vector<fs::path>& paths)
+{
+  if(uri.empty() || isDataUri(uri))
+    return {};
+  std::string uriDecoded;
+  tinygltf::URIDecode(uri, &uriDecoded, nullptr);
+  return nvutils::findFile(nvutils::pathFromUtf8(uriDecoded), paths, false);
+}
+
+// Same order of preference as SceneVk::loadImage: buffer view, decoded data URI, file
+uint64_t hashImage(const tinygltf::Model& model, const tinygltf::Image& image, const std::vector<fs::path>& paths)
+{
+  if(image.bufferView >= 0)
+  {
+    const size_t length = image.bufferView < int(model.bufferViews.size()) ? model.bufferViews[image.bufferView].byteLength : 0;
+    const unsigned char* data = viewBytes(model, image.bufferView, 0, length);
+    return data ? hashBytes(data, length) : 0;
+  }
+  if(!image.image.empty())
+    return hashBytes(image.image.data(), image.image.size());
+
+  uint64_t       fileHash = 0;
+  const fs::path file     = findUri(image.uri, paths);
+  if(file.empty() || !hashFileContent(file, fileHash))
+    return 0;  // Missing: differs from the file once it is there
+  return fileHash;
+}
+
+// Primitive state that the render primitives, BLAS and pipelines are built from
+bool primitiveLayoutEqual(const tinygltf::Primitive& a, const tinygltf::Primitive& b)
+{
+  const auto sameNames = [](const std::map<std::string, int>& x, const std::map<std::string, int>& y) {
+    return std::equal(x.begin(), x.end(), y.begin(), y.end(), [](const auto& l, const auto& r) { return l.first == r.first; });
+  };
+  if(a.mode != b.mode || (a.indices >= 0) != (b.indices >= 0) || !sameNames(a.attributes, b.attributes)
+     || a.targets.size() != b.targets.size() || !(a.extensions == b.extensions))
+    return false;
+  for(size_t t = 0; t < a.targets.size(); t++)
+    if(!sameNames(a.targets[t], b.targets[t]))
+      return false;
+  return true;
+}
+
+tinygltf::Node withoutTransform(tinygltf::Node node)
+{
+  node.translation.clear();
+  node.rotation.clear();
+  node.scale.clear();
+  node.matrix.clear();
+  return node;
+}
+
+bool sameTransform(const tinygltf::Node& a, const tinygltf::Node& b)
+{
+  return a.translation == b.translation && a.rotation == b.rotation && a.scale == b.scale && a.matrix == b.matrix;
+}
+
+// Content of the EXT_mesh_gpu_instancing attributes of a node (0 without instancing)
+uint64_t hashInstancing(const tinygltf::Model& model, const tinygltf::Node& node)
+{
+  auto it = node.extensions.find(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+  if(it == node.extensions.end() || !it->second.Has("attributes") || !it->second.Get("attributes").IsObject())
+    return 0;
+  uint64_t hash = kFnvOffset;
+  for(const auto& [name, value] : it->second.Get("attributes").Get<tinygltf::Value::Object>())
+    hash = hashAccessor(model, value.IsInt() || value.IsNumber() ? value.GetNumberAsInt() : -1, hashString(name, hash));
+  return hash;
+}
+
+// Render primitive -> (mesh, primitive in the mesh)
+std::vector<std::pair<int, int>> primitiveSlots(const Scene& scene)
+{
+  std::vector<std::pair<int, int>> slots;
+  slots.reserve(scene.getNumRenderPrimitives());
+  for(const RenderPrimitive& renderPrim : scene.getRenderPrimitives())
+  {
+    const tinygltf::Mesh& mesh = scene.getModel().meshes[renderPrim.meshID];
+    slots.emplace_back(renderPrim.meshID, int(renderPrim.pPrimitive - mesh.primitives.data()));
+  }
+  return slots;
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+SceneContentHashes hashSceneContent(const Scene& scene)
+{
+  const tinygltf::Model&      model = scene.getModel();
+  const std::vector<fs::path> paths = searchPaths(scene);
+
+  SceneContentHashes hashes;
+  hashes.meshes.resize(model.meshes.size());
+  hashes.images.resize(model.images.size());
+  parallelFor(model.meshes.size(), [&](uint64_t i) { hashes.meshes[i] = hashMesh(model, model.meshes[i]); });
+  parallelFor<1>(model.images.size(), [&](uint64_t i) { hashes.images[i] = hashImage(model, model.images[i], paths); });
+  return hashes;
+}
+
+std::vector<fs::path> sceneSourceFiles(const Scene& scene)
+{
+  std::vector<fs::path> files;
+  const auto            add = [&](const fs::path& file) {
+    std::error_code ec;
+    const fs::path  absolute = fs::absolute(file, ec).lexically_normal();
+    if(!file.empty() && !ec && std::find(files.begin(), files.end(), absolute) == files.end())
+      files.push_back(absolute);
+  };
+
+  const tinygltf::Model&      model = scene.getModel();
+  const std::vector<fs::path> paths = searchPaths(scene);
+  add(scene.getFilename());
+  for(const tinygltf::Buffer& buffer : model.buffers)
+    add(findUri(buffer.uri, paths));
+  for(const tinygltf::Image& image : model.images)
+    if(image.bufferView < 0)
+      add(findUri(image.uri, paths));
+  for(const ReferencedAsset& asset : scene.getReferencedAssets())
+  {
+    const fs::path source = nvutils::pathFromUtf8(asset.sourceUri);
+    std::error_code ec;
+    if(fs::is_regular_file(source, ec))
+      add(source);
+  }
+  return files;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Structural checks first: the first one that fails is reported and nothing else is compared.
+SceneDiff diffScenes(const Scene& current, const SceneContentHashes& currentHashes, const Scene& incoming, const SceneContentHashes& incomingHashes)
+{
+  const tinygltf::Model& a = current.getModel();
+  const tinygltf::Model& b = incoming.getModel();
+
+  SceneDiff  diff;
+  const auto structural = [&diff](std::string reason) {
+    diff = SceneDiff{.structuralChange = std::move(reason)};
+    return diff;
+  };
+
+  struct Count
+  {
+    const char* name;
+    size_t      a;
+    size_t      b;
+  };
+  const Count counts[] = {
+      {"scenes", a.scenes.size(), b.scenes.size()},       {"nodes", a.nodes.size(), b.nodes.size()},
+      {"meshes", a.meshes.size(), b.meshes.size()},       {"materials", a.materials.size(), b.materials.size()},
+      {"textures", a.textures.size(), b.textures.size()}, {"images", a.images.size(), b.images.size()},
+      {"samplers", a.samplers.size(), b.samplers.size()}, {"skins", a.skins.size(), b.skins.size()},
+      {"animations", a.animations.size(), b.animations.size()}, {"cameras", a.cameras.size(), b.cameras.size()},
+      {"lights", a.lights.size(), b.lights.size()},
+  };
+  for(const Count& count : counts)
+    if(count.a != count.b)
+      return structural(fmt::format("{} count {} -> {}", count.name, count.a, count.b));
+  if(currentHashes.meshes.size() != a.meshes.size() || incomingHashes.meshes.size() != b.meshes.size()
+     || currentHashes.images.size() != a.images.size() || incomingHashes.images.size() != b.images.size())
+    return structural("content hashes out of date");
+
+  if(a.defaultScene != b.defaultScene || a.scenes != b.scenes)
+    return structural("scene roots");
+
+  tinygltf::ExtensionMap extensionsA = a.extensions, extensionsB = b.extensions;
+  extensionsA.erase(kLightsPunctual);  // Compared per light
+  extensionsB.erase(kLightsPunctual);
+  if(!(extensionsA == extensionsB))
+    return structural("model extensions");
+
+  for(size_t i = 0; i < a.nodes.size(); i++)
+  {
+    if(!(withoutTransform(a.nodes[i]) == withoutTransform(b.nodes[i])))
+      return structural(fmt::format("node {}", i));
+    if(hashInstancing(a, a.nodes[i]) != hashInstancing(b, b.nodes[i]))
+      return structural(fmt::format("instancing of node {}", i));
+    if(!sameTransform(a.nodes[i], b.nodes[i]))
+      diff.nodes.push_back(int(i));
+  }
+
+  for(size_t i = 0; i < a.meshes.size(); i++)
+  {
+    const tinygltf::Mesh& meshA = a.meshes[i];
+    const tinygltf::Mesh& meshB = b.meshes[i];
+    if(meshA.primitives.size() != meshB.primitives.size() || meshA.weights != meshB.weights)
+      return structural(fmt::format("primitives of mesh {}", i));
+    for(size_t p = 0; p < meshA.primitives.size(); p++)
+      if(!primitiveLayoutEqual(meshA.primitives[p], meshB.primitives[p]))
+        return structural(fmt::format("layout of mesh {} primitive {}", i, p));
+    if(currentHashes.meshes[i] != incomingHashes.meshes[i])
+      diff.meshes.push_back(int(i));
+  }
+
+  if(a.textures != b.textures)
+    return structural("textures");
+  if(a.samplers != b.samplers)
+    return structural("samplers");
+  if(a.cameras != b.cameras)
+    return structural("cameras");
+
+  for(size_t i = 0; i < a.skins.size(); i++)
+  {
+    const tinygltf::Skin& skinA = a.skins[i];
+    const tinygltf::Skin& skinB = b.skins[i];
+    if(skinA.joints != skinB.joints || skinA.skeleton != skinB.skeleton
+       || hashAccessor(a, skinA.inverseBindMatrices, kFnvOffset) != hashAccessor(b, skinB.inverseBindMatrices, kFnvOffset))
+      return structural(fmt::format("skin {}", i));
+  }
+
+  for(size_t i = 0; i < a.animations.size(); i++)
+  {
+    const tinygltf::Animation& animA = a.animations[i];
+    const tinygltf::Animation& animB = b.animations[i];
+    if(animA.channels != animB.channels || animA.samplers.size() != animB.samplers.size())
+      return structural(fmt::format("animation {}", i));
+    for(size_t s = 0; s < animA.samplers.size(); s++)
+    {
+      const tinygltf::AnimationSampler& samplerA = animA.samplers[s];
+      const tinygltf::AnimationSampler& samplerB = animB.samplers[s];
+      if(samplerA.interpolation != samplerB.interpolation
+         || hashAccessor(a, samplerA.input, kFnvOffset) != hashAccessor(b, samplerB.input, kFnvOffset)
+         || hashAccessor(a, samplerA.output, kFnvOffset) != hashAccessor(b, samplerB.output, kFnvOffset))
+        return structural(fmt::format("animation {}", i));
+    }
+  }
+
+  for(size_t i = 0; i < a.materials.size(); i++)
+    if(!(a.materials[i] == b.materials[i]))
+      diff.materials.push_back(int(i));
+  for(size_t i = 0; i < a.lights.size(); i++)
+    if(!(a.lights[i] == b.lights[i]))
+      diff.lights.push_back(int(i));
+  for(size_t i = 0; i < a.images.size(); i++)
+  {
+    const tinygltf::Image& imageA = a.images[i];
+    const tinygltf::Image& imageB = b.images[i];
+    if(imageA.uri != imageB.uri || imageA.mimeType != imageB.mimeType || currentHashes.images[i] != incomingHashes.images[i])
+      diff.images.push_back(int(i));
+  }
+  return diff;
+}
+
+std::string formatSceneDiff(const SceneDiff& diff)
+{
+  if(diff.isStructural())
+    return "structural change (" + diff.structuralChange + ")";
+  if(diff.empty())
+    return "no change";
+
+  std::string text;
+  const auto  add = [&text](size_t count, const char* name) {
+    if(count == 0)
+      return;
+    text += fmt::format("{}{} {}", text.empty() ? "" : ", ", count, name);
+  };
+  add(diff.meshes.size(), "mesh(es)");
+  add(diff.materials.size(), "material(s)");
+  add(diff.images.size(), "image(s)");
+  add(diff.nodes.size(), "node transform(s)");
+  add(diff.lights.size(), "light(s)");
+  return text;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Buffers, views and accessors are taken over as a whole: the changed meshes may have been written
+// anywhere in them. Skins, animations and embedded images read the same arrays, so they follow.
+SceneDiffUpdate applySceneDiff(Scene& scene, tinygltf::Model&& incoming, const SceneDiff& diff)
+{
+  assert(!diff.isStructural());
+  SceneDiffUpdate  update;
+  tinygltf::Model& model = scene.getModel();
+
+  const bool embeddedImageChanged =
+      std::any_of(diff.images.begin(), diff.images.end(), [&](int i) { return incoming.images[i].bufferView >= 0; });
+  const bool takeGeometry = !diff.meshes.empty() || embeddedImageChanged;
+
+  const std::vector<std::pair<int, int>> slotsBefore = primitiveSlots(scene);
+  if(takeGeometry)
+  {
+    scene.waitForSaves();
+    model.buffers     = std::move(incoming.buffers);
+    model.bufferViews = std::move(incoming.bufferViews);
+    model.accessors   = std::move(incoming.accessors);
+    model.meshes      = std::move(incoming.meshes);
+    model.skins       = std::move(incoming.skins);
+    model.animations  = std::move(incoming.animations);
+    for(size_t i = 0; i < model.images.size(); i++)
+      model.images[i].bufferView = incoming.images[i].bufferView;
+  }
+
+  for(int i : diff.images)
+    model.images[i] = std::move(incoming.images[i]);
+  for(int i : diff.materials)
+    model.materials[i] = std::move(incoming.materials[i]);
+  for(int i : diff.lights)
+    model.lights[i] = std::move(incoming.lights[i]);
+  for(int i : diff.nodes)
+  {
+    tinygltf::Node&       node   = model.nodes[i];
+    const tinygltf::Node& source = incoming.nodes[i];
+    node.translation             = source.translation;
+    node.rotation                = source.rotation;
+    node.scale                   = source.scale;
+    node.matrix                  = source.matrix;
+  }
+
+  if(takeGeometry)
+  {
+    scene.setCurrentScene(scene.getCurrentScene());  // Primitive pointers, render nodes, animation
+    update.reparsed = true;
+
+    if(primitiveSlots(scene) != slotsBefore)
+    {
+      update.primitivesChanged                 = true;
+      scene.getDirtyFlags().primitivesChanged = true;
+    }
+    else
+    {
+      for(size_t primID = 0; primID < scene.getNumRenderPrimitives(); primID++)
+        if(std::binary_search(diff.meshes.begin(), diff.meshes.end(), scene.getRenderPrimitive(primID).meshID))
+          update.renderPrimitives.push_back(int(primID));
+    }
+  }
+
+  // After the parse, which resets the dirty flags
+  for(int i : diff.materials)
+    scene.markMaterialDirty(i);
+  if(!diff.materials.empty())
+    scene.markRenderNodeRtxDirtyForMaterials(std::unordered_set<int>(diff.materials.begin(), diff.materials.end()));
+  for(int i : diff.lights)
+    scene.markLightDirty(i);
+  for(int i : diff.nodes)
+    scene.markNodeDirty(i);
+
+  return update;
+}
+
+//--------------------------------------------------------------------------------------------------
+AsyncSceneReload::~AsyncSceneReload()
+{
+  wait();
+}
+
+bool AsyncSceneReload::start(const fs::path& filename, const std::unordered_set<std::string>& supportedExtensions)
+{
+  if(m_running.load())
+    return false;
+  wait();  // The previous, finished task
+
+  {
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    m_result.reset();
+  }
+  m_running = true;
+
+  m_task = TaskScheduler::shared().submit(
+      [this, filename, supportedExtensions]() {
+        Result result;
+        result.filename = filename;
+        auto scene      = std::make_unique<Scene>();
+        scene->supportedExtensions().insert(supportedExtensions.begin(), supportedExtensions.end());
+        bool loaded = false;
+        try
+        {
+          loaded = scene->load(filename);
+        }
+        catch(const std::exception& e)
+        {
+          LOGW("Reloading %s failed: %s\n", nvutils::utf8FromPath(filename).c_str(), e.what());
+        }
+        if(loaded)
+        {
+          result.hashes = hashSceneContent(*scene);
+          result.scene  = std::move(scene);
+        }
+        {
+          std::lock_guard<std::mutex> lock(m_resultMutex);
+          m_result = std::move(result);
+        }
+        m_running = false;
+      },
+      {.name = "Reload scene", .priority = TaskPriority::eBackground});
+  return true;
+}
+
+void AsyncSceneReload::wait()
+{
+  TaskScheduler::shared().wait(m_task);
+}
+
+std::optional<AsyncSceneReload::Result> AsyncSceneReload::takeResult()
+{
+  std::lock_guard<std::mutex> lock(m_resultMutex);
+  std::optional<Result>       result = std::move(m_result);
+  m_result.reset();
+  return result;
+}
+
+}  // namespace nvvkgltf
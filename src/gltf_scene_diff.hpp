@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "gltf_scene.hpp"
+#include "task_scheduler.hpp"
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# Scene diff (hot reload)
+
+>  Compares the scene being rendered with a new load of its files and patches what changed.
+
+The content that is expensive to upload is compared by hash: the geometry of each mesh (the
+accessors of its primitives, whatever buffer they live in) and the encoded bytes of each image
+(embedded, data URI or file). The rest of the model is compared by value.
+
+What can change in place:
+- materials, lights:          copied, their GPU records re-uploaded
+- images:                     decoded and uploaded again (SceneVk::reloadImages)
+- node TRS / matrix:          copied, the transforms updated like an edit
+- mesh content:               vertex and index buffers of its primitives recreated, BLAS rebuilt
+
+Anything else (node hierarchy, counts, textures, samplers, skins, animations, primitive layout,
+...) is a structural change: `SceneDiff::structuralChange` says what, and the scene is reloaded.
+ -------------------------------------------------------------------------------------------------*/
+
+// Content hashes of a loaded scene, one per mesh and per image
+struct SceneContentHashes
+{
+  std::vector<uint64_t> meshes;
+  std::vector<uint64_t> images;
+};
+
+// Hashes the meshes and images of `scene`; image files are found like SceneVk finds them
+SceneContentHashes hashSceneContent(const Scene& scene);
+
+// Files the scene was read from: the glTF, its external buffers and images, referenced assets.
+// Absolute, without duplicates; files that can't be found are left out.
+std::vector<std::filesystem::path> sceneSourceFiles(const Scene& scene);
+
+struct SceneDiff
+{
+  std::string      structuralChange;  // Why the scene must be reloaded; empty when it can be patched
+  std::vector<int> meshes;            // Indices of the changed elements, ascending
+  std::vector<int> materials;
+  std::vector<int> images;
+  std::vector<int> nodes;  // Transform only
+  std::vector<int> lights;
+
+  [[nodiscard]] bool isStructural() const { return !structuralChange.empty(); }
+  [[nodiscard]] bool empty() const
+  {
+    return !isStructural() && meshes.empty() && materials.empty() && images.empty() && nodes.empty() && lights.empty();
+  }
+};
+
+// `current` is the scene being rendered, `incoming` a new load of the same file
+SceneDiff diffScenes(const Scene& current, const SceneContentHashes& currentHashes, const Scene& incoming, const SceneContentHashes& incomingHashes);
+
+// One line, for the log
+std::string formatSceneDiff(const SceneDiff& diff);
+
+// What applySceneDiff() changed that the GPU side must follow
+struct SceneDiffUpdate
+{
+  std::vector<int> renderPrimitives;           // Render primitives whose geometry was replaced
+  bool             primitivesChanged = false;  // The render primitives no longer match: rebuild all geometry
+  bool             reparsed          = false;  // Scene::setCurrentScene ran (render nodes, animation)
+};
+
+// Applies a non-structural `diff` to `scene`, taking the changed parts from `incoming` (the model
+// of the scene the diff was made with). Marks the materials, lights and nodes dirty; when meshes or
+// embedded images changed, the geometry data is taken over and the scene parsed again.
+SceneDiffUpdate applySceneDiff(Scene& scene, tinygltf::Model&& incoming, const SceneDiff& diff);
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::AsyncSceneReload
+
+>  Loads a scene file and hashes it as an eBackground task of the shared scheduler.
+
+The owner polls takeResult() once per frame, then diffs the result against the scene it renders.
+The destructor waits for a running load.
+ -------------------------------------------------------------------------------------------------*/
+class AsyncSceneReload
+{
+public:
+  struct Result
+  {
+    std::filesystem::path  filename;
+    std::unique_ptr<Scene> scene;  // nullptr if loading failed
+    SceneContentHashes     hashes;
+  };
+
+  AsyncSceneReload() = default;
+  ~AsyncSceneReload();
+  AsyncSceneReload(const AsyncSceneReload&)            = delete;
+  AsyncSceneReload& operator=(const AsyncSceneReload&) = delete;
+
+  // Start loading `filename`; false if a load is still running
+  bool start(const std::filesystem::path& filename, const std::unordered_set<std::string>& supportedExtensions);
+
+  [[nodiscard]] bool isRunning() const { return m_running.load(); }
+  void               wait();
+
+  // The result of the finished load, once
+  [[nodiscard]] std::optional<Result> takeResult();
+
+private:
+  TaskHandle            m_task;  // eBackground on the shared scheduler
+  std::atomic<bool>     m_running{false};
+  std::mutex            m_resultMutex;
+  std::optional<Result> m_result;
+};
+
+}  // namespace nvvkgltf
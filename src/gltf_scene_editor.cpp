@@ -580,6 +580,7 @@ int SceneEditor::addPrimitiveMesh(PrimitiveKind kind, const PrimitiveParams& par
   }
 
   // 3. Dedicated buffer so an undo can pop the whole append cleanly (see truncateGeometryTail).
+  m_scene.waitForSaves();
   const int bufferIndex = static_cast<int>(model.buffers.size());
   model.buffers.emplace_back();
   model.buffers[bufferIndex].name = baseName + " Buffer";
@@ -642,6 +643,7 @@ void SceneEditor::truncateGeometryTail(const ModelTailSizes& sizes)
 {
   // Geometry-only resize: does not call parseScene(). Undo truncates first, then
   // restoreFromSnapshot() reparses once against the final model (see AddPrimitiveCommand::undo).
+  m_scene.waitForSaves();
   auto& model = m_scene.m_model;
   if(sizes.meshes <= model.meshes.size())
     model.meshes.resize(sizes.meshes);
@@ -1198,21 +1200,22 @@ void SceneEditor::setPrimitiveMaterial(int meshIndex, int primIndex, int newMate
   const int            prevMat   = primitive.material;
   primitive.material             = newMaterialID;
 
-  std::vector<nvvkgltf::RenderNode>& rnodes = m_scene.m_renderNodeRegistry.getRenderNodes();
+  RenderNodeArrays&    rnodes     = m_scene.m_renderNodeRegistry.getRenderNodes();
+  std::span<const int> refNodeIDs = rnodes.refNodeIDs();
   for(size_t renderNodeIdx = 0; renderNodeIdx < rnodes.size(); ++renderNodeIdx)
   {
-    const RenderNode& rn = rnodes[renderNodeIdx];
+    const int refNodeID = refNodeIDs[renderNodeIdx];
 
-    if(rn.refNodeID >= 0 && rn.refNodeID < static_cast<int>(m_scene.m_model.nodes.size()))
+    if(refNodeID >= 0 && refNodeID < static_cast<int>(m_scene.m_model.nodes.size()))
     {
-      const tinygltf::Node& node = m_scene.m_model.nodes[rn.refNodeID];
+      const tinygltf::Node& node = m_scene.m_model.nodes[refNodeID];
       if(node.mesh == meshIndex)
       {
         auto np = m_scene.m_renderNodeRegistry.getNodeAndPrim(static_cast<int>(renderNodeIdx));
         if(np && np->second == primIndex)
         {
           m_scene.m_dirtyFlags.renderNodesVk.insert(static_cast<int>(renderNodeIdx));
-          rnodes[renderNodeIdx].materialID = newMaterialID;
+          rnodes.materialIDs()[renderNodeIdx] = newMaterialID;
         }
       }
     }
@@ -0,0 +1,694 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Pre-load estimate of a glTF scene. See gltf_scene_estimate.hpp.
+//
+// The sizes mirror what the loaders allocate:
+// - SceneVk::createVertexBuffers: POSITION/NORMAL vec3, TEXCOORD_0/1 vec2, TANGENT vec4 (also created
+//   by Scene::createMissingTangentsForModel when the material has a normal texture), COLOR_0 packed
+//   to 4 bytes, 32-bit indices; one set per unique primitive.
+// - SceneVk::createImage: decoded images are RGBA8 (R8 for one channel, 16-bit when the PNG is),
+//   with a generated mip chain; DDS/KTX keep their format and levels.
+// - SceneTransformVk / SceneVk: per render node GltfRenderNode, RenderNodeGpuMapping, instance-local
+//   and previous object-to-world matrices; per node local and world matrices, parent and order.
+//
+
+#include "gltf_scene_estimate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+#include <stb/stb_image.h>
+#include <tinygltf/json.hpp>
+#include <tinygltf/tiny_gltf.h>
+
+#include <nvutils/file_operations.hpp>
+
+#include "tinygltf_utils.hpp"
+
+namespace fs = std::filesystem;
+using json   = nlohmann::json;
+
+namespace {
+
+constexpr size_t   kImageHeaderBytes     = 256 * 1024;         // JPEG frame headers can follow large EXIF/XMP segments
+constexpr uint64_t kRenderNodeGpuBytes   = 136 + 16 + 64 + 64;  // GltfRenderNode, mapping, instance local, previous O2W
+constexpr uint64_t kNodeGpuBytes         = 64 + 64 + 4 + 4;     // Local + world matrices, parent, topological order
+constexpr uint64_t kTlasBytesPerInstance = 64 + 128;           // VkAccelerationStructureInstanceKHR + TLAS share
+constexpr uint64_t kBlasHeaderBytes      = 256;
+constexpr uint64_t kBlasAlignment        = 256;
+
+struct GltfSource
+{
+  json     doc;
+  fs::path file;
+  fs::path baseDir;
+  bool     glb       = false;
+  uint64_t binOffset = 0;  // GLB BIN chunk: file offset and length
+  uint64_t binLength = 0;
+};
+
+uint32_t readU32(const uint8_t* p)
+{
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint64_t readU64(const uint8_t* p)
+{
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint64_t alignUp(uint64_t v, uint64_t alignment)
+{
+  return (v + alignment - 1) / alignment * alignment;
+}
+
+uint64_t fileSize(const fs::path& path)
+{
+  std::error_code ec;
+  const uint64_t  size = fs::file_size(path, ec);
+  return ec ? 0 : size;
+}
+
+std::vector<uint8_t> readFileRange(const fs::path& path, uint64_t offset, size_t maxBytes)
+{
+  std::vector<uint8_t> bytes;
+  std::ifstream        in(path, std::ios::binary);
+  if(!in)
+    return bytes;
+  in.seekg(std::streamoff(offset));
+  bytes.resize(maxBytes);
+  in.read(reinterpret_cast<char*>(bytes.data()), std::streamsize(maxBytes));
+  bytes.resize(size_t(std::max<std::streamsize>(in.gcount(), 0)));
+  return bytes;
+}
+
+// Decodes the first `maxBytes` of a base64 payload
+std::vector<uint8_t> decodeBase64Prefix(std::string_view text, size_t maxBytes)
+{
+  static constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::vector<uint8_t>              out;
+  uint32_t                          bits  = 0;
+  int                               nbits = 0;
+  for(char c : text)
+  {
+    const size_t v = alphabet.find(c);
+    if(v == std::string_view::npos)
+      break;  // '=' padding or end
+    bits = (bits << 6) | uint32_t(v);
+    nbits += 6;
+    if(nbits >= 8)
+    {
+      nbits -= 8;
+      out.push_back(uint8_t(bits >> nbits));
+      if(out.size() >= maxBytes)
+        break;
+    }
+  }
+  return out;
+}
+
+bool readGltfSource(const fs::path& filename, GltfSource& src, uint64_t& bytesRead, std::string& error)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if(!in)
+  {
+    error = "cannot open " + nvutils::utf8FromPath(filename);
+    return false;
+  }
+  src.file    = filename;
+  src.baseDir = filename.parent_path();
+
+  std::array<uint8_t, 20> header{};
+  in.read(reinterpret_cast<char*>(header.data()), header.size());
+  const size_t headerRead = size_t(in.gcount());
+  std::string  text;
+  if(headerRead >= 20 && std::memcmp(header.data(), "glTF", 4) == 0)
+  {
+    // GLB: 12-byte header, JSON chunk, then the BIN chunk whose payload is only located
+    const uint32_t jsonLength = readU32(&header[12]);
+    if(readU32(&header[16]) != 0x4E4F534A)  // "JSON"
+    {
+      error = "GLB does not start with a JSON chunk";
+      return false;
+    }
+    text.resize(jsonLength);
+    in.read(text.data(), jsonLength);
+    if(size_t(in.gcount()) != jsonLength)
+    {
+      error = "truncated GLB JSON chunk";
+      return false;
+    }
+    std::array<uint8_t, 8> binHeader{};
+    in.seekg(std::streamoff(20 + alignUp(jsonLength, 4)));
+    in.read(reinterpret_cast<char*>(binHeader.data()), binHeader.size());
+    if(size_t(in.gcount()) == binHeader.size() && readU32(&binHeader[4]) == 0x004E4942)  // "BIN\0"
+    {
+      src.binOffset = 28 + alignUp(jsonLength, 4);
+      src.binLength = readU32(&binHeader[0]);
+    }
+    src.glb = true;
+    bytesRead += fileSize(filename);
+  }
+  else
+  {
+    text.assign(reinterpret_cast<const char*>(header.data()), headerRead);
+    text.append(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    bytesRead += text.size();
+  }
+
+  src.doc = json::parse(text, nullptr, false);
+  if(src.doc.is_discarded() || !src.doc.is_object())
+  {
+    error = "invalid glTF JSON";
+    return false;
+  }
+  return true;
+}
+
+const json& arrayOf(const json& doc, const char* name)
+{
+  static const json empty = json::array();
+  const auto        it    = doc.find(name);
+  return (it != doc.end() && it->is_array()) ? *it : empty;
+}
+
+const json* element(const json& array, int index)
+{
+  return (index >= 0 && size_t(index) < array.size() && array[index].is_object()) ? &array[index] : nullptr;
+}
+
+uint64_t accessorCount(const json& accessors, int index)
+{
+  const json* accessor = element(accessors, index);
+  return accessor ? accessor->value("count", uint64_t(0)) : 0;
+}
+
+fs::path uriPath(const fs::path& baseDir, const std::string& uri)
+{
+  std::string decoded;
+  tinygltf::URIDecode(uri, &decoded, nullptr);
+  return baseDir / nvutils::pathFromUtf8(decoded);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Images
+//--------------------------------------------------------------------------------------------------
+
+struct ImageFootprint
+{
+  bool     known         = false;
+  uint64_t gpuBytes      = 0;  // All levels
+  uint64_t cpuBytes      = 0;  // Pixel data held for the upload
+  uint64_t decodedPixels = 0;  // Pixels decoded on the CPU (0 for GPU formats)
+};
+
+uint32_t mipLevelCount(uint32_t width, uint32_t height)
+{
+  uint32_t levels = 1;
+  for(uint32_t size = std::max(width, height); size > 1; size >>= 1)
+    levels++;
+  return levels;
+}
+
+// Uncompressed levels, bytesPerPixel per texel
+uint64_t pixelChainBytes(uint32_t width, uint32_t height, uint32_t levels, double bytesPerPixel)
+{
+  double bytes = 0.0;
+  for(uint32_t l = 0; l < levels; l++)
+    bytes += double(std::max(1u, width >> l)) * double(std::max(1u, height >> l)) * bytesPerPixel;
+  return uint64_t(bytes);
+}
+
+// 4x4 block-compressed levels
+uint64_t blockChainBytes(uint32_t width, uint32_t height, uint32_t levels, uint32_t blockBytes)
+{
+  uint64_t bytes = 0;
+  for(uint32_t l = 0; l < levels; l++)
+    bytes += uint64_t((std::max(1u, width >> l) + 3) / 4) * ((std::max(1u, height >> l) + 3) / 4) * blockBytes;
+  return bytes;
+}
+
+// Decoded to RGBA8 (or R8 / 16-bit): level 0 on the CPU, generated chain on the GPU
+ImageFootprint decodedFootprint(uint32_t width, uint32_t height, uint32_t bytesPerPixel, const nvvkgltf::SceneEstimateOptions& options)
+{
+  ImageFootprint fp;
+  fp.known         = width > 0 && height > 0;
+  fp.cpuBytes      = uint64_t(width) * height * bytesPerPixel;
+  fp.gpuBytes      = pixelChainBytes(width, height, options.generateMipmaps ? mipLevelCount(width, height) : 1, bytesPerPixel);
+  fp.decodedPixels = uint64_t(width) * height;
+  return fp;
+}
+
+// DDS: legacy header, DX10 extension for BC6H/BC7 and DXGI formats
+ImageFootprint ddsFootprint(const std::vector<uint8_t>& b, const nvvkgltf::SceneEstimateOptions& options)
+{
+  ImageFootprint fp;
+  if(b.size() < 128)
+    return fp;
+  const uint32_t height      = readU32(&b[12]);
+  const uint32_t width       = readU32(&b[16]);
+  const uint32_t levels      = (readU32(&b[8]) & 0x20000) ? std::max(1u, readU32(&b[28])) : 1;  // DDSD_MIPMAPCOUNT
+  const uint32_t pfFlags     = readU32(&b[80]);
+  const uint32_t fourCC      = readU32(&b[84]);
+  const uint32_t rgbBitCount = readU32(&b[88]);
+  const auto     cc          = [](const char* s) { return readU32(reinterpret_cast<const uint8_t*>(s)); };
+
+  uint32_t blockBytes    = 0;  // 4x4 block formats
+  uint32_t bytesPerPixel = 0;
+  if(pfFlags & 0x4)  // DDPF_FOURCC
+  {
+    if(fourCC == cc("DXT1") || fourCC == cc("ATI1") || fourCC == cc("BC4U") || fourCC == cc("BC4S"))
+      blockBytes = 8;
+    else if(fourCC == cc("DX10"))
+    {
+      if(b.size() < 148)
+        return fp;
+      const uint32_t dxgi = readU32(&b[128]);
+      if((dxgi >= 70 && dxgi <= 72) || (dxgi >= 79 && dxgi <= 81))  // BC1, BC4
+        blockBytes = 8;
+      else if((dxgi >= 73 && dxgi <= 78) || (dxgi >= 82 && dxgi <= 84) || (dxgi >= 94 && dxgi <= 99))  // BC2/3/5/6H/7
+        blockBytes = 16;
+      else if(dxgi >= 1 && dxgi <= 4)  // R32G32B32A32
+        bytesPerPixel = 16;
+      else if(dxgi >= 9 && dxgi <= 14)  // R16G16B16A16
+        bytesPerPixel = 8;
+      else if(dxgi >= 49 && dxgi <= 59)  // R8G8, R16
+        bytesPerPixel = 2;
+      else if(dxgi >= 60 && dxgi <= 65)  // R8, A8
+        bytesPerPixel = 1;
+      else
+        bytesPerPixel = 4;
+    }
+    else
+      blockBytes = 16;  // DXT2-5, ATI2, BC5U/S
+  }
+  else
+  {
+    bytesPerPixel = std::max(1u, rgbBitCount / 8);
+  }
+
+  fp.known = width > 0 && height > 0;
+  if(blockBytes != 0)
+    fp.gpuBytes = blockChainBytes(width, height, levels, blockBytes);
+  else
+  {
+    // Single-level uncompressed images get a generated chain, like decoded ones
+    const uint32_t gpuLevels = (levels == 1 && options.generateMipmaps) ? mipLevelCount(width, height) : levels;
+    fp.gpuBytes              = pixelChainBytes(width, height, gpuLevels, bytesPerPixel);
+  }
+  fp.cpuBytes = blockBytes != 0 ? fp.gpuBytes : pixelChainBytes(width, height, levels, bytesPerPixel);
+  return fp;
+}
+
+bool isCompressedVkFormat(uint32_t vkFormat)
+{
+  return (vkFormat >= 131 && vkFormat <= 184)                     // BC, ETC2, EAC, ASTC LDR
+         || (vkFormat >= 1000054000 && vkFormat <= 1000054007)    // PVRTC
+         || (vkFormat >= 1000066000 && vkFormat <= 1000066013);   // ASTC HDR
+}
+
+// KTX2: the level index has the (uncompressed) size of every level
+ImageFootprint ktx2Footprint(const std::vector<uint8_t>& b, const nvvkgltf::SceneEstimateOptions& options)
+{
+  ImageFootprint fp;
+  if(b.size() < 80)
+    return fp;
+  const uint32_t vkFormat   = readU32(&b[12]);
+  const uint32_t width      = readU32(&b[20]);
+  const uint32_t height     = std::max(1u, readU32(&b[24]));
+  const uint32_t levelCount = readU32(&b[40]);
+  const uint32_t levels     = std::max(1u, levelCount);
+  if(width == 0)
+    return fp;
+
+  fp.known = true;
+  if(vkFormat == 0)
+  {
+    // Basis Universal, transcoded at load: 16-byte blocks (BC7)
+    fp.gpuBytes = blockChainBytes(width, height, levels, 16);
+    fp.cpuBytes = fp.gpuBytes;
+    return fp;
+  }
+
+  if(b.size() < 80 + size_t(levels) * 24)
+  {
+    fp.known = false;
+    return fp;
+  }
+  for(uint32_t l = 0; l < levels; l++)
+    fp.gpuBytes += readU64(&b[80 + size_t(l) * 24 + 16]);  // uncompressedByteLength
+  fp.cpuBytes = fp.gpuBytes;
+
+  if(levels == 1 && options.generateMipmaps && !isCompressedVkFormat(vkFormat))
+    fp.gpuBytes = pixelChainBytes(width, height, mipLevelCount(width, height), double(fp.gpuBytes) / (double(width) * height));
+  return fp;
+}
+
+// KTX 1: only level 0's size is read; the other levels are a quarter of the previous one
+ImageFootprint ktx1Footprint(const std::vector<uint8_t>& b, const nvvkgltf::SceneEstimateOptions& options)
+{
+  ImageFootprint fp;
+  if(b.size() < 64)
+    return fp;
+  const uint32_t glType   = readU32(&b[16]);  // 0 for compressed formats
+  const uint32_t width    = readU32(&b[36]);
+  const uint32_t height   = std::max(1u, readU32(&b[40]));
+  const uint32_t levels   = std::max(1u, readU32(&b[56]));
+  const uint64_t kvdBytes = readU32(&b[60]);
+  if(width == 0 || b.size() < 64 + kvdBytes + 4)
+    return fp;
+  const uint64_t level0 = readU32(&b[64 + kvdBytes]);
+
+  fp.known                 = true;
+  const uint32_t gpuLevels = (levels == 1 && glType != 0 && options.generateMipmaps) ? mipLevelCount(width, height) : levels;
+  const double   bpp       = double(level0) / (double(width) * height);
+  fp.gpuBytes              = pixelChainBytes(width, height, gpuLevels, bpp);
+  fp.cpuBytes              = pixelChainBytes(width, height, levels, bpp);
+  return fp;
+}
+
+// WebP: dimensions from the VP8 / VP8L / VP8X header, decoded to RGBA8
+ImageFootprint webpFootprint(const std::vector<uint8_t>& b, const nvvkgltf::SceneEstimateOptions& options)
+{
+  if(b.size() < 30)
+    return {};
+  uint32_t width = 0, height = 0;
+  if(std::memcmp(&b[12], "VP8 ", 4) == 0)
+  {
+    width  = (b[26] | (b[27] << 8)) & 0x3FFF;
+    height = (b[28] | (b[29] << 8)) & 0x3FFF;
+  }
+  else if(std::memcmp(&b[12], "VP8L", 4) == 0)
+  {
+    const uint32_t bits = readU32(&b[21]);
+    width               = (bits & 0x3FFF) + 1;
+    height              = ((bits >> 14) & 0x3FFF) + 1;
+  }
+  else if(std::memcmp(&b[12], "VP8X", 4) == 0)
+  {
+    width  = (b[24] | (b[25] << 8) | (b[26] << 16)) + 1;
+    height = (b[27] | (b[28] << 8) | (b[29] << 16)) + 1;
+  }
+  return decodedFootprint(width, height, 4, options);
+}
+
+// Same dispatch as ImageLoader::loadFromMemory, plus WebP (decoded by the application callback)
+ImageFootprint imageFootprint(const std::vector<uint8_t>& b, const nvvkgltf::SceneEstimateOptions& options)
+{
+  static constexpr uint8_t ktx2Id[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+  static constexpr uint8_t ktx1Id[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+  if(b.size() >= 4 && std::memcmp(b.data(), "DDS ", 4) == 0)
+    return ddsFootprint(b, options);
+  if(b.size() >= 12 && std::memcmp(b.data(), ktx2Id, 12) == 0)
+    return ktx2Footprint(b, options);
+  if(b.size() >= 12 && std::memcmp(b.data(), ktx1Id, 12) == 0)
+    return ktx1Footprint(b, options);
+  if(b.size() >= 12 && std::memcmp(b.data(), "RIFF", 4) == 0 && std::memcmp(&b[8], "WEBP", 4) == 0)
+    return webpFootprint(b, options);
+
+  int w = 0, h = 0, comp = 0;
+  if(b.empty() || !stbi_info_from_memory(b.data(), int(b.size()), &w, &h, &comp))
+    return {};
+  const bool     is16Bit       = stbi_is_16_bit_from_memory(b.data(), int(b.size())) != 0;
+  const uint32_t bytesPerPixel = (comp == 1 ? 1 : 4) * (is16Bit ? 2 : 1);
+  return decodedFootprint(uint32_t(w), uint32_t(h), bytesPerPixel, options);
+}
+
+// First bytes of an image, wherever it is stored. `encodedBytes` is its full size.
+std::vector<uint8_t> readImageHeader(const GltfSource& src, const json& image, uint64_t& encodedBytes, uint64_t& bytesRead)
+{
+  encodedBytes = 0;
+  const std::string uri = image.value("uri", std::string());
+  if(!uri.empty())
+  {
+    if(uri.starts_with("data:"))
+    {
+      const size_t comma = uri.find(',');
+      if(comma == std::string::npos)
+        return {};
+      encodedBytes = (uri.size() - comma - 1) * 3 / 4;
+      return decodeBase64Prefix(std::string_view(uri).substr(comma + 1), kImageHeaderBytes);
+    }
+    const fs::path path = uriPath(src.baseDir, uri);
+    encodedBytes        = fileSize(path);
+    bytesRead += encodedBytes;
+    return readFileRange(path, 0, kImageHeaderBytes);
+  }
+
+  const json* view = element(arrayOf(src.doc, "bufferViews"), image.value("bufferView", -1));
+  if(view == nullptr)
+    return {};
+  const int      bufferIndex = view->value("buffer", -1);
+  const json*    buffer      = element(arrayOf(src.doc, "buffers"), bufferIndex);
+  const uint64_t viewOffset  = view->value("byteOffset", uint64_t(0));
+  encodedBytes               = view->value("byteLength", uint64_t(0));
+  const size_t length        = size_t(std::min<uint64_t>(encodedBytes, kImageHeaderBytes));
+  if(buffer == nullptr)
+    return {};
+
+  const std::string bufferUri = buffer->value("uri", std::string());
+  if(bufferUri.empty() && src.glb && bufferIndex == 0)
+  {
+    if(viewOffset + length > src.binLength)
+      return {};
+    return readFileRange(src.file, src.binOffset + viewOffset, length);
+  }
+  if(!bufferUri.empty() && !bufferUri.starts_with("data:"))
+    return readFileRange(uriPath(src.baseDir, bufferUri), viewOffset, length);
+  return {};  // Image inside a data-URI buffer: not decoded for an estimate
+}
+
+//--------------------------------------------------------------------------------------------------
+// Geometry, render nodes, images, then the derived GPU sizes. Throws json::exception on malformed
+// glTF (wrong value types).
+//
+void estimateContent(const GltfSource& src, const nvvkgltf::SceneEstimateOptions& options, nvvkgltf::SceneEstimate& estimate)
+{
+  const json& doc         = src.doc;
+  const json& accessors   = arrayOf(doc, "accessors");
+  const json& bufferViews = arrayOf(doc, "bufferViews");
+  const json& buffers     = arrayOf(doc, "buffers");
+  const json& materials   = arrayOf(doc, "materials");
+  const json& meshes      = arrayOf(doc, "meshes");
+  const json& nodes       = arrayOf(doc, "nodes");
+  const json& images      = arrayOf(doc, "images");
+
+  // Buffers: held by tinygltf; meshopt fallback buffers are allocated at their decoded size
+  for(const json& buffer : buffers)
+  {
+    const uint64_t byteLength = buffer.value("byteLength", uint64_t(0));
+    estimate.bufferBytes += byteLength;
+    const std::string uri = buffer.value("uri", std::string());
+    if(!uri.empty() && !uri.starts_with("data:"))
+      estimate.bytesRead += byteLength;
+  }
+  for(const json& view : bufferViews)
+  {
+    const auto ext = view.find("extensions");
+    if(ext == view.end() || !ext->is_object())
+      continue;
+    for(const char* name : {EXT_MESHOPT_COMPRESSION_EXTENSION_NAME, KHR_MESHOPT_COMPRESSION_EXTENSION_NAME})
+    {
+      const auto meshopt = ext->find(name);
+      if(meshopt != ext->end() && meshopt->is_object())
+      {
+        estimate.meshoptViews++;
+        estimate.meshoptCompressed += meshopt->value("byteLength", uint64_t(0));
+      }
+    }
+  }
+
+  // Unique primitives, keyed like tinygltf::utils::generatePrimitiveKey (attributes in name order)
+  std::unordered_set<std::string> primitiveKeys;
+  for(const json& mesh : meshes)
+  {
+    for(const json& primitive : arrayOf(mesh, "primitives"))
+    {
+      const auto attributes = primitive.find("attributes");
+      if(attributes == primitive.end() || !attributes->is_object() || !attributes->contains("POSITION"))
+        continue;
+      const int position = (*attributes)["POSITION"].get<int>();
+      std::string key;
+      for(const auto& [name, accessor] : attributes->items())
+        key += fmt::format("{}:{} ", name, accessor.is_number_integer() ? accessor.get<int>() : -1);
+      key += fmt::format("indices:{}", primitive.value("indices", -1));
+      if(!primitiveKeys.insert(key).second)
+        continue;
+
+      const uint64_t vertexCount = accessorCount(accessors, position);
+      const auto attributeBytes  = [&](const char* name, uint64_t elementBytes) -> uint64_t {
+        const auto it = attributes->find(name);
+        return (it != attributes->end() && it->is_number_integer()) ? accessorCount(accessors, it->get<int>()) * elementBytes : 0;
+      };
+      uint64_t geometry = attributeBytes("POSITION", 12) + attributeBytes("NORMAL", 12) + attributeBytes("TEXCOORD_0", 8)
+                          + attributeBytes("TEXCOORD_1", 8) + attributeBytes("TANGENT", 16) + attributeBytes("COLOR_0", 4);
+      if(!attributes->contains("TANGENT"))
+      {
+        const json* material = element(materials, std::max(0, primitive.value("material", 0)));
+        if(material != nullptr && material->contains("normalTexture"))
+          geometry += vertexCount * 16;  // Scene::createMissingTangentsForModel
+      }
+
+      const int      indices    = primitive.value("indices", -1);
+      const uint64_t indexCount = indices >= 0 ? accessorCount(accessors, indices) : vertexCount;
+      geometry += indexCount * sizeof(uint32_t);
+
+      uint64_t  triangles = 0;
+      const int mode      = primitive.value("mode", TINYGLTF_MODE_TRIANGLES);
+      if(mode == TINYGLTF_MODE_TRIANGLES)
+        triangles = indexCount / 3;
+      else if(mode == TINYGLTF_MODE_TRIANGLE_STRIP || mode == TINYGLTF_MODE_TRIANGLE_FAN)
+        triangles = indexCount > 2 ? indexCount - 2 : 0;
+
+      estimate.renderPrimitives++;
+      estimate.vertices += vertexCount;
+      estimate.triangles += triangles;
+      estimate.geometryBytes += geometry;
+      if(triangles > 0)
+        estimate.blasBytes += alignUp(uint64_t(double(triangles) * options.blasBytesPerTriangle) + kBlasHeaderBytes, kBlasAlignment);
+    }
+  }
+
+  // Render nodes: the scene traversal, with EXT_mesh_gpu_instancing expanded
+  estimate.nodes = nodes.size();
+  const json* scene = element(arrayOf(doc, "scenes"), std::max(0, doc.value("scene", 0)));
+  if(scene != nullptr)
+  {
+    std::vector<std::pair<int, size_t>> stack;  // Node, depth (guards against cycles)
+    for(const json& root : arrayOf(*scene, "nodes"))
+    {
+      if(root.is_number_integer())
+        stack.emplace_back(root.get<int>(), 0);
+    }
+    while(!stack.empty())
+    {
+      const auto [nodeID, depth] = stack.back();
+      stack.pop_back();
+      const json* node = element(nodes, nodeID);
+      if(node == nullptr || depth > nodes.size())
+        continue;
+
+      if(const json* mesh = element(meshes, node->value("mesh", -1)))
+      {
+        uint64_t   instances = 1;
+        const auto ext       = node->find("extensions");
+        if(ext != node->end() && ext->contains(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME))
+        {
+          const json& gpuInstancing = (*ext)[EXT_MESH_GPU_INSTANCING_EXTENSION_NAME];
+          if(gpuInstancing.contains("attributes") && gpuInstancing["attributes"].is_object())
+          {
+            instances = 0;
+            for(const auto& [name, accessor] : gpuInstancing["attributes"].items())
+            {
+              if(accessor.is_number_integer())
+                instances = std::max(instances, accessorCount(accessors, accessor.get<int>()));
+            }
+          }
+        }
+        estimate.renderNodes += arrayOf(*mesh, "primitives").size() * instances;
+      }
+      for(const json& child : arrayOf(*node, "children"))
+      {
+        if(child.is_number_integer())
+          stack.emplace_back(child.get<int>(), depth + 1);
+      }
+    }
+  }
+
+  // Images: headers only
+  for(const json& image : images)
+  {
+    estimate.images++;
+    uint64_t                   encodedBytes = 0;
+    const std::vector<uint8_t> header       = readImageHeader(src, image, encodedBytes, estimate.bytesRead);
+    estimate.encodedImageBytes += encodedBytes;
+    const ImageFootprint fp = imageFootprint(header, options);
+    if(!fp.known)
+    {
+      estimate.unknownImages++;
+      continue;
+    }
+    estimate.imageBytes += fp.gpuBytes;
+    estimate.decodedImageBytes += fp.cpuBytes;
+    estimate.decodedPixels += fp.decodedPixels;
+  }
+
+  estimate.tlasBytes       = estimate.renderNodes * kTlasBytesPerInstance;
+  estimate.renderNodeBytes = estimate.renderNodes * kRenderNodeGpuBytes + estimate.nodes * kNodeGpuBytes;
+  estimate.loadSeconds     = double(estimate.bytesRead) / options.readBytesPerSecond
+                         + double(estimate.decodedPixels) / options.decodePixelsPerSecond;
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Dry-run load. Malformed values (a string where a count is expected, ...) fail the estimate.
+bool nvvkgltf::estimateScene(const fs::path& filename, SceneEstimate& estimate, const SceneEstimateOptions& options, std::string* error)
+{
+  estimate = {};
+  GltfSource  src;
+  std::string err;
+  if(readGltfSource(filename, src, estimate.bytesRead, err))
+  {
+    try
+    {
+      estimateContent(src, options, estimate);
+      return true;
+    }
+    catch(const json::exception& e)
+    {
+      err = e.what();
+    }
+  }
+  if(error)
+    *error = err;
+  return false;
+}
+
+std::string nvvkgltf::formatSceneEstimate(const SceneEstimate& e)
+{
+  const auto mb = [](uint64_t bytes) { return double(bytes) / (1024.0 * 1024.0); };
+  std::string out;
+  out += fmt::format("GPU memory:   {:10.2f} MB\n", mb(e.gpuBytes()));
+  out += fmt::format("  Geometry:   {:10.2f} MB  ({} primitives, {} vertices, {} triangles)\n", mb(e.geometryBytes),
+                     e.renderPrimitives, e.vertices, e.triangles);
+  out += fmt::format("  Images:     {:10.2f} MB  ({} images, {} unreadable)\n", mb(e.imageBytes), e.images, e.unknownImages);
+  out += fmt::format("  BLAS:       {:10.2f} MB\n", mb(e.blasBytes));
+  out += fmt::format("  TLAS:       {:10.2f} MB  ({} render nodes)\n", mb(e.tlasBytes), e.renderNodes);
+  out += fmt::format("  Nodes:      {:10.2f} MB  ({} nodes)\n", mb(e.renderNodeBytes), e.nodes);
+  out += fmt::format("CPU memory:   {:10.2f} MB\n", mb(e.cpuBytes()));
+  out += fmt::format("  Buffers:    {:10.2f} MB  ({} meshopt views, {:.2f} MB compressed)\n", mb(e.bufferBytes),
+                     e.meshoptViews, mb(e.meshoptCompressed));
+  out += fmt::format("  Images:     {:10.2f} MB encoded, {:.2f} MB decoded\n", mb(e.encodedImageBytes), mb(e.decodedImageBytes));
+  out += fmt::format("Load:         {:10.2f} s    ({:.2f} MB read, {:.1f} Mpixels decoded)\n", e.loadSeconds,
+                     mb(e.bytesRead), double(e.decodedPixels) / 1.0e6);
+  return out;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace nvvkgltf {
+
+// Knobs of the estimate that depend on how the scene will be loaded, or on the driver
+struct SceneEstimateOptions
+{
+  bool   generateMipmaps       = true;   // SceneVk::create(generateMipmaps): full chains for decoded images
+  double blasBytesPerTriangle  = 64.0;   // Compacted BLAS (static scenes); uncompacted is about twice that
+  double readBytesPerSecond    = 1.0e9;  // Load-time model: file reads...
+  double decodePixelsPerSecond = 1.0e8;  // ...and PNG/JPEG/WebP decoding
+};
+
+// What loading a glTF into Scene + SceneVk + SceneRtx will cost. GPU byte counts follow the
+// GpuMemoryTracker categories of the same name; they do not include allocation alignment,
+// transient scratch and staging buffers, or animation buffers.
+struct SceneEstimate
+{
+  // GPU memory
+  uint64_t geometryBytes   = 0;  // "Geometry": SceneVk vertex attributes + 32-bit indices, unique primitives
+  uint64_t imageBytes      = 0;  // "Images": all mip levels
+  uint64_t blasBytes       = 0;  // "BLAS": from the triangle counts
+  uint64_t tlasBytes       = 0;  // "TLAS" + "Instances"
+  uint64_t renderNodeBytes = 0;  // "SceneData" render nodes + "Xform/*" matrices and mappings
+
+  // CPU memory held by the loaded Scene
+  uint64_t bufferBytes       = 0;  // glTF buffers (meshopt fallback buffers at their decoded size)
+  uint64_t encodedImageBytes = 0;  // Image files, kept encoded in tinygltf::Image::image
+  uint64_t decodedImageBytes = 0;  // Pixel data SceneVk holds while uploading: level 0, or all levels of DDS/KTX
+
+  // Counts
+  uint64_t nodes             = 0;  // All nodes of the model (transform buffers are sized for them)
+  uint64_t renderNodes       = 0;  // After EXT_mesh_gpu_instancing expansion
+  uint64_t renderPrimitives  = 0;  // Unique primitives (same key as Scene::buildPrimitiveKeyMap)
+  uint64_t vertices          = 0;  // Of the unique primitives
+  uint64_t triangles         = 0;  // Of the unique primitives
+  uint64_t images            = 0;
+  uint64_t unknownImages     = 0;  // Header not readable: not counted in imageBytes
+  uint64_t meshoptViews      = 0;  // Buffer views decoded from EXT/KHR_meshopt_compression
+  uint64_t meshoptCompressed = 0;  // Bytes read for them
+  uint64_t decodedPixels     = 0;  // Pixels decoded on the CPU (PNG, JPEG, WebP)
+  uint64_t bytesRead         = 0;  // glTF/GLB file, external buffers and images
+
+  double loadSeconds = 0.0;  // Rough: reads + decoding at SceneEstimateOptions throughputs
+
+  [[nodiscard]] uint64_t gpuBytes() const { return geometryBytes + imageBytes + blasBytes + tlasBytes + renderNodeBytes; }
+  [[nodiscard]] uint64_t cpuBytes() const { return bufferBytes + encodedImageBytes + decodedImageBytes; }
+};
+
+// Dry run of a .gltf/.glb load: reads the JSON, the GLB chunk headers and the first bytes of every
+// image (PNG, JPEG, WebP, DDS, KTX/KTX2), never the buffers or the pixels.
+// Returns false with `error` set when the file cannot be read or parsed. Referenced glTF 2.1
+// external assets are not followed.
+[[nodiscard]] bool estimateScene(const std::filesystem::path& filename,
+                                 SceneEstimate&               estimate,
+                                 const SceneEstimateOptions&  options = {},
+                                 std::string*                 error   = nullptr);
+
+// Multi-line summary for logs and the --estimate command line
+std::string formatSceneEstimate(const SceneEstimate& estimate);
+
+}  // namespace nvvkgltf
@@ -63,6 +63,7 @@ void SceneGpu::create(VkCommandBuffer cmd, Scene& scn, bool generateMipmaps)
 {
   m_sceneVk.create(cmd, m_staging, scn, generateMipmaps);
   m_animationVk.createGpuBuffers(m_staging, scn);
+  scn.animation().invalidateDeformation();  // Vertex buffers hold the base geometry again
   applyAnimation(cmd, scn);
   m_staging.cmdUploadAppended(cmd);
 }
@@ -87,10 +88,51 @@ void SceneGpu::rebuild(VkCommandBuffer cmd, Scene& scn, bool rebuildTextures)
   }
 
   m_animationVk.createGpuBuffers(m_staging, scn);
+  scn.animation().invalidateDeformation();  // Vertex buffers hold the base geometry again
   applyAnimation(cmd, scn);
   m_staging.cmdUploadAppended(cmd);
 }
 
+//--------------------------------------------------------------------------------------------------
+// Incremental counterpart of rebuild() after a merge/reference that only appended content.
+// SceneVk creates the new geometry and textures and regrows the per-element buffers; the animation
+// SSBOs are small and indexed across the whole scene, so they are recreated.
+bool SceneGpu::append(VkCommandBuffer cmd, Scene& scn, const SceneAppendInfo& info)
+{
+  if(!m_sceneVk.canAppend(scn, info))
+    return false;
+
+  m_animationVk.destroyGpuBuffers();
+  m_sceneVk.append(cmd, m_staging, scn, info);
+  m_animationVk.createGpuBuffers(m_staging, scn);
+  scn.animation().invalidateDeformation();  // Vertex buffers hold the base geometry again
+  applyAnimation(cmd, scn);
+  m_staging.cmdUploadAppended(cmd);
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// In-place counterpart of rebuild(false) when only the content of some primitives changed: their
+// buffers are recreated, the others kept. Animation SSBOs hold copies of the base geometry.
+void SceneGpu::updateGeometry(VkCommandBuffer cmd, Scene& scn, std::span<const int> renderPrimIDs)
+{
+  m_animationVk.destroyGpuBuffers();
+  m_sceneVk.updatePrimitiveGeometry(cmd, m_staging, scn, renderPrimIDs);
+  m_animationVk.createGpuBuffers(m_staging, scn);
+  scn.animation().invalidateDeformation();  // Vertex buffers hold the base geometry again
+  applyAnimation(cmd, scn);
+  m_staging.cmdUploadAppended(cmd);
+}
+
+//--------------------------------------------------------------------------------------------------
+// The appended uploads are flushed by the caller with the rest of the frame's scene changes.
+void SceneGpu::uploadVertexBuffers(Scene& scn)
+{
+  m_sceneVk.uploadVertexBuffers(m_staging, scn);
+  m_animationVk.invalidateBatchTasks();     // The batch tasks point at the vertex buffers
+  scn.animation().invalidateDeformation();  // Deformed primitives were reset to their base geometry
+}
+
 //--------------------------------------------------------------------------------------------------
 // Release scene-level GPU resources across all three subsystems.
 // Order: animation SSBOs -> scene buffers/textures -> acceleration structures.
@@ -105,14 +147,22 @@ void SceneGpu::destroy()
 // Apply morph target blending and skeletal skinning to vertex buffers.
 // Dispatches GPU compute shaders when useComputeAnimation is set and the compute pipelines
 // are initialized; otherwise falls back to CPU-side computation via SceneVk::uploadPrimitives.
+// With worldMatrices set, the GPU path computes the joint palettes from the device world matrices.
+// Primitives whose deformation inputs did not change since the last call are skipped.
 // No-op if the scene has no morph targets or skinning data.
-void SceneGpu::applyAnimation(VkCommandBuffer cmd, Scene& scn)
+void SceneGpu::applyAnimation(VkCommandBuffer cmd, Scene& scn, VkDeviceAddress worldMatrices)
 {
   if(!scn.animation().hasMorphTargets() && !scn.animation().hasSkinning())
     return;
 
-  if(useComputeAnimation && m_animationVk.isInitialized())
-    m_animationVk.dispatchAnimation(cmd, m_staging, scn, m_sceneVk);
+  // The CPU blended outputs are stale after GPU frames, and the other way around
+  const bool onGpu = useComputeAnimation && m_animationVk.isInitialized();
+  if(onGpu != m_deformedOnGpu)
+    scn.animation().invalidateDeformation();
+  m_deformedOnGpu = onGpu;
+
+  if(onGpu)
+    m_animationVk.dispatchAnimation(cmd, m_staging, scn, m_sceneVk, worldMatrices);
   else
     m_sceneVk.uploadPrimitives(cmd, m_staging, scn);
 }
@@ -120,9 +170,9 @@ void SceneGpu::applyAnimation(VkCommandBuffer cmd, Scene& scn)
 //--------------------------------------------------------------------------------------------------
 // Check whether the GPU compute transform path should be used this frame.
 // Combines the user-facing toggle with the technical prerequisites checked by canUseGpuTransformPath.
-bool SceneGpu::shouldUseGpuTransform(const Scene& scn) const
+bool SceneGpu::shouldUseGpuTransform(const Scene& scn, bool gpuNodeAnimation) const
 {
-  return useComputeTransformation && canUseGpuTransformPath(m_transformCompute, scn, m_sceneRtx);
+  return useComputeTransformation && canUseGpuTransformPath(m_transformCompute, scn, m_sceneRtx, gpuNodeAnimation);
 }
 
 }  // namespace nvvkgltf
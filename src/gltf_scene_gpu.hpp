@@ -40,7 +40,7 @@ purely an orchestration concern that neither SceneVk nor AnimationVk should know
 Usage:
   sceneGpu.init(alloc, samplerPool, staging, queue, deferredFree);
   sceneGpu.create(cmd, scene);           // geometry + animation SSBOs + initial deformation
-  sceneGpu.applyAnimation(cmd, scene);   // per-frame morph/skin dispatch
+  sceneGpu.applyAnimation(cmd, scene);   // per-frame morph/skin dispatch (one dispatch each)
   sceneGpu.destroy();                    // release scene-level GPU resources
   sceneGpu.deinit();                     // release pipelines and allocator references
 
@@ -83,6 +83,20 @@ public:
   // (rebuildTextures=false), preserves textures and materials.
   void rebuild(VkCommandBuffer cmd, Scene& scn, bool rebuildTextures);
 
+  // Upload only what a merge/reference appended (Scene::takeLastAppend) on top of the existing
+  // resources; animation SSBOs are recreated. Returns false, without touching anything, when the
+  // append can't be applied in place (see SceneVk::canAppend) -- the caller then rebuilds.
+  // Does NOT build acceleration structures (see SceneRtx::appendBottomLevelAccelerationStructure).
+  [[nodiscard]] bool append(VkCommandBuffer cmd, Scene& scn, const SceneAppendInfo& info);
+
+  // Replace the vertex and index buffers of the given render primitives after their mesh content
+  // changed (hot reload); animation SSBOs are recreated. Does NOT rebuild acceleration structures.
+  void updateGeometry(VkCommandBuffer cmd, Scene& scn, std::span<const int> renderPrimIDs);
+
+  // Re-upload the vertex attributes of all primitives (e.g. after a tangent recompute). New vertex
+  // buffers may be created, so the deformation task tables are refilled on the next dispatch.
+  void uploadVertexBuffers(Scene& scn);
+
   // Release scene-level GPU resources across all three subsystems (buffers, textures, AS).
   // Does NOT release pipelines or allocator references -- call deinit() for full teardown.
   void destroy();
@@ -91,15 +105,19 @@ public:
 
   // Apply morph target blending and skeletal skinning to vertex buffers.
   // Dispatches GPU compute shaders or the CPU fallback based on useComputeAnimation.
+  // worldMatrices: current node world matrices on the device (TransformComputeVk::worldMatricesAddress,
+  // after its propagation this frame) to compute the joint palettes on the GPU; 0 uses the CPU ones.
   // No-op if the scene has no morph targets or skinning.
-  void applyAnimation(VkCommandBuffer cmd, Scene& scn);
+  void applyAnimation(VkCommandBuffer cmd, Scene& scn, VkDeviceAddress worldMatrices = 0);
 
   // Returns true when the GPU compute transform path should be used this frame.
   // Checks the user toggle and technical prerequisites (buffers, dirty flags, TLAS state).
-  [[nodiscard]] bool shouldUseGpuTransform(const Scene& scn) const;
+  // gpuNodeAnimation: the animated local matrices are evaluated on the GPU this frame.
+  [[nodiscard]] bool shouldUseGpuTransform(const Scene& scn, bool gpuNodeAnimation = false) const;
 
   bool useComputeAnimation      = true;
   bool useComputeTransformation = true;
+  bool useGpuNodeAnimation      = false;  // Play rigid TRS animations on the GPU (needs useComputeTransformation)
 
 private:
   SceneVk&               m_sceneVk;
@@ -107,6 +125,7 @@ private:
   SceneRtx&              m_sceneRtx;
   TransformComputeVk&    m_transformCompute;
   nvvk::StagingUploader& m_staging;
+  bool                   m_deformedOnGpu = false;  // Path of the last applyAnimation()
 };
 
 }  // namespace nvvkgltf
@@ -0,0 +1,852 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Offline optimization passes and the load / optimize / write driver. See gltf_scene_optimizer.hpp.
+//
+
+#include "gltf_scene_optimizer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <fmt/format.h>
+#include <meshoptimizer/src/meshoptimizer.h>
+#include <tinygltf/tiny_gltf.h>
+
+#include <nvutils/file_operations.hpp>
+#include <nvutils/logger.hpp>
+#include <nvutils/timers.hpp>
+
+#include "gltf_compact_model.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_save.hpp"
+#include "tinygltf_utils.hpp"
+
+namespace fs = std::filesystem;
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr const char* kMeshQuantization = "KHR_mesh_quantization";
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime  = 1099511628211ull;
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t hash = kFnvOffset)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for(size_t i = 0; i < size; i++)
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  return hash;
+}
+
+bool isDracoCompressed(const tinygltf::Primitive& primitive)
+{
+  return primitive.extensions.count("KHR_draco_mesh_compression") != 0;
+}
+
+size_t elementSize(const tinygltf::Accessor& accessor)
+{
+  return size_t(tinygltf::GetComponentSizeInBytes(accessor.componentType)) * size_t(tinygltf::GetNumComponentsInType(accessor.type));
+}
+
+// Where the elements of a plain (non-sparse) accessor are, nullptr if it has no valid storage
+unsigned char* accessorStorage(tinygltf::Model& model, const tinygltf::Accessor& accessor, size_t& stride)
+{
+  if(accessor.sparse.isSparse || accessor.bufferView < 0 || accessor.bufferView >= int(model.bufferViews.size()))
+    return nullptr;
+  const tinygltf::BufferView& view = model.bufferViews[accessor.bufferView];
+  if(view.buffer < 0 || view.buffer >= int(model.buffers.size()))
+    return nullptr;
+  const size_t element = elementSize(accessor);
+  stride               = view.byteStride ? view.byteStride : element;
+  if(element == 0 || accessor.count == 0)
+    return nullptr;
+  const size_t begin = view.byteOffset + accessor.byteOffset;
+  const size_t end   = begin + (accessor.count - 1) * stride + element;
+  if(end > view.byteOffset + view.byteLength || end > model.buffers[view.buffer].data.size())
+    return nullptr;
+  return model.buffers[view.buffer].data.data() + begin;
+}
+
+// The elements of a plain accessor, tightly packed
+bool gatherAccessorBytes(tinygltf::Model& model, const tinygltf::Accessor& accessor, std::vector<unsigned char>& bytes)
+{
+  size_t               stride = 0;
+  const unsigned char* data   = accessorStorage(model, accessor, stride);
+  if(!data)
+    return false;
+  const size_t element = elementSize(accessor);
+  bytes.resize(accessor.count * element);
+  for(size_t i = 0; i < accessor.count; i++)
+    std::memcpy(bytes.data() + i * element, data + i * stride, element);
+  return true;
+}
+
+// Visits every accessor index referenced by meshes, instancing nodes, skins and animations
+template <typename Fn>
+void forEachAccessorReference(tinygltf::Model& model, Fn&& fn)
+{
+  for(tinygltf::Mesh& mesh : model.meshes)
+  {
+    for(tinygltf::Primitive& primitive : mesh.primitives)
+    {
+      if(isDracoCompressed(primitive))
+        continue;
+      for(auto& [name, index] : primitive.attributes)
+        fn(index);
+      fn(primitive.indices);
+      for(auto& target : primitive.targets)
+        for(auto& [name, index] : target)
+          fn(index);
+    }
+  }
+  for(tinygltf::Node& node : model.nodes)
+  {
+    auto it = node.extensions.find(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+    if(it == node.extensions.end() || !it->second.Has("attributes") || !it->second.Get("attributes").IsObject())
+      continue;
+    for(auto& [name, value] : it->second.Get<tinygltf::Value::Object>()["attributes"].Get<tinygltf::Value::Object>())
+    {
+      if(!value.IsInt() && !value.IsNumber())
+        continue;
+      int index = value.GetNumberAsInt();
+      fn(index);
+      value = tinygltf::Value(index);
+    }
+  }
+  for(tinygltf::Skin& skin : model.skins)
+    fn(skin.inverseBindMatrices);
+  for(tinygltf::Animation& animation : model.animations)
+  {
+    for(tinygltf::AnimationSampler& sampler : animation.samplers)
+    {
+      fn(sampler.input);
+      fn(sampler.output);
+    }
+  }
+}
+
+// The material indices a primitive may render with: its own and its KHR_materials_variants mappings
+template <typename Fn>
+void forEachPrimitiveMaterial(tinygltf::Primitive& primitive, Fn&& fn)
+{
+  fn(primitive.material);
+  auto it = primitive.extensions.find(KHR_MATERIALS_VARIANTS_EXTENSION_NAME);
+  if(it == primitive.extensions.end() || !it->second.Has("mappings") || !it->second.Get("mappings").IsArray())
+    return;
+  for(tinygltf::Value& mapping : it->second.Get<tinygltf::Value::Object>()["mappings"].Get<tinygltf::Value::Array>())
+  {
+    if(!mapping.IsObject() || !mapping.Has("material"))
+      continue;
+    int material = mapping.Get("material").GetNumberAsInt();
+    fn(material);
+    mapping.Get<tinygltf::Value::Object>()["material"] = tinygltf::Value(material);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Accessors with the same type, count, normalization, bufferView target and bytes. Hashing finds
+// the candidates; the bytes are compared before merging.
+uint32_t mergeDuplicateAccessors(tinygltf::Model& model)
+{
+  std::vector<int>                               remap(model.accessors.size());
+  std::unordered_map<uint64_t, std::vector<int>> buckets;
+  std::vector<unsigned char>                     bytes, other;
+  uint32_t                                       merged = 0;
+  for(size_t i = 0; i < model.accessors.size(); i++)
+  {
+    remap[i]                           = int(i);
+    const tinygltf::Accessor& accessor = model.accessors[i];
+    if(!gatherAccessorBytes(model, accessor, bytes))
+      continue;
+    const int target = model.bufferViews[accessor.bufferView].target;
+    uint64_t  hash   = hashBytes(&accessor.componentType, sizeof(accessor.componentType));
+    hash             = hashBytes(&accessor.type, sizeof(accessor.type), hash);
+    hash             = hashBytes(&target, sizeof(target), hash);
+    hash             = hashBytes(bytes.data(), bytes.size(), hash ^ uint64_t(accessor.normalized));
+
+    std::vector<int>& candidates = buckets[hash];
+    for(int candidate : candidates)
+    {
+      const tinygltf::Accessor& first = model.accessors[candidate];
+      if(first.componentType != accessor.componentType || first.type != accessor.type || first.count != accessor.count
+         || first.normalized != accessor.normalized || model.bufferViews[first.bufferView].target != target)
+        continue;
+      if(gatherAccessorBytes(model, first, other) && other == bytes)
+      {
+        remap[i] = candidate;
+        break;
+      }
+    }
+    if(remap[i] == int(i))
+      candidates.push_back(int(i));
+    else
+      merged++;
+  }
+
+  if(merged > 0)
+  {
+    forEachAccessorReference(model, [&](int& index) {
+      if(index >= 0 && index < int(remap.size()))
+        index = remap[index];
+    });
+  }
+  return merged;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Materials equal in everything but their name. Materials addressed by KHR_animation_pointer keep
+// their identity: merging them would animate the other users too.
+uint32_t mergeDuplicateMaterials(tinygltf::Model& model)
+{
+  std::unordered_set<int> animated;
+  for(const tinygltf::Animation& animation : model.animations)
+  {
+    for(const tinygltf::AnimationChannel& channel : animation.channels)
+    {
+      auto it = channel.extensions.find("KHR_animation_pointer");
+      if(it == channel.extensions.end() || !it->second.Has("pointer") || !it->second.Get("pointer").IsString())
+        continue;
+      const std::string& pointer = it->second.Get("pointer").Get<std::string>();
+      if(pointer.rfind("/materials/", 0) == 0)
+        animated.insert(std::atoi(pointer.c_str() + std::strlen("/materials/")));
+    }
+  }
+
+  std::vector<int>                                  remap(model.materials.size());
+  std::unordered_map<std::string, std::vector<int>> buckets;  // Cheap key: alpha mode and texture indices
+  uint32_t                                          merged = 0;
+  for(size_t i = 0; i < model.materials.size(); i++)
+  {
+    remap[i]                           = int(i);
+    const tinygltf::Material& material = model.materials[i];
+    if(animated.count(int(i)))
+      continue;
+    const std::string key = fmt::format("{}:{}:{}:{}", material.alphaMode, material.pbrMetallicRoughness.baseColorTexture.index,
+                                        material.normalTexture.index, material.extensions.size());
+
+    tinygltf::Material unnamed = material;
+    unnamed.name.clear();
+    std::vector<int>& candidates = buckets[key];
+    for(int candidate : candidates)
+    {
+      tinygltf::Material first = model.materials[candidate];
+      first.name.clear();
+      if(first == unnamed)
+      {
+        remap[i] = candidate;
+        break;
+      }
+    }
+    if(remap[i] == int(i))
+      candidates.push_back(int(i));
+    else
+      merged++;
+  }
+
+  if(merged > 0)
+  {
+    for(tinygltf::Mesh& mesh : model.meshes)
+    {
+      for(tinygltf::Primitive& primitive : mesh.primitives)
+      {
+        forEachPrimitiveMaterial(primitive, [&](int& index) {
+          if(index >= 0 && index < int(remap.size()))
+            index = remap[index];
+        });
+      }
+    }
+  }
+  return merged;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Normal-mapped primitives the loader will give a TANGENT (Scene::createMissingTangentsForModel)
+uint32_t countMissingTangents(const tinygltf::Model& model)
+{
+  uint32_t count = 0;
+  for(const tinygltf::Mesh& mesh : model.meshes)
+  {
+    for(const tinygltf::Primitive& primitive : mesh.primitives)
+    {
+      const int material = primitive.material >= 0 && primitive.material < int(model.materials.size()) ? primitive.material : 0;
+      if(material < int(model.materials.size()) && model.materials[material].normalTexture.index >= 0
+         && primitive.attributes.count("TANGENT") == 0)
+        count++;
+    }
+  }
+  return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Reorders each index accessor used only by triangle lists with non-blended materials, in place
+// and with its component type: vertex data and accessor layout do not change.
+uint32_t optimizeVertexCache(tinygltf::Model& model)
+{
+  struct Usage
+  {
+    bool   eligible    = true;
+    size_t vertexCount = 0;
+  };
+  std::unordered_map<int, Usage> usages;
+  for(tinygltf::Mesh& mesh : model.meshes)
+  {
+    for(tinygltf::Primitive& primitive : mesh.primitives)
+    {
+      if(primitive.indices < 0 || isDracoCompressed(primitive))
+        continue;
+      Usage& usage = usages[primitive.indices];
+      usage.eligible &= primitive.mode == TINYGLTF_MODE_TRIANGLES;
+      forEachPrimitiveMaterial(primitive, [&](int& index) {
+        if(index >= 0 && index < int(model.materials.size()) && model.materials[index].alphaMode == "BLEND")
+          usage.eligible = false;
+      });
+      const auto position = primitive.attributes.find("POSITION");
+      if(position == primitive.attributes.end())
+        usage.eligible = false;
+      else
+        usage.vertexCount = std::max(usage.vertexCount, size_t(model.accessors[position->second].count));
+    }
+  }
+
+  uint32_t              reordered = 0;
+  std::vector<uint32_t> indices, optimized;
+  for(const auto& [accessorIndex, usage] : usages)
+  {
+    const tinygltf::Accessor& accessor = model.accessors[accessorIndex];
+    if(!usage.eligible || accessor.count < 6 || accessor.count % 3 != 0)
+      continue;
+    size_t         stride = 0;
+    unsigned char* data   = accessorStorage(model, accessor, stride);
+    indices.clear();
+    if(!data || !tinygltf::utils::copyAccessorData<uint32_t>(model, accessor, indices))
+      continue;
+    if(*std::max_element(indices.begin(), indices.end()) >= usage.vertexCount)
+      continue;
+
+    optimized.resize(indices.size());
+    meshopt_optimizeVertexCache(optimized.data(), indices.data(), indices.size(), usage.vertexCount);
+    for(size_t i = 0; i < optimized.size(); i++)
+    {
+      unsigned char* element = data + i * stride;
+      switch(accessor.componentType)
+      {
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+          *element = uint8_t(optimized[i]);
+          break;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+          const uint16_t value = uint16_t(optimized[i]);
+          std::memcpy(element, &value, sizeof(value));
+          break;
+        }
+        default:
+          std::memcpy(element, &optimized[i], sizeof(uint32_t));
+          break;
+      }
+    }
+    reordered++;
+  }
+  return reordered;
+}
+
+// The components of a float accessor, flattened
+template <typename T>
+bool copyFloatComponents(const tinygltf::Model& model, const tinygltf::Accessor& accessor, std::vector<float>& values)
+{
+  std::vector<T> elements;
+  if(!tinygltf::utils::copyAccessorData<T>(model, accessor, elements))
+    return false;
+  const float* first = reinterpret_cast<const float*>(elements.data());
+  values.assign(first, first + elements.size() * T::length());
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// KHR_mesh_quantization of the float NORMAL, TANGENT and TEXCOORD_n attributes. Quantized copies
+// are appended (shared accessors are converted once) and the float ones left for compactModel.
+// Three-component attributes are padded to 8 bytes: vertex attributes start on 4-byte boundaries.
+uint32_t quantizeAttributes(tinygltf::Model& model)
+{
+  if(model.buffers.empty())
+    return 0;
+
+  std::unordered_map<int, int> quantized;  // Float accessor -> quantized accessor, -1: not quantizable
+  const auto                   quantize = [&](int index, const std::string& name) -> int {
+    if(auto it = quantized.find(index); it != quantized.end())
+      return it->second;
+    int&                      result   = quantized[index];
+    const tinygltf::Accessor& accessor = model.accessors[index];
+    result                             = -1;
+    if(accessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT || accessor.sparse.isSparse || accessor.count == 0)
+      return result;
+
+    const bool         normal   = name == "NORMAL" && accessor.type == TINYGLTF_TYPE_VEC3;
+    const bool         tangent  = name == "TANGENT" && accessor.type == TINYGLTF_TYPE_VEC4;
+    const bool         texcoord = name.rfind("TEXCOORD_", 0) == 0 && accessor.type == TINYGLTF_TYPE_VEC2;
+    std::vector<float> values;
+    const bool         read = normal  ? copyFloatComponents<glm::vec3>(model, accessor, values) :
+                              tangent ? copyFloatComponents<glm::vec4>(model, accessor, values) :
+                                        texcoord && copyFloatComponents<glm::vec2>(model, accessor, values);
+    if(!read)
+      return result;
+
+    const size_t          components = normal ? 3 : (tangent ? 4 : 2);
+    const size_t          padded     = normal ? 4 : components;
+    std::vector<uint16_t> packed(accessor.count * padded, 0);
+    for(size_t i = 0; i < accessor.count; i++)
+    {
+      for(size_t c = 0; c < components; c++)
+      {
+        const float value = values[i * components + c];
+        if(texcoord)
+        {
+          if(!(value >= 0.0f && value <= 1.0f))
+            return result;  // Outside the unsigned normalized range: keep float
+          packed[i * padded + c] = uint16_t(std::lround(value * 65535.0f));
+        }
+        else
+          packed[i * padded + c] = uint16_t(int16_t(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f)));
+      }
+    }
+
+    const int componentType = texcoord ? TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT : TINYGLTF_COMPONENT_TYPE_SHORT;
+    result = tinygltf::utils::appendAccessor(model, 0, packed.data(), packed.size() * sizeof(uint16_t), componentType,
+                                             accessor.type, accessor.count, TINYGLTF_TARGET_ARRAY_BUFFER);
+    model.accessors[result].normalized = true;
+    model.accessors[result].name       = model.accessors[index].name;
+    if(normal)
+      model.bufferViews[model.accessors[result].bufferView].byteStride = padded * sizeof(uint16_t);
+    return result;
+  };
+
+  uint32_t count = 0;
+  for(tinygltf::Mesh& mesh : model.meshes)
+  {
+    for(tinygltf::Primitive& primitive : mesh.primitives)
+    {
+      if(isDracoCompressed(primitive))
+        continue;
+      for(auto& [name, index] : primitive.attributes)
+      {
+        if(index < 0 || index >= int(model.accessors.size()))
+          continue;
+        // Morph targets blend into these attributes: their deltas keep the float base
+        const bool morphed = std::any_of(primitive.targets.begin(), primitive.targets.end(),
+                                         [&](const auto& target) { return target.count(name) != 0; });
+        if(morphed)
+          continue;
+        const size_t before = quantized.size();
+        const int    result = quantize(index, name);
+        if(result >= 0)
+        {
+          count += quantized.size() > before ? 1 : 0;
+          index = result;
+        }
+      }
+    }
+  }
+
+  if(count > 0)
+  {
+    for(std::vector<std::string>* list : {&model.extensionsUsed, &model.extensionsRequired})
+    {
+      if(std::find(list->begin(), list->end(), kMeshQuantization) == list->end())
+        list->push_back(kMeshQuantization);
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Pass names
+bool parseSceneOptimizePasses(const std::string& passes, SceneOptimizeOptions& options, std::string* error)
+{
+  SceneOptimizeOptions parsed{false, false, false, false, false, false};
+  std::stringstream    stream(passes);
+  std::string          name;
+  while(std::getline(stream, name, ','))
+  {
+    name.erase(std::remove_if(name.begin(), name.end(), [](unsigned char c) { return std::isspace(c); }), name.end());
+    if(name.empty() || name == "none")
+      continue;
+    if(name == "all")
+      parsed = {true, true, true, true, true, true};
+    else if(name == "compact")
+      parsed.removeUnused = true;
+    else if(name == "dedup")
+      parsed.mergeDuplicates = true;
+    else if(name == "tangents")
+      parsed.tangents = true;
+    else if(name == "vcache")
+      parsed.vertexCache = true;
+    else if(name == "quantize")
+      parsed.quantize = true;
+    else if(name == "meshopt")
+      parsed.meshopt = true;
+    else
+    {
+      if(error)
+        *error = "unknown pass '" + name + "' (compact, dedup, tangents, vcache, quantize, meshopt, all, none)";
+      return false;
+    }
+  }
+  options = parsed;
+  return true;
+}
+
+std::string formatSceneOptimizePasses(const SceneOptimizeOptions& options)
+{
+  std::string out;
+  for(const auto& [enabled, name] : {std::pair{options.mergeDuplicates, "dedup"},
+                                     {options.removeUnused, "compact"},
+                                     {options.tangents, "tangents"},
+                                     {options.vertexCache, "vcache"},
+                                     {options.quantize, "quantize"},
+                                     {options.meshopt, "meshopt"}})
+  {
+    if(enabled)
+      out += (out.empty() ? "" : ",") + std::string(name);
+  }
+  return out.empty() ? "none" : out;
+}
+
+//--------------------------------------------------------------------------------------------------
+// The model passes, then one parse so the render nodes and primitives match the rewritten model
+SceneOptimizeStats optimizeScene(Scene& scene, const SceneOptimizeOptions& options)
+{
+  nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
+  SceneOptimizeStats   stats;
+  tinygltf::Model&     model = scene.getModel();
+  scene.waitForSaves();  // The buffers are rewritten
+  stats.accessorsBefore      = uint32_t(model.accessors.size());
+  stats.materialsBefore      = uint32_t(model.materials.size());
+
+  if(options.mergeDuplicates)
+  {
+    stats.accessorsMerged = mergeDuplicateAccessors(model);
+    stats.materialsMerged = mergeDuplicateMaterials(model);
+  }
+  if(options.removeUnused && scene.valid())
+    (void)scene.compactModel();
+
+  if(options.tangents)
+  {
+    stats.tangentsBaked = countMissingTangents(model);
+    scene.setCreateMissingTangents(true);
+    if(stats.tangentsBaked > 0)
+      scene.setCurrentScene(scene.getCurrentScene());  // Generates them into the model
+  }
+  if(options.vertexCache)
+    stats.indexBuffersOrdered = optimizeVertexCache(model);
+  if(options.quantize)
+    stats.accessorsQuantized = quantizeAttributes(model);
+
+  // Drops what the merges and the quantization left unreferenced, and the space of both
+  if(options.removeUnused || options.mergeDuplicates || options.quantize)
+    ::compactModel(model);
+
+  if(!model.nodes.empty() && !model.scenes.empty())
+    scene.setCurrentScene(scene.getCurrentScene());
+
+  stats.accessorsAfter = uint32_t(model.accessors.size());
+  stats.materialsAfter = uint32_t(model.materials.size());
+  LOGI("%sAccessors merged: %u, materials merged: %u, tangents baked: %u, index buffers reordered: %u, quantized: %u\n",
+       st.indent().c_str(), stats.accessorsMerged, stats.materialsMerged, stats.tangentsBaked, stats.indexBuffersOrdered,
+       stats.accessorsQuantized);
+  return stats;
+}
+
+//--------------------------------------------------------------------------------------------------
+// One stream per buffer view. A view is compressed as ATTRIBUTES when all its accessors share an
+// element stride that is a multiple of 4 (at most 256), as TRIANGLES when it holds exactly the
+// 16/32-bit indices of one triangle list, as INDICES for other 16/32-bit index data. A stream
+// that is not smaller than the raw data is not used.
+void compressMeshoptBuffers(tinygltf::Model& model, SceneOptimizeStats& stats)
+{
+  enum class Mode
+  {
+    eRaw,
+    eAttributes,
+    eTriangles,
+    eIndices,
+  };
+  struct ViewPlan
+  {
+    Mode   mode              = Mode::eRaw;
+    size_t stride            = 0;
+    bool   locked            = false;  // Used by an image, a sparse accessor or an extension: stays raw
+    bool   index             = false;  // Holds primitive indices
+    int    accessors         = 0;
+    bool   wholeTriangleList = false;  // Exactly the indices of one triangle list
+  };
+  std::vector<ViewPlan> plans(model.bufferViews.size());
+
+  std::unordered_set<int> triangleIndices;
+  for(const tinygltf::Mesh& mesh : model.meshes)
+    for(const tinygltf::Primitive& primitive : mesh.primitives)
+      if(primitive.indices >= 0 && primitive.mode == TINYGLTF_MODE_TRIANGLES)
+        triangleIndices.insert(primitive.indices);
+  std::unordered_set<int> indexAccessors;
+  for(const tinygltf::Mesh& mesh : model.meshes)
+    for(const tinygltf::Primitive& primitive : mesh.primitives)
+      if(primitive.indices >= 0)
+        indexAccessors.insert(primitive.indices);
+
+  for(const tinygltf::Image& image : model.images)
+    if(image.bufferView >= 0 && image.bufferView < int(plans.size()))
+      plans[image.bufferView].locked = true;
+  for(size_t i = 0; i < model.bufferViews.size(); i++)
+  {
+    const tinygltf::BufferView& view = model.bufferViews[i];
+    if(!view.extensions.empty() || view.buffer < 0 || view.buffer >= int(model.buffers.size())
+       || view.byteOffset + view.byteLength > model.buffers[view.buffer].data.size())
+      plans[i].locked = true;
+  }
+
+  for(size_t a = 0; a < model.accessors.size(); a++)
+  {
+    const tinygltf::Accessor& accessor = model.accessors[a];
+    if(accessor.sparse.isSparse)
+    {
+      for(int view : {accessor.bufferView, accessor.sparse.indices.bufferView, accessor.sparse.values.bufferView})
+        if(view >= 0 && view < int(plans.size()))
+          plans[view].locked = true;
+      continue;
+    }
+    if(accessor.bufferView < 0 || accessor.bufferView >= int(plans.size()))
+      continue;
+    ViewPlan&                   plan    = plans[accessor.bufferView];
+    const tinygltf::BufferView& view    = model.bufferViews[accessor.bufferView];
+    const bool                  index   = indexAccessors.count(int(a)) != 0;
+    const size_t                element = elementSize(accessor);
+    const size_t                stride  = view.byteStride ? view.byteStride : element;
+    if(plan.accessors > 0 && (plan.index != index || plan.stride != stride))
+      plan.locked = true;
+    plan.index  = index;
+    plan.stride = stride;
+    plan.accessors++;
+    plan.wholeTriangleList = plan.accessors == 1 && triangleIndices.count(int(a)) && accessor.byteOffset == 0
+                             && accessor.count * element == view.byteLength && accessor.count % 3 == 0;
+    if(index && accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
+      plan.locked = true;  // Meshopt index modes decode 16 or 32-bit indices only
+  }
+
+  for(size_t i = 0; i < plans.size(); i++)
+  {
+    ViewPlan& plan = plans[i];
+    if(plan.locked || plan.accessors == 0 || plan.stride == 0 || model.bufferViews[i].byteLength % plan.stride != 0)
+      continue;
+    if(plan.index)
+      plan.mode = plan.wholeTriangleList ? Mode::eTriangles : Mode::eIndices;
+    else if(plan.stride % 4 == 0 && plan.stride <= 256)
+      plan.mode = Mode::eAttributes;
+  }
+
+  // EXT_meshopt_compression decoders support vertex codec version 0 and index codec version 1
+  meshopt_encodeVertexVersion(0);
+  meshopt_encodeIndexVersion(1);
+
+  tinygltf::Buffer data;
+  tinygltf::Buffer fallback;
+  size_t           fallbackSize = 0;
+  const auto       align4       = [](std::vector<unsigned char>& bytes) { bytes.resize((bytes.size() + 3) & ~size_t(3), 0); };
+  data.name                     = model.buffers.empty() ? "" : model.buffers[0].name;
+
+  std::vector<unsigned char> encoded;
+  std::vector<uint32_t>      indices;
+  for(size_t i = 0; i < model.bufferViews.size(); i++)
+  {
+    tinygltf::BufferView& view = model.bufferViews[i];
+    const ViewPlan&       plan = plans[i];
+    if(view.buffer < 0 || view.buffer >= int(model.buffers.size()))
+      continue;
+    const unsigned char* source = model.buffers[view.buffer].data.data() + view.byteOffset;
+    const size_t         count  = plan.stride ? view.byteLength / plan.stride : 0;
+
+    size_t encodedSize = 0;
+    if(plan.mode == Mode::eAttributes)
+    {
+      encoded.resize(meshopt_encodeVertexBufferBound(count, plan.stride));
+      encodedSize = meshopt_encodeVertexBuffer(encoded.data(), encoded.size(), source, count, plan.stride);
+    }
+    else if(plan.mode != Mode::eRaw)
+    {
+      indices.resize(count);
+      for(size_t k = 0; k < count; k++)
+      {
+        if(plan.stride == 2)
+        {
+          uint16_t value;
+          std::memcpy(&value, source + k * 2, 2);
+          indices[k] = value;
+        }
+        else
+          std::memcpy(&indices[k], source + k * 4, 4);
+      }
+      const size_t vertexCount = indices.empty() ? 0 : size_t(*std::max_element(indices.begin(), indices.end())) + 1;
+      if(plan.mode == Mode::eTriangles)
+      {
+        encoded.resize(meshopt_encodeIndexBufferBound(count, vertexCount));
+        encodedSize = meshopt_encodeIndexBuffer(encoded.data(), encoded.size(), indices.data(), count);
+      }
+      else
+      {
+        encoded.resize(meshopt_encodeIndexSequenceBound(count, vertexCount));
+        encodedSize = meshopt_encodeIndexSequence(encoded.data(), encoded.size(), indices.data(), count);
+      }
+    }
+
+    if(encodedSize == 0 || encodedSize >= view.byteLength)
+    {
+      // Raw: copied as is, the views keep 4-byte alignment
+      align4(data.data);
+      const size_t offset = data.data.size();
+      data.data.insert(data.data.end(), source, source + view.byteLength);
+      view.buffer     = 0;
+      view.byteOffset = offset;
+      continue;
+    }
+
+    align4(data.data);
+    const size_t encodedOffset = data.data.size();
+    data.data.insert(data.data.end(), encoded.data(), encoded.data() + encodedSize);
+    fallbackSize = (fallbackSize + 3) & ~size_t(3);
+
+    static constexpr const char* kModeNames[] = {"", "ATTRIBUTES", "TRIANGLES", "INDICES"};
+    tinygltf::Value::Object      ext;
+    ext["buffer"]     = tinygltf::Value(0);
+    // Offsets past INT_MAX are written as (exact) doubles, like the GLB writer does
+    ext["byteOffset"] = encodedOffset <= size_t(std::numeric_limits<int>::max()) ? tinygltf::Value(int(encodedOffset)) :
+                                                                                    tinygltf::Value(double(encodedOffset));
+    ext["byteLength"] = tinygltf::Value(int(encodedSize));
+    ext["byteStride"] = tinygltf::Value(int(plan.stride));
+    ext["count"]      = tinygltf::Value(int(count));
+    ext["mode"]       = tinygltf::Value(std::string(kModeNames[int(plan.mode)]));
+    view.extensions[EXT_MESHOPT_COMPRESSION_EXTENSION_NAME] = tinygltf::Value(std::move(ext));
+    view.buffer                                             = 1;
+    view.byteOffset                                         = fallbackSize;
+    fallbackSize += view.byteLength;
+
+    stats.meshoptViews++;
+    stats.meshoptRawBytes += view.byteLength;
+    stats.meshoptBytes += encodedSize;
+  }
+
+  if(stats.meshoptViews == 0)
+  {
+    data.byteLength = data.data.size();
+    model.buffers   = {std::move(data)};
+    return;
+  }
+
+  data.byteLength     = data.data.size();
+  fallback.byteLength = fallbackSize;
+  tinygltf::Value::Object marker;
+  marker["fallback"] = tinygltf::Value(true);
+  fallback.extensions[EXT_MESHOPT_COMPRESSION_EXTENSION_NAME] = tinygltf::Value(std::move(marker));
+  model.buffers = {std::move(data), std::move(fallback)};
+
+  // No storage for the fallback: readers must decode
+  for(std::vector<std::string>* list : {&model.extensionsUsed, &model.extensionsRequired})
+  {
+    if(std::find(list->begin(), list->end(), EXT_MESHOPT_COMPRESSION_EXTENSION_NAME) == list->end())
+      list->push_back(EXT_MESHOPT_COMPRESSION_EXTENSION_NAME);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Estimate, load without generated tangents, optimize, write, estimate the result
+bool optimizeSceneFile(const fs::path& input, const fs::path& output, const SceneOptimizeOptions& options, SceneOptimizeReport& report, std::string* error)
+{
+  nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
+  const auto           fail = [&](const std::string& message) {
+    if(error)
+      *error = message;
+    return false;
+  };
+
+  report = {};
+  std::string estimateError;
+  if(!estimateScene(input, report.before, {}, &estimateError))
+    return fail(estimateError);
+
+  Scene scene;
+  scene.setCreateMissingTangents(false);
+  if(!scene.load(input))
+    return fail("cannot load " + nvutils::utf8FromPath(input));
+
+  report.stats = optimizeScene(scene, options);
+
+  const bool binary = nvutils::extensionMatches(output, ".glb");
+  if(options.meshopt && !binary)
+    LOGW("%sEXT_meshopt_compression is only written to .glb files: skipped\n", st.indent().c_str());
+
+  // Self-contained: external assets (glTF 2.1) are kept inline, as they were optimized
+  std::optional<SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(output, true);
+  if(!snapshot)
+    return fail("the optimized scene does not validate");
+  if(options.meshopt && binary)
+    compressMeshoptBuffers(snapshot->model, report.stats);
+  if(writeSceneSnapshot(*snapshot) != SceneSaveStatus::eSaved)
+    return fail("cannot write " + nvutils::utf8FromPath(snapshot->filename));
+
+  if(!estimateScene(snapshot->filename, report.after, {}, &estimateError))
+    return fail(estimateError);
+  return true;
+}
+
+std::string formatSceneOptimizeReport(const SceneOptimizeReport& report)
+{
+  const auto mb      = [](uint64_t bytes) { return double(bytes) / (1024.0 * 1024.0); };
+  const auto percent = [](double before, double after) { return before > 0.0 ? (after - before) / before * 100.0 : 0.0; };
+
+  const SceneOptimizeStats& s = report.stats;
+  const SceneEstimate&      b = report.before;
+  const SceneEstimate&      a = report.after;
+
+  std::string out;
+  out += fmt::format("Read:         {:10.2f} MB -> {:.2f} MB ({:+.1f}%)\n", mb(b.bytesRead), mb(a.bytesRead),
+                     percent(double(b.bytesRead), double(a.bytesRead)));
+  out += fmt::format("Load:         {:10.3f} s  -> {:.3f} s  ({:+.1f}%)\n", b.loadSeconds, a.loadSeconds,
+                     percent(b.loadSeconds, a.loadSeconds));
+  out += fmt::format("Geometry:     {:10.2f} MB -> {:.2f} MB GPU, {} -> {} primitives\n", mb(b.geometryBytes),
+                     mb(a.geometryBytes), b.renderPrimitives, a.renderPrimitives);
+  out += fmt::format("Accessors:    {:10} -> {} ({} merged, {} quantized)\n", s.accessorsBefore, s.accessorsAfter,
+                     s.accessorsMerged, s.accessorsQuantized);
+  out += fmt::format("Materials:    {:10} -> {} ({} merged)\n", s.materialsBefore, s.materialsAfter, s.materialsMerged);
+  out += fmt::format("Tangents:     {:10} primitives baked\n", s.tangentsBaked);
+  out += fmt::format("Vertex cache: {:10} index buffers reordered\n", s.indexBuffersOrdered);
+  out += fmt::format("Meshopt:      {:10} views, {:.2f} MB -> {:.2f} MB\n", s.meshoptViews, mb(s.meshoptRawBytes), mb(s.meshoptBytes));
+  return out;
+}
+
+}  // namespace nvvkgltf
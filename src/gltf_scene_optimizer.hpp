@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "gltf_scene_estimate.hpp"
+
+namespace tinygltf {
+class Model;
+}
+
+namespace nvvkgltf {
+
+class Scene;
+
+/*-------------------------------------------------------------------------------------------------
+# Offline scene optimization
+
+>  Rewrites a glTF so that loading it does less work, without changing what is rendered.
+
+The passes run in this order on a loaded Scene:
+- "dedup":    accessors with identical content, and materials identical but for their name, are
+              merged; the references are redirected to the first one.
+- "compact":  meshes, materials, textures, images, accessors and buffer data no longer reachable
+              from the scene are removed (this also drops what "dedup" left unreferenced).
+- "tangents": the TANGENT attributes the loader generates for normal-mapped primitives are written
+              to the file, so loading no longer computes them.
+- "vcache":   the triangles of each index buffer are reordered for the post-transform vertex cache
+              (meshopt_optimizeVertexCache). Triangle lists only; blended materials keep their
+              order, since it is their draw order.
+- "quantize": KHR_mesh_quantization. NORMAL and TANGENT become normalized 16-bit integers,
+              TEXCOORD_n too when all its values are in [0, 1]. POSITION and morph targets stay
+              float, so bounds and the acceleration structures are unchanged.
+- "meshopt":  EXT_meshopt_compression of the buffer views, lossless (no filters). .glb output
+              only: the decoded data lives in a fallback buffer that has no storage in the file.
+
+The tangents pass is the only one that is decided at load: the Scene is loaded with tangent
+generation turned off, then parsed again with it on when the pass is selected.
+ -------------------------------------------------------------------------------------------------*/
+
+struct SceneOptimizeOptions
+{
+  bool removeUnused    = true;   // "compact"
+  bool mergeDuplicates = true;   // "dedup"
+  bool tangents        = true;   // "tangents"
+  bool vertexCache     = true;   // "vcache"
+  bool quantize        = false;  // "quantize"
+  bool meshopt         = false;  // "meshopt"
+};
+
+// Comma-separated pass names (see above), or "all" / "none". Returns false with `error` set on an
+// unknown name; `options` is only changed on success.
+[[nodiscard]] bool parseSceneOptimizePasses(const std::string& passes, SceneOptimizeOptions& options, std::string* error = nullptr);
+std::string        formatSceneOptimizePasses(const SceneOptimizeOptions& options);
+
+// What the passes did
+struct SceneOptimizeStats
+{
+  uint32_t accessorsMerged     = 0;
+  uint32_t materialsMerged     = 0;
+  uint32_t tangentsBaked       = 0;  // Primitives whose generated TANGENT is written
+  uint32_t indexBuffersOrdered = 0;  // Index accessors reordered for the vertex cache
+  uint32_t accessorsQuantized  = 0;
+  uint32_t meshoptViews        = 0;  // Buffer views compressed
+  uint64_t meshoptRawBytes     = 0;  // Their decoded size...
+  uint64_t meshoptBytes        = 0;  // ...and compressed size
+  uint32_t accessorsBefore     = 0;
+  uint32_t accessorsAfter      = 0;
+  uint32_t materialsBefore     = 0;
+  uint32_t materialsAfter      = 0;
+};
+
+struct SceneOptimizeReport
+{
+  SceneOptimizeStats stats;
+  SceneEstimate      before;  // Estimates of the input and the written file: sizes, primitives, load time
+  SceneEstimate      after;
+};
+
+// The model passes ("dedup", "compact", "tangents", "vcache", "quantize") on a loaded scene, which
+// is parsed again afterwards. "meshopt" is applied when writing (compressMeshoptBuffers).
+SceneOptimizeStats optimizeScene(Scene& scene, const SceneOptimizeOptions& options);
+
+// Lossless EXT_meshopt_compression of the buffer views of `model`: buffer 0 receives the raw views
+// that were not worth compressing and the compressed streams, buffer 1 is the fallback buffer the
+// compressed views decode into. Views used by images or sparse accessors stay raw.
+void compressMeshoptBuffers(tinygltf::Model& model, SceneOptimizeStats& stats);
+
+// Load `input`, run the passes and write `output` (.gltf or .glb). `report` holds the estimates
+// of both files. Returns false with `error` set if loading or saving fails.
+[[nodiscard]] bool optimizeSceneFile(const std::filesystem::path& input,
+                                     const std::filesystem::path& output,
+                                     const SceneOptimizeOptions&  options,
+                                     SceneOptimizeReport&         report,
+                                     std::string*                 error = nullptr);
+
+// Multi-line summary for logs and the --optimize command line
+std::string formatSceneOptimizeReport(const SceneOptimizeReport& report);
+
+}  // namespace nvvkgltf
@@ -123,10 +123,10 @@ VkAccelerationStructureKHR nvvkgltf::SceneRtx::topLevelAS()
 }
 
 //--------------------------------------------------------------------------------------------------
-// Register all BLAS allocations with the memory tracker. Call after all BLAS are built.
+// Register the BLAS allocations of the last build with the memory tracker. Call after all BLAS are built.
 void nvvkgltf::SceneRtx::trackBlasMemory()
 {
-  for(const auto& blas : m_blasAccel)
+  for(const auto& blas : std::span(m_blasAccel).subspan(m_blasBuildBegin))
   {
     if(blas.accel != VK_NULL_HANDLE && blas.buffer.allocation)
     {
@@ -178,9 +178,41 @@ void nvvkgltf::SceneRtx::createBottomLevelAccelerationStructure(const nvvkgltf::
 
   destroy();  // Make sure not to leave allocated buffers
 
+  prepareBottomLevelGeometry(scene, sceneVk, flags, 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Like createBottomLevelAccelerationStructure, but keeps the BLAS of primitives [0, firstPrim) and
+// prepares build data only for the primitives appended after them (Scene::takeLastAppend). The
+// following cmdBuildBottomLevelAccelerationStructure / cmdCompactBlas calls only touch the new BLAS.
+// The TLAS is left as is: rebuildTopLevelAS() takes the new instance count.
+void nvvkgltf::SceneRtx::appendBottomLevelAccelerationStructure(const nvvkgltf::Scene&               scene,
+                                                                const SceneVk&                       sceneVk,
+                                                                VkBuildAccelerationStructureFlagsKHR flags,
+                                                                uint32_t                             firstPrim)
+{
+  nvutils::ScopedTimer st(__FUNCTION__);
+  assert(firstPrim == m_blasAccel.size());
+
+  // Builder from the previous build (and its non-compacted BLAS) is no longer needed: the GPU is idle.
+  if(m_blasBuilder)
+    m_blasBuilder->deinit();
+  m_blasBuilder.reset();
+
+  prepareBottomLevelGeometry(scene, sceneVk, flags, firstPrim);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Fill BLAS build data for primitives [firstPrim, count) and create a fresh BLAS builder.
+void nvvkgltf::SceneRtx::prepareBottomLevelGeometry(const nvvkgltf::Scene&               scene,
+                                                    const SceneVk&                       sceneVk,
+                                                    VkBuildAccelerationStructureFlagsKHR flags,
+                                                    uint32_t                             firstPrim)
+{
   auto& renderPrimitives = scene.getRenderPrimitives();
 
   // BLAS - Storing each primitive in a geometry
+  m_blasBuildBegin = firstPrim;
   m_blasBuildData.resize(renderPrimitives.size());
   m_blasAccel.resize(m_blasBuildData.size());
 
@@ -190,10 +222,10 @@ void nvvkgltf::SceneRtx::createBottomLevelAccelerationStructure(const nvvkgltf::
 
   // Per-primitive opacity micromap linkage (kept alive for the whole build; see header).
   const SceneOmm& sceneOmm = sceneVk.opacityMicromap();
-  m_ommGeometry.assign(renderPrimitives.size(), VkAccelerationStructureTrianglesOpacityMicromapEXT{
+  m_ommGeometry.resize(renderPrimitives.size(), VkAccelerationStructureTrianglesOpacityMicromapEXT{
                                                     VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT});
 
-  for(uint32_t p_idx = 0; p_idx < renderPrimitives.size(); p_idx++)
+  for(uint32_t p_idx = firstPrim; p_idx < renderPrimitives.size(); p_idx++)
   {
     auto& blasData  = m_blasBuildData[p_idx];
     blasData.asType = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
@@ -235,7 +267,8 @@ bool nvvkgltf::SceneRtx::cmdBuildBottomLevelAccelerationStructure(VkCommandBuffe
 
   destroyScratchBuffers();
 
-  // 1) finding the largest scratch size
+  // 1) finding the largest scratch size. Sized over all primitives, not just the ones being built:
+  // updateBottomLevelAS() reuses this buffer for every animated BLAS, old and appended.
   VkDeviceSize scratchSize = m_blasBuilder->getScratchSize(hintMaxBudget, m_blasBuildData);
 
   // 2) allocating the scratch buffer
@@ -246,8 +279,8 @@ bool nvvkgltf::SceneRtx::cmdBuildBottomLevelAccelerationStructure(VkCommandBuffe
   NVVK_DBG_NAME(m_blasScratchBuffer.buffer);
   m_memoryTracker.track(kMemCategoryScratch, m_blasScratchBuffer.allocation);
 
-  std::span<nvvk::AccelerationStructureBuildData> blasBuildData(m_blasBuildData);
-  std::span<nvvk::AccelerationStructure>          blasAccel(m_blasAccel);
+  std::span<nvvk::AccelerationStructureBuildData> blasBuildData = std::span(m_blasBuildData).subspan(m_blasBuildBegin);
+  std::span<nvvk::AccelerationStructure>          blasAccel     = std::span(m_blasAccel).subspan(m_blasBuildBegin);
 
   // Ensure transfer-write -> AS-build-read sync, or BLAS may read incomplete geometry and cause GPU/device loss.
   nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COPY_BIT, VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
@@ -333,32 +366,30 @@ void nvvkgltf::SceneRtx::cmdCreateBuildTopLevelAccelerationStructure(VkCommandBu
     m_tlasInstances.push_back(asInstance);
   }
 
-  // Vulkan requires at least one instance for TLAS builds. Use a local invisible dummy
-  // so m_tlasInstances always reflects the true scene state (empty when no render nodes).
-  VkAccelerationStructureInstanceKHR                  dummyInstance{};
-  std::span<const VkAccelerationStructureInstanceKHR> buildInstances = m_tlasInstances;
-  if(m_tlasInstances.empty())
-  {
-    dummyInstance.transform = nvvk::toTransformMatrixKHR(glm::mat4(1.0f));
-    dummyInstance.mask      = 0x00;
-    buildInstances          = {&dummyInstance, 1};
-  }
+  // The instance buffer and the TLAS are sized for the slot capacity, with headroom over the render
+  // nodes: slots [instanceCount, capacity) are parked (inactive), which also gives Vulkan the one
+  // instance it requires when the scene has no render nodes. m_tlasInstances only holds the active
+  // slots, so it always reflects the true scene state.
+  m_instanceSlots.reset(instanceCount);
+  const uint32_t slotCapacity = m_instanceSlots.capacity();
 
   VkBuildAccelerationStructureFlagsKHR buildFlags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
   buildFlags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
 
   constexpr VmaAllocationCreateFlags instanceAllocFlags   = 0;
   constexpr VkDeviceSize             instanceMinAlignment = 16;
-  NVVK_CHECK(m_alloc->createBuffer(m_instancesBuffer, buildInstances.size_bytes(),
+  NVVK_CHECK(m_alloc->createBuffer(m_instancesBuffer, sizeof(VkAccelerationStructureInstanceKHR) * slotCapacity,
                                    VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_2_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR
                                        | VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT,
                                    VMA_MEMORY_USAGE_AUTO, instanceAllocFlags, instanceMinAlignment));
-  NVVK_CHECK(staging.appendBuffer(m_instancesBuffer, 0, buildInstances));
+  if(!m_tlasInstances.empty())
+    NVVK_CHECK(staging.appendBuffer(m_instancesBuffer, 0, std::span(m_tlasInstances)));
+  appendParkedInstances(staging, instanceCount, slotCapacity);
   NVVK_DBG_NAME(m_instancesBuffer.buffer);
   m_memoryTracker.track(kMemCategoryInstances, m_instancesBuffer.allocation);
 
   m_tlasBuildData.asType = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR;
-  auto geo               = m_tlasBuildData.makeInstanceGeometry(buildInstances.size(), m_instancesBuffer.address);
+  auto geo               = m_tlasBuildData.makeInstanceGeometry(slotCapacity, m_instancesBuffer.address);
   m_tlasBuildData.addGeometry(geo);
 
   staging.cmdUploadAppended(cmd);
@@ -422,15 +453,32 @@ void nvvkgltf::SceneRtx::rebuildTopLevelAS(VkCommandBuffer                cmd,
 
   int32_t numVisibleElement = dirtyRenderNodes.empty() ? 0 : m_numVisibleElement;
 
-  // If the number of render nodes changed, we need to recreate the TLAS from scratch,
-  // as well as the instance buffer.
-  // This is because the TLAS build requires a contiguous array of instances, and we don't
-  // want to manage holes in that array from removed nodes.
+  // Render node count changed (add, duplicate, delete, merge). Shaders index the render nodes with
+  // the instance index, so slot == render node id: the slots [0, count) become active and the rest
+  // are parked. Within the slot capacity this is an in-place rebuild of every instance; the buffer
+  // and TLAS are only recreated when the capacity is exceeded or too many slots are parked.
+  bool forceBuild = false;
   if(m_tlasInstances.size() != drawObjects.size())
   {
-    destroyTlasResourcesDeferred();
-    cmdCreateBuildTopLevelAccelerationStructure(cmd, staging, scene);
-    return;
+    const uint32_t oldCount = static_cast<uint32_t>(m_tlasInstances.size());
+    const uint32_t newCount = static_cast<uint32_t>(drawObjects.size());
+    if(m_tlasAccel.accel == VK_NULL_HANDLE || m_instanceSlots.resize(newCount) == InstanceSlotAllocator::Change::eReallocate)
+    {
+      destroyTlasResourcesDeferred();
+      cmdCreateBuildTopLevelAccelerationStructure(cmd, staging, scene);
+      return;
+    }
+
+    m_tlasInstances.resize(newCount);
+    if(newCount < oldCount)
+      appendParkedInstances(staging, newCount, oldCount);
+    for(uint32_t i = oldCount; i < newCount; i++)
+      m_tlasInstances[i].mask = 0x01;  // Un-parked slot; the rest is written by updateInstance below
+
+    // Render node ids may have shifted: refresh every active instance, and build rather than
+    // update since the set of active instances changed.
+    numVisibleElement = 0;
+    forceBuild        = true;
   }
 
   // Lambda to update a single instance in the TLAS instance array and return its previous and current visibility.
@@ -448,7 +496,7 @@ void nvvkgltf::SceneRtx::rebuildTopLevelAS(VkCommandBuffer                cmd,
     return std::pair<bool, bool>{wasVisible, isVisible};
   };
 
-  if(dirtyRenderNodes.empty())
+  if(dirtyRenderNodes.empty() || forceBuild)
   {
     for(size_t i = 0; i < drawObjects.size(); i++)
     {
@@ -487,7 +535,7 @@ void nvvkgltf::SceneRtx::rebuildTopLevelAS(VkCommandBuffer                cmd,
     m_memoryTracker.track(kMemCategoryScratch, m_tlasScratchBuffer.allocation);
   }
 
-  if(m_numVisibleElement != numVisibleElement)
+  if(forceBuild || m_numVisibleElement != numVisibleElement)
   {
     m_tlasBuildData.cmdBuildAccelerationStructure(cmd, m_tlasAccel.accel, m_tlasScratchBuffer.address);
   }
@@ -501,6 +549,22 @@ void nvvkgltf::SceneRtx::rebuildTopLevelAS(VkCommandBuffer                cmd,
   nvvk::accelerationStructureBarrier(cmd, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR);
 }
 
+//--------------------------------------------------------------------------------------------------
+// Write parked (inactive) instances to slots [begin, end) of the instance buffer: no BLAS, mask 0.
+void nvvkgltf::SceneRtx::appendParkedInstances(nvvk::StagingUploader& staging, uint32_t begin, uint32_t end)
+{
+  if(begin >= end)
+    return;
+
+  VkAccelerationStructureInstanceKHR parked{};
+  parked.transform = nvvk::toTransformMatrixKHR(glm::mat4(1.0f));
+  parked.mask      = 0x00;
+
+  const std::vector<VkAccelerationStructureInstanceKHR> parkedInstances(end - begin, parked);
+  const VkDeviceSize offset = static_cast<VkDeviceSize>(begin) * sizeof(VkAccelerationStructureInstanceKHR);
+  NVVK_CHECK(staging.appendBuffer(m_instancesBuffer, offset, std::span(parkedInstances)));
+}
+
 //--------------------------------------------------------------------------------------------------
 // In-place TLAS update after compute wrote instance transforms into `m_instancesBuffer` (CPU shadow vector may be stale).
 void nvvkgltf::SceneRtx::cmdUpdateTlasFromInstanceBuffer(VkCommandBuffer cmd)
@@ -532,35 +596,45 @@ bool nvvkgltf::SceneRtx::syncTopLevelAS(VkCommandBuffer cmd, nvvk::StagingUpload
   const auto& dirty       = df.renderNodesRtx;
   const auto& renderNodes = scene.getRenderNodes();
 
-  if(!df.allRenderNodesDirty && dirty.empty() && m_tlasInstances.size() == renderNodes.size())
+  if(!df.allRenderNodesDirty && !df.renderNodesRtxDirty() && m_tlasInstances.size() == renderNodes.size())
     return false;
 
   // Check if we need to do a full update (rebuild) or if we can do a surgical update of the existing TLAS.
   // If the ratio of dirty nodes is high, it's more efficient to do a full rebuild.
-  const bool useFullUpdate = df.allRenderNodesDirty || renderNodes.empty()
+  const bool useFullUpdate = df.allRenderNodesDirty || df.allRenderNodesRtx || renderNodes.empty()
                              || float(dirty.size()) / float(renderNodes.size()) >= nvvkgltf::kFullUpdateRatio;
 
   rebuildTopLevelAS(cmd, staging, scene, useFullUpdate ? std::unordered_set<int>{} : dirty);
   df.renderNodesRtx.clear();
+  df.allRenderNodesRtx = false;
 
   return true;
 }
 
 //--------------------------------------------------------------------------------------------------
-// Update BLAS for morph targets and skinned primitives (vertex data changed).
+// Update BLAS for morph targets and skinned primitives (vertex data changed). Primitives the last
+// deformation skipped (same weights / joint palette, see DeformChangeTracker) keep their BLAS.
 void nvvkgltf::SceneRtx::updateBottomLevelAS(VkCommandBuffer cmd, const nvvkgltf::Scene& scene)
 {
-  for(auto& primID : scene.animation().getMorphPrimitives())
+  const nvvkgltf::DeformChangeTracker& changes    = scene.animation().getDeformationChanges();
+  const auto&                          morphPrims = scene.animation().getMorphPrimitives();
+  for(size_t i = 0; i < morphPrims.size(); i++)
   {
+    if(!changes.morphChanged(i))
+      continue;
+    const uint32_t primID = morphPrims[i];
     m_blasBuildData[primID].cmdUpdateAccelerationStructure(cmd, m_blasAccel[primID].accel, m_blasScratchBuffer.address);
     // Add synchronization between consecutive acceleration structure updates that use the same scratch buffer
     nvvk::accelerationStructureBarrier(cmd, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
                                        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR);
   }
-  for(const auto& task : scene.animation().getSkinTasks())
+  const auto& skinTasks = scene.animation().getSkinTasks();
+  for(size_t i = 0; i < skinTasks.size(); i++)
   {
-    m_blasBuildData[task.renderPrimID].cmdUpdateAccelerationStructure(cmd, m_blasAccel[task.renderPrimID].accel,
-                                                                      m_blasScratchBuffer.address);
+    if(!changes.skinChanged(i))
+      continue;
+    const int primID = skinTasks[i].renderPrimID;
+    m_blasBuildData[primID].cmdUpdateAccelerationStructure(cmd, m_blasAccel[primID].accel, m_blasScratchBuffer.address);
     nvvk::accelerationStructureBarrier(cmd, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
                                        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR);
   }
@@ -572,8 +646,8 @@ VkResult nvvkgltf::SceneRtx::cmdCompactBlas(VkCommandBuffer cmd)
 {
   nvutils::ScopedTimer st(__FUNCTION__ + std::string("\n"));
 
-  std::span<nvvk::AccelerationStructureBuildData> blasBuildData(m_blasBuildData);
-  std::span<nvvk::AccelerationStructure>          blasAccel(m_blasAccel);
+  std::span<nvvk::AccelerationStructureBuildData> blasBuildData = std::span(m_blasBuildData).subspan(m_blasBuildBegin);
+  std::span<nvvk::AccelerationStructure>          blasAccel     = std::span(m_blasAccel).subspan(m_blasBuildBegin);
 
   VkResult result = m_blasBuilder->cmdCompactBlas(cmd, blasBuildData, blasAccel);
 
@@ -609,8 +683,10 @@ void nvvkgltf::SceneRtx::destroy()
 
   m_blasAccel          = {};
   m_blasBuildData      = {};
+  m_blasBuildBegin     = 0;
   m_ommGeometry        = {};
   m_instanceFlagsCache = {};
+  m_instanceSlots.clear();
   if(m_blasBuilder)
   {
     m_blasBuilder->deinit();
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <deque>
 
 #include <nvvk/acceleration_structures.hpp>
 
+#include "gltf_instance_slots.hpp"
 #include "gltf_scene_vk.hpp"
 #include "gpu_memory_tracker.hpp"
 
@@ -56,6 +58,11 @@ public:
   // Create BLAS and TLAS for the scene (no compaction). Calls destroy() first.
   void create(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, const SceneVk& scnVk, VkBuildAccelerationStructureFlagsKHR flags);
   void createBottomLevelAccelerationStructure(const nvvkgltf::Scene& scene, const SceneVk& sceneVk, VkBuildAccelerationStructureFlagsKHR flags);
+  // Prepare BLAS only for the primitives appended from firstPrim on (Scene::takeLastAppend); existing BLAS are kept.
+  void appendBottomLevelAccelerationStructure(const nvvkgltf::Scene&               scene,
+                                              const SceneVk&                       sceneVk,
+                                              VkBuildAccelerationStructureFlagsKHR flags,
+                                              uint32_t                             firstPrim);
   // Build BLAS on GPU; may return false if budget exceeded (call again to continue). Returns true when done.
   [[nodiscard]] bool cmdBuildBottomLevelAccelerationStructure(VkCommandBuffer cmd, VkDeviceSize hintMaxBudget = 512'000'000);
   void cmdCreateBuildTopLevelAccelerationStructure(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scene);
@@ -75,7 +82,8 @@ public:
   void                          cmdUpdateTlasFromInstanceBuffer(VkCommandBuffer cmd);
   [[nodiscard]] VkDeviceAddress getInstancesBufferAddress() const { return m_instancesBuffer.address; }
 
-  // Rebuild or update TLAS. dirtyRenderNodes empty = full update.
+  // Rebuild or update TLAS. dirtyRenderNodes empty = full update. A changed render-node count is
+  // handled in place while it fits the instance slot capacity (see InstanceSlotAllocator).
   void rebuildTopLevelAS(VkCommandBuffer                cmd,
                          nvvk::StagingUploader&         staging,
                          const nvvkgltf::Scene&         scene,
@@ -101,6 +109,11 @@ protected:
                                                                       VkDeviceAddress                  vertexAddress,
                                                                       VkDeviceAddress                  indexAddress);
 
+  void prepareBottomLevelGeometry(const nvvkgltf::Scene&               scene,
+                                  const SceneVk&                       sceneVk,
+                                  VkBuildAccelerationStructureFlagsKHR flags,
+                                  uint32_t                             firstPrim);
+  void appendParkedInstances(nvvk::StagingUploader& staging, uint32_t begin, uint32_t end);
   void destroyTlasResources();
   void destroyTlasResourcesDeferred();
 
@@ -113,14 +126,17 @@ protected:
   std::unique_ptr<nvvk::AccelerationStructureBuilder> m_blasBuilder;
   std::vector<nvvk::AccelerationStructureBuildData>   m_blasBuildData;
   std::vector<nvvk::AccelerationStructure>            m_blasAccel;
+  uint32_t                                            m_blasBuildBegin = 0;  // First BLAS handled by m_blasBuilder (> 0 after an append)
 
   // Per-renderPrimID opacity micromap linkage attached to the BLAS geometry (triangles.pNext).
-  // Must stay alive from the BLAS size query through the GPU build, so it lives here.
-  std::vector<VkAccelerationStructureTrianglesOpacityMicromapEXT> m_ommGeometry;
+  // Must stay alive from the BLAS size query through the GPU build, so it lives here. A deque so
+  // growing it on append keeps the pointers held by the existing build data valid.
+  std::deque<VkAccelerationStructureTrianglesOpacityMicromapEXT> m_ommGeometry;
 
   nvvk::AccelerationStructureBuildData            m_tlasBuildData;
   nvvk::AccelerationStructure                     m_tlasAccel;
-  std::vector<VkAccelerationStructureInstanceKHR> m_tlasInstances;
+  std::vector<VkAccelerationStructureInstanceKHR> m_tlasInstances;  // Active slots only (one per render node)
+  InstanceSlotAllocator                           m_instanceSlots;  // Instance buffer / TLAS capacity, parked slots past the render nodes
 
   nvvk::Buffer m_blasScratchBuffer;
   nvvk::Buffer m_tlasScratchBuffer;
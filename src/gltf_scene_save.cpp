@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Writing a save snapshot, synchronously or on a background thread. See gltf_scene_save.hpp.
+//
+
+#include "gltf_scene_save.hpp"
+
+#include <memory>
+
+#include <nvutils/file_operations.hpp>
+#include <nvutils/logger.hpp>
+#include <nvutils/timers.hpp>
+
+#include "gltf_glb_writer.hpp"
+#include "gltf_image_export.hpp"
+#include "tinygltf_utils.hpp"
+#include "version.hpp"
+
+namespace nvvkgltf {
+
+namespace {
+
+bool cancelled(const SceneSaveProgress* progress)
+{
+  return progress && progress->cancel.load();
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// The lease holds a reference on the counter: it may outlive the scene that handed it out
+std::shared_ptr<void> SavePayloadReaders::acquire()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_leases++;
+  }
+  return std::shared_ptr<void>(this, [self = shared_from_this()](void*) { self->release(); });
+}
+
+void SavePayloadReaders::release()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_leases--;
+  }
+  m_released.notify_all();
+}
+
+void SavePayloadReaders::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_released.wait(lock, [this]() { return m_leases == 0; });
+}
+
+bool SavePayloadReaders::busy() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_leases > 0;
+}
+
+float SceneSaveProgress::fraction() const
+{
+  if(written.load())
+    return 1.0f;
+  const uint32_t total = imagesTotal.load();
+  return total == 0 ? 0.5f : 0.5f * float(imagesCompleted.load()) / float(total);
+}
+
+void SceneSaveProgress::reset()
+{
+  imagesTotal     = 0;
+  imagesCompleted = 0;
+  written         = false;
+  cancel          = false;
+}
+
+namespace {
+
+//--------------------------------------------------------------------------------------------------
+// The writing half of Scene::save; touches nothing but the snapshot and the destination folder
+// (and reads the buffers of the live model through the lease).
+SceneSaveStatus writeSnapshot(SceneSaveSnapshot& snapshot, SceneSaveProgress* progress)
+{
+  nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
+  tinygltf::Model&     outModel = snapshot.model;
+
+  // Copy the images to the destination folder using the same search paths as for loading.
+  // Images that already resolve next to the saved file (at their current relative URI) are left
+  // in place -- this keeps a "save in place" (or a save-as into a folder that already contains the
+  // referenced images) from needlessly duplicating them into an "images/" subfolder. Only images
+  // that would not be found relative to the destination are copied there and have their URI
+  // rewritten. The URIs are decided serially; the copies run on worker threads (see
+  // gltf_image_export.hpp), and an image whose copy failed keeps its original URI.
+  if(!outModel.images.empty() && !snapshot.binary && !snapshot.imageSearchPaths.empty())
+  {
+    const ImageExportPlan plan = planImageExport(outModel, snapshot.imageSearchPaths, snapshot.requestedFilename.parent_path());
+
+    std::vector<ImageCopyOutcome> outcomes;
+    ImageCopyControl              control;
+    if(progress)
+    {
+      progress->imagesTotal = static_cast<uint32_t>(plan.copies.size());
+      control.cancel        = &progress->cancel;
+      control.completed     = &progress->imagesCompleted;
+    }
+    const ImageCopyStats stats = copyImages(plan.copies, snapshot.imageSaveConcurrency, &outcomes, control);
+
+    if(cancelled(progress))
+    {
+      LOGI("%sSave cancelled\n", st.indent().c_str());
+      return SceneSaveStatus::eCancelled;
+    }
+
+    for(size_t i = 0; i < outModel.images.size(); i++)
+    {
+      if(plan.uris[i].empty())
+        continue;
+      if(plan.copyJob[i] >= 0 && outcomes[plan.copyJob[i]] == ImageCopyOutcome::eFailed)
+      {
+        LOGW("%sError copying image: %s\n", st.indent().c_str(), outModel.images[i].uri.c_str());
+        continue;
+      }
+      outModel.images[i].uri = plan.uris[i];
+    }
+    if(stats.copied > 0 || stats.reused > 0)
+      LOGI("%sImages copied: %u, unchanged: %u\n", st.indent().c_str(), stats.copied, stats.reused);
+  }
+
+  // Append generator tag if not already present
+  constexpr const char* generatorPrefix = "NVIDIA vk_gltf_renderer";
+  if(outModel.asset.generator.find(generatorPrefix) == std::string::npos)
+  {
+    if(!outModel.asset.generator.empty())
+      outModel.asset.generator += " + ";
+    outModel.asset.generator += std::string(generatorPrefix) + " " APP_VERSION_STRING;
+  }
+
+  // Reconcile top-level extensionsUsed / extensionsRequired with what the model actually
+  // contains, so the written asset complies with the glTF 2.0 "Specifying Extensions" rules
+  // (tinygltf writes these arrays verbatim). This prunes stale entries left by edits/merges
+  // and adds any extension that became used since load.
+  tinygltf::utils::syncExtensionsUsed(outModel);
+
+  // Last chance to cancel: the write itself is not interruptible
+  if(cancelled(progress))
+  {
+    LOGI("%sSave cancelled\n", st.indent().c_str());
+    return SceneSaveStatus::eCancelled;
+  }
+
+  // Save the glTF file. A .glb is streamed to disk (see gltf_glb_writer.hpp) instead of being
+  // assembled in memory by tinygltf, unless it uses buffer-view extensions the writer can't rebase.
+  const bool        binary           = snapshot.binary;
+  const std::string saveFilenameUtf8 = nvutils::utf8FromPath(snapshot.filename);
+  bool              result           = false;
+  if(binary && canStreamGlb(outModel))
+  {
+    std::string error;
+    result = writeGlbStreamed(outModel, snapshot.filename, &error, snapshot.payloads);
+    if(!result)
+      LOGE("%sError writing %s: %s\n", st.indent().c_str(), saveFilenameUtf8.c_str(), error.c_str());
+  }
+  else
+  {
+    // tinygltf assembles the file from the model: it gets its own copy of the buffer data, and the
+    // scene its buffers back right away
+    if(snapshot.payloads)
+    {
+      for(size_t i = 0; i < outModel.buffers.size(); i++)
+        outModel.buffers[i].data = snapshot.payloads->buffers[i].data;
+      snapshot.payloads = nullptr;
+      snapshot.payloadLease.reset();
+    }
+    tinygltf::TinyGLTF tcontext;
+    result = tcontext.WriteGltfSceneToFile(&outModel, saveFilenameUtf8, binary, binary, true, binary);
+    if(!result)
+      LOGE("%sError writing %s\n", st.indent().c_str(), saveFilenameUtf8.c_str());
+  }
+  if(!result)
+    return SceneSaveStatus::eFailed;
+
+  LOGI("%sSaved: %s\n", st.indent().c_str(), saveFilenameUtf8.c_str());
+  if(progress)
+    progress->written = true;
+  return SceneSaveStatus::eSaved;
+}
+
+}  // namespace
+
+SceneSaveStatus writeSceneSnapshot(SceneSaveSnapshot& snapshot, SceneSaveProgress* progress)
+{
+  const SceneSaveStatus status = writeSnapshot(snapshot, progress);
+  snapshot.payloads = nullptr;
+  snapshot.payloadLease.reset();  // The scene may change its buffers again
+  return status;
+}
+
+//--------------------------------------------------------------------------------------------------
+// The worker moves the snapshot in and publishes its Result before clearing m_running.
+AsyncSceneSave::~AsyncSceneSave()
+{
+  wait();
+}
+
+bool AsyncSceneSave::start(SceneSaveSnapshot&& snapshot)
+{
+  if(m_running.load())
+    return false;
+  wait();  // The previous, finished task
+
+  {
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    m_result.reset();
+  }
+  m_progress.reset();
+  m_running = true;
+
+  // std::function needs a copyable callable: the snapshot is moved into a shared_ptr
+  auto shared = std::make_shared<SceneSaveSnapshot>(std::move(snapshot));
+  m_task      = TaskScheduler::shared().submit(
+      [this, shared]() {
+        Result result;
+        result.filename = shared->filename;
+        result.status   = writeSceneSnapshot(*shared, &m_progress);
+        {
+          std::lock_guard<std::mutex> lock(m_resultMutex);
+          m_result = std::move(result);
+        }
+        m_running = false;
+      },
+      {.name = "Save scene", .priority = TaskPriority::eBackground});
+  return true;
+}
+
+void AsyncSceneSave::wait()
+{
+  TaskScheduler::shared().wait(m_task);
+}
+
+std::optional<AsyncSceneSave::Result> AsyncSceneSave::takeResult()
+{
+  std::lock_guard<std::mutex> lock(m_resultMutex);
+  std::optional<Result>       result = std::move(m_result);
+  m_result.reset();
+  return result;
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <tinygltf/tiny_gltf.h>
+
+#include "task_scheduler.hpp"
+
+namespace nvvkgltf {
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::SavePayloadReaders
+
+>  Counts the save snapshots that read the buffer data of a live model.
+
+A Scene owns one. Scene::makeSaveSnapshot() takes a lease with acquire(); the writer drops it once
+the file is written. Code that changes the buffers of the scene calls wait() first
+(Scene::waitForSaves()), so a running save never sees them move.
+
+ -------------------------------------------------------------------------------------------------*/
+class SavePayloadReaders : public std::enable_shared_from_this<SavePayloadReaders>
+{
+public:
+  // Held by the snapshot; the count drops when the last copy goes
+  [[nodiscard]] std::shared_ptr<void> acquire();
+  void                                wait();  // Until no lease is left
+  [[nodiscard]] bool                  busy() const;
+
+private:
+  void release();
+
+  mutable std::mutex      m_mutex;
+  std::condition_variable m_released;
+  uint32_t                m_leases = 0;
+};
+
+/*-------------------------------------------------------------------------------------------------
+# struct nvvkgltf::SceneSaveSnapshot
+
+>  Everything Scene::save writes, detached from the live scene.
+
+Made by Scene::makeSaveSnapshot() on the thread that owns the scene (validation, external-asset
+transform, model copy); written by writeSceneSnapshot() on any thread. Edits made to the scene
+after the snapshot never reach the file.
+
+Only the JSON level of the model is copied. The buffer data (and the pixels of images stored in
+buffer views, which tinygltf doesn't write) are left out: the writer reads the buffers from the
+live model through `payloads`, and `payloadLease` keeps the scene from changing them until it is
+done. The streamed .glb writer reads them in place; the tinygltf path (.gltf, or a .glb the
+streamed writer can't represent) copies them on the writing thread. Scenes with external assets
+are transformed before writing, so their snapshot holds a full copy and `payloads` is null.
+
+ -------------------------------------------------------------------------------------------------*/
+struct SceneSaveSnapshot
+{
+  tinygltf::Model                    model;
+  const tinygltf::Model*             payloads = nullptr;  // Buffer data source when `model` has none
+  std::shared_ptr<void>              payloadLease;        // SavePayloadReaders::acquire(), dropped once written
+  std::filesystem::path              requestedFilename;   // As given: referenced images are copied next to it
+  std::filesystem::path              filename;            // Written file (.gltf unless .glb was requested)
+  bool                               binary = false;
+  std::vector<std::filesystem::path> imageSearchPaths;
+  uint32_t                           imageSaveConcurrency = 8;
+};
+
+// Progress and cancellation of writeSceneSnapshot(), shared with the thread running it
+struct SceneSaveProgress
+{
+  std::atomic<uint32_t> imagesTotal{0};      // Image files to copy
+  std::atomic<uint32_t> imagesCompleted{0};  // Copies finished (written, reused or failed)
+  std::atomic<bool>     written{false};      // The glTF file was written
+  std::atomic<bool>     cancel{false};       // Checked between image copies and before serialization
+
+  // 0..1: the image copies take the first half, serialization and the file write the second
+  [[nodiscard]] float fraction() const;
+  void                reset();
+};
+
+enum class SceneSaveStatus : uint8_t
+{
+  eSaved,
+  eFailed,
+  eCancelled,
+};
+
+// Copy the referenced images, stamp the generator, reconcile extensionsUsed and write the file.
+// The snapshot's model is modified (URIs, generator); nothing else is touched. The payload lease is
+// dropped before returning.
+SceneSaveStatus writeSceneSnapshot(SceneSaveSnapshot& snapshot, SceneSaveProgress* progress = nullptr);
+
+/*-------------------------------------------------------------------------------------------------
+# class nvvkgltf::AsyncSceneSave
+
+>  Runs writeSceneSnapshot() as an eBackground task of the shared scheduler, one save at a time.
+
+The owner polls takeResult() (e.g. once per frame) and, on eSaved, calls Scene::onSaved() on
+its own thread. The destructor waits for a running save.
+
+ -------------------------------------------------------------------------------------------------*/
+class AsyncSceneSave
+{
+public:
+  struct Result
+  {
+    SceneSaveStatus       status = SceneSaveStatus::eFailed;
+    std::filesystem::path filename;  // SceneSaveSnapshot::filename
+  };
+
+  AsyncSceneSave() = default;
+  ~AsyncSceneSave();
+  AsyncSceneSave(const AsyncSceneSave&)            = delete;
+  AsyncSceneSave& operator=(const AsyncSceneSave&) = delete;
+
+  // Start writing the snapshot; false (snapshot dropped) if a save is still running
+  bool start(SceneSaveSnapshot&& snapshot);
+
+  [[nodiscard]] bool  isRunning() const { return m_running.load(); }
+  [[nodiscard]] float progress() const { return m_progress.fraction(); }
+  void                cancel() { m_progress.cancel = true; }
+  void                wait();
+
+  // The result of the finished save, once
+  [[nodiscard]] std::optional<Result> takeResult();
+
+private:
+  TaskHandle            m_task;  // eBackground on the shared scheduler
+  std::atomic<bool>     m_running{false};
+  SceneSaveProgress     m_progress;
+  std::mutex            m_resultMutex;
+  std::optional<Result> m_result;
+};
+
+}  // namespace nvvkgltf
@@ -27,6 +27,7 @@
 
 #include "gltf_scene_transform_vk.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cstring>
@@ -41,7 +42,8 @@
 // ShaderIO struct definitions for the GPU transform path (push constants, SSBO layouts).
 #include "shaders/world_matrix_io.h.slang"
 
-// Pre-compiled compute shaders (SPIR-V) for the three stages of the GPU transform path.
+// Pre-compiled compute shaders (SPIR-V) for the stages of the GPU transform path.
+#include "_autogen/node_animation.comp.slang.h"
 #include "_autogen/snapshot_prev_transforms.comp.slang.h"
 #include "_autogen/update_render_instances.comp.slang.h"
 #include "_autogen/world_matrix_propagate.comp.slang.h"
@@ -56,45 +58,33 @@ namespace {
 constexpr VkBufferUsageFlags kSsboUsage = VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT;
 constexpr const char* kMemCategoryGraph    = "Xform/Graph";
 constexpr const char* kMemCategoryMatrices = "Xform/Matrices";
+constexpr const char* kMemCategoryAnim     = "Xform/Animation";
 
 // Build a per-render-node array of GPU instance-local matrices (identity for nodes without one).
+// Instance i of a batch is render node firstRenderNode + i.
 static void fillPerRenderNodeInstanceLocals(const Scene& scn, std::vector<glm::mat4>& out)
 {
-  const auto& rns    = scn.getRenderNodes();
-  const auto& reg    = scn.getRenderNodeRegistry();
   const auto& gpuMap = scn.getGpuInstanceLocalMatrices();
-  out.assign(rns.size(), glm::mat4(1.f));
+  out.assign(scn.getRenderNodes().size(), glm::mat4(1.f));
 
-  for(size_t i = 0; i < rns.size(); ++i)
+  for(const InstanceBatch& batch : scn.getRenderNodeRegistry().getInstanceBatches())
   {
-    int nodeID = rns[i].refNodeID;
-    if(nodeID < 0)
+    auto it = gpuMap.find(batch.nodeID);
+    if(it == gpuMap.end() || it->second.size() < size_t(batch.instanceCount))
       continue;
-    auto it = gpuMap.find(nodeID);
-    if(it == gpuMap.end() || it->second.empty())
-      continue;
-
-    const auto& rnList = reg.getRenderNodesForNode(nodeID);
-    for(size_t k = 0; k < rnList.size(); ++k)
-    {
-      if(rnList[k] == static_cast<int>(i))
-      {
-        out[i] = it->second[k % it->second.size()];
-        break;
-      }
-    }
+    std::copy_n(it->second.begin(), batch.instanceCount, out.begin() + batch.firstRenderNode);
   }
 }
 
 //--------------------------------------------------------------------------------------------------
-// Pack one CPU RenderNode into the SSBO layout consumed by update_render_instances.comp (material/prim IDs).
+// Pack one CPU render node into the SSBO layout consumed by update_render_instances.comp (material/prim IDs).
 //--------------------------------------------------------------------------------------------------
-static void fillRenderNodeGpuMapping(shaderio::RenderNodeGpuMapping& out, const nvvkgltf::RenderNode& rn)
+static void fillRenderNodeGpuMapping(shaderio::RenderNodeGpuMapping& out, const nvvkgltf::RenderNodeArrays& rns, size_t index)
 {
-  out.nodeID       = rn.refNodeID;
+  out.nodeID       = rns.refNodeIDs()[index];
   out.pad0         = 0;
-  out.materialID   = rn.materialID;
-  out.renderPrimID = rn.renderPrimID;
+  out.materialID   = rns.materialIDs()[index];
+  out.renderPrimID = rns.renderPrimIDs()[index];
 }
 
 }  // namespace
@@ -103,7 +93,9 @@ static void fillRenderNodeGpuMapping(shaderio::RenderNodeGpuMapping& out, const
 // Returns true when the fast GPU transform path can replace the full CPU upload.
 // Requires: initialized GPU buffers, only node transforms dirty (no material or structural changes),
 // and a valid TLAS instance array matching the current render-node count.
-bool canUseGpuTransformPath(const TransformComputeVk& tc, const Scene& scn, const SceneRtx& rtx)
+// With gpuNodeAnimation the animated local matrices are evaluated on the GPU, so the frame may have
+// no CPU-dirty node at all.
+bool canUseGpuTransformPath(const TransformComputeVk& tc, const Scene& scn, const SceneRtx& rtx, bool gpuNodeAnimation)
 {
   if(!tc.isInitialized() || !tc.hasSceneGpuBuffers())
     return false;
@@ -111,7 +103,7 @@ bool canUseGpuTransformPath(const TransformComputeVk& tc, const Scene& scn, cons
   const auto& df = scn.getDirtyFlags();
   if(df.primitivesChanged || df.allRenderNodesDirty)
     return false;
-  if(df.nodes.empty())
+  if(df.nodes.empty() && !gpuNodeAnimation)
     return false;
   if(!df.materials.empty())
     return false;
@@ -151,8 +143,8 @@ void TransformComputeVk::deinit()
 }
 
 //--------------------------------------------------------------------------------------------------
-// Create the two compute pipelines (world-matrix propagation and render-instance update).
-// Both use push constants only (no descriptor sets); buffer addresses are passed via BDA.
+// Create the compute pipelines (world-matrix propagation, render-instance update, previous-transform
+// snapshot and node-animation evaluation). All use push constants only (no descriptor sets); buffer addresses are passed via BDA.
 void TransformComputeVk::createPipelines()
 {
   VkDevice device = m_alloc->getDevice();
@@ -234,6 +226,32 @@ void TransformComputeVk::createPipelines()
     NVVK_CHECK(vkCreateComputePipelines(device, nullptr, 1, &pipeInfo, nullptr, &m_snapshotPipeline));
     NVVK_DBG_NAME(m_snapshotPipeline);
   }
+
+  // Pipeline 4: Evaluate rigid node animation (TRS keyframes) into the local-matrix buffer.
+  {
+    VkPushConstantRange        pushRange{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                                         .offset     = 0,
+                                         .size       = sizeof(shaderio::EvalNodeAnimationPushConstant)};
+    VkPipelineLayoutCreateInfo layoutInfo{.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+                                          .pushConstantRangeCount = 1,
+                                          .pPushConstantRanges    = &pushRange};
+    NVVK_CHECK(vkCreatePipelineLayout(device, &layoutInfo, nullptr, &m_nodeAnimLayout));
+    NVVK_DBG_NAME(m_nodeAnimLayout);
+
+    VkShaderModuleCreateInfo shaderInfo{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    shaderInfo.codeSize = node_animation_comp_slang_sizeInBytes;
+    shaderInfo.pCode    = node_animation_comp_slang;
+
+    VkComputePipelineCreateInfo pipeInfo{.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    pipeInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeInfo.stage.pName = "main";
+    pipeInfo.stage.pNext = &shaderInfo;
+    pipeInfo.layout      = m_nodeAnimLayout;
+
+    NVVK_CHECK(vkCreateComputePipelines(device, nullptr, 1, &pipeInfo, nullptr, &m_nodeAnimPipeline));
+    NVVK_DBG_NAME(m_nodeAnimPipeline);
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -250,19 +268,25 @@ void TransformComputeVk::destroyPipelines()
     vkDestroyPipeline(device, m_updatePipeline, nullptr);
   if(m_snapshotPipeline)
     vkDestroyPipeline(device, m_snapshotPipeline, nullptr);
+  if(m_nodeAnimPipeline)
+    vkDestroyPipeline(device, m_nodeAnimPipeline, nullptr);
   if(m_propagateLayout)
     vkDestroyPipelineLayout(device, m_propagateLayout, nullptr);
   if(m_updateLayout)
     vkDestroyPipelineLayout(device, m_updateLayout, nullptr);
   if(m_snapshotLayout)
     vkDestroyPipelineLayout(device, m_snapshotLayout, nullptr);
+  if(m_nodeAnimLayout)
+    vkDestroyPipelineLayout(device, m_nodeAnimLayout, nullptr);
 
   m_propagatePipeline = {};
   m_updatePipeline    = {};
   m_snapshotPipeline  = {};
+  m_nodeAnimPipeline  = {};
   m_propagateLayout   = {};
   m_updateLayout      = {};
   m_snapshotLayout    = {};
+  m_nodeAnimLayout    = {};
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -309,6 +333,10 @@ void TransformComputeVk::destroyGpuBuffers()
   m_memoryTracker.untrack(kMemCategoryMatrices, m_bWorldMatrices.allocation);
   m_memoryTracker.untrack(kMemCategoryMatrices, m_bGpuInstLocalMatrices.allocation);
   m_memoryTracker.untrack(kMemCategoryMatrices, m_bPrevRenderNodeO2W.allocation);
+  m_memoryTracker.untrack(kMemCategoryAnim, m_bNodeAnimTargets.allocation);
+  m_memoryTracker.untrack(kMemCategoryAnim, m_bNodeAnimTracks.allocation);
+  m_memoryTracker.untrack(kMemCategoryAnim, m_bNodeAnimKeyTimes.allocation);
+  m_memoryTracker.untrack(kMemCategoryAnim, m_bNodeAnimKeyValues.allocation);
 
   // Capture handles by value, clear members immediately so createGpuBuffers can allocate replacements.
   // Actual vkDestroyBuffer must be deferred while command buffers may still reference the old SSBOs
@@ -320,6 +348,10 @@ void TransformComputeVk::destroyGpuBuffers()
   nvvk::Buffer oldMappings   = m_bRenderNodeMappings;
   nvvk::Buffer oldInstLocals = m_bGpuInstLocalMatrices;
   nvvk::Buffer oldPrevO2W    = m_bPrevRenderNodeO2W;
+  nvvk::Buffer oldAnimTgt    = m_bNodeAnimTargets;
+  nvvk::Buffer oldAnimTrk    = m_bNodeAnimTracks;
+  nvvk::Buffer oldAnimTimes  = m_bNodeAnimKeyTimes;
+  nvvk::Buffer oldAnimValues = m_bNodeAnimKeyValues;
 
   m_bNodeParents          = {};
   m_bTopoNodeOrder        = {};
@@ -328,12 +360,18 @@ void TransformComputeVk::destroyGpuBuffers()
   m_bRenderNodeMappings   = {};
   m_bGpuInstLocalMatrices = {};
   m_bPrevRenderNodeO2W    = {};
+  m_bNodeAnimTargets      = {};
+  m_bNodeAnimTracks       = {};
+  m_bNodeAnimKeyTimes     = {};
+  m_bNodeAnimKeyValues    = {};
 
   m_cachedSceneGraphRevision = 0;
   m_cachedNumRenderNodes     = 0;
   m_cachedNumNodes           = 0;
   m_cachedTopoOrderSize      = 0;
   m_cachedPrevO2WCount       = 0;
+  m_cachedNodeAnimRevision   = 0;
+  m_nodeAnimTargetCount      = 0;
 
   // Deferred cleanup lambda, so buffers are only destroyed after GPU work referencing them has completed.
   nvvk::ResourceAllocator* alloc   = m_alloc;
@@ -345,6 +383,10 @@ void TransformComputeVk::destroyGpuBuffers()
     alloc->destroyBuffer(oldMappings);
     alloc->destroyBuffer(oldInstLocals);
     alloc->destroyBuffer(oldPrevO2W);
+    alloc->destroyBuffer(oldAnimTgt);
+    alloc->destroyBuffer(oldAnimTrk);
+    alloc->destroyBuffer(oldAnimTimes);
+    alloc->destroyBuffer(oldAnimValues);
   };
 
   if(m_deferredFree)
@@ -384,12 +426,18 @@ void TransformComputeVk::destroyGpuBuffersImmediate()
   destroyBuf(m_bWorldMatrices, kMemCategoryMatrices);
   destroyBuf(m_bGpuInstLocalMatrices, kMemCategoryMatrices);
   destroyBuf(m_bPrevRenderNodeO2W, kMemCategoryMatrices);
+  destroyBuf(m_bNodeAnimTargets, kMemCategoryAnim);
+  destroyBuf(m_bNodeAnimTracks, kMemCategoryAnim);
+  destroyBuf(m_bNodeAnimKeyTimes, kMemCategoryAnim);
+  destroyBuf(m_bNodeAnimKeyValues, kMemCategoryAnim);
 
   m_cachedSceneGraphRevision = 0;
   m_cachedNumRenderNodes     = 0;
   m_cachedNumNodes           = 0;
   m_cachedTopoOrderSize      = 0;
   m_cachedPrevO2WCount       = 0;
+  m_cachedNodeAnimRevision   = 0;
+  m_nodeAnimTargetCount      = 0;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -419,7 +467,7 @@ void TransformComputeVk::createGpuBuffers(nvvk::StagingUploader& staging, const
   const auto&                                 rns = scn.getRenderNodes();
   for(size_t i = 0; i < numRenderNodes; ++i)
   {
-    fillRenderNodeGpuMapping(mappings[i], rns[i]);
+    fillRenderNodeGpuMapping(mappings[i], rns, i);
   }
 
   NVVK_CHECK(m_alloc->createBuffer(m_bRenderNodeMappings, std::span(mappings).size_bytes(), kSsboUsage));
@@ -457,6 +505,56 @@ void TransformComputeVk::createGpuBuffers(nvvk::StagingUploader& staging, const
   m_cachedTopoOrderSize      = topoOrder.size();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Upload the keyframe table of a GPU-played animation. Only runs when the table revision changes
+// (animation switched, re-parsed or invalidated by an edit); the buffers are then reused every frame.
+void TransformComputeVk::uploadNodeAnimation(nvvk::StagingUploader& staging, const NodeAnimationTable& anim, uint64_t animRevision)
+{
+  if(animRevision == m_cachedNodeAnimRevision && m_bNodeAnimTargets.buffer != VK_NULL_HANDLE)
+    return;
+
+  nvvk::ResourceAllocator* alloc     = m_alloc;
+  nvvk::Buffer             oldBufs[] = {m_bNodeAnimTargets, m_bNodeAnimTracks, m_bNodeAnimKeyTimes, m_bNodeAnimKeyValues};
+  for(const nvvk::Buffer& b : oldBufs)
+    m_memoryTracker.untrack(kMemCategoryAnim, b.allocation);
+  auto cleanup = [=]() mutable {
+    for(nvvk::Buffer& b : oldBufs)
+      alloc->destroyBuffer(b);
+  };
+  if(m_deferredFree)
+    m_deferredFree(std::move(cleanup));
+  else
+  {
+    if(m_graphicsQueue)
+      vkQueueWaitIdle(m_graphicsQueue);
+    else
+      vkDeviceWaitIdle(m_alloc->getDevice());
+    cleanup();
+  }
+
+  NVVK_CHECK(m_alloc->createBuffer(m_bNodeAnimTargets, std::span(anim.targets).size_bytes(), kSsboUsage));
+  NVVK_CHECK(m_alloc->createBuffer(m_bNodeAnimTracks, std::span(anim.tracks).size_bytes(), kSsboUsage));
+  NVVK_CHECK(m_alloc->createBuffer(m_bNodeAnimKeyTimes, std::span(anim.keyTimes).size_bytes(), kSsboUsage));
+  NVVK_CHECK(m_alloc->createBuffer(m_bNodeAnimKeyValues, std::span(anim.keyValues).size_bytes(), kSsboUsage));
+  NVVK_CHECK(staging.appendBuffer(m_bNodeAnimTargets, 0, std::span(anim.targets)));
+  NVVK_CHECK(staging.appendBuffer(m_bNodeAnimTracks, 0, std::span(anim.tracks)));
+  NVVK_CHECK(staging.appendBuffer(m_bNodeAnimKeyTimes, 0, std::span(anim.keyTimes)));
+  NVVK_CHECK(staging.appendBuffer(m_bNodeAnimKeyValues, 0, std::span(anim.keyValues)));
+
+  NVVK_DBG_NAME(m_bNodeAnimTargets.buffer);
+  NVVK_DBG_NAME(m_bNodeAnimTracks.buffer);
+  NVVK_DBG_NAME(m_bNodeAnimKeyTimes.buffer);
+  NVVK_DBG_NAME(m_bNodeAnimKeyValues.buffer);
+
+  m_memoryTracker.track(kMemCategoryAnim, m_bNodeAnimTargets.allocation);
+  m_memoryTracker.track(kMemCategoryAnim, m_bNodeAnimTracks.allocation);
+  m_memoryTracker.track(kMemCategoryAnim, m_bNodeAnimKeyTimes.allocation);
+  m_memoryTracker.track(kMemCategoryAnim, m_bNodeAnimKeyValues.allocation);
+
+  m_cachedNodeAnimRevision = animRevision;
+  m_nodeAnimTargetCount    = static_cast<uint32_t>(anim.targets.size());
+}
+
 //--------------------------------------------------------------------------------------------------
 // Record the full GPU transform update into `cmd`:
 //   1. Upload dirty (or all) local matrices via the staging uploader.
@@ -464,9 +562,44 @@ void TransformComputeVk::createGpuBuffers(nvvk::StagingUploader& staging, const
 //   3. Phase 2 — write render-node SSBO + TLAS instance transforms (BLAS ref preserved on GPU).
 //      RenderNodeGpuMapping is refreshed only in createGpuBuffers when getSceneGraphRevision() changes
 //      (parseScene(), variant-driven material IDs, etc.).
-//   4. TLAS in-place update from the instance buffer (cmdUpdateTlasFromInstanceBuffer).
-//   5. If tlasVisibilityNeedsCpuSync — syncTopLevelAS refreshes instance BLAS refs from CPU Scene.
-void TransformComputeVk::dispatchTransformUpdate(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk, SceneRtx& scnRtx)
+//   4. beforeTlasUpdate, if set (batched skinning with GPU joint palettes, BLAS refit).
+//   5. TLAS in-place update from the instance buffer (cmdUpdateTlasFromInstanceBuffer).
+//   6. If tlasVisibilityNeedsCpuSync — syncTopLevelAS refreshes instance BLAS refs from CPU Scene.
+void TransformComputeVk::dispatchTransformUpdate(VkCommandBuffer             cmd,
+                                                 nvvk::StagingUploader&      staging,
+                                                 Scene&                      scn,
+                                                 const SceneVk&              scnVk,
+                                                 SceneRtx&                   scnRtx,
+                                                 const BeforeTlasUpdateFunc& beforeTlasUpdate)
+{
+  recordTransformUpdate(cmd, staging, scn, scnVk, scnRtx, nullptr, 0, 0.0f, beforeTlasUpdate);
+}
+
+//--------------------------------------------------------------------------------------------------
+// GPU animation playback: as dispatchTransformUpdate, with node_animation.comp writing the local
+// matrices of the animated nodes between the upload and the propagation. Edited (CPU-dirty) nodes
+// are still uploaded first; the animation then overrides the animated ones, as on the CPU path.
+void TransformComputeVk::dispatchAnimatedTransformUpdate(VkCommandBuffer           cmd,
+                                                         nvvk::StagingUploader&    staging,
+                                                         Scene&                    scn,
+                                                         const SceneVk&            scnVk,
+                                                         SceneRtx&                 scnRtx,
+                                                         const NodeAnimationTable& anim,
+                                                         uint64_t                  animRevision,
+                                                         float                     time)
+{
+  recordTransformUpdate(cmd, staging, scn, scnVk, scnRtx, &anim, animRevision, time, {});
+}
+
+void TransformComputeVk::recordTransformUpdate(VkCommandBuffer             cmd,
+                                               nvvk::StagingUploader&      staging,
+                                               Scene&                      scn,
+                                               const SceneVk&              scnVk,
+                                               SceneRtx&                   scnRtx,
+                                               const NodeAnimationTable*   anim,
+                                               uint64_t                    animRevision,
+                                               float                       time,
+                                               const BeforeTlasUpdateFunc& beforeTlasUpdate)
 {
   if(!m_alloc)
     return;
@@ -508,9 +641,34 @@ void TransformComputeVk::dispatchTransformUpdate(VkCommandBuffer cmd, nvvk::Stag
     }
   }
 
+  const bool evalAnimation = (anim != nullptr) && !anim->empty();
+  if(evalAnimation)
+    uploadNodeAnimation(staging, *anim, animRevision);
+
   staging.cmdUploadAppended(cmd);
   nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
-                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT);
+
+  // Phase 0 (GPU animation only): evaluate the animated nodes' local matrices at `time`.
+  if(evalAnimation)
+  {
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_nodeAnimPipeline);
+
+    shaderio::EvalNodeAnimationPushConstant apc{};
+    apc.targets       = reinterpret_cast<shaderio::NodeAnimTarget*>(m_bNodeAnimTargets.address);
+    apc.tracks        = reinterpret_cast<shaderio::NodeAnimTrack*>(m_bNodeAnimTracks.address);
+    apc.keyTimes      = reinterpret_cast<float*>(m_bNodeAnimKeyTimes.address);
+    apc.keyValues     = reinterpret_cast<glm::vec4*>(m_bNodeAnimKeyValues.address);
+    apc.localMatrices = reinterpret_cast<glm::mat4*>(m_bLocalMatrices.address);
+    apc.targetCount   = m_nodeAnimTargetCount;
+    apc.time          = time;
+
+    vkCmdPushConstants(cmd, m_nodeAnimLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(apc), &apc);
+    vkCmdDispatch(cmd, (m_nodeAnimTargetCount + NODE_ANIMATION_WORKGROUP_SIZE - 1) / NODE_ANIMATION_WORKGROUP_SIZE, 1, 1);
+
+    nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                           VK_ACCESS_2_SHADER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+  }
 
   // Phase 1: propagate world matrices per topological level.
   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, m_propagatePipeline);
@@ -558,6 +716,14 @@ void TransformComputeVk::dispatchTransformUpdate(VkCommandBuffer cmd, nvvk::Stag
   vkCmdPushConstants(cmd, m_updateLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(upc), &upc);
   vkCmdDispatch(cmd, static_cast<uint32_t>((numRenderNodes + WORLD_MATRIX_WORKGROUP_SIZE - 1) / WORLD_MATRIX_WORKGROUP_SIZE), 1, 1);
 
+  // Caller work that needs this frame's world matrices and must land before the TLAS update (skinning + BLAS)
+  if(beforeTlasUpdate)
+  {
+    nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                           VK_ACCESS_2_SHADER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+    beforeTlasUpdate(cmd, m_bWorldMatrices.address);
+  }
+
   scnRtx.cmdUpdateTlasFromInstanceBuffer(cmd);
 
   if(df.tlasVisibilityNeedsCpuSync)
@@ -586,6 +752,8 @@ void TransformComputeVk::dispatchTransformUpdate(VkCommandBuffer cmd, nvvk::Stag
 
   df.renderNodesVk.clear();
   df.renderNodesRtx.clear();
+  df.allRenderNodesVk  = false;
+  df.allRenderNodesRtx = false;
 }
 
 //--------------------------------------------------------------------------------------------------
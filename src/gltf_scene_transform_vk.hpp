@@ -22,6 +22,12 @@ The three-step GPU pipeline
 1. Upload dirty locals
 Every frame, only the changed local matrices are uploaded (sparse patch). If markGpuStale() was called (e.g. after a CPU-side upload), all matrices are re-uploaded.
 
+1b. Evaluate node animation — node_animation.comp (dispatchAnimatedTransformUpdate only)
+For rigid animations (translation/rotation/scale channels only), the keyframe table is uploaded once and
+one thread per animated node writes its local matrix at the current time, so the CPU neither evaluates
+channels nor uploads the animated locals. The model's node TRS are only caught up on demand
+(AnimationSystem::syncGpuNodeAnimationToCpu).
+
 2. Propagate world matrices — world_matrix_propagate.comp
 The scene graph is pre-sorted in BFS (breadth-first) topological order, level by level. The shader runs one dispatch per level:
 
@@ -42,6 +48,9 @@ CPU writes once (at load / topo change):
   RenderNodeMappings[]   — which node/material/prim each RenderNode points to
   InstLocalMatrices[]    — extra local offset (KHR_mesh_gpu_instancing)
 
+CPU writes once per animation (GPU node animation):
+  NodeAnim*[]            — targets, tracks, key times and values (NodeAnimationTable)
+
 CPU patches each frame:
   LocalMatrices[]        — dirty node local matrices
 
@@ -58,7 +67,7 @@ init()                    — create the 3 compute pipelines
   │
   ├─ [every frame]
   │   ├─ cmdSnapshotPrevObjectToWorld()   — DLSS: save prev transforms
-  │   └─ dispatchTransformUpdate()        — (1,2,3) + TLAS rebuild
+  │   └─ dispatchTransformUpdate()        — (1,2,3) + [beforeTlasUpdate: skinning, BLAS] + TLAS rebuild
   │
   └─ deinit()             — vkDeviceWaitIdle → destroy everything
 */
@@ -67,10 +76,12 @@ init()                    — create the 3 compute pipelines
 #pragma once
 
 #include <cstdint>
+#include <functional>
 
 #include <nvvk/resource_allocator.hpp>
 #include <nvvk/staging.hpp>
 
+#include "gltf_node_animation.hpp"
 #include "gltf_scene.hpp"
 #include "gltf_scene_vk.hpp"
 #include "gltf_scene_rtx.hpp"
@@ -81,7 +92,8 @@ namespace nvvkgltf {
 class TransformComputeVk;
 
 // Returns true when transform-only GPU path is valid (no structural/material-RTX changes this frame).
-[[nodiscard]] bool canUseGpuTransformPath(const TransformComputeVk& tc, const Scene& scn, const SceneRtx& rtx);
+// With gpuNodeAnimation, animated locals come from the GPU, so no CPU-dirty node is required.
+[[nodiscard]] bool canUseGpuTransformPath(const TransformComputeVk& tc, const Scene& scn, const SceneRtx& rtx, bool gpuNodeAnimation = false);
 
 class TransformComputeVk
 {
@@ -107,7 +119,27 @@ public:
   // Call when the renderer used the CPU upload path — next GPU frame must re-upload all locals.
   void markGpuStale();
 
-  void dispatchTransformUpdate(VkCommandBuffer cmd, nvvk::StagingUploader& staging, Scene& scn, const SceneVk& scnVk, SceneRtx& scnRtx);
+  // Recorded after the world matrices are propagated and before the TLAS update, with the device address
+  // of the world-matrix buffer: GPU skinning palettes and BLAS refits go here (see updateAnimation).
+  using BeforeTlasUpdateFunc = std::function<void(VkCommandBuffer cmd, VkDeviceAddress worldMatrices)>;
+
+  void dispatchTransformUpdate(VkCommandBuffer             cmd,
+                               nvvk::StagingUploader&      staging,
+                               Scene&                      scn,
+                               const SceneVk&              scnVk,
+                               SceneRtx&                   scnRtx,
+                               const BeforeTlasUpdateFunc& beforeTlasUpdate = {});
+
+  // Same as dispatchTransformUpdate, with the local matrices of the animated nodes evaluated on the GPU
+  // from `anim` at `time`. The table is (re)uploaded only when animRevision changes.
+  void dispatchAnimatedTransformUpdate(VkCommandBuffer           cmd,
+                                       nvvk::StagingUploader&    staging,
+                                       Scene&                    scn,
+                                       const SceneVk&            scnVk,
+                                       SceneRtx&                 scnRtx,
+                                       const NodeAnimationTable& anim,
+                                       uint64_t                  animRevision,
+                                       float                     time);
 
   // DLSS instance motion vectors: snapshot the current render-node objectToWorld matrices
   void cmdSnapshotPrevObjectToWorld(VkCommandBuffer cmd, const SceneVk& scnVk, size_t numRenderNodes);
@@ -115,6 +147,9 @@ public:
   // Device address of the previous-frame objectToWorld buffer (0 if not yet allocated).
   [[nodiscard]] VkDeviceAddress prevObjectToWorldAddress() const { return m_bPrevRenderNodeO2W.address; }
 
+  // Device address of the node world matrices (valid after this frame's dispatch*TransformUpdate).
+  [[nodiscard]] VkDeviceAddress worldMatricesAddress() const { return m_bWorldMatrices.address; }
+
   [[nodiscard]] bool isInitialized() const { return m_alloc != nullptr; }
   [[nodiscard]] bool hasSceneGpuBuffers() const { return m_bLocalMatrices.buffer != VK_NULL_HANDLE; }
 
@@ -126,6 +161,16 @@ private:
   void destroyPipelines();
   bool ensureGpuBuffersMatchScene(nvvk::StagingUploader& staging, const Scene& scn);
   void destroyGpuBuffersImmediate();
+  void uploadNodeAnimation(nvvk::StagingUploader& staging, const NodeAnimationTable& anim, uint64_t animRevision);
+  void recordTransformUpdate(VkCommandBuffer             cmd,
+                             nvvk::StagingUploader&      staging,
+                             Scene&                      scn,
+                             const SceneVk&              scnVk,
+                             SceneRtx&                   scnRtx,
+                             const NodeAnimationTable*   anim,
+                             uint64_t                    animRevision,
+                             float                       time,
+                             const BeforeTlasUpdateFunc& beforeTlasUpdate);
 
   nvvk::ResourceAllocator*  m_alloc = nullptr;
   SceneVk::DeferredFreeFunc m_deferredFree;
@@ -139,9 +184,11 @@ private:
   VkPipeline       m_propagatePipeline{};
   VkPipeline       m_updatePipeline{};
   VkPipeline       m_snapshotPipeline{};
+  VkPipeline       m_nodeAnimPipeline{};
   VkPipelineLayout m_propagateLayout{};
   VkPipelineLayout m_updateLayout{};
   VkPipelineLayout m_snapshotLayout{};
+  VkPipelineLayout m_nodeAnimLayout{};
 
   nvvk::Buffer m_bNodeParents;         // Node parents (node index -> parent index)
   nvvk::Buffer m_bTopoNodeOrder;       // Topological node order (node index -> topological node index)
@@ -150,6 +197,14 @@ private:
   nvvk::Buffer m_bRenderNodeMappings;  // Render node mappings (render node index -> node index)
   nvvk::Buffer m_bGpuInstLocalMatrices;  // GPU instance local matrices (instance index -> local matrix) KHR_mesh_gpu_instancing
 
+  // GPU node animation keyframe table (uploaded once per NodeAnimationTable revision).
+  nvvk::Buffer m_bNodeAnimTargets;
+  nvvk::Buffer m_bNodeAnimTracks;
+  nvvk::Buffer m_bNodeAnimKeyTimes;
+  nvvk::Buffer m_bNodeAnimKeyValues;
+  uint64_t     m_cachedNodeAnimRevision = 0;  // 0: no table uploaded
+  uint32_t     m_nodeAnimTargetCount    = 0;
+
   // DLSS instance motion: previous-frame objectToWorld per render node (lazily allocated, DLSS only).
   nvvk::Buffer m_bPrevRenderNodeO2W;
   size_t       m_cachedPrevO2WCount = 0;
@@ -26,7 +26,8 @@
 
 #include "gltf_scene_validator.hpp"
 
-#include <functional>
+#include <array>
+#include <iterator>
 
 #include <fmt/format.h>
 #include <tinygltf/tiny_gltf.h>
@@ -34,6 +35,8 @@
 #include <nvutils/logger.hpp>
 #include <nvutils/timers.hpp>
 
+#include "task_scheduler.hpp"
+
 namespace nvvkgltf {
 
 SceneValidator::SceneValidator(const Scene& scene)
@@ -41,95 +44,157 @@ SceneValidator::SceneValidator(const Scene& scene)
 {
 }
 
+namespace {
+
+// Append `src` after the messages already in `dst`. Used to merge per-check results in a fixed
+// order so the output does not depend on which worker finished first.
+void appendResult(Scene::ValidationResult& dst, Scene::ValidationResult&& src)
+{
+  dst.errors.insert(dst.errors.end(), std::make_move_iterator(src.errors.begin()), std::make_move_iterator(src.errors.end()));
+  dst.warnings.insert(dst.warnings.end(), std::make_move_iterator(src.warnings.begin()),
+                      std::make_move_iterator(src.warnings.end()));
+  dst.valid = dst.valid && src.valid;
+}
+
+// Per-node reference problems, found in parallel and reported serially in node order.
+enum NodeIssue : uint8_t
+{
+  eNodeIssueChild  = 1 << 0,  // Out-of-range or self-referencing child
+  eNodeIssueMesh   = 1 << 1,
+  eNodeIssueCamera = 1 << 2,
+  eNodeIssueSkin   = 1 << 3,
+};
+
+}  // namespace
+
 Scene::ValidationResult SceneValidator::validateModel() const
 {
-  Scene::ValidationResult result;
+  // The checks only read the model and each writes its own result, so they run concurrently and
+  // are merged afterwards in this (declaration) order.
+  using CheckFn = void (SceneValidator::*)(Scene::ValidationResult&) const;
+  static constexpr CheckFn kChecks[] = {
+      &SceneValidator::validateNodes,          &SceneValidator::validateScenes,
+      &SceneValidator::validateAnimations,     &SceneValidator::validateSkins,
+      &SceneValidator::validateMeshReferences, &SceneValidator::validateMaterialReferences,
+      &SceneValidator::validateAccessors,
+  };
+  constexpr size_t kNumChecks = std::size(kChecks);
 
-  validateNodes(result);
-  validateScenes(result);
-  validateAnimations(result);
-  validateSkins(result);
-  validateMeshReferences(result);
-  validateMaterialReferences(result);
+  std::array<Scene::ValidationResult, kNumChecks> partial;
+  nvvkgltf::parallelFor<1>(kNumChecks, [&](uint64_t i) { (this->*kChecks[i])(partial[i]); });
 
+  Scene::ValidationResult result;
+  for(Scene::ValidationResult& p : partial)
+    appendResult(result, std::move(p));
   return result;
 }
 
 void SceneValidator::validateNodes(Scene::ValidationResult& result) const
 {
-  const auto& model = m_scene.getModel();
+  const auto& model    = m_scene.getModel();
+  const int   numNodes = static_cast<int>(model.nodes.size());
 
-  // Check parent-child consistency
-  for(size_t i = 0; i < model.nodes.size(); ++i)
-  {
+  // Reference checks are independent per node: flag them in parallel, then format messages
+  // serially for the (usually zero) flagged nodes so the output order is stable.
+  std::vector<uint8_t> issues(numNodes, 0);
+  nvvkgltf::parallelFor<4096>(numNodes, [&](uint64_t i) {
     const auto& node = model.nodes[i];
-
-    // Validate children indices
+    uint8_t     bits = 0;
     for(int childIdx : node.children)
     {
-      if(childIdx < 0 || childIdx >= static_cast<int>(model.nodes.size()))
-      {
-        result.addError(fmt::format("Node {} has invalid child index {}", i, childIdx));
-      }
+      if(childIdx < 0 || childIdx >= numNodes || childIdx == static_cast<int>(i))
+        bits |= eNodeIssueChild;
+    }
+    if(node.mesh >= static_cast<int>(model.meshes.size()))
+      bits |= eNodeIssueMesh;
+    if(node.camera >= static_cast<int>(model.cameras.size()))
+      bits |= eNodeIssueCamera;
+    if(node.skin >= static_cast<int>(model.skins.size()))
+      bits |= eNodeIssueSkin;
+    issues[i] = bits;
+  });
+
+  for(int i = 0; i < numNodes; ++i)
+  {
+    if(issues[i] == 0)
+      continue;
 
-      // Check for self-reference
-      if(childIdx == static_cast<int>(i))
+    const auto& node = model.nodes[i];
+    if(issues[i] & eNodeIssueChild)
+    {
+      for(int childIdx : node.children)
       {
-        result.addError(fmt::format("Node {} references itself as child", i));
+        if(childIdx < 0 || childIdx >= numNodes)
+          result.addError(fmt::format("Node {} has invalid child index {}", i, childIdx));
+        if(childIdx == i)
+          result.addError(fmt::format("Node {} references itself as child", i));
       }
     }
-
-    // Validate mesh reference
-    if(node.mesh >= 0 && node.mesh >= static_cast<int>(model.meshes.size()))
-    {
+    if(issues[i] & eNodeIssueMesh)
       result.addError(fmt::format("Node {} has invalid mesh index {}", i, node.mesh));
-    }
-
-    // Validate camera reference
-    if(node.camera >= 0 && node.camera >= static_cast<int>(model.cameras.size()))
-    {
+    if(issues[i] & eNodeIssueCamera)
       result.addError(fmt::format("Node {} has invalid camera index {}", i, node.camera));
-    }
+    if(issues[i] & eNodeIssueSkin)
+      result.addError(fmt::format("Node {} has invalid skin index {}", i, node.skin));
+  }
 
-    // Validate skin reference
-    if(node.skin >= 0 && node.skin >= static_cast<int>(model.skins.size()))
+  // Multi-parent check: a glTF node hierarchy must be a forest, so every node is the child of
+  // at most one other node.
+  std::vector<int> parent(numNodes, -1);
+  for(int i = 0; i < numNodes; ++i)
+  {
+    for(int childIdx : model.nodes[i].children)
     {
-      result.addError(fmt::format("Node {} has invalid skin index {}", i, node.skin));
+      if(childIdx < 0 || childIdx >= numNodes || childIdx == i)
+        continue;
+      if(parent[childIdx] >= 0 && parent[childIdx] != i)
+        result.addError(fmt::format("Node {} has multiple parents ({} and {})", childIdx, parent[childIdx], i));
+      else
+        parent[childIdx] = i;
     }
   }
 
-  // Check for cycles in hierarchy
-  std::vector<bool> visited(model.nodes.size(), false);
-  std::vector<bool> inStack(model.nodes.size(), false);
-
-  std::function<bool(int)> hasCycle = [&](int nodeIdx) -> bool {
-    if(inStack[nodeIdx])
-      return true;  // Cycle detected
-    if(visited[nodeIdx])
-      return false;
-
-    visited[nodeIdx] = true;
-    inStack[nodeIdx] = true;
+  // Cycle check: single iterative DFS over all nodes with an explicit stack (no recursion, so
+  // arbitrarily deep hierarchies cannot overflow the call stack). Each node is entered once;
+  // an edge to a node still on the stack closes a cycle. Self-references were reported above.
+  enum : uint8_t
+  {
+    eUnvisited,
+    eOnStack,
+    eDone
+  };
+  std::vector<uint8_t>             state(numNodes, eUnvisited);
+  std::vector<std::pair<int, int>> stack;  // (node, next child slot)
+  for(int root = 0; root < numNodes; ++root)
+  {
+    if(state[root] != eUnvisited)
+      continue;
 
-    const auto& node = model.nodes[nodeIdx];
-    for(int childIdx : node.children)
+    state[root] = eOnStack;
+    stack.emplace_back(root, 0);
+    while(!stack.empty())
     {
-      if(childIdx >= 0 && childIdx < static_cast<int>(model.nodes.size()))
+      auto& [nodeIdx, childSlot] = stack.back();
+      const auto& children       = model.nodes[nodeIdx].children;
+      if(childSlot >= static_cast<int>(children.size()))
       {
-        if(hasCycle(childIdx))
-          return true;
+        state[nodeIdx] = eDone;
+        stack.pop_back();
+        continue;
       }
-    }
-
-    inStack[nodeIdx] = false;
-    return false;
-  };
 
-  for(size_t i = 0; i < model.nodes.size(); ++i)
-  {
-    if(hasCycle(static_cast<int>(i)))
-    {
-      result.addError(fmt::format("Cycle detected in node hierarchy at node {}", i));
+      const int childIdx = children[childSlot++];
+      if(childIdx < 0 || childIdx >= numNodes || childIdx == nodeIdx)
+        continue;
+      if(state[childIdx] == eOnStack)
+      {
+        result.addError(fmt::format("Cycle detected in node hierarchy at node {}", childIdx));
+      }
+      else if(state[childIdx] == eUnvisited)
+      {
+        state[childIdx] = eOnStack;
+        stack.emplace_back(childIdx, 0);  // Invalidates nodeIdx/childSlot; loop re-fetches back()
+      }
     }
   }
 }
@@ -244,6 +309,20 @@ void SceneValidator::validateMeshReferences(Scene::ValidationResult& result) con
       {
         result.addError(fmt::format("Mesh {} primitive {} has invalid material index {}", meshIdx, primIdx, prim.material));
       }
+
+      // Validate accessor references (indices + attributes)
+      if(prim.indices >= static_cast<int>(model.accessors.size()))
+      {
+        result.addError(fmt::format("Mesh {} primitive {} has invalid indices accessor {}", meshIdx, primIdx, prim.indices));
+      }
+      for(const auto& [attribName, accessorIdx] : prim.attributes)
+      {
+        if(accessorIdx < 0 || accessorIdx >= static_cast<int>(model.accessors.size()))
+        {
+          result.addError(fmt::format("Mesh {} primitive {} attribute {} has invalid accessor {}", meshIdx, primIdx,
+                                      attribName, accessorIdx));
+        }
+      }
     }
   }
 }
@@ -272,6 +351,63 @@ void SceneValidator::validateMaterialReferences(Scene::ValidationResult& result)
   }
 }
 
+void SceneValidator::validateAccessors(Scene::ValidationResult& result) const
+{
+  const auto& model = m_scene.getModel();
+
+  // Accessors must lie inside their buffer view, and buffer views inside their buffer. Accessors
+  // without a buffer view (zero-initialized / sparse-only) have nothing to check. Buffers whose
+  // data was not loaded (e.g. meshopt fallback buffers) are skipped for the view range check.
+  for(size_t viewIdx = 0; viewIdx < model.bufferViews.size(); ++viewIdx)
+  {
+    const auto& view = model.bufferViews[viewIdx];
+    if(view.buffer < 0 || view.buffer >= static_cast<int>(model.buffers.size()))
+    {
+      result.addError(fmt::format("BufferView {} has invalid buffer index {}", viewIdx, view.buffer));
+      continue;
+    }
+    const auto& buffer = model.buffers[view.buffer];
+    if(!buffer.data.empty() && view.byteOffset + view.byteLength > buffer.data.size())
+    {
+      result.addError(fmt::format("BufferView {} range [{}, {}) exceeds buffer {} size {}", viewIdx, view.byteOffset,
+                                  view.byteOffset + view.byteLength, view.buffer, buffer.data.size()));
+    }
+  }
+
+  for(size_t accIdx = 0; accIdx < model.accessors.size(); ++accIdx)
+  {
+    const auto& accessor = model.accessors[accIdx];
+    if(accessor.bufferView < 0)
+      continue;
+    if(accessor.bufferView >= static_cast<int>(model.bufferViews.size()))
+    {
+      result.addError(fmt::format("Accessor {} has invalid bufferView index {}", accIdx, accessor.bufferView));
+      continue;
+    }
+    if(accessor.count == 0)
+      continue;
+
+    const int componentSize = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    const int numComponents = tinygltf::GetNumComponentsInType(accessor.type);
+    if(componentSize <= 0 || numComponents <= 0)
+    {
+      result.addError(fmt::format("Accessor {} has invalid component type {} / type {}", accIdx, accessor.componentType,
+                                  accessor.type));
+      continue;
+    }
+
+    const auto&  view        = model.bufferViews[accessor.bufferView];
+    const size_t elementSize = static_cast<size_t>(componentSize) * numComponents;
+    const size_t stride      = view.byteStride ? view.byteStride : elementSize;
+    const size_t required    = accessor.byteOffset + (accessor.count - 1) * stride + elementSize;
+    if(required > view.byteLength)
+    {
+      result.addError(fmt::format("Accessor {} needs {} bytes but bufferView {} has {}", accIdx, required,
+                                  accessor.bufferView, view.byteLength));
+    }
+  }
+}
+
 Scene::ValidationResult SceneValidator::validateBeforeSave() const
 {
   auto result = validateModel();
@@ -29,6 +29,10 @@ namespace nvvkgltf {
   Read-only validation of a Scene's model: validateModel, validateBeforeSave, validateModelExtensions.
   Friend of Scene for access to m_model and m_supportedExtensions. Scene retains forwarding
   wrappers so external call sites are unchanged.
+
+  validateModel runs the independent checks below concurrently (nvvkgltf::parallelFor), each
+  into its own result, and merges them in declaration order so output is deterministic. The node
+  hierarchy check is a single iterative pass (explicit stack), safe on arbitrarily deep trees.
 --------------------------------------------------------------------------------------------------*/
 class SceneValidator
 {
@@ -50,6 +54,7 @@ private:
   void validateSkins(Scene::ValidationResult& result) const;
   void validateMeshReferences(Scene::ValidationResult& result) const;
   void validateMaterialReferences(Scene::ValidationResult& result) const;
+  void validateAccessors(Scene::ValidationResult& result) const;
 };
 
 }  // namespace nvvkgltf
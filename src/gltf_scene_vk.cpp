@@ -51,8 +51,8 @@
 #include "gltf_scene_vk.hpp"
 #include "gltf_scene_animation.hpp"
 #include "gltf_image_loader.hpp"
-#include "nvutils/parallel_work.hpp"
 #include "nvvk/helpers.hpp"
+#include "task_scheduler.hpp"
 
 namespace nvvkgltf {
 namespace {
@@ -83,6 +83,18 @@ constexpr std::string_view kMemCategoryGeometry  = "Geometry";
 constexpr std::string_view kMemCategorySceneData = "SceneData";
 constexpr std::string_view kMemCategoryImages    = "Images";
 
+// Host memory categories (HostMemoryTracker)
+constexpr std::string_view kHostCategoryDecodedImages = "Images/Decoded";
+constexpr std::string_view kHostCategoryMaterials     = "Materials";
+
+uint64_t mipDataBytes(const nvvkgltf::SceneVk::SceneImage& image)
+{
+  uint64_t bytes = 0;
+  for(const std::vector<char>& level : image.mipData)
+    bytes += level.size();
+  return bytes;
+}
+
 // Gets the friendly name of a TinyGLTF image for logs and UIs.
 std::string getImageName(const tinygltf::Image& img, size_t index)
 {
@@ -113,6 +125,48 @@ std::filesystem::path resolveImagePath(const std::filesystem::path& basedir, con
   return basedir / nvutils::pathFromUtf8(uriDecoded);
 }
 
+// Finds the file of an image that is neither embedded nor a data URI in the search paths; empty
+// path otherwise, or when the file can't be found.
+std::filesystem::path findImageFile(const tinygltf::Image& img, const std::vector<std::filesystem::path>& imageSearchPaths)
+{
+  if(img.uri.empty() || img.bufferView >= 0 || (img.uri.size() >= 5 && img.uri.compare(0, 5, "data:") == 0))
+  {
+    return {};
+  }
+
+  std::string uriDecoded;
+  tinygltf::URIDecode(img.uri, &uriDecoded, nullptr);
+  return nvutils::findFile(nvutils::pathFromUtf8(uriDecoded), imageSearchPaths, false);
+}
+
+// Image search paths of the scene, or the folder of the scene file when it has none.
+std::vector<std::filesystem::path> getImageSearchPaths(const nvvkgltf::Scene& scn)
+{
+  std::vector<std::filesystem::path> imageSearchPaths = scn.getImageSearchPaths();
+  if(imageSearchPaths.empty())
+  {
+    std::error_code       ec;
+    std::filesystem::path baseDir = std::filesystem::absolute(scn.getFilename().parent_path(), ec);
+    if(!ec)
+      imageSearchPaths.push_back(baseDir);
+  }
+  return imageSearchPaths;
+}
+
+// Make the geometry uploads visible to the shaders and the acceleration structure builds.
+void cmdGeometryBarrier(VkCommandBuffer cmd, bool rayTracing)
+{
+  VkMemoryBarrier barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  if(rayTracing)
+  {
+    barrier.dstAccessMask |= VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+  }
+  vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0,
+                       nullptr, 0, nullptr);
+}
+
 // Gets the size in bytes of the compressed data of a tinygltf::Image.
 size_t getImageByteSize(const tinygltf::Model& model, const tinygltf::Image& img, const std::filesystem::path& diskPath)
 {
@@ -192,6 +246,13 @@ void nvvkgltf::SceneVk::destroyBufferDeferred(nvvk::Buffer& buf)
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// Material cache measured on demand; decoded images are tracked while createTextureImages() holds them.
+void nvvkgltf::SceneVk::reportHostMemory(HostMemoryTracker& tracker) const
+{
+  tracker.set(kHostCategoryMaterials, m_materialCache.sizeInBytes());
+}
+
 void nvvkgltf::SceneVk::deinit()
 {
   if(!m_alloc)
@@ -227,14 +288,7 @@ void nvvkgltf::SceneVk::create(VkCommandBuffer        cmd,
   m_generateMipmaps   = generateMipmaps;
   m_rayTracingEnabled = enableRayTracing;
 
-  std::vector<std::filesystem::path> imageSearchPaths = scn.getImageSearchPaths();
-  if(imageSearchPaths.empty())
-  {
-    std::error_code       ec;
-    std::filesystem::path baseDir = std::filesystem::absolute(scn.getFilename().parent_path(), ec);
-    if(!ec)
-      imageSearchPaths.push_back(baseDir);
-  }
+  const std::vector<std::filesystem::path> imageSearchPaths = getImageSearchPaths(scn);
 
   uploadMaterials(staging, scn);
   uploadRenderNodes(staging, scn);
@@ -293,14 +347,15 @@ uint32_t nvvkgltf::SceneVk::syncFromScene(nvvk::StagingUploader& staging, nvvkgl
     const auto&        dirty         = df.renderNodesVk;
     const auto&        renderNodes   = scn.getRenderNodes();
     const VkDeviceSize requiredBytes = renderNodes.size() * sizeof(shaderio::GltfRenderNode);
-    const bool         needsUpdate = df.allRenderNodesDirty || !dirty.empty() || m_bRenderNode.buffer == VK_NULL_HANDLE
+    const bool         needsUpdate = df.allRenderNodesDirty || df.renderNodesVkDirty() || m_bRenderNode.buffer == VK_NULL_HANDLE
                              || m_bRenderNode.bufferSize != requiredBytes;
     if(needsUpdate)
     {
-      const bool useFullUpdate = df.allRenderNodesDirty || renderNodes.empty()
+      const bool useFullUpdate = df.allRenderNodesDirty || df.allRenderNodesVk || renderNodes.empty()
                                  || float(dirty.size()) / float(renderNodes.size()) >= fullUpdateRatio;
       uploadRenderNodes(staging, scn, useFullUpdate ? std::unordered_set<int>{} : dirty);
       df.renderNodesVk.clear();
+      df.allRenderNodesVk    = false;
       df.allRenderNodesDirty = false;
       result |= eSyncRenderNodes;
     }
@@ -324,6 +379,48 @@ void nvvkgltf::SceneVk::createGeometry(VkCommandBuffer cmd, nvvk::StagingUploade
   (void)flushSceneDescIfDirty(staging, scn);
 }
 
+//--------------------------------------------------------------------------------------------------
+// True when append() can extend the current resources with what the scene appended: the existing
+// geometry, images and textures line up with the start of the appended ranges. Fails when nothing
+// was created yet, when a placeholder image/texture stands in for an empty array, or when opacity
+// micromaps are in use (they are built for the whole scene at once).
+bool nvvkgltf::SceneVk::canAppend(const nvvkgltf::Scene& scn, const SceneAppendInfo& info) const
+{
+  if(m_bMaterial.buffer == VK_NULL_HANDLE || m_bSceneDesc.buffer == VK_NULL_HANDLE)
+    return false;
+
+  if(m_vertexBuffers.size() != info.renderPrimitives.begin || m_images.size() != info.images.begin
+     || m_textures.size() != info.textures.begin)
+    return false;
+
+  const bool usesOmm = tinygltf::utils::findExtension(scn.getModel().extensions, EXT_MESH_OPACITY_MICROMAP_EXTENSION_NAME) != nullptr;
+  return !(m_rayTracingEnabled && m_sceneOmm.isEnabled() && usesOmm);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Upload what a merge/reference appended (see Scene::takeLastAppend): vertex/index buffers of the
+// new primitives, the new images and textures. The render-primitive, material, render-node and
+// light buffers are regrown and re-uploaded (one entry per element, cheap next to geometry and
+// images). Existing vertex buffers and images are untouched. Requires canAppend().
+// The caller is responsible for running the initial animation pass after this.
+void nvvkgltf::SceneVk::append(VkCommandBuffer cmd, nvvk::StagingUploader& staging, nvvkgltf::Scene& scn, const SceneAppendInfo& info)
+{
+  nvutils::ScopedTimer st(__FUNCTION__);
+  assert(canAppend(scn, info));
+
+  const std::vector<std::filesystem::path> imageSearchPaths = getImageSearchPaths(scn);
+
+  uploadMaterials(staging, scn);
+  uploadRenderNodes(staging, scn);
+  if(!info.renderPrimitives.empty())
+    createVertexBuffers(cmd, staging, scn, info.renderPrimitives.begin);
+  if(!info.images.empty() || !info.textures.empty())
+    createTextureImages(cmd, staging, scn, imageSearchPaths, info.images.begin, info.textures.begin);
+  uploadLights(staging, scn);
+
+  (void)flushSceneDescIfDirty(staging, scn);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Update or create the scene descriptor buffer (GPU pointer to materials, textures, primitives,
 // render nodes, lights). Called when buffer addresses change (e.g. after create or buffer resize).
@@ -490,13 +587,13 @@ void nvvkgltf::SceneVk::uploadMaterials(nvvk::StagingUploader& staging, const nv
 // Upload render node (instance) data to GPU SSBO. dirtyIndices = render node indices to update;
 // empty = full upload. Resizes buffer if node count changed.
 // Convert CPU render node to GPU format.
-static shaderio::GltfRenderNode buildRenderNodeInfo(const nvvkgltf::RenderNode& renderNode)
+static shaderio::GltfRenderNode buildRenderNodeInfo(const nvvkgltf::RenderNodeArrays& renderNodes, size_t index)
 {
   shaderio::GltfRenderNode info{};
-  info.objectToWorld = renderNode.worldMatrix;
-  info.worldToObject = glm::inverse(renderNode.worldMatrix);
-  info.materialID    = renderNode.materialID;
-  info.renderPrimID  = renderNode.renderPrimID;
+  info.objectToWorld = renderNodes.worldMatrices()[index];
+  info.worldToObject = glm::inverse(info.objectToWorld);
+  info.materialID    = renderNodes.materialIDs()[index];
+  info.renderPrimID  = renderNodes.renderPrimIDs()[index];
   return info;
 }
 
@@ -530,7 +627,7 @@ void nvvkgltf::SceneVk::ensureRenderNodeBuffer(nvvk::StagingUploader& staging, s
 
 void nvvkgltf::SceneVk::uploadRenderNodes(nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, const std::unordered_set<int>& dirtyIndices)
 {
-  const std::vector<nvvkgltf::RenderNode>& renderNodes = scn.getRenderNodes();
+  const nvvkgltf::RenderNodeArrays& renderNodes = scn.getRenderNodes();
 
   const VkDeviceSize prevSize = m_bRenderNode.bufferSize;
   ensureRenderNodeBuffer(staging, renderNodes.size());
@@ -545,10 +642,9 @@ void nvvkgltf::SceneVk::uploadRenderNodes(nvvk::StagingUploader& staging, const
   const bool bufferRecreated = (m_bRenderNode.bufferSize != prevSize) || (prevSize == 0);
   if(bufferRecreated || dirtyIndices.empty())
   {
-    std::vector<shaderio::GltfRenderNode> instanceInfo;
-    instanceInfo.reserve(renderNodes.size());
-    for(const nvvkgltf::RenderNode& rn : renderNodes)
-      instanceInfo.emplace_back(buildRenderNodeInfo(rn));
+    // Reads three columns per node (no skin/ref/visibility); the matrix inverse dominates, so split across threads.
+    std::vector<shaderio::GltfRenderNode> instanceInfo(renderNodes.size());
+    nvvkgltf::parallelFor<4096>(renderNodes.size(), [&](uint64_t i) { instanceInfo[i] = buildRenderNodeInfo(renderNodes, i); });
     staging.appendBuffer(m_bRenderNode, 0, std::span(instanceInfo));
   }
   else
@@ -557,7 +653,7 @@ void nvvkgltf::SceneVk::uploadRenderNodes(nvvk::StagingUploader& staging, const
     {
       if(renderNodeIdx < 0 || static_cast<size_t>(renderNodeIdx) >= renderNodes.size())
         continue;
-      const shaderio::GltfRenderNode info   = buildRenderNodeInfo(renderNodes[renderNodeIdx]);
+      const shaderio::GltfRenderNode info   = buildRenderNodeInfo(renderNodes, renderNodeIdx);
       const size_t                   offset = static_cast<size_t>(renderNodeIdx) * sizeof(shaderio::GltfRenderNode);
       staging.appendBuffer(m_bRenderNode, offset, sizeof(shaderio::GltfRenderNode), &info);
     }
@@ -617,16 +713,19 @@ void nvvkgltf::SceneVk::uploadLights(nvvk::StagingUploader& staging, const nvvkg
 
 //--------------------------------------------------------------------------------------------------
 // Upload render primitive info (and morph/skin vertex data) to GPU. Used for morph targets and skinning.
+// Primitives whose morph weights / joint palette did not change since the last frame are not re-uploaded.
 void nvvkgltf::SceneVk::uploadPrimitives(VkCommandBuffer cmd, nvvk::StagingUploader& staging, nvvkgltf::Scene& scn)
 {
+  scn.animation().updateDeformationChanges();
   scn.animation().computeMorphTargets();
   scn.animation().computeSkinning();
+  const nvvkgltf::DeformChangeTracker& changes = scn.animation().getDeformationChanges();
 
   // ** Morph **
   for(size_t i = 0; i < scn.animation().getMorphPrimitives().size(); i++)
   {
     const auto& morph = scn.animation().getMorphResult(i);
-    if(morph.renderPrimID < 0)
+    if(morph.renderPrimID < 0 || !changes.morphChanged(i))
       continue;
 
     staging.cmdUploadAppended(cmd);
@@ -651,6 +750,8 @@ void nvvkgltf::SceneVk::uploadPrimitives(VkCommandBuffer cmd, nvvk::StagingUploa
   // ** Skin **
   for(size_t i = 0; i < scn.animation().getSkinTasks().size(); i++)
   {
+    if(!changes.skinChanged(i))
+      continue;
     const auto& task    = scn.animation().getSkinTasks()[i];
     const auto& skinned = scn.animation().getSkinningResult(i);
 
@@ -736,13 +837,28 @@ VkBufferUsageFlags2 nvvkgltf::SceneVk::getBufferUsageFlags() const
 }
 
 //--------------------------------------------------------------------------------------------------
-// Create vertex/index buffers and render-primitive info for all primitives. One vertex buffer set
-// per primitive; primitive buffer references vertex/index buffers and material id.
-void nvvkgltf::SceneVk::createVertexBuffers(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn)
+// Render-primitive info (device addresses of the index and vertex buffers) for one primitive.
+static shaderio::GltfRenderPrimitive makeRenderPrimitive(const nvvk::Buffer& indices, const nvvkgltf::SceneVk::VertexBuffers& vertexBuffers)
 {
-  nvutils::ScopedTimer st(__FUNCTION__);
+  shaderio::GltfRenderPrimitive renderPrim{};
+  renderPrim.indices                   = (glm::uvec3*)indices.address;
+  renderPrim.vertexBuffer.positions    = (glm::vec3*)vertexBuffers.position.address;
+  renderPrim.vertexBuffer.normals      = (glm::vec3*)vertexBuffers.normal.address;
+  renderPrim.vertexBuffer.tangents     = (glm::vec4*)vertexBuffers.tangent.address;
+  renderPrim.vertexBuffer.texCoords[0] = (glm::vec2*)vertexBuffers.texCoord0.address;
+  renderPrim.vertexBuffer.texCoords[1] = (glm::vec2*)vertexBuffers.texCoord1.address;
+  renderPrim.vertexBuffer.colors       = (glm::uint*)vertexBuffers.color.address;
+  return renderPrim;
+}
 
-  const auto& model = scn.getModel();
+//--------------------------------------------------------------------------------------------------
+// Create vertex/index buffers for primitives [firstPrim, count) and the render-primitive info for
+// all of them. One vertex buffer set per primitive; primitive buffer references vertex/index buffers.
+// firstPrim > 0 appends: buffers of the earlier primitives are kept, the render-primitive buffer is
+// recreated at the new size.
+void nvvkgltf::SceneVk::createVertexBuffers(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, uint32_t firstPrim)
+{
+  nvutils::ScopedTimer st(__FUNCTION__);
 
   std::vector<shaderio::GltfRenderPrimitive> renderPrim;  // The array of all primitive information
 
@@ -751,122 +867,138 @@ void nvvkgltf::SceneVk::createVertexBuffers(VkCommandBuffer cmd, nvvk::StagingUp
   m_vertexBuffers.resize(numUniquePrimitive);
   renderPrim.resize(numUniquePrimitive);
 
-  for(size_t primID = 0; primID < scn.getNumRenderPrimitives(); primID++)
+  for(size_t primID = firstPrim; primID < scn.getNumRenderPrimitives(); primID++)
+    createPrimitiveBuffers(staging, scn, primID);
+
+  // Filling the primitive information
+  for(size_t primID = 0; primID < numUniquePrimitive; primID++)
+    renderPrim[primID] = makeRenderPrimitive(m_bIndices[primID], m_vertexBuffers[primID]);
+
+  // Creating the buffer of all primitive information
+  if(m_bRenderPrim.buffer != VK_NULL_HANDLE)
   {
-    const tinygltf::Primitive& primitive     = *scn.getRenderPrimitive(primID).pPrimitive;
-    const tinygltf::Mesh&      mesh          = model.meshes[scn.getRenderPrimitive(primID).meshID];
-    VertexBuffers&             vertexBuffers = m_vertexBuffers[primID];
+    destroyBufferDeferred(m_bRenderPrim);
+    m_sceneDescDirty = true;
+  }
+  NVVK_CHECK(m_alloc->createBuffer(m_bRenderPrim, std::span(renderPrim).size_bytes(), getBufferUsageFlags()));
+  NVVK_CHECK(staging.appendBuffer(m_bRenderPrim, 0, std::span(renderPrim)));
+  NVVK_DBG_NAME(m_bRenderPrim.buffer);
+  m_memoryTracker.track(kMemCategorySceneData, m_bRenderPrim.allocation);
 
-    updateAttributeBuffer<glm::vec3>("POSITION", model, primitive, m_alloc, &staging, vertexBuffers.position);
-    updateAttributeBuffer<glm::vec3>("NORMAL", model, primitive, m_alloc, &staging, vertexBuffers.normal);
-    updateAttributeBuffer<glm::vec2>("TEXCOORD_0", model, primitive, m_alloc, &staging, vertexBuffers.texCoord0);
-    updateAttributeBuffer<glm::vec2>("TEXCOORD_1", model, primitive, m_alloc, &staging, vertexBuffers.texCoord1);
-    updateAttributeBuffer<glm::vec4>("TANGENT", model, primitive, m_alloc, &staging, vertexBuffers.tangent);
+  // Barrier to make sure the data is in the GPU
+  cmdGeometryBarrier(cmd, m_rayTracingEnabled);
+}
 
-    if(tinygltf::utils::hasElementName(primitive.attributes, "COLOR_0"))
+//--------------------------------------------------------------------------------------------------
+// Vertex attribute buffers and index buffer of one primitive (the buffers must not exist yet).
+void nvvkgltf::SceneVk::createPrimitiveBuffers(nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, size_t primID)
+{
+  const auto&                model         = scn.getModel();
+  const tinygltf::Primitive& primitive     = *scn.getRenderPrimitive(primID).pPrimitive;
+  VertexBuffers&             vertexBuffers = m_vertexBuffers[primID];
+
+  updateAttributeBuffer<glm::vec3>("POSITION", model, primitive, m_alloc, &staging, vertexBuffers.position);
+  updateAttributeBuffer<glm::vec3>("NORMAL", model, primitive, m_alloc, &staging, vertexBuffers.normal);
+  updateAttributeBuffer<glm::vec2>("TEXCOORD_0", model, primitive, m_alloc, &staging, vertexBuffers.texCoord0);
+  updateAttributeBuffer<glm::vec2>("TEXCOORD_1", model, primitive, m_alloc, &staging, vertexBuffers.texCoord1);
+  updateAttributeBuffer<glm::vec4>("TANGENT", model, primitive, m_alloc, &staging, vertexBuffers.tangent);
+
+  if(tinygltf::utils::hasElementName(primitive.attributes, "COLOR_0"))
+  {
+    // For color, we need to pack it into a single int
+    const tinygltf::Accessor& accessor = model.accessors[primitive.attributes.at("COLOR_0")];
+    std::vector<uint32_t>     tempIntData(accessor.count);
+    if(accessor.type == TINYGLTF_TYPE_VEC3)
     {
-      // For color, we need to pack it into a single int
-      const tinygltf::Accessor& accessor = model.accessors[primitive.attributes.at("COLOR_0")];
-      std::vector<uint32_t>     tempIntData(accessor.count);
-      if(accessor.type == TINYGLTF_TYPE_VEC3)
-      {
-        std::vector<glm::vec3>     tempStorage;
-        std::span<const glm::vec3> colors = tinygltf::utils::getAccessorData(model, accessor, &tempStorage);
-        for(size_t i = 0; i < accessor.count; i++)
-        {
-          tempIntData[i] = glm::packUnorm4x8(glm::vec4(colors[i], 1));
-        }
-      }
-      else if(accessor.type == TINYGLTF_TYPE_VEC4)
+      std::vector<glm::vec3>     tempStorage;
+      std::span<const glm::vec3> colors = tinygltf::utils::getAccessorData(model, accessor, &tempStorage);
+      for(size_t i = 0; i < accessor.count; i++)
       {
-        std::vector<glm::vec4>     tempStorage;
-        std::span<const glm::vec4> colors = tinygltf::utils::getAccessorData(model, accessor, &tempStorage);
-        for(size_t i = 0; i < accessor.count; i++)
-        {
-          tempIntData[i] = glm::packUnorm4x8(colors[i]);
-        }
+        tempIntData[i] = glm::packUnorm4x8(glm::vec4(colors[i], 1));
       }
-      else
+    }
+    else if(accessor.type == TINYGLTF_TYPE_VEC4)
+    {
+      std::vector<glm::vec4>     tempStorage;
+      std::span<const glm::vec4> colors = tinygltf::utils::getAccessorData(model, accessor, &tempStorage);
+      for(size_t i = 0; i < accessor.count; i++)
       {
-        assert(!"Unknown color type");
+        tempIntData[i] = glm::packUnorm4x8(colors[i]);
       }
-
-      NVVK_CHECK(m_alloc->createBuffer(vertexBuffers.color, std::span(tempIntData).size_bytes(),
-                                       getBufferUsageFlags() | VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT));
-      NVVK_CHECK(staging.appendBuffer(vertexBuffers.color, 0, std::span(tempIntData)));
-      m_memoryTracker.track(kMemCategoryGeometry, vertexBuffers.color.allocation);
     }
-
-    // Debug name
-    if(vertexBuffers.position.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.position.buffer);
-    if(vertexBuffers.normal.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.normal.buffer);
-    if(vertexBuffers.texCoord0.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.texCoord0.buffer);
-    if(vertexBuffers.texCoord1.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.texCoord1.buffer);
-    if(vertexBuffers.tangent.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.tangent.buffer);
-    if(vertexBuffers.color.buffer != VK_NULL_HANDLE)
-      NVVK_DBG_NAME(vertexBuffers.color.buffer);
-
-
-    // Buffer of indices
-    std::vector<uint32_t> indexBuffer;
-    if(primitive.indices > -1)
+    else
     {
-      const tinygltf::Accessor& accessor = model.accessors[primitive.indices];
-      bool                      ok       = tinygltf::utils::copyAccessorData(model, accessor, indexBuffer);
-      assert(ok);
+      assert(!"Unknown color type");
     }
-    else
-    {  // Primitive without indices, creating them
-      const tinygltf::Accessor& accessor = model.accessors[primitive.attributes.at("POSITION")];
 
-      indexBuffer.resize(accessor.count);
-      for(auto i = 0; i < accessor.count; i++)
-        indexBuffer[i] = i;
-    }
+    NVVK_CHECK(m_alloc->createBuffer(vertexBuffers.color, std::span(tempIntData).size_bytes(),
+                                     getBufferUsageFlags() | VK_BUFFER_USAGE_2_VERTEX_BUFFER_BIT));
+    NVVK_CHECK(staging.appendBuffer(vertexBuffers.color, 0, std::span(tempIntData)));
+    m_memoryTracker.track(kMemCategoryGeometry, vertexBuffers.color.allocation);
+  }
 
-    // Creating the buffer for the indices
-    nvvk::Buffer& i_buffer = m_bIndices[primID];
-    NVVK_CHECK(m_alloc->createBuffer(i_buffer, std::span(indexBuffer).size_bytes(),
-                                     getBufferUsageFlags() | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT));
-    NVVK_CHECK(staging.appendBuffer(i_buffer, 0, std::span(indexBuffer)));
-    NVVK_DBG_NAME(i_buffer.buffer);
-    m_memoryTracker.track(kMemCategoryGeometry, i_buffer.allocation);
+  // Debug name
+  if(vertexBuffers.position.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.position.buffer);
+  if(vertexBuffers.normal.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.normal.buffer);
+  if(vertexBuffers.texCoord0.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.texCoord0.buffer);
+  if(vertexBuffers.texCoord1.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.texCoord1.buffer);
+  if(vertexBuffers.tangent.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.tangent.buffer);
+  if(vertexBuffers.color.buffer != VK_NULL_HANDLE)
+    NVVK_DBG_NAME(vertexBuffers.color.buffer);
 
-    // Filling the primitive information
-    renderPrim[primID].indices = (glm::uvec3*)i_buffer.address;
 
-    shaderio::VertexBuffers vBuf = {};
-    vBuf.positions               = (glm::vec3*)vertexBuffers.position.address;
-    vBuf.normals                 = (glm::vec3*)vertexBuffers.normal.address;
-    vBuf.tangents                = (glm::vec4*)vertexBuffers.tangent.address;
-    vBuf.texCoords[0]            = (glm::vec2*)vertexBuffers.texCoord0.address;
-    vBuf.texCoords[1]            = (glm::vec2*)vertexBuffers.texCoord1.address;
-    vBuf.colors                  = (glm::uint*)vertexBuffers.color.address;
+  // Buffer of indices
+  std::vector<uint32_t> indexBuffer;
+  if(primitive.indices > -1)
+  {
+    const tinygltf::Accessor& accessor = model.accessors[primitive.indices];
+    bool                      ok       = tinygltf::utils::copyAccessorData(model, accessor, indexBuffer);
+    assert(ok);
+  }
+  else
+  {  // Primitive without indices, creating them
+    const tinygltf::Accessor& accessor = model.accessors[primitive.attributes.at("POSITION")];
 
-    renderPrim[primID].vertexBuffer = vBuf;
+    indexBuffer.resize(accessor.count);
+    for(auto i = 0; i < accessor.count; i++)
+      indexBuffer[i] = i;
   }
 
-  // Creating the buffer of all primitive information
-  NVVK_CHECK(m_alloc->createBuffer(m_bRenderPrim, std::span(renderPrim).size_bytes(), getBufferUsageFlags()));
-  NVVK_CHECK(staging.appendBuffer(m_bRenderPrim, 0, std::span(renderPrim)));
-  NVVK_DBG_NAME(m_bRenderPrim.buffer);
-  m_memoryTracker.track(kMemCategorySceneData, m_bRenderPrim.allocation);
+  // Creating the buffer for the indices
+  nvvk::Buffer& i_buffer = m_bIndices[primID];
+  NVVK_CHECK(m_alloc->createBuffer(i_buffer, std::span(indexBuffer).size_bytes(),
+                                   getBufferUsageFlags() | VK_BUFFER_USAGE_2_INDEX_BUFFER_BIT));
+  NVVK_CHECK(staging.appendBuffer(i_buffer, 0, std::span(indexBuffer)));
+  NVVK_DBG_NAME(i_buffer.buffer);
+  m_memoryTracker.track(kMemCategoryGeometry, i_buffer.allocation);
+}
 
-  // Barrier to make sure the data is in the GPU
-  VkMemoryBarrier barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
-  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-  if(m_rayTracingEnabled)
+//--------------------------------------------------------------------------------------------------
+// Replace the vertex and index buffers of the given render primitives, e.g. after their mesh data
+// changed on disk, and update their render-primitive records. The GPU must not use the old buffers
+// anymore. The BLAS of these primitives must be rebuilt, and morph/skin data re-applied.
+void nvvkgltf::SceneVk::updatePrimitiveGeometry(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, std::span<const int> renderPrimIDs)
+{
+  nvutils::ScopedTimer st(__FUNCTION__);
+
+  for(int primID : renderPrimIDs)
   {
-    barrier.dstAccessMask |= VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+    if(primID < 0 || static_cast<size_t>(primID) >= m_vertexBuffers.size() || static_cast<size_t>(primID) >= scn.getNumRenderPrimitives())
+      continue;
+    destroyPrimitiveBuffers(primID);
+    createPrimitiveBuffers(staging, scn, primID);
+
+    const shaderio::GltfRenderPrimitive renderPrim = makeRenderPrimitive(m_bIndices[primID], m_vertexBuffers[primID]);
+    NVVK_CHECK(staging.appendBuffer(m_bRenderPrim, sizeof(shaderio::GltfRenderPrimitive) * primID, std::span(&renderPrim, 1)));
   }
-  vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0,
-                       nullptr, 0, nullptr);
+
+  // Barrier to make sure the data is in the GPU
+  cmdGeometryBarrier(cmd, m_rayTracingEnabled);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -889,14 +1021,7 @@ void nvvkgltf::SceneVk::uploadVertexBuffers(nvvk::StagingUploader& staging, cons
     // A buffer was created (most likely tangent buffer), we need to update the RenderPrimitive buffer
     if(newBuffer)
     {
-      shaderio::GltfRenderPrimitive renderPrim{};  // The array of all primitive information
-      renderPrim.indices                   = (glm::uvec3*)m_bIndices[primID].address;
-      renderPrim.vertexBuffer.positions    = (glm::vec3*)vertexBuffers.position.address;
-      renderPrim.vertexBuffer.normals      = (glm::vec3*)vertexBuffers.normal.address;
-      renderPrim.vertexBuffer.tangents     = (glm::vec4*)vertexBuffers.tangent.address;
-      renderPrim.vertexBuffer.texCoords[0] = (glm::vec2*)vertexBuffers.texCoord0.address;
-      renderPrim.vertexBuffer.texCoords[1] = (glm::vec2*)vertexBuffers.texCoord1.address;
-      renderPrim.vertexBuffer.colors       = (glm::uint*)vertexBuffers.color.address;
+      const shaderio::GltfRenderPrimitive renderPrim = makeRenderPrimitive(m_bIndices[primID], vertexBuffers);
       staging.appendBuffer(m_bRenderPrim, sizeof(shaderio::GltfRenderPrimitive) * primID, std::span(&renderPrim, 1));
     }
   }
@@ -948,10 +1073,14 @@ static VkSamplerCreateInfo getSampler(const tinygltf::Model& model, int index)
 
 //--------------------------------------------------------------------------------------------------
 // Create GPU images for all textures referenced by the scene. Loads from disk or embedded data.
+// firstImage/firstTexture > 0 appends: only images and textures from those indices on are loaded
+// and created (the earlier ones must already exist, see canAppend()).
 void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer                           cmd,
                                             nvvk::StagingUploader&                    staging,
                                             nvvkgltf::Scene&                          scn,
-                                            const std::vector<std::filesystem::path>& imageSearchPaths)
+                                            const std::vector<std::filesystem::path>& imageSearchPaths,
+                                            uint32_t                                  firstImage,
+                                            uint32_t                                  firstTexture)
 {
   nvutils::ScopedTimer   st(std::string(__FUNCTION__) + "\n");
   const tinygltf::Model& model = scn.getModel();
@@ -965,21 +1094,6 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
   // Find and all textures/images that should be sRgb encoded.
   findSrgbImages(model);
 
-  // Make dummy image(1,1), needed as we cannot have an empty array
-  auto addDefaultImage = [&](uint32_t idx, const std::array<uint8_t, 4>& color) {
-    VkImageCreateInfo image_create_info = DEFAULT_VkImageCreateInfo;
-    image_create_info.extent            = {1, 1, 1};
-    image_create_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
-    nvvk::Image image;
-    //
-    NVVK_CHECK(m_alloc->createImage(image, image_create_info, DEFAULT_VkImageViewCreateInfo));
-    NVVK_CHECK(staging.appendImage(image, std::span<const uint8_t>(color.data(), 4), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL));
-    NVVK_DBG_NAME(image.image);
-    // assert(idx < m_images.size());
-    m_images[idx] = SceneImage{.imageTexture = image};
-    nvvk::DebugUtil::getInstance().setObjectName(m_images[idx].imageTexture.image, "Dummy");
-  };
-
   // Adds a texture that points to image 0, so that every texture points to some image.
   auto addDefaultTexture = [&]() {
     assert(!m_images.empty());
@@ -992,7 +1106,7 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
   // Collect images that are in use by textures
   // If an image is not used, it will not be loaded. Instead, a dummy image will be created to avoid modifying the texture image source index.
   std::set<int> usedImages;
-  for(const auto& texture : model.textures)
+  for(const auto& texture : std::span(model.textures).subspan(firstTexture))
   {
     int source_image = tinygltf::utils::getTextureImageIndex(texture);
     usedImages.insert(source_image);
@@ -1010,21 +1124,14 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
   };
   std::vector<ImageLoadItem> imageLoadItems;
   const std::string          indent = st.indent();
-  for(size_t i = 0; i < model.images.size(); i++)
+  for(size_t i = firstImage; i < model.images.size(); i++)
   {
     if(usedImages.find(static_cast<int>(i)) == usedImages.end())
       continue;  // Skip unused images
 
-    const auto&           gltfImage = model.images[i];
-    std::filesystem::path diskPath;
-    if(!gltfImage.uri.empty() && gltfImage.bufferView < 0 && (gltfImage.uri.size() < 5 || gltfImage.uri.compare(0, 5, "data:") != 0))
-    {
-      std::string uriDecoded;
-      tinygltf::URIDecode(gltfImage.uri, &uriDecoded, nullptr);
-      diskPath = nvutils::findFile(nvutils::pathFromUtf8(uriDecoded), imageSearchPaths, false);
-    }
+    const auto&   gltfImage = model.images[i];
     ImageLoadItem item{.imageId = i};
-    item.diskPath       = diskPath;
+    item.diskPath       = findImageFile(gltfImage, imageSearchPaths);
     item.numBytes       = getImageByteSize(model, gltfImage, item.diskPath);
     m_images[i].imgName = getImageName(gltfImage, i);
 
@@ -1036,13 +1143,18 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
             [](const ImageLoadItem& a, const ImageLoadItem& b) { return a.numBytes > b.numBytes; });
 
   std::atomic<uint32_t> failedImageCount{0};
-  nvutils::parallel_batches<1>(  // Not batching
+  std::atomic<uint64_t> decodedBytes{0};  // Held until the Vulkan images are created below
+  nvvkgltf::parallelFor<1>(  // Not batching
       imageLoadItems.size(), [&](uint64_t i) {
         const ImageLoadItem& item = imageLoadItems[i];
         if(!loadImage(item.diskPath, model, item.imageId))
         {
           ++failedImageCount;
         }
+        const uint64_t bytes = mipDataBytes(m_images[item.imageId]);
+        decodedBytes += bytes;
+        if(m_hostMemoryTracker)
+          m_hostMemoryTracker->track(kHostCategoryDecodedImages, bytes);
       });
   if(failedImageCount > 0)
   {
@@ -1052,24 +1164,26 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
   syncTinyGltfImageDimensionsFromLoadedImages(scn.getModel(), m_images);
 
   // Create Vulkan images
-  for(size_t i = 0; i < m_images.size(); i++)
+  for(size_t i = firstImage; i < m_images.size(); i++)
   {
     if(!createImage(cmd, staging, m_images[i]))
     {
-      addDefaultImage((uint32_t)i, {255, 0, 255, 255});  // Image not present or incorrectly loaded (image.empty)
+      createDefaultImage(staging, i, {255, 0, 255, 255});  // Image not present or incorrectly loaded (image.empty)
     }
   }
+  if(m_hostMemoryTracker)
+    m_hostMemoryTracker->untrack(kHostCategoryDecodedImages, decodedBytes.load());
 
   // Add default image if nothing was loaded
   if(model.images.empty())
   {
     m_images.resize(1);
-    addDefaultImage(0, {255, 255, 255, 255});
+    createDefaultImage(staging, 0, {255, 255, 255, 255});
   }
 
   // Creating the textures using the above images
   m_textures.reserve(model.textures.size());
-  for(size_t i = 0; i < model.textures.size(); i++)
+  for(size_t i = firstTexture; i < model.textures.size(); i++)
   {
     const auto& texture      = model.textures[i];
     int         source_image = tinygltf::utils::getTextureImageIndex(texture);
@@ -1097,6 +1211,86 @@ void nvvkgltf::SceneVk::createTextureImages(VkCommandBuffer
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// Make a dummy image(1,1) at imageID: stands in for images that failed to load, and for the empty
+// image array (cannot have an empty descriptor array).
+void nvvkgltf::SceneVk::createDefaultImage(nvvk::StagingUploader& staging, size_t imageID, const std::array<uint8_t, 4>& color)
+{
+  VkImageCreateInfo image_create_info = DEFAULT_VkImageCreateInfo;
+  image_create_info.extent            = {1, 1, 1};
+  image_create_info.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  nvvk::Image image;
+  //
+  NVVK_CHECK(m_alloc->createImage(image, image_create_info, DEFAULT_VkImageViewCreateInfo));
+  NVVK_CHECK(staging.appendImage(image, std::span<const uint8_t>(color.data(), 4), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL));
+  NVVK_DBG_NAME(image.image);
+  assert(imageID < m_images.size());
+  m_images[imageID] = SceneImage{.imageTexture = image};
+  nvvk::DebugUtil::getInstance().setObjectName(m_images[imageID].imageTexture.image, "Dummy");
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decode and upload the given images again, e.g. after their files changed. The GPU must not use
+// them anymore (the old images are destroyed here). Textures hold a copy of the image handles, so
+// the ones sourcing a reloaded image are updated, keeping their sampler; the texture descriptors
+// must be written again afterwards. Images no texture uses stay placeholders, as in createTextureImages.
+void nvvkgltf::SceneVk::reloadImages(VkCommandBuffer cmd, nvvk::StagingUploader& staging, nvvkgltf::Scene& scn, std::span<const int> imageIDs)
+{
+  nvutils::ScopedTimer   st(__FUNCTION__);
+  const tinygltf::Model& model = scn.getModel();
+
+  const std::vector<std::filesystem::path> imageSearchPaths = getImageSearchPaths(scn);
+  findSrgbImages(model);  // Materials may have changed along with the images
+
+  for(int imageID : imageIDs)
+  {
+    if(imageID < 0 || static_cast<size_t>(imageID) >= m_images.size() || static_cast<size_t>(imageID) >= model.images.size())
+      continue;
+
+    std::vector<size_t> textures;  // Textures sourcing this image
+    for(size_t i = 0; i < model.textures.size() && i < m_textures.size(); i++)
+    {
+      if(tinygltf::utils::getTextureImageIndex(model.textures[i]) == imageID)
+        textures.push_back(i);
+    }
+    if(textures.empty())
+      continue;
+
+    SceneImage& sceneImage = m_images[imageID];
+    if(sceneImage.imageTexture.image != VK_NULL_HANDLE)
+    {
+      m_memoryTracker.untrack(kMemCategoryImages, sceneImage.imageTexture.allocation);
+      m_alloc->destroyImage(sceneImage.imageTexture);
+    }
+    sceneImage = SceneImage{.imgName = getImageName(model.images[imageID], imageID)};
+
+    if(!loadImage(findImageFile(model.images[imageID], imageSearchPaths), model, imageID))
+    {
+      LOGW("Image %d (%s) failed to reload.\n", imageID, sceneImage.imgName.c_str());
+    }
+    const uint64_t decodedBytes = mipDataBytes(sceneImage);
+    if(m_hostMemoryTracker)
+      m_hostMemoryTracker->track(kHostCategoryDecodedImages, decodedBytes);
+    if(!createImage(cmd, staging, sceneImage))
+    {
+      createDefaultImage(staging, imageID, {255, 0, 255, 255});
+    }
+    if(m_hostMemoryTracker)
+      m_hostMemoryTracker->untrack(kHostCategoryDecodedImages, decodedBytes);
+
+    for(size_t textureID : textures)
+    {
+      nvvk::Image& tex       = m_textures[textureID];
+      VkSampler    sampler   = tex.descriptor.sampler;
+      tex                    = m_images[imageID].imageTexture;
+      tex.descriptor.sampler = sampler;
+    }
+  }
+
+  syncTinyGltfImageDimensionsFromLoadedImages(scn.getModel(), m_images);
+  staging.cmdUploadAppended(cmd);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Identify images that must use sRGB format (e.g. base color). Stored in m_sRgbImages for createImage.
 void nvvkgltf::SceneVk::findSrgbImages(const tinygltf::Model& model)
@@ -1399,49 +1593,9 @@ std::vector<shaderio::GltfLight> getShaderLights(const std::vector<nvvkgltf::Ren
 // Preserves textures and materials. Use for geometry-only rebuilds (e.g. tangent generation).
 void nvvkgltf::SceneVk::destroyGeometry()
 {
-  for(auto& vertexBuffer : m_vertexBuffers)
-  {
-    if(vertexBuffer.position.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.position.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.position);
-    }
-    if(vertexBuffer.normal.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.normal.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.normal);
-    }
-    if(vertexBuffer.tangent.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.tangent.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.tangent);
-    }
-    if(vertexBuffer.texCoord0.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.texCoord0.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.texCoord0);
-    }
-    if(vertexBuffer.texCoord1.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.texCoord1.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.texCoord1);
-    }
-    if(vertexBuffer.color.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, vertexBuffer.color.allocation);
-      m_alloc->destroyBuffer(vertexBuffer.color);
-    }
-  }
+  for(size_t primID = 0; primID < std::max(m_vertexBuffers.size(), m_bIndices.size()); primID++)
+    destroyPrimitiveBuffers(primID);
   m_vertexBuffers.clear();
-
-  for(auto& indicesBuffer : m_bIndices)
-  {
-    if(indicesBuffer.buffer != VK_NULL_HANDLE)
-    {
-      m_memoryTracker.untrack(kMemCategoryGeometry, indicesBuffer.allocation);
-      m_alloc->destroyBuffer(indicesBuffer);
-    }
-  }
   m_bIndices.clear();
 
   if(m_bRenderPrim.buffer != VK_NULL_HANDLE)
@@ -1459,6 +1613,33 @@ void nvvkgltf::SceneVk::destroyGeometry()
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// Release the vertex and index buffers of one primitive; its entries are reset, not removed.
+void nvvkgltf::SceneVk::destroyPrimitiveBuffers(size_t primID)
+{
+  if(primID < m_vertexBuffers.size())
+  {
+    VertexBuffers& vertexBuffers = m_vertexBuffers[primID];
+    for(nvvk::Buffer* buffer : {&vertexBuffers.position, &vertexBuffers.normal, &vertexBuffers.tangent,
+                                &vertexBuffers.texCoord0, &vertexBuffers.texCoord1, &vertexBuffers.color})
+    {
+      if(buffer->buffer != VK_NULL_HANDLE)
+      {
+        m_memoryTracker.untrack(kMemCategoryGeometry, buffer->allocation);
+        m_alloc->destroyBuffer(*buffer);
+        *buffer = {};
+      }
+    }
+  }
+
+  if(primID < m_bIndices.size() && m_bIndices[primID].buffer != VK_NULL_HANDLE)
+  {
+    m_memoryTracker.untrack(kMemCategoryGeometry, m_bIndices[primID].allocation);
+    m_alloc->destroyBuffer(m_bIndices[primID]);
+    m_bIndices[primID] = {};
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // Release all Vulkan resources (geometry, scene data buffers, textures, images). Idempotent.
 void nvvkgltf::SceneVk::destroy()
@@ -1523,8 +1704,8 @@ void nvvkgltf::SceneVk::debugUpdateShadowCopy(const nvvkgltf::Scene& scn)
   m_debugLastUploadedRN.resize(rn.size());
   for(size_t i = 0; i < rn.size(); i++)
   {
-    m_debugLastUploadedRN[i].materialID   = rn[i].materialID;
-    m_debugLastUploadedRN[i].renderPrimID = rn[i].renderPrimID;
+    m_debugLastUploadedRN[i].materialID   = rn.materialIDs()[i];
+    m_debugLastUploadedRN[i].renderPrimID = rn.renderPrimIDs()[i];
   }
 }
 
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <array>
 #include <filesystem>
 #include <functional>
 #include <set>
+#include <span>
 #include <unordered_set>
 #include <vector>
 
@@ -81,6 +83,11 @@ public:
   using DeferredFreeFunc = std::function<void(std::function<void()>&&)>;
   void setDeferredFree(DeferredFreeFunc func) { m_deferredFree = std::move(func); }
 
+  // Optional: host-memory tracker for the decoded images held between decoding and upload ("Images/Decoded").
+  void setHostMemoryTracker(HostMemoryTracker* tracker) { m_hostMemoryTracker = tracker; }
+  // Measure the material cache ("Materials") into `tracker`
+  void reportHostMemory(HostMemoryTracker& tracker) const;
+
   virtual void create(VkCommandBuffer        cmd,
                       nvvk::StagingUploader& staging,
                       nvvkgltf::Scene&       scn,
@@ -114,6 +121,18 @@ public:
   void destroyGeometry();
   void createGeometry(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn);
 
+  // Incremental upload after Scene::mergeScene/referenceScene appended content (Scene::takeLastAppend).
+  // Only the appended primitives, images and textures are created; existing ones are kept.
+  [[nodiscard]] bool canAppend(const nvvkgltf::Scene& scn, const SceneAppendInfo& info) const;
+  void append(VkCommandBuffer cmd, nvvk::StagingUploader& staging, nvvkgltf::Scene& scn, const SceneAppendInfo& info);
+
+  // Hot reload: replace the vertex and index buffers of the given render primitives (same attributes,
+  // new content) and re-upload their records. The BLAS of those primitives must be rebuilt.
+  void updatePrimitiveGeometry(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, std::span<const int> renderPrimIDs);
+  // Hot reload: decode and upload the given images again; the textures sourcing them are re-pointed
+  // and keep their sampler. The old images are destroyed, so the GPU must be idle.
+  void reloadImages(VkCommandBuffer cmd, nvvk::StagingUploader& staging, nvvkgltf::Scene& scn, std::span<const int> imageIDs);
+
   // Getters
   const nvvk::Buffer&               material() const { return m_bMaterial; }
   const nvvk::Buffer&               primitiveBuffer() const { return m_bRenderPrim; }
@@ -159,7 +178,10 @@ public:
 
 protected:
   VkBufferUsageFlags2 getBufferUsageFlags() const;
-  virtual void createVertexBuffers(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn);
+  // firstPrim/firstImage/firstTexture > 0: append, creating only the resources from that index on.
+  virtual void createVertexBuffers(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, uint32_t firstPrim = 0);
+  void createPrimitiveBuffers(nvvk::StagingUploader& staging, const nvvkgltf::Scene& scn, size_t primID);
+  void destroyPrimitiveBuffers(size_t primID);
   template <typename T>
   bool updateAttributeBuffer(const std::string&         attributeName,
                              const tinygltf::Model&     model,
@@ -171,8 +193,12 @@ protected:
   virtual void createTextureImages(VkCommandBuffer                           cmd,
                                    nvvk::StagingUploader&                    staging,
                                    nvvkgltf::Scene&                          scn,
-                                   const std::vector<std::filesystem::path>& imageSearchPaths);
+                                   const std::vector<std::filesystem::path>& imageSearchPaths,
+                                   uint32_t                                  firstImage   = 0,
+                                   uint32_t                                  firstTexture = 0);
 
+  // 1x1 placeholder for an image that is missing or could not be decoded
+  void createDefaultImage(nvvk::StagingUploader& staging, size_t imageID, const std::array<uint8_t, 4>& color);
   void findSrgbImages(const tinygltf::Model& model);
 
   // Rebuild scene descriptor buffer (buffer addresses + numLights). Called internally when buffers change.
@@ -223,7 +249,8 @@ protected:
   DeferredFreeFunc m_deferredFree;                            // Optional: schedules deferred GPU resource destruction
   void             destroyBufferDeferred(nvvk::Buffer& buf);  // Destroy via m_deferredFree or fallback to queue wait
 
-  GpuMemoryTracker m_memoryTracker;  // GPU memory tracking
+  GpuMemoryTracker   m_memoryTracker;                // GPU memory tracking
+  HostMemoryTracker* m_hostMemoryTracker = nullptr;  // Optional, see setHostMemoryTracker()
 
 #ifndef NDEBUG
 public:
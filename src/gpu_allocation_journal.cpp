@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "gpu_allocation_journal.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <fmt/format.h>
+
+namespace nvvkgltf {
+
+namespace {
+
+constexpr std::string_view kJournalHeader = "gpujournal 1";
+
+void setError(std::string* error, std::string message)
+{
+  if(error)
+    *error = std::move(message);
+}
+
+// Largest first, then oldest first so equal sizes keep a stable order
+void sortBySize(std::vector<JournalAllocation>& allocations)
+{
+  std::sort(allocations.begin(), allocations.end(), [](const JournalAllocation& a, const JournalAllocation& b) {
+    return a.bytes != b.bytes ? a.bytes > b.bytes : a.frame < b.frame;
+  });
+}
+
+double mb(uint64_t bytes)
+{
+  return double(bytes) / (1024.0 * 1024.0);
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Recording
+//
+AllocationJournal::AllocationJournal()
+{
+  m_data.strings.emplace_back();
+  m_stringIndex.emplace(std::string(), 0);
+}
+
+uint32_t AllocationJournal::intern(std::string_view s)
+{
+  std::string key(s);
+  std::replace(key.begin(), key.end(), '\n', ' ');  // One string per line in the file
+  std::replace(key.begin(), key.end(), '\r', ' ');
+  auto [it, inserted] = m_stringIndex.try_emplace(key, uint32_t(m_data.strings.size()));
+  if(inserted)
+    m_data.strings.push_back(std::move(key));
+  return it->second;
+}
+
+void AllocationJournal::setFrame(uint64_t frame)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_frame = frame;
+}
+
+void AllocationJournal::recordAllocate(std::string_view category, uint64_t id, uint64_t bytes, std::string_view name)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_data.events.push_back({.type     = AllocationEvent::Type::eAllocate,
+                           .frame    = m_frame,
+                           .id       = id,
+                           .bytes    = bytes,
+                           .category = intern(category),
+                           .name     = intern(name)});
+}
+
+void AllocationJournal::recordFree(std::string_view category, uint64_t id)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_data.events.push_back({.type = AllocationEvent::Type::eFree, .frame = m_frame, .id = id, .category = intern(category)});
+}
+
+void AllocationJournal::mark(std::string_view label)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_data.events.push_back({.type = AllocationEvent::Type::eMark, .frame = m_frame, .name = intern(label)});
+}
+
+size_t AllocationJournal::getEventCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_data.events.size();
+}
+
+AllocationJournalData AllocationJournal::getData() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_data;
+}
+
+void AllocationJournal::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_data.events.clear();
+}
+
+bool AllocationJournal::save(const std::filesystem::path& path, std::string* error) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return saveAllocationJournal(path, m_data, error);
+}
+
+//--------------------------------------------------------------------------------------------------
+// File format: see the header comment
+//
+bool saveAllocationJournal(const std::filesystem::path& path, const AllocationJournalData& data, std::string* error)
+{
+  std::string text;
+  text.reserve(64 + data.events.size() * 24);
+  text += fmt::format("{}\n", kJournalHeader);
+  for(size_t i = 1; i < data.strings.size(); i++)
+    text += fmt::format("s {} {}\n", i, data.strings[i]);
+  for(const AllocationEvent& e : data.events)
+  {
+    switch(e.type)
+    {
+      case AllocationEvent::Type::eAllocate:
+        text += fmt::format("a {} {:x} {} {} {}\n", e.frame, e.id, e.bytes, e.category, e.name);
+        break;
+      case AllocationEvent::Type::eFree:
+        text += fmt::format("f {} {:x} {}\n", e.frame, e.id, e.category);
+        break;
+      case AllocationEvent::Type::eMark:
+        text += fmt::format("m {} {}\n", e.frame, e.name);
+        break;
+    }
+  }
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if(!out)
+  {
+    setError(error, "cannot open the file for writing");
+    return false;
+  }
+  out.write(text.data(), std::streamsize(text.size()));
+  if(!out)
+  {
+    setError(error, "write failed");
+    return false;
+  }
+  return true;
+}
+
+bool loadAllocationJournal(const std::filesystem::path& path, AllocationJournalData& data, std::string* error)
+{
+  data = {};
+  data.strings.emplace_back();
+
+  std::ifstream in(path, std::ios::binary);
+  if(!in)
+  {
+    setError(error, "cannot open the file");
+    return false;
+  }
+
+  std::string line;
+  if(!std::getline(in, line) || line != kJournalHeader)
+  {
+    setError(error, "not an allocation journal");
+    return false;
+  }
+
+  size_t lineNumber = 1;
+  while(std::getline(in, line))
+  {
+    lineNumber++;
+    if(line.empty())
+      continue;
+
+    std::istringstream fields(line.substr(1));
+    AllocationEvent    e;
+    bool               valid = line.size() > 1 && line[1] == ' ';
+    switch(line[0])
+    {
+      case 's': {
+        // The string is the rest of the line after the index and may contain spaces
+        size_t index = 0;
+        valid        = valid && bool(fields >> index) && index == data.strings.size();
+        if(valid)
+        {
+          const size_t start = line.find(' ', 2);
+          data.strings.push_back(start == std::string::npos ? std::string() : line.substr(start + 1));
+        }
+        break;
+      }
+      case 'a':
+        e.type = AllocationEvent::Type::eAllocate;
+        valid  = valid && bool(fields >> e.frame >> std::hex >> e.id >> std::dec >> e.bytes >> e.category >> e.name);
+        break;
+      case 'f':
+        e.type = AllocationEvent::Type::eFree;
+        valid  = valid && bool(fields >> e.frame >> std::hex >> e.id >> std::dec >> e.category);
+        break;
+      case 'm':
+        e.type = AllocationEvent::Type::eMark;
+        valid  = valid && bool(fields >> e.frame >> e.name);
+        break;
+      default:
+        valid = false;
+        break;
+    }
+
+    if(valid && line[0] != 's')
+    {
+      valid = e.category < data.strings.size() && e.name < data.strings.size();
+      if(valid)
+        data.events.push_back(e);
+    }
+    if(!valid)
+    {
+      setError(error, fmt::format("invalid record on line {}", lineNumber));
+      return false;
+    }
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Replay the events: allocations alive at the end, churn per category, and the growth between the
+// two selected marks (per-category live totals snapshotted at each mark).
+//
+JournalSummary summarizeJournal(const AllocationJournalData& data, const JournalSummaryOptions& options)
+{
+  JournalSummary summary;
+  summary.events = data.events.size();
+
+  const auto stringAt = [&](uint32_t index) -> const std::string& {
+    static const std::string empty;
+    return index < data.strings.size() ? data.strings[index] : empty;
+  };
+
+  // Select the marks: first match for 'from', last match for 'to'
+  constexpr size_t kNone    = ~size_t(0);
+  size_t           fromMark = kNone;
+  size_t           toMark   = kNone;
+  for(size_t i = 0; i < data.events.size(); i++)
+  {
+    const AllocationEvent& e = data.events[i];
+    if(e.type != AllocationEvent::Type::eMark)
+      continue;
+    if(fromMark == kNone && (options.fromMark.empty() || stringAt(e.name) == options.fromMark))
+      fromMark = i;
+    if(options.toMark.empty() || stringAt(e.name) == options.toMark)
+      toMark = i;
+  }
+  summary.hasGrowth = fromMark != kNone && toMark != kNone && fromMark < toMark;
+
+  struct Live
+  {
+    uint64_t bytes      = 0;
+    uint64_t frame      = 0;
+    size_t   eventIndex = 0;
+    uint32_t category   = 0;
+    uint32_t name       = 0;
+  };
+  std::unordered_map<uint64_t, Live> live;
+  std::vector<JournalCategoryChurn>  churn(data.strings.size());
+  std::vector<bool>                  usedCategory(data.strings.size(), false);
+  std::vector<JournalCategoryChurn>  atFrom;
+
+  const auto toAllocation = [&](uint64_t id, const Live& l) {
+    return JournalAllocation{.id = id, .bytes = l.bytes, .frame = l.frame, .category = stringAt(l.category), .name = stringAt(l.name)};
+  };
+  const auto release = [&](const Live& l) {
+    churn[l.category].liveBytes -= l.bytes;
+    churn[l.category].liveCount -= 1;
+  };
+
+  for(size_t i = 0; i < data.events.size(); i++)
+  {
+    const AllocationEvent& e = data.events[i];
+    summary.frames           = std::max(summary.frames, e.frame);
+    switch(e.type)
+    {
+      case AllocationEvent::Type::eAllocate: {
+        auto [it, inserted] = live.try_emplace(e.id);
+        if(!inserted)
+        {
+          // The previous allocation with this id was released without a recorded free
+          summary.replacedAllocations++;
+          release(it->second);
+        }
+        it->second = {.bytes = e.bytes, .frame = e.frame, .eventIndex = i, .category = e.category, .name = e.name};
+        JournalCategoryChurn& c = churn[e.category];
+        usedCategory[e.category] = true;
+        c.allocations++;
+        c.allocatedBytes += e.bytes;
+        c.liveBytes += e.bytes;
+        c.liveCount++;
+        break;
+      }
+      case AllocationEvent::Type::eFree: {
+        auto it = live.find(e.id);
+        if(it == live.end())
+        {
+          summary.unmatchedFrees++;
+          break;
+        }
+        JournalCategoryChurn& c = churn[it->second.category];
+        c.frees++;
+        c.freedBytes += it->second.bytes;
+        release(it->second);
+        live.erase(it);
+        break;
+      }
+      case AllocationEvent::Type::eMark:
+        break;
+    }
+
+    if(!summary.hasGrowth)
+      continue;
+    if(i == fromMark)
+    {
+      atFrom            = churn;
+      summary.fromMark  = stringAt(e.name);
+      summary.fromFrame = e.frame;
+    }
+    else if(i == toMark)
+    {
+      summary.toMark  = stringAt(e.name);
+      summary.toFrame = e.frame;
+      for(size_t c = 0; c < churn.size(); c++)
+      {
+        const int64_t bytes = int64_t(churn[c].liveBytes) - int64_t(atFrom[c].liveBytes);
+        const int64_t count = int64_t(churn[c].liveCount) - int64_t(atFrom[c].liveCount);
+        if(bytes != 0 || count != 0)
+          summary.growth.push_back({.category = stringAt(uint32_t(c)), .bytes = bytes, .count = count});
+      }
+      for(const auto& [id, l] : live)
+      {
+        if(l.eventIndex > fromMark)
+          summary.growthAllocations.push_back(toAllocation(id, l));
+      }
+    }
+  }
+
+  for(const auto& [id, l] : live)
+  {
+    summary.liveAllocations.push_back(toAllocation(id, l));
+    summary.liveBytes += l.bytes;
+  }
+  sortBySize(summary.liveAllocations);
+  sortBySize(summary.growthAllocations);
+  std::sort(summary.growth.begin(), summary.growth.end(), [](const JournalCategoryGrowth& a, const JournalCategoryGrowth& b) {
+    return a.bytes != b.bytes ? a.bytes > b.bytes : a.category < b.category;
+  });
+
+  for(size_t c = 0; c < churn.size(); c++)
+  {
+    if(!usedCategory[c])
+      continue;
+    churn[c].category = stringAt(uint32_t(c));
+    summary.churn.push_back(std::move(churn[c]));
+  }
+  std::sort(summary.churn.begin(), summary.churn.end(),
+            [](const JournalCategoryChurn& a, const JournalCategoryChurn& b) { return a.category < b.category; });
+  return summary;
+}
+
+//--------------------------------------------------------------------------------------------------
+std::string formatJournalSummary(const JournalSummary& s, size_t maxAllocations)
+{
+  const auto listAllocations = [maxAllocations](std::string& out, const std::vector<JournalAllocation>& allocations) {
+    for(size_t i = 0; i < std::min(allocations.size(), maxAllocations); i++)
+    {
+      const JournalAllocation& a = allocations[i];
+      out += fmt::format("  {:10.3f} MB  frame {:<8} {:<28} {}\n", mb(a.bytes), a.frame, a.category, a.name);
+    }
+    if(allocations.size() > maxAllocations)
+      out += fmt::format("  ... {} more\n", allocations.size() - maxAllocations);
+  };
+
+  std::string out;
+  out += fmt::format("Allocation journal: {} events, {} frames\n", s.events, s.frames);
+
+  out += fmt::format("Live at end: {} allocations, {:.2f} MB\n", s.liveAllocations.size(), mb(s.liveBytes));
+  listAllocations(out, s.liveAllocations);
+
+  out += "Churn per category:\n";
+  out += fmt::format("  {:<28} {:>8} {:>8} {:>12} {:>12} {:>10}\n", "Category", "Allocs", "Frees", "Alloc MB", "Freed MB", "Live MB");
+  for(const JournalCategoryChurn& c : s.churn)
+  {
+    out += fmt::format("  {:<28} {:>8} {:>8} {:>12.2f} {:>12.2f} {:>10.2f}\n", c.category, c.allocations, c.frees,
+                       mb(c.allocatedBytes), mb(c.freedBytes), mb(c.liveBytes));
+  }
+
+  if(s.hasGrowth)
+  {
+    out += fmt::format("Growth '{}' (frame {}) -> '{}' (frame {}):\n", s.fromMark, s.fromFrame, s.toMark, s.toFrame);
+    for(const JournalCategoryGrowth& g : s.growth)
+    {
+      out += fmt::format("  {:<28} {:>+12.2f} MB  {:>+6} allocations\n", g.category,
+                         double(g.bytes) / (1024.0 * 1024.0), g.count);
+    }
+    out += fmt::format("  Created between the marks and alive at '{}': {}\n", s.toMark, s.growthAllocations.size());
+    listAllocations(out, s.growthAllocations);
+  }
+  else
+  {
+    out += "Growth: needs two marks\n";
+  }
+
+  if(s.unmatchedFrees > 0 || s.replacedAllocations > 0)
+    out += fmt::format("Inconsistent events: {} unmatched frees, {} replaced allocations\n", s.unmatchedFrees, s.replacedAllocations);
+  return out;
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Opt-in journal of GPU allocation events. GpuMemoryTracker only keeps current
+// totals per category; the journal records every allocate / free with its
+// category, size, frame and debug name, plus user marks ("scene loaded", ...),
+// so memory that creeps up over a long session can be traced back to the
+// allocations that were never freed.
+//
+// The journal is written as a compact text file: strings (categories, names,
+// mark labels) are interned once, events reference them by index.
+//
+//   gpujournal 1
+//   s <index> <string>
+//   a <frame> <id> <bytes> <category> <name>
+//   f <frame> <id> <category>
+//   m <frame> <label>
+//
+// summarizeJournal() replays an event stream (live or loaded from disk) into
+// the allocations still alive at the end, the per-category growth between two
+// marks, and the allocate / free churn per category.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nvvkgltf {
+
+struct AllocationEvent
+{
+  enum class Type : uint8_t
+  {
+    eAllocate,
+    eFree,
+    eMark,
+  };
+
+  Type     type     = Type::eAllocate;
+  uint64_t frame    = 0;
+  uint64_t id       = 0;  // Allocation handle; ids can be reused after a free
+  uint64_t bytes    = 0;  // eAllocate only
+  uint32_t category = 0;  // String index (eAllocate, eFree)
+  uint32_t name     = 0;  // String index: debug name (eAllocate) or label (eMark)
+};
+
+struct AllocationJournalData
+{
+  std::vector<std::string>     strings;  // strings[0] is always the empty string
+  std::vector<AllocationEvent> events;
+};
+
+// Thread-safe: allocations are recorded from the loader threads as well as the main thread.
+class AllocationJournal
+{
+public:
+  AllocationJournal();
+
+  void setFrame(uint64_t frame);
+  void recordAllocate(std::string_view category, uint64_t id, uint64_t bytes, std::string_view name);
+  void recordFree(std::string_view category, uint64_t id);
+  void mark(std::string_view label);
+
+  size_t                getEventCount() const;
+  AllocationJournalData getData() const;  // Copy of the strings and events, for summarizeJournal()
+  void                  clear();
+
+  bool save(const std::filesystem::path& path, std::string* error = nullptr) const;
+
+private:
+  uint32_t intern(std::string_view s);  // Requires m_mutex
+
+  AllocationJournalData                     m_data;
+  std::unordered_map<std::string, uint32_t> m_stringIndex;
+  uint64_t                                  m_frame = 0;
+  mutable std::mutex                        m_mutex;
+};
+
+bool saveAllocationJournal(const std::filesystem::path& path, const AllocationJournalData& data, std::string* error = nullptr);
+bool loadAllocationJournal(const std::filesystem::path& path, AllocationJournalData& data, std::string* error = nullptr);
+
+//--------------------------------------------------------------------------------------------------
+// Offline analysis
+
+struct JournalSummaryOptions
+{
+  std::string fromMark;  // First mark with this label; empty: the first mark
+  std::string toMark;    // Last mark with this label; empty: the last mark
+};
+
+struct JournalAllocation
+{
+  uint64_t    id    = 0;
+  uint64_t    bytes = 0;
+  uint64_t    frame = 0;  // Frame of the allocation
+  std::string category;
+  std::string name;
+};
+
+struct JournalCategoryChurn
+{
+  std::string category;
+  uint64_t    allocations    = 0;
+  uint64_t    frees          = 0;
+  uint64_t    allocatedBytes = 0;
+  uint64_t    freedBytes     = 0;
+  uint64_t    liveBytes      = 0;  // At the end of the journal
+  uint64_t    liveCount      = 0;
+};
+
+struct JournalCategoryGrowth
+{
+  std::string category;
+  int64_t     bytes = 0;  // Live bytes at the 'to' mark minus live bytes at the 'from' mark
+  int64_t     count = 0;
+};
+
+struct JournalSummary
+{
+  uint64_t frames = 0;  // Last frame seen
+  uint64_t events = 0;
+
+  std::vector<JournalAllocation> liveAllocations;  // Alive at the end, largest first
+  uint64_t                       liveBytes = 0;
+
+  std::vector<JournalCategoryChurn> churn;  // Sorted by category
+
+  bool                               hasGrowth = false;  // Both marks were found, 'from' before 'to'
+  std::string                        fromMark;
+  std::string                        toMark;
+  uint64_t                           fromFrame = 0;
+  uint64_t                           toFrame   = 0;
+  std::vector<JournalCategoryGrowth> growth;             // Non-zero categories, largest growth first
+  std::vector<JournalAllocation>     growthAllocations;  // Created between the marks, alive at 'to', largest first
+
+  uint64_t unmatchedFrees      = 0;  // Free of an id that was not alive
+  uint64_t replacedAllocations = 0;  // Allocate of an id that was still alive (missed free)
+};
+
+JournalSummary summarizeJournal(const AllocationJournalData& data, const JournalSummaryOptions& options = {});
+std::string    formatJournalSummary(const JournalSummary& summary, size_t maxAllocations = 20);
+
+}  // namespace nvvkgltf
@@ -18,11 +18,19 @@
  */
 
 #include "gpu_memory_tracker.hpp"
+#include "gpu_allocation_journal.hpp"
 
 #include <nvvk/render_target.hpp>
 
 namespace nvvkgltf {
 
+void GpuMemoryTracker::setJournal(AllocationJournal* journal, std::string_view owner)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_journal      = journal;
+  m_journalOwner = std::string(owner) + "/";
+}
+
 void GpuMemoryTracker::track(std::string_view category, const nvvk::RenderTarget& renderTarget, uint32_t colorCount)
 {
   VkExtent2D sz = renderTarget.getSize();
@@ -46,7 +54,10 @@ void GpuMemoryTracker::track(std::string_view category, VmaAllocation allocation
 
   std::lock_guard<std::mutex> lock(m_mutex);
   std::string                 categoryStr(category);
-  auto&                       stats = m_stats[categoryStr];
+  if(m_journal)
+    m_journal->recordAllocate(m_journalOwner + categoryStr, reinterpret_cast<uint64_t>(allocation), allocInfo.size,
+                              allocInfo.pName ? allocInfo.pName : "");
+  auto& stats = m_stats[categoryStr];
   stats.currentBytes += allocInfo.size;
   stats.currentCount += 1;
   stats.totalAllocations += 1;
@@ -81,7 +92,9 @@ void GpuMemoryTracker::untrack(std::string_view category, VmaAllocation allocati
 
   std::lock_guard<std::mutex> lock(m_mutex);
   std::string                 categoryStr(category);
-  auto                        it = m_stats.find(categoryStr);
+  if(m_journal)
+    m_journal->recordFree(m_journalOwner + categoryStr, reinterpret_cast<uint64_t>(allocation));
+  auto it = m_stats.find(categoryStr);
   if(it == m_stats.end())
     return;
 
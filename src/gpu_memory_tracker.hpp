@@ -42,6 +42,8 @@ class RenderTarget;
 
 namespace nvvkgltf {
 
+class AllocationJournal;
+
 // Sort criteria for category listing
 enum class CategorySortBy
 {
@@ -72,6 +74,9 @@ public:
   // Initialize with resource allocator to query allocation sizes
   void init(nvvk::ResourceAllocator* alloc) { m_alloc = alloc; }
 
+  // Opt-in: forward every track / untrack to the journal as "<owner>/<category>" events
+  void setJournal(AllocationJournal* journal, std::string_view owner);
+
   // Track an allocation - queries VMA for actual size
   void track(std::string_view category, VmaAllocation allocation);
 
@@ -104,7 +109,9 @@ public:
   void resetAll();
 
 private:
-  nvvk::ResourceAllocator*                        m_alloc = nullptr;
+  nvvk::ResourceAllocator*                        m_alloc   = nullptr;
+  AllocationJournal*                              m_journal = nullptr;
+  std::string                                     m_journalOwner;
   std::unordered_map<std::string, GpuMemoryStats> m_stats;
   mutable std::mutex                              m_mutex;
 };
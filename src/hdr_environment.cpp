@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// HDR environment decode, importance-sampling build and disk cache. See hdr_environment.hpp.
+//
+
+#include "hdr_environment.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include <glm/ext/scalar_constants.hpp>
+#include <stb/stb_image.h>
+
+#include <nvutils/file_operations.hpp>
+#include <nvutils/logger.hpp>
+#include <nvutils/timers.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t kCacheMagic       = 0x434C4249;  // "IBLC"
+constexpr char     kCacheExtension[] = ".iblcache";
+
+// Fixed-size header of a cache entry, followed by the pixels then the sampling table
+struct CacheHeader
+{
+  uint32_t magic      = kCacheMagic;
+  uint32_t version    = kHdrEnvDataVersion;
+  uint64_t key        = 0;
+  uint32_t width      = 0;
+  uint32_t height     = 0;
+  float    integral   = 0.0f;
+  float    average    = 0.0f;
+  uint64_t pixelBytes = 0;
+  uint64_t accelBytes = 0;
+};
+static_assert(sizeof(HdrEnvAccel) == 8, "HdrEnvAccel must match the shader's EnvAccel");
+
+//--------------------------------------------------------------------------------------------------
+// Alias map (Vose) over `importance`: texel i is kept with probability q, else its alias is taken,
+// so texels are drawn in proportion to their importance with one random lookup. Returns the sum of
+// the importance.
+float buildAliasMap(const std::vector<float>& importance, std::vector<HdrEnvAccel>& accel)
+{
+  const uint32_t size = static_cast<uint32_t>(importance.size());
+  double         sum  = 0.0;
+  for(float value : importance)
+    sum += value;
+
+  accel.resize(size);
+  if(sum <= 0.0)
+  {
+    // Nothing emits: sample uniformly
+    for(uint32_t i = 0; i < size; i++)
+      accel[i] = {i, 1.0f};
+    return 0.0f;
+  }
+
+  // Ratio of each texel's importance to the average, split into under- and overfull texels
+  const double          inverseAverage = double(size) / sum;
+  std::vector<uint32_t> partition(size);
+  uint32_t              small = 0;
+  uint32_t              large = size;
+  for(uint32_t i = 0; i < size; i++)
+  {
+    accel[i] = {i, static_cast<float>(importance[i] * inverseAverage)};
+    if(accel[i].q < 1.0f)
+      partition[small++] = i;
+    else
+      partition[--large] = i;
+  }
+
+  // Each underfull texel gives its remaining probability to an overfull one
+  for(uint32_t s = 0; s < large && large < size; s++)
+  {
+    const uint32_t smallIndex = partition[s];
+    const uint32_t largeIndex = partition[large];
+    accel[smallIndex].alias   = largeIndex;
+    accel[largeIndex].q -= 1.0f - accel[smallIndex].q;
+    if(accel[largeIndex].q < 1.0f)
+      large++;
+  }
+  return static_cast<float>(sum);
+}
+
+void touch(const fs::path& path)
+{
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// Texels are weighted by their solid angle on the sphere (rows near the poles cover less) times
+// their brightest channel. The PDF in alpha is with respect to the texel (divided by the integral).
+HdrEnvironmentData buildHdrEnvironmentData(std::vector<float>&& rgba, uint32_t width, uint32_t height)
+{
+  HdrEnvironmentData data;
+  data.width  = width;
+  data.height = height;
+  data.pixels = std::move(rgba);
+
+  const size_t       texelCount = size_t(width) * height;
+  std::vector<float> importance(texelCount);
+  const float        stepPhi   = 2.0f * glm::pi<float>() / float(width);
+  const float        stepTheta = glm::pi<float>() / float(height);
+  float              cosTheta0 = 1.0f;
+  double             luminance = 0.0;
+  for(uint32_t y = 0; y < height; y++)
+  {
+    const float cosTheta1 = std::cos(float(y + 1) * stepTheta);
+    const float area      = (cosTheta0 - cosTheta1) * stepPhi;
+    cosTheta0             = cosTheta1;
+    for(uint32_t x = 0; x < width; x++)
+    {
+      const size_t i  = size_t(y) * width + x;
+      const float* px = &data.pixels[i * 4];
+      importance[i]   = area * std::max(px[0], std::max(px[1], px[2]));
+      luminance += 0.2126f * px[0] + 0.7152f * px[1] + 0.0722f * px[2];
+    }
+  }
+  data.average  = texelCount > 0 ? static_cast<float>(luminance / double(texelCount)) : 0.0f;
+  data.integral = buildAliasMap(importance, data.accel);
+  if(data.integral <= 0.0f)
+    data.integral = 1.0f;
+
+  const float inverseIntegral = 1.0f / data.integral;
+  for(size_t i = 0; i < texelCount; i++)
+  {
+    float* px = &data.pixels[i * 4];
+    px[3]     = std::max(px[0], std::max(px[1], px[2])) * inverseIntegral;
+  }
+  return data;
+}
+
+HdrEnvironmentData makeDefaultHdrEnvironment()
+{
+  return buildHdrEnvironmentData({0.0f, 0.0f, 0.0f, 0.0f}, 1, 1);
+}
+
+//--------------------------------------------------------------------------------------------------
+// FNV-1a of the file bytes, then of the product version
+uint64_t hdrEnvCacheKey(const void* fileData, size_t fileSize)
+{
+  constexpr uint64_t kPrime = 1099511628211ull;
+  uint64_t           hash   = 14695981039346656037ull;
+  const auto*        bytes  = static_cast<const uint8_t*>(fileData);
+  for(size_t i = 0; i < fileSize; i++)
+    hash = (hash ^ bytes[i]) * kPrime;
+  for(uint32_t shift = 0; shift < 32; shift += 8)
+    hash = (hash ^ ((kHdrEnvDataVersion >> shift) & 0xFF)) * kPrime;
+  return hash;
+}
+
+fs::path HdrEnvCache::entryPath(uint64_t key) const
+{
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+  return m_directory / (std::string(name) + kCacheExtension);
+}
+
+bool HdrEnvCache::load(uint64_t key, HdrEnvironmentData& data) const
+{
+  data = {};
+  if(!enabled())
+    return false;
+
+  const fs::path path = entryPath(key);
+  std::ifstream  in(path, std::ios::binary);
+  if(!in)
+    return false;
+
+  CacheHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  const uint64_t  texelCount = uint64_t(header.width) * header.height;
+  std::error_code ec;
+  if(!in || header.magic != kCacheMagic || header.version != kHdrEnvDataVersion || header.key != key || texelCount == 0
+     || header.pixelBytes != texelCount * 4 * sizeof(float) || header.accelBytes != texelCount * sizeof(HdrEnvAccel)
+     || fs::file_size(path, ec) != sizeof(header) + header.pixelBytes + header.accelBytes)
+  {
+    LOGW("Ignoring invalid IBL cache entry: %s\n", nvutils::utf8FromPath(path).c_str());
+    return false;
+  }
+
+  data.width    = header.width;
+  data.height   = header.height;
+  data.integral = header.integral;
+  data.average  = header.average;
+  data.pixels.resize(texelCount * 4);
+  data.accel.resize(texelCount);
+  in.read(reinterpret_cast<char*>(data.pixels.data()), static_cast<std::streamsize>(header.pixelBytes));
+  in.read(reinterpret_cast<char*>(data.accel.data()), static_cast<std::streamsize>(header.accelBytes));
+  if(!in)
+  {
+    data = {};
+    return false;
+  }
+  in.close();
+  touch(path);  // Most recently used: last to be evicted
+  return true;
+}
+
+bool HdrEnvCache::store(uint64_t key, const HdrEnvironmentData& data) const
+{
+  if(!enabled() || !data.valid())
+    return false;
+
+  std::error_code ec;
+  fs::create_directories(m_directory, ec);
+
+  CacheHeader header;
+  header.key        = key;
+  header.width      = data.width;
+  header.height     = data.height;
+  header.integral   = data.integral;
+  header.average    = data.average;
+  header.pixelBytes = data.pixels.size() * sizeof(float);
+  header.accelBytes = data.accel.size() * sizeof(HdrEnvAccel);
+
+  const fs::path path = entryPath(key);
+  fs::path       temp = path;
+  temp += ".tmp";
+  {
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(data.pixels.data()), static_cast<std::streamsize>(header.pixelBytes));
+    out.write(reinterpret_cast<const char*>(data.accel.data()), static_cast<std::streamsize>(header.accelBytes));
+    out.flush();
+    if(!out)
+    {
+      out.close();
+      fs::remove(temp, ec);
+      return false;
+    }
+  }
+  fs::rename(temp, path, ec);
+  if(ec)
+  {
+    fs::remove(temp, ec);
+    return false;
+  }
+
+  trim();
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Least recently used first; the newest entry is always kept, even alone above the limit
+void HdrEnvCache::trim() const
+{
+  struct Entry
+  {
+    fs::path           path;
+    uint64_t           size;
+    fs::file_time_type time;
+  };
+  std::vector<Entry> entries;
+  uint64_t           total = 0;
+  std::error_code    ec;
+  for(const fs::directory_entry& file : fs::directory_iterator(m_directory, ec))
+  {
+    if(!file.is_regular_file(ec) || file.path().extension() != kCacheExtension)
+      continue;
+    const uint64_t size = file.file_size(ec);
+    entries.push_back({file.path(), size, file.last_write_time(ec)});
+    total += size;
+  }
+  if(total <= m_maxBytes)
+    return;
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.time < b.time; });
+  for(size_t i = 0; i + 1 < entries.size() && total > m_maxBytes; i++)
+  {
+    if(fs::remove(entries[i].path, ec))
+      total -= entries[i].size;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// The file is read once: its bytes give the cache key and, on a miss, are decoded from memory
+bool loadHdrEnvironment(const fs::path& filename, const HdrEnvCache& cache, HdrEnvironmentData& data, bool* fromCache)
+{
+  nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
+  if(fromCache)
+    *fromCache = false;
+
+  std::ifstream in(filename, std::ios::binary);
+  if(!in)
+  {
+    LOGE("%sCannot open %s\n", st.indent().c_str(), nvutils::utf8FromPath(filename).c_str());
+    return false;
+  }
+  const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  const uint64_t             key = hdrEnvCacheKey(bytes.data(), bytes.size());
+
+  if(cache.load(key, data))
+  {
+    if(fromCache)
+      *fromCache = true;
+    LOGI("%s%ux%u from IBL cache\n", st.indent().c_str(), data.width, data.height);
+    return true;
+  }
+
+  int    width    = 0;
+  int    height   = 0;
+  int    channels = 0;
+  float* decoded  = stbi_loadf_from_memory(bytes.data(), static_cast<int>(bytes.size()), &width, &height, &channels, 4);
+  if(decoded == nullptr || width <= 0 || height <= 0)
+  {
+    LOGE("%sFailed to decode %s: %s\n", st.indent().c_str(), nvutils::utf8FromPath(filename).c_str(), stbi_failure_reason());
+    stbi_image_free(decoded);
+    return false;
+  }
+  std::vector<float> rgba(decoded, decoded + size_t(width) * height * 4);
+  stbi_image_free(decoded);
+
+  data = buildHdrEnvironmentData(std::move(rgba), uint32_t(width), uint32_t(height));
+  cache.store(key, data);
+  LOGI("%s%ux%u decoded\n", st.indent().c_str(), data.width, data.height);
+  return true;
+}
+
+AsyncHdrLoad::~AsyncHdrLoad()
+{
+  wait();
+}
+
+bool AsyncHdrLoad::start(const fs::path& filename, const HdrEnvCache& cache)
+{
+  if(m_running.load())
+    return false;
+  wait();  // The previous, finished task
+
+  {
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    m_result.reset();
+  }
+  m_running = true;
+
+  m_task = nvvkgltf::TaskScheduler::shared().submit(
+      [this, filename, cache]() {
+        Result result;
+        result.filename = filename;
+        result.loaded   = loadHdrEnvironment(filename, cache, result.data, &result.fromCache);
+        {
+          std::lock_guard<std::mutex> lock(m_resultMutex);
+          m_result = std::move(result);
+        }
+        m_running = false;
+      },
+      {.name = "Load HDR environment", .priority = nvvkgltf::TaskPriority::eNormal});
+  return true;
+}
+
+void AsyncHdrLoad::wait()
+{
+  nvvkgltf::TaskScheduler::shared().wait(m_task);
+}
+
+std::optional<AsyncHdrLoad::Result> AsyncHdrLoad::takeResult()
+{
+  std::lock_guard<std::mutex> lock(m_resultMutex);
+  std::optional<Result>       result = std::move(m_result);
+  m_result.reset();
+  return result;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/*
+ * HdrEnvironmentData - CPU products of an HDR environment map, and their persistent cache
+ *
+ * Loading an environment decodes the .hdr file to RGBA32F and builds the importance-sampling table
+ * the path tracer draws light directions from: an alias map over the texels, weighted by radiance
+ * times solid angle. The alpha channel of the pixels holds the sampling PDF. For large maps this is
+ * seconds of CPU work, all of it depending only on the file content.
+ *
+ * HdrEnvCache keeps these products on disk, one file per environment. The key hashes the file
+ * content together with the layout version of the products (kHdrEnvDataVersion), so an edited file
+ * or a changed builder never reads a stale entry. Entries are written to a temporary file then
+ * renamed, and a header check (magic, version, key, sizes) rejects anything truncated or foreign.
+ *
+ * AsyncHdrLoad runs loadHdrEnvironment() as a task of the shared scheduler; the owner polls takeResult() and
+ * uploads the data (HdrEnvironmentVk) while the previous environment keeps rendering.
+ *
+ * No GPU dependency.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "task_scheduler.hpp"
+
+// Importance-sampling entry of one texel, laid out as the shader's EnvAccel (nvshaders/hdr_io.h.slang)
+struct HdrEnvAccel
+{
+  uint32_t alias = 0;     // Texel sampled instead when the random value falls above q
+  float    q     = 0.0f;  // Probability of keeping this texel
+};
+
+struct HdrEnvironmentData
+{
+  uint32_t                 width    = 0;
+  uint32_t                 height   = 0;
+  float                    integral = 1.0f;  // Sum of max(r,g,b) x solid angle over the texels
+  float                    average  = 0.0f;  // Average luminance
+  std::vector<float>       pixels;           // RGBA32F, alpha = sampling PDF
+  std::vector<HdrEnvAccel> accel;            // One entry per texel
+
+  [[nodiscard]] bool valid() const
+  {
+    return width > 0 && height > 0 && pixels.size() == size_t(width) * height * 4 && accel.size() == size_t(width) * height;
+  }
+};
+
+// Bumped whenever the products or their file layout change; part of every cache key
+constexpr uint32_t kHdrEnvDataVersion = 1;
+
+// Build the sampling data from decoded RGBA32F pixels (the alpha channel is overwritten)
+HdrEnvironmentData buildHdrEnvironmentData(std::vector<float>&& rgba, uint32_t width, uint32_t height);
+
+// 1x1 black environment, bound when no HDR is loaded so the descriptor sets stay valid
+HdrEnvironmentData makeDefaultHdrEnvironment();
+
+// Cache key of an environment file, from the bytes of the file
+uint64_t hdrEnvCacheKey(const void* fileData, size_t fileSize);
+
+class HdrEnvCache
+{
+public:
+  HdrEnvCache() = default;  // Disabled: load() misses, store() does nothing
+  explicit HdrEnvCache(std::filesystem::path directory, uint64_t maxBytes = 4ull << 30)
+      : m_directory(std::move(directory))
+      , m_maxBytes(maxBytes)
+  {
+  }
+
+  [[nodiscard]] bool                         enabled() const { return !m_directory.empty(); }
+  [[nodiscard]] const std::filesystem::path& directory() const { return m_directory; }
+  [[nodiscard]] std::filesystem::path        entryPath(uint64_t key) const;
+
+  // False if there is no valid entry for the key; `data` is then left empty
+  bool load(uint64_t key, HdrEnvironmentData& data) const;
+  // Write the entry, then evict the oldest entries while the cache exceeds maxBytes
+  bool store(uint64_t key, const HdrEnvironmentData& data) const;
+
+private:
+  void trim() const;
+
+  std::filesystem::path m_directory;
+  uint64_t              m_maxBytes = 0;
+};
+
+// Read and decode an .hdr file, or take its products from the cache (and store them after a
+// decode). False if the file can't be read or decoded. Safe to call from any thread.
+bool loadHdrEnvironment(const std::filesystem::path& filename, const HdrEnvCache& cache, HdrEnvironmentData& data, bool* fromCache = nullptr);
+
+/*
+ * AsyncHdrLoad - loadHdrEnvironment() as an eNormal task, one load at a time
+ *
+ * The owner polls takeResult() once per frame and uploads the data on its own thread. The
+ * destructor waits for a running load.
+ */
+class AsyncHdrLoad
+{
+public:
+  struct Result
+  {
+    std::filesystem::path filename;
+    HdrEnvironmentData    data;
+    bool                  loaded    = false;
+    bool                  fromCache = false;
+  };
+
+  AsyncHdrLoad() = default;
+  ~AsyncHdrLoad();
+  AsyncHdrLoad(const AsyncHdrLoad&)            = delete;
+  AsyncHdrLoad& operator=(const AsyncHdrLoad&) = delete;
+
+  // Start loading `filename`; false if a load is still running
+  bool start(const std::filesystem::path& filename, const HdrEnvCache& cache);
+
+  [[nodiscard]] bool isRunning() const { return m_running.load(); }
+  void               wait();
+
+  // The result of the finished load, once
+  [[nodiscard]] std::optional<Result> takeResult();
+
+private:
+  nvvkgltf::TaskHandle  m_task;
+  std::atomic<bool>     m_running{false};
+  std::mutex            m_resultMutex;
+  std::optional<Result> m_result;
+};
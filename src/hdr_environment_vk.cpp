@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// GPU resources of the HDR environment. See hdr_environment_vk.hpp.
+//
+
+#include "hdr_environment_vk.hpp"
+
+#include <span>
+
+#include <nvvk/barriers.hpp>
+#include <nvvk/check_error.hpp>
+#include <nvvk/debug_util.hpp>
+#include <nvvk/default_structs.hpp>
+#include <nvvk/mipmaps.hpp>
+
+#include "shaders/shaderio.h"
+
+static_assert(sizeof(HdrEnvAccel) == sizeof(shaderio::EnvAccel), "HdrEnvAccel must match EnvAccel");
+
+void HdrEnvironmentVk::init(nvvk::ResourceAllocator* alloc, nvvk::SamplerPool* samplerPool)
+{
+  m_alloc       = alloc;
+  m_samplerPool = samplerPool;
+  m_device      = alloc->getDevice();
+
+  m_bindings.addBinding(shaderio::EnvBindings::eHdr, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL);
+  m_bindings.addBinding(shaderio::EnvBindings::eImpSamples, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL);
+  NVVK_CHECK(m_bindings.createDescriptorSetLayout(m_device, 0, &m_descriptorSetLayout));
+  NVVK_DBG_NAME(m_descriptorSetLayout);
+
+  std::vector<VkDescriptorPoolSize> poolSizes = m_bindings.calculatePoolSizes();
+  VkDescriptorPoolCreateInfo        poolInfo{.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+                                               .maxSets       = 1,
+                                               .poolSizeCount = uint32_t(poolSizes.size()),
+                                               .pPoolSizes    = poolSizes.data()};
+  NVVK_CHECK(vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool));
+  NVVK_DBG_NAME(m_descriptorPool);
+
+  VkDescriptorSetAllocateInfo allocInfo{
+      .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+      .descriptorPool     = m_descriptorPool,
+      .descriptorSetCount = 1,
+      .pSetLayouts        = &m_descriptorSetLayout,
+  };
+  NVVK_CHECK(vkAllocateDescriptorSets(m_device, &allocInfo, &m_descriptorSet));
+  NVVK_DBG_NAME(m_descriptorSet);
+}
+
+void HdrEnvironmentVk::deinit()
+{
+  if(m_device == VK_NULL_HANDLE)
+    return;
+  destroy(m_uploaded);
+  destroy(m_current);
+  vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+  vkDestroyDescriptorSetLayout(m_device, m_descriptorSetLayout, nullptr);
+  m_bindings.clear();
+  m_descriptorPool      = VK_NULL_HANDLE;
+  m_descriptorSetLayout = VK_NULL_HANDLE;
+  m_descriptorSet       = VK_NULL_HANDLE;
+  m_device              = VK_NULL_HANDLE;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Same layout transitions as SceneVk::createImage: TRANSFER_DST for the copy and the mip chain,
+// then SHADER_READ_ONLY
+void HdrEnvironmentVk::cmdUpload(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const HdrEnvironmentData& data, bool generateMipmaps)
+{
+  destroy(m_uploaded);
+
+  Environment& env = m_uploaded;
+  env.size         = {data.width, data.height};
+  env.integral     = data.integral;
+  env.average      = data.average;
+
+  VkImageCreateInfo imageInfo = DEFAULT_VkImageCreateInfo;
+  imageInfo.extent            = {data.width, data.height, 1};
+  imageInfo.format            = VK_FORMAT_R32G32B32A32_SFLOAT;
+  imageInfo.usage             = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  imageInfo.mipLevels         = (generateMipmaps && data.width > 1 && data.height > 1) ? nvvk::mipLevels(env.size) : 1;
+  NVVK_CHECK(m_alloc->createImage(env.image, imageInfo, DEFAULT_VkImageViewCreateInfo));
+  NVVK_DBG_NAME(env.image.image);
+  NVVK_DBG_NAME(env.image.descriptor.imageView);
+
+  VkSamplerCreateInfo samplerInfo{VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+  samplerInfo.magFilter    = VK_FILTER_LINEAR;
+  samplerInfo.minFilter    = VK_FILTER_LINEAR;
+  samplerInfo.mipmapMode   = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+  samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;  // Longitude wraps around
+  samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+  samplerInfo.maxLod       = VK_LOD_CLAMP_NONE;
+  NVVK_CHECK(m_samplerPool->acquireSampler(env.image.descriptor.sampler, samplerInfo));
+
+  env.image.descriptor.imageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  nvvk::cmdImageMemoryBarrier(cmd, {env.image.image, VK_IMAGE_LAYOUT_UNDEFINED, env.image.descriptor.imageLayout});
+  const std::span<const uint8_t> pixels(reinterpret_cast<const uint8_t*>(data.pixels.data()), std::span(data.pixels).size_bytes());
+  NVVK_CHECK(staging.appendImage(env.image, pixels, env.image.descriptor.imageLayout));
+
+  NVVK_CHECK(m_alloc->createBuffer(env.accel, std::span(data.accel).size_bytes(), VK_BUFFER_USAGE_2_STORAGE_BUFFER_BIT));
+  NVVK_DBG_NAME(env.accel.buffer);
+  NVVK_CHECK(staging.appendBuffer(env.accel, 0, std::span(data.accel)));
+  staging.cmdUploadAppended(cmd);
+
+  if(imageInfo.mipLevels > 1)
+  {
+    nvvk::cmdGenerateMipmaps(cmd, env.image.image, env.size, imageInfo.mipLevels, 1, env.image.descriptor.imageLayout);
+  }
+  env.image.descriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  nvvk::cmdImageMemoryBarrier(cmd, {env.image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, env.image.descriptor.imageLayout});
+}
+
+void HdrEnvironmentVk::activateUploaded()
+{
+  if(!hasUploaded())
+    return;
+  destroy(m_current);
+  m_current  = m_uploaded;
+  m_uploaded = {};
+  writeDescriptorSet();
+}
+
+void HdrEnvironmentVk::writeDescriptorSet()
+{
+  const VkDescriptorBufferInfo accelInfo{m_current.accel.buffer, 0, VK_WHOLE_SIZE};
+  nvvk::WriteSetContainer      write{};
+  write.append(m_bindings.getWriteSet(shaderio::EnvBindings::eHdr, m_descriptorSet), m_current.image);
+  write.append(m_bindings.getWriteSet(shaderio::EnvBindings::eImpSamples, m_descriptorSet), accelInfo);
+  vkUpdateDescriptorSets(m_device, write.size(), write.data(), 0, nullptr);
+}
+
+void HdrEnvironmentVk::destroy(Environment& env)
+{
+  if(env.image.descriptor.sampler != VK_NULL_HANDLE)
+    m_samplerPool->releaseSampler(env.image.descriptor.sampler);
+  if(env.image.image != VK_NULL_HANDLE)
+    m_alloc->destroyImage(env.image);
+  if(env.accel.buffer != VK_NULL_HANDLE)
+    m_alloc->destroyBuffer(env.accel);
+  env = {};
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/*
+ * HdrEnvironmentVk - GPU side of the HDR environment (image + importance-sampling buffer)
+ *
+ * Takes the place of nvvk::HdrIbl, with the CPU work moved out (HdrEnvironmentData, built or read
+ * from the cache on another thread). The descriptor set layout matches HdrIbl's (EnvBindings::eHdr,
+ * EnvBindings::eImpSamples), so HdrEnvDome and the path tracer bind it unchanged.
+ *
+ * Replacing the environment is two steps: cmdUpload() records the upload of the new data into
+ * resources of their own while the current environment keeps rendering, then activateUploaded()
+ * switches to them and destroys the previous ones. The layout never changes, so pipelines built
+ * against it stay valid.
+ */
+
+#include <vulkan/vulkan_core.h>
+
+#include <nvvk/descriptors.hpp>
+#include <nvvk/resource_allocator.hpp>
+#include <nvvk/sampler_pool.hpp>
+#include <nvvk/staging.hpp>
+
+#include "hdr_environment.hpp"
+
+class HdrEnvironmentVk
+{
+public:
+  void init(nvvk::ResourceAllocator* alloc, nvvk::SamplerPool* samplerPool);
+  void deinit();
+
+  // Record the upload of `data` (image with optional mipmaps, sampling buffer). The current
+  // environment is untouched; a previous upload that was never activated is dropped.
+  void cmdUpload(VkCommandBuffer cmd, nvvk::StagingUploader& staging, const HdrEnvironmentData& data, bool generateMipmaps = true);
+  // Make the uploaded environment current. The GPU must be done with the upload and with the
+  // previous environment, which is destroyed.
+  void activateUploaded();
+  [[nodiscard]] bool hasUploaded() const { return m_uploaded.image.image != VK_NULL_HANDLE; }
+
+  float                 getIntegral() const { return m_current.integral; }
+  float                 getAverage() const { return m_current.average; }
+  VkDescriptorSetLayout getDescriptorSetLayout() const { return m_descriptorSetLayout; }
+  VkDescriptorSet       getDescriptorSet() const { return m_descriptorSet; }
+  const nvvk::Image&    getHdrImage() const { return m_current.image; }
+  VkExtent2D            getHdrImageSize() const { return m_current.size; }
+
+private:
+  struct Environment
+  {
+    nvvk::Image  image;
+    nvvk::Buffer accel;
+    VkExtent2D   size{};
+    float        integral = 1.0f;
+    float        average  = 0.0f;
+  };
+  void destroy(Environment& env);
+  void writeDescriptorSet();
+
+  nvvk::ResourceAllocator* m_alloc{};
+  nvvk::SamplerPool*       m_samplerPool{};
+  VkDevice                 m_device{};
+
+  nvvk::DescriptorBindings m_bindings;
+  VkDescriptorSetLayout    m_descriptorSetLayout{};
+  VkDescriptorPool         m_descriptorPool{};
+  VkDescriptorSet          m_descriptorSet{};
+
+  Environment m_current;   // Bound in the descriptor set
+  Environment m_uploaded;  // Recorded by cmdUpload(), waiting for activateUploaded()
+};
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_memory_tracker.hpp"
+
+#include <algorithm>
+
+namespace nvvkgltf {
+
+void HostMemoryTracker::updatePeaks(HostMemoryStats& stats)
+{
+  stats.peakBytes = std::max(stats.peakBytes, stats.currentBytes);
+  m_totalPeak     = std::max(m_totalPeak, m_totalBytes);
+}
+
+void HostMemoryTracker::set(std::string_view category, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto&                       stats = m_stats[std::string(category)];
+  m_totalBytes                      = m_totalBytes - stats.currentBytes + bytes;
+  stats.currentBytes                = bytes;
+  updatePeaks(stats);
+}
+
+void HostMemoryTracker::track(std::string_view category, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto&                       stats = m_stats[std::string(category)];
+  stats.currentBytes += bytes;
+  m_totalBytes += bytes;
+  updatePeaks(stats);
+}
+
+void HostMemoryTracker::untrack(std::string_view category, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto                        it = m_stats.find(std::string(category));
+  if(it == m_stats.end())
+    return;
+  const uint64_t removed = std::min(bytes, it->second.currentBytes);
+  it->second.currentBytes -= removed;
+  m_totalBytes -= removed;
+}
+
+HostMemoryStats HostMemoryTracker::getStats(std::string_view category) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto                        it = m_stats.find(std::string(category));
+  return it != m_stats.end() ? it->second : HostMemoryStats{};
+}
+
+HostMemoryStats HostMemoryTracker::getTotalStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return {.currentBytes = m_totalBytes, .peakBytes = m_totalPeak};
+}
+
+std::vector<std::string> HostMemoryTracker::getCategories() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::string>    categories;
+  for(const auto& [name, stats] : m_stats)
+  {
+    if(stats.currentBytes > 0 || stats.peakBytes > 0)
+      categories.push_back(name);
+  }
+  std::sort(categories.begin(), categories.end());
+  return categories;
+}
+
+void HostMemoryTracker::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(auto& [name, stats] : m_stats)
+    stats = {};
+  m_totalBytes = 0;
+  m_totalPeak  = 0;
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Host-memory counterpart of GpuMemoryTracker: current and peak bytes per named
+// category ("Model/Buffers", "Animation/Skin", ...). Long-lived containers are
+// measured by their owners (reportHostMemory / sizeInBytes) and set() here;
+// transient allocations, like decoded images waiting for upload, are tracked
+// and untracked around their lifetime so the peak catches them.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace nvvkgltf {
+
+struct HostMemoryStats
+{
+  uint64_t currentBytes = 0;
+  uint64_t peakBytes    = 0;  // High water mark since the last reset()
+};
+
+// Thread-safe: every method may be called concurrently.
+class HostMemoryTracker
+{
+public:
+  // Measured size of a category's containers: replaces the current value
+  void set(std::string_view category, uint64_t bytes);
+
+  // Transient allocations: added to / removed from the current value
+  void track(std::string_view category, uint64_t bytes);
+  void untrack(std::string_view category, uint64_t bytes);
+
+  HostMemoryStats getStats(std::string_view category) const;
+
+  // Sum of the categories. The peak is the high water mark of the sum, not the sum of the peaks.
+  HostMemoryStats getTotalStats() const;
+
+  // Categories with current or peak bytes, sorted by name
+  std::vector<std::string> getCategories() const;
+
+  // Keep the categories, restart current and peak from zero (new scene)
+  void reset();
+
+private:
+  void updatePeaks(HostMemoryStats& stats);  // Requires m_mutex
+
+  std::unordered_map<std::string, HostMemoryStats> m_stats;
+  uint64_t                                         m_totalBytes = 0;
+  uint64_t                                         m_totalPeak  = 0;
+  mutable std::mutex                               m_mutex;
+};
+
+//--------------------------------------------------------------------------------------------------
+// Heap size of common containers, for the sizeInBytes() / reportHostMemory() implementations.
+// Allocator overhead is ignored; hashed containers count one node (value + next pointer + hash)
+// per element and one pointer per bucket.
+
+template <typename T>
+inline uint64_t containerBytes(const std::vector<T>& v)
+{
+  return uint64_t(v.capacity()) * sizeof(T);
+}
+
+inline uint64_t containerBytes(const std::string& s)
+{
+  return s.capacity() > std::string().capacity() ? uint64_t(s.capacity()) + 1 : 0;  // Beyond the small-string buffer
+}
+
+template <typename K, typename V, typename... Rest>
+inline uint64_t containerBytes(const std::unordered_map<K, V, Rest...>& m)
+{
+  return uint64_t(m.size()) * (sizeof(std::pair<const K, V>) + 2 * sizeof(void*)) + uint64_t(m.bucket_count()) * sizeof(void*);
+}
+
+template <typename K, typename... Rest>
+inline uint64_t containerBytes(const std::unordered_set<K, Rest...>& s)
+{
+  return uint64_t(s.size()) * (sizeof(K) + 2 * sizeof(void*)) + uint64_t(s.bucket_count()) * sizeof(void*);
+}
+
+}  // namespace nvvkgltf
@@ -42,7 +42,11 @@
 #include <nvvk/context.hpp>
 #include <nvvk/validation_settings.hpp>
 
+#include "gltf_scene_estimate.hpp"
+#include "gltf_scene_optimizer.hpp"
+#include "gpu_allocation_journal.hpp"
 #include "renderer.hpp"
+#include "task_scheduler.hpp"
 #include "docs/app_icon_png.h"
 #include "version.hpp"
 
@@ -113,6 +117,20 @@ auto main(int argc, char** argv) -> int
   parameterRegistry.add({"floatingWindows", "Allow dock windows to be separate windows"}, &appInfo.hasUndockableViewport, true);
   bool useOpacityMicromap = true;
   parameterRegistry.add({"useOpacityMicromap", "Use EXT_mesh_opacity_micromap opacity micromaps when supported"}, &useOpacityMicromap);
+  bool estimateOnly = false;
+  parameterRegistry.add({"estimate", "Print the estimated GPU/CPU memory and load time of --scenefile, then exit"}, &estimateOnly, true);
+  std::filesystem::path           journalSummaryPath;
+  nvvkgltf::JournalSummaryOptions journalOptions;
+  parameterRegistry.add({"journalSummary", "Print the summary of an --allocJournal file, then exit"}, &journalSummaryPath);
+  parameterRegistry.add({"journalFrom", "Mark label starting the growth window (default: first mark)"}, &journalOptions.fromMark);
+  parameterRegistry.add({"journalTo", "Mark label ending the growth window (default: last mark)"}, &journalOptions.toMark);
+  int workerThreads = 0;
+  parameterRegistry.add({"workerThreads", "Worker threads of the task scheduler (0: hardware concurrency, minimum 2)"}, &workerThreads);
+  std::filesystem::path optimizedFilename;
+  std::string           optimizePasses = nvvkgltf::formatSceneOptimizePasses({});
+  parameterRegistry.add({"optimize", "Write an optimized copy of --scenefile to this .gltf/.glb, print the report, then exit"}, &optimizedFilename);
+  parameterRegistry.add({"optimizePasses", "Comma-separated passes of --optimize: compact, dedup, tangents, vcache, quantize, meshopt, all"},
+                        &optimizePasses);
 
   // Don't show the profiler by default
   auto profilerSettings  = std::make_shared<nvapp::ElementProfiler::ViewSettings>();
@@ -129,6 +147,7 @@ auto main(int argc, char** argv) -> int
   cli.add(parameterRegistry);
   cli.parse(argc, argv);
   cli.setVerbose(benchmarkOptions.enabled);
+  nvvkgltf::TaskScheduler::setSharedWorkerCount(uint32_t(std::max(0, workerThreads)));  // Before the first task
 
   if(appInfo.headless)
   {
@@ -149,6 +168,52 @@ auto main(int argc, char** argv) -> int
   logger.setMinimumLogLevel(logLevel);
   logger.setShowFlags(logShow);
 
+  // Dry run: only the JSON and the image headers are read, no device is created
+  if(estimateOnly)
+  {
+    nvvkgltf::SceneEstimate estimate;
+    std::string             error;
+    if(!nvvkgltf::estimateScene(sceneFilename, estimate, {}, &error))
+    {
+      LOGE("Cannot estimate %s: %s\n", nvutils::utf8FromPath(sceneFilename).c_str(), error.c_str());
+      return 1;
+    }
+    LOGI("%s\n%s", nvutils::utf8FromPath(sceneFilename).c_str(), nvvkgltf::formatSceneEstimate(estimate).c_str());
+    return 0;
+  }
+
+  // Offline optimization: load, rewrite, save; no device is created
+  if(!optimizedFilename.empty())
+  {
+    nvvkgltf::SceneOptimizeOptions options;
+    nvvkgltf::SceneOptimizeReport  report;
+    std::string                    error;
+    if(!nvvkgltf::parseSceneOptimizePasses(optimizePasses, options, &error)
+       || !nvvkgltf::optimizeSceneFile(sceneFilename, optimizedFilename, options, report, &error))
+    {
+      LOGE("Cannot optimize %s: %s\n", nvutils::utf8FromPath(sceneFilename).c_str(), error.c_str());
+      return 1;
+    }
+    LOGI("%s -> %s (%s)\n%s", nvutils::utf8FromPath(sceneFilename).c_str(), nvutils::utf8FromPath(optimizedFilename).c_str(),
+         nvvkgltf::formatSceneOptimizePasses(options).c_str(), nvvkgltf::formatSceneOptimizeReport(report).c_str());
+    return 0;
+  }
+
+  // Offline analysis of a journal written by --allocJournal
+  if(!journalSummaryPath.empty())
+  {
+    nvvkgltf::AllocationJournalData journal;
+    std::string                     error;
+    if(!nvvkgltf::loadAllocationJournal(journalSummaryPath, journal, &error))
+    {
+      LOGE("Cannot read %s: %s\n", nvutils::utf8FromPath(journalSummaryPath).c_str(), error.c_str());
+      return 1;
+    }
+    LOGI("%s\n%s", nvutils::utf8FromPath(journalSummaryPath).c_str(),
+         nvvkgltf::formatJournalSummary(nvvkgltf::summarizeJournal(journal, journalOptions)).c_str());
+    return 0;
+  }
+
   std::shared_ptr<nvapp::ElementSequencer> elemSequencer;
   if(sequencerInfo.hasScript())
   {
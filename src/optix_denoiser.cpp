@@ -89,13 +89,17 @@ void OptiXDenoiser::init(Resources& resources)
   // Memory tracking: denoiser RenderTargets use the main allocator; export buffers use m_allocExport.
   m_appMemoryTracker = &resources.appMemoryTracker;
 
-  // Create render targets for denoiser output and guides
+  // Create render targets for denoiser output and guides.
+  // The denoised output follows the rendered image precision; the guide stays RGBA32F because its
+  // alpha carries the bit-packed normal.
+  m_halfOutput = (resources.settings.colorPrecision == ColorPrecision::eHalf);
   resources.samplerPool.acquireSampler(m_linearSampler);
   NVVK_CHECK(m_denoiserTarget.init({.device = resources.allocator.getDevice(),
                                     .alloc  = &resources.allocator,
                                     .colorFormats =
                                         {
-                                            VK_FORMAT_R32G32B32A32_SFLOAT,  // Output denoised image (index 0)
+                                            m_halfOutput ? VK_FORMAT_R16G16B16A16_SFLOAT :
+                                                           VK_FORMAT_R32G32B32A32_SFLOAT,  // Output denoised image (index 0)
                                             VK_FORMAT_R32G32B32A32_SFLOAT,  // OptiX Albedo+Normal (index 1)
                                         },
                                     .debugName = "OptiX-IO"}));
@@ -242,9 +246,10 @@ bool OptiXDenoiser::createSharedBuffers()
   }
 
   // Calculate buffer sizes
-  size_t pixelSize        = sizeof(float) * 4;  // RGBA float
+  size_t pixelSize        = sizeof(float) * 4;                       // RGBA float
+  size_t outputPixelSize  = m_halfOutput ? sizeof(uint16_t) * 4 : pixelSize;  // Matches the denoised image format
   size_t inputBufferSize  = m_inputSize.width * m_inputSize.height * pixelSize;
-  size_t outputBufferSize = m_outputSize.width * m_outputSize.height * pixelSize;
+  size_t outputBufferSize = m_outputSize.width * m_outputSize.height * outputPixelSize;
 
   // Create shared buffers with export flags and DEDICATED memory to ensure each gets its own memory block
   VkBufferUsageFlags2KHR usage =
@@ -511,14 +516,16 @@ bool OptiXDenoiser::executeDenoising()
         .format             = OPTIX_PIXEL_FORMAT_FLOAT4,
     };
 
-    // Output format at display (output) resolution
+    // Output format at display (output) resolution, written straight in the denoised image format
+    const unsigned int outputPixelStride = m_halfOutput ? sizeof(uint16_t) * 4 : sizeof(float) * 4;
+
     OptixImage2D outputFormat = {
         .data               = 0,
         .width              = m_outputSize.width,
         .height             = m_outputSize.height,
-        .rowStrideInBytes   = static_cast<unsigned int>(sizeof(float) * 4 * m_outputSize.width),
-        .pixelStrideInBytes = sizeof(float) * 4,
-        .format             = OPTIX_PIXEL_FORMAT_FLOAT4,
+        .rowStrideInBytes   = outputPixelStride * m_outputSize.width,
+        .pixelStrideInBytes = outputPixelStride,
+        .format             = m_halfOutput ? OPTIX_PIXEL_FORMAT_HALF4 : OPTIX_PIXEL_FORMAT_FLOAT4,
     };
 
     // RGB input
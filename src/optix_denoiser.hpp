@@ -235,6 +235,7 @@ private:
   VkExtent2D   m_inputSize{};   // Render/input resolution (half for upscale, full for AOV)
   Availability m_availability         = Availability::eNotChecked;
   bool         m_hasValidOutput       = false;
+  bool         m_halfOutput           = false;  // Denoised output in RGBA16F (follows Settings::colorPrecision)
   bool         m_needModelRecreate    = false;  // Denoiser must be destroyed and recreated
   uint64_t     m_lastAutoDenoiseFrame = 0;      // Track last frame we auto-denoised
 
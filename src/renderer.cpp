@@ -50,7 +50,6 @@
 #define IMGUI_DEFINE_MATH_OPERATORS
 
 #include <cmath>
-#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vulkan/vulkan_core.h>
@@ -92,6 +91,7 @@
 
 #include "renderer.hpp"
 #include "scene_descriptor.hpp"
+#include "scene_descriptor_loader.hpp"
 #include "tinygltf_utils.hpp"
 #include "utils.hpp"
 #include "tinyobjloader/tiny_obj_loader.h"
@@ -158,6 +158,11 @@ GltfRenderer::GltfRenderer(nvutils::ParameterRegistry* paramReg, const nvutils::
   paramReg->add({"hdrEnvIntensity", "HDR Environment Intensity"}, &m_resources.settings.hdrEnvIntensity);
   paramReg->add({"hdrEnvRotation", "HDR Environment Rotation"}, &m_resources.settings.hdrEnvRotation);
   paramReg->add({"hdrBlur", "HDR Environment Blur"}, &m_resources.settings.hdrBlur);
+  paramReg->add({"hdrCache", "Cache decoded HDR environments on disk (ibl_cache next to the executable)"}, &m_useHdrCache);
+  paramReg->add({"memoryBudgetMB", "Reject glTF scenes whose estimated GPU memory exceeds this budget (0: no budget)"}, &m_memoryBudgetMB);
+  paramReg->add({"hotReload", "Watch the scene files and apply their changes while rendering"}, &m_hotReload);
+  paramReg->add({"allocJournal", "Record every GPU allocation/free to this file (written on exit, with a summary in the log)"},
+                &m_allocJournalPath);
   paramReg->addVector({"silhouetteColor", "Color of the silhouette"}, &m_resources.settings.silhouetteColor);
   paramReg->add({"visualization", "Visualization Mode"}, (int*)&m_resources.settings.visualization);
   paramReg->add({"wireframe", "Enable wireframe overlay"}, &m_resources.settings.wireframe);
@@ -169,6 +174,14 @@ GltfRenderer::GltfRenderer(nvutils::ParameterRegistry* paramReg, const nvutils::
   paramReg->addVector({"solidBackgroundColor", "Solid Background Color"}, &m_resources.settings.solidBackgroundColor);
   paramReg->add({"maxFrames", "Maximum number of iterations"}, &m_resources.settings.maxFrames);
   paramReg->add({"output", "Output image file path for headless mode"}, &m_resources.headlessOutputPath);
+  paramReg->add({"colorPrecision", "Rendered image precision: [Full (RGBA32F):0, Half (RGBA16F):1]"},
+                (int*)&m_resources.settings.colorPrecision);
+  paramReg->add({"gpuNodeAnimation", "Evaluate rigid node animations on the GPU"}, &m_resources.sceneGpu.useGpuNodeAnimation);
+  paramReg->add({"animationStep", "Advance animations by this many seconds per frame instead of the real frame time (0: real time)"},
+                &m_animationStep);
+  paramReg->add({"animationPipelineDepth",
+                 "Headless with --animationStep: evaluate the animation of up to this many frames ahead (0: serial)"},
+                &m_animationPipelineDepth);
 
   paramReg->add({"tmMethod", "Tonemapper method: [Filmic:0, Uncharted:1, Clip:2, ACES:3, AgX:4, KhronosPBR:5]"},
                 &m_resources.tonemapperData.method);
@@ -292,14 +305,18 @@ void GltfRenderer::onAttach(nvapp::Application* app)
 
   // Application-level memory tracker (frame targets, DLSS, OptiX images)
   m_resources.appMemoryTracker.init(&m_resources.allocator);
+  initAllocationJournal();
 
   // G-Buffer
+  const VkFormat renderedFormat = (m_resources.settings.colorPrecision == ColorPrecision::eHalf) ?
+                                      VK_FORMAT_R16G16B16A16_SFLOAT :
+                                      VK_FORMAT_R32G32B32A32_SFLOAT;
   NVVK_CHECK(m_resources.gBuffers.init({.device = m_device,
                                         .alloc  = &m_resources.allocator,
                                         .colorFormats =
                                             {
-                                                VK_FORMAT_R8G8B8A8_UNORM,       // Tonemapped (eImgTonemapped)
-                                                VK_FORMAT_R32G32B32A32_SFLOAT,  // Rendered image (eImgRendered)
+                                                VK_FORMAT_R8G8B8A8_UNORM,  // Tonemapped (eImgTonemapped)
+                                                renderedFormat,            // Rendered image (eImgRendered)
                                                 VK_FORMAT_R32_SFLOAT,  // ObjectID for selection/silhouette (eImgSelection), .r = render node ID+1
                                             },
                                         .depthFormat = nvvk::findDepthFormat(app->getPhysicalDevice()),
@@ -329,6 +346,7 @@ void GltfRenderer::onAttach(nvapp::Application* app)
   // ===== Scene & Acceleration Structure =====
   m_resources.sceneGpu.init(&m_resources.allocator, &m_resources.samplerPool, m_app->getQueue(0).queue,
                             [app](std::function<void()>&& fn) { app->submitResourceFree(std::move(fn)); });
+  m_resources.sceneVk.setHostMemoryTracker(&m_resources.hostMemoryTracker);
   m_resources.transformCompute.init(&m_resources.allocator);
   m_resources.transformCompute.setGraphicsQueue(m_app->getQueue(0).queue);
   m_resources.transformCompute.setDeferredFree(
@@ -423,6 +441,8 @@ void GltfRenderer::onAttach(nvapp::Application* app)
     m_visualHelpers.transform.setOnTransformBegin([this]() {
       if(m_gizmoNodeIndex >= 0 && m_resources.getScene())
       {
+        // The drag edits the model: bring it up to date with GPU-played node animation first
+        m_resources.getScene()->animation().syncGpuNodeAnimationToCpu();
         const auto& node = m_resources.getScene()->editor().getNode(m_gizmoNodeIndex);
         tinygltf::utils::getNodeTRS(node, m_gizmoSnapshotT, m_gizmoSnapshotR, m_gizmoSnapshotS);
       }
@@ -456,12 +476,15 @@ void GltfRenderer::onAttach(nvapp::Application* app)
 // Detach the renderers and destroy the resources
 void GltfRenderer::onDetach()
 {
+  // A load still running would touch the resources destroyed below
+  nvvkgltf::TaskScheduler::shared().wait(m_sceneTask);
   // SYNC NOTE: Full device wait during shutdown is the standard Vulkan teardown pattern.
   vkDeviceWaitIdle(m_device);
   m_visualHelpers.deinit();
   m_pathTracer.onDetach(m_resources);
   m_rasterizer.onDetach(m_resources);
   destroyResources();
+  writeAllocationJournal();
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -540,7 +563,12 @@ std::vector<BenchmarkController::MemorySample> GltfRenderer::benchmarkMemorySamp
                                + sumTrackerPeakBytes(m_resources.sceneRtx.getMemoryTracker())
                                + sumTrackerPeakBytes(m_resources.transformCompute.getMemoryTracker())
                                + sumTrackerPeakBytes(m_resources.animationVk.getMemoryTracker());
-    samples.push_back({.category = "Scene", .deviceUsed = sceneUsed, .deviceAllocated = scenePeak});
+    const nvvkgltf::HostMemoryStats host = m_resources.hostMemoryTracker.getTotalStats();
+    samples.push_back({.category        = "Scene",
+                       .hostUsed        = host.currentBytes,
+                       .deviceUsed      = sceneUsed,
+                       .deviceAllocated = scenePeak,
+                       .hostPeak        = host.peakBytes});
   }
   else
   {
@@ -602,12 +630,22 @@ void GltfRenderer::onRender(VkCommandBuffer cmd)
     resetFrame();
   }
 
+  if(m_allocJournal)
+    m_allocJournal->setFrame(++m_allocJournalFrame);
+
+  // Background HDR environment load finished: queue its upload (switched to by onHdrUploaded)
+  finishHdrLoad();
+
   // Loading pipeline: submit queued work, poll completion, run callbacks
   if(isAutomatedRun())
     m_loadPipeline.drain();
   else if(m_loadPipeline.poll())
     return;  // Still loading -- give control back to the UI
 
+  // Scene files changed on disk (--hotReload): geometry and image updates go through the loading pipeline
+  if(updateHotReload())
+    return;
+
   // Begin the frame for the staging uploader, using the semaphore from the current frame to clear and synchronize
   m_resources.staging.beginFrame(m_app->getFrameSignalSemaphore());
 
@@ -746,6 +784,14 @@ void GltfRenderer::onRender(VkCommandBuffer cmd)
 void GltfRenderer::benchmarkAdvance(const nvutils::ParameterSequencer::State& state)
 {
   (void)state;
+  nvvkgltf::Scene* scn = m_resources.getScene();
+  if(scn && (scn->animation().hasMorphTargets() || scn->animation().hasSkinning()))
+  {
+    const nvvkgltf::DeformSkipStats stats = scn->animation().takeDeformationStats();
+    m_benchmark.emitSequenceDeformation({stats.frames, stats.morphEvaluated, stats.morphAtRest, stats.morphUnchanged,
+                                         stats.skinEvaluated, stats.skinUnchanged, stats.verticesSkipped});
+  }
+  updateHostMemory();
   m_benchmark.emitSequenceMemory(benchmarkMemorySamples());
 }
 
@@ -792,31 +838,44 @@ void GltfRenderer::addSceneFromFile(const std::filesystem::path& filename, bool
   // menu entry points reach here directly, so idle here to cover both. (main thread; see VUID-00922)
   vkQueueWaitIdle(m_app->getQueue(0).queue);
 
-  // Set busy BEFORE starting the worker thread to prevent UI access during scene modification
+  // The imported content is not in the watched file, and the full rebuild below clears the undo
+  // history: a hot reload must not replace the scene from now on
+  m_sceneEditedOutsideUndo = true;
+
+  // Set busy BEFORE starting the task to prevent UI access during scene modification
   m_busy.start(asReference ? "Referencing Scene" : "Merging Scene");
 
-  std::thread([=, this]() {
-    const int         nodeIdx = asReference ? m_resources.getScene()->referenceScene(filename) :
-                                              m_resources.getScene()->mergeScene(filename, static_cast<uint32_t>(m_maxTextures));
-    const std::string name    = nvutils::utf8FromPath(filename.filename());
-    if(nodeIdx >= 0)
-    {
-      m_undoStack.clear();
-      rebuildVulkanSceneFull();
-      // Imported glTF may bring extensions the previous scene didn't use; recompute so optimal-mode
-      // rebuilds the shader if the feature set widened.
-      m_resources.recomputeSceneFeatures(dlssGuideRequired());
-      resetFrame();
-      m_sceneSelection.selectNode(nodeIdx);
-      m_sceneBrowser.focusOnSelection();
-      LOGI("Scene %s successfully: %s\n", asReference ? "referenced" : "merged", name.c_str());
-    }
-    else
-    {
-      LOGE("Failed to %s scene: %s\n", asReference ? "reference" : "merge", name.c_str());
-    }
-    m_busy.stop();
-  }).detach();
+  m_sceneTask = nvvkgltf::TaskScheduler::shared().submit(
+      [=, this]() {
+        const int         nodeIdx = asReference ? m_resources.getScene()->referenceScene(filename) :
+                                                  m_resources.getScene()->mergeScene(filename, static_cast<uint32_t>(m_maxTextures));
+        const std::string name    = nvutils::utf8FromPath(filename.filename());
+        if(nodeIdx >= 0)
+        {
+          // An import that only appended is uploaded on top of the existing GPU scene; existing node,
+          // mesh and material indices are unchanged, so the undo history stays valid. Anything else
+          // (indices shifted, first build, placeholder textures, micromaps) takes the full rebuild.
+          const std::optional<nvvkgltf::SceneAppendInfo> appended = m_resources.getScene()->takeLastAppend();
+          if(!appended || !appendVulkanScene(*appended))
+          {
+            m_undoStack.clear();
+            rebuildVulkanSceneFull();
+          }
+          // Imported glTF may bring extensions the previous scene didn't use; recompute so optimal-mode
+          // rebuilds the shader if the feature set widened.
+          m_resources.recomputeSceneFeatures(dlssGuideRequired());
+          resetFrame();
+          m_sceneSelection.selectNode(nodeIdx);
+          m_sceneBrowser.focusOnSelection();
+          LOGI("Scene %s successfully: %s\n", asReference ? "referenced" : "merged", name.c_str());
+        }
+        else
+        {
+          LOGE("Failed to %s scene: %s\n", asReference ? "reference" : "merge", name.c_str());
+        }
+        m_busy.stop();
+      },
+      {.name = "Add scene", .priority = nvvkgltf::TaskPriority::eHigh});
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -851,15 +910,17 @@ void GltfRenderer::onFileDrop(const std::filesystem::path& filename)
     if(m_busy.isBusy())
       return;
 
-    m_loadPipeline.clear();
+    clearLoadPipeline();
     cleanupScene();  // also frees rasterizer record cmd + clears sort state via onSceneInvalidated()
 
     m_busy.start("Loading Descriptor");
-    std::thread([=, this]() {
-      m_lastSceneDirectory = filename.parent_path();
-      createSceneFromDescriptor(filename);
-      m_busy.stop();
-    }).detach();
+    m_sceneTask = nvvkgltf::TaskScheduler::shared().submit(
+        [=, this]() {
+          m_lastSceneDirectory = filename.parent_path();
+          createSceneFromDescriptor(filename);
+          m_busy.stop();
+        },
+        {.name = "Load descriptor", .priority = nvvkgltf::TaskPriority::eHigh});
   }
   else if(nvutils::extensionMatches(filename, ".gltf") || nvutils::extensionMatches(filename, ".glb")
           || nvutils::extensionMatches(filename, ".obj"))
@@ -891,25 +952,34 @@ void GltfRenderer::onFileDrop(const std::filesystem::path& filename)
     }
     else
     {
-      m_loadPipeline.clear();
+      clearLoadPipeline();
       cleanupScene();  // also frees rasterizer record cmd + clears sort state via onSceneInvalidated()
 
-      // Set busy BEFORE starting the worker thread to prevent re-entrant drops
+      // Set busy BEFORE starting the task to prevent re-entrant drops
       m_busy.start("Loading");
 
-      std::thread([=, this]() {
-        m_lastSceneDirectory = filename.parent_path();
-        createScene(filename);
-        m_busy.stop();
-      }).detach();
+      m_sceneTask = nvvkgltf::TaskScheduler::shared().submit(
+          [=, this]() {
+            m_lastSceneDirectory = filename.parent_path();
+            createScene(filename);
+            m_busy.stop();
+          },
+          {.name = "Load scene", .priority = nvvkgltf::TaskPriority::eHigh});
     }
   }
   else if(nvutils::extensionMatches(filename, ".hdr"))
   {
     m_lastHdrDirectory = filename.parent_path();
-    createHDR(filename);
-    m_resources.settings.envSystem                 = shaderio::EnvSystem::eHdr;
-    m_pathTracer.m_pushConst.fireflyClampThreshold = m_resources.hdrIbl.getIntegral();
+    if(isAutomatedRun())
+    {
+      createHDR(filename);
+      m_resources.settings.envSystem                 = shaderio::EnvSystem::eHdr;
+      m_pathTracer.m_pushConst.fireflyClampThreshold = m_resources.hdrIbl.getIntegral();
+    }
+    else
+    {
+      loadHdrAsync(filename);  // Switches to the HDR environment once loaded and uploaded (finishHdrLoad)
+    }
   }
 
   resetFrame();
@@ -947,8 +1017,22 @@ bool GltfRenderer::save(const std::filesystem::path& filename, bool selfContaine
       m_resources.getScene()->setSceneCameras(cameras);
     }
 
-    // Saving the scene
-    return m_resources.getScene()->save(filename, selfContained);
+    // Saving the scene (with the node TRS of the current frame, also when animation plays on the GPU)
+    m_resources.getScene()->animation().syncGpuNodeAnimationToCpu();
+    if(isAutomatedRun())
+      return m_resources.getScene()->save(filename, selfContained);
+
+    // Interactive: snapshot now, write in the background (see renderSaveProgress)
+    if(m_asyncSave.isRunning())
+    {
+      LOGW("A save is still in progress\n");
+      return false;
+    }
+    std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = m_resources.getScene()->makeSaveSnapshot(filename, selfContained);
+    if(!snapshot)
+      return false;
+    m_asyncSaveScene = m_resources.getScene();
+    return m_asyncSave.start(std::move(*snapshot));
   }
   return false;
 }
@@ -1197,6 +1281,10 @@ void GltfRenderer::updateGizmoAttachment()
   {
     m_gizmoNodeIndex = nodeIdx;
 
+    // The gizmo reads node TRS and the parent matrix from the model; catch it up with GPU-played
+    // node animation once here (no-op otherwise). Drags sync again in the transform-begin callback.
+    m_resources.getScene()->animation().syncGpuNodeAnimationToCpu();
+
     glm::quat rotation;
     tinygltf::utils::getNodeTRS(m_resources.getScene()->editor().getNode(nodeIdx), m_gizmoPosition, rotation, m_gizmoScale);
     m_gizmoRotation = glm::degrees(glm::eulerAngles(rotation));
@@ -1209,9 +1297,11 @@ void GltfRenderer::updateGizmoAttachment()
   }
   else if(!m_visualHelpers.transform.isDragging())
   {
-    // Re-read TRS from the scene node so inspector edits are reflected immediately
+    // Re-read TRS from the scene node so inspector edits are reflected immediately. While the node
+    // animation plays on the GPU, show what it played without syncing (which would dirty every target).
     glm::quat rotation;
-    tinygltf::utils::getNodeTRS(m_resources.getScene()->editor().getNode(nodeIdx), m_gizmoPosition, rotation, m_gizmoScale);
+    if(!m_resources.getScene()->animation().getGpuNodeAnimationTrs(nodeIdx, m_gizmoPosition, rotation, m_gizmoScale))
+      tinygltf::utils::getNodeTRS(m_resources.getScene()->editor().getNode(nodeIdx), m_gizmoPosition, rotation, m_gizmoScale);
     m_gizmoRotation = glm::degrees(glm::eulerAngles(rotation));
   }
 }
@@ -1284,12 +1374,16 @@ void GltfRenderer::createScene(const std::filesystem::path& sceneFilename)
   }
   else
   {
+    if(!checkMemoryBudget(filename))
+      return;
+
     LOGI("Loading scene: %s\n", nvutils::utf8FromPath(filename).c_str());
     auto scn = std::make_unique<nvvkgltf::Scene>();
     scn->supportedExtensions().insert(EXT_TEXTURE_WEBP_EXTENSION_NAME);  // Register support for WebP images in glTF (local to this project)
     if(!scn->load(filename))
     {
       LOGW("Error loading scene: %s\n", nvutils::utf8FromPath(filename).c_str());
+      m_loadEstimate.reset();
       removeFromRecentFiles(filename);
       return;
     }
@@ -1341,8 +1435,254 @@ void GltfRenderer::finalizeSceneSetup(const std::filesystem::path& filename)
     return;
   }
 
+  logEstimateAccuracy();
+  updateHostMemory();
+  if(m_allocJournal)
+    m_allocJournal->mark("loaded " + nvutils::utf8FromPath(filename.filename()));
+
   if(!filename.empty())
     addToRecentFiles(filename);
+
+  watchSceneFiles();
+}
+
+//--------------------------------------------------------------------------------------------------
+// With --memoryBudgetMB, estimate the scene from its JSON and image headers and refuse to load it
+// when the GPU memory it needs does not fit. The estimate is kept to be compared with the real load.
+//
+bool GltfRenderer::checkMemoryBudget(const std::filesystem::path& filename)
+{
+  m_loadEstimate.reset();
+  if(m_memoryBudgetMB <= 0.0f)
+    return true;
+
+  nvvkgltf::SceneEstimate estimate;
+  std::string             error;
+  if(!nvvkgltf::estimateScene(filename, estimate, {}, &error))
+  {
+    LOGW("Cannot estimate %s (%s); loading without a budget check\n", nvutils::utf8FromPath(filename).c_str(), error.c_str());
+    return true;
+  }
+
+  const double estimatedMB = double(estimate.gpuBytes()) / (1024.0 * 1024.0);
+  if(estimatedMB > double(m_memoryBudgetMB))
+  {
+    LOGE("Scene %s needs about %.1f MB of GPU memory, over the %.1f MB budget: not loaded\n%s",
+         nvutils::utf8FromPath(filename).c_str(), estimatedMB, m_memoryBudgetMB, nvvkgltf::formatSceneEstimate(estimate).c_str());
+    return false;
+  }
+  m_loadEstimate = estimate;
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Geometry and images are allocated by the time the scene is set up; the BLAS are still building.
+//
+void GltfRenderer::logEstimateAccuracy()
+{
+  if(!m_loadEstimate)
+    return;
+  const nvvkgltf::GpuMemoryTracker& tracker = m_resources.sceneVk.getMemoryTracker();
+  const auto ratio = [](uint64_t estimated, uint64_t actual) { return actual ? double(estimated) / double(actual) : 0.0; };
+  const uint64_t geometry = tracker.getStats("Geometry").currentBytes;
+  const uint64_t images   = tracker.getStats("Images").currentBytes;
+  LOGI("Load estimate vs. actual: geometry %.1f / %.1f MB (x%.2f), images %.1f / %.1f MB (x%.2f)\n",
+       double(m_loadEstimate->geometryBytes) / (1024.0 * 1024.0), double(geometry) / (1024.0 * 1024.0),
+       ratio(m_loadEstimate->geometryBytes, geometry), double(m_loadEstimate->imageBytes) / (1024.0 * 1024.0),
+       double(images) / (1024.0 * 1024.0), ratio(m_loadEstimate->imageBytes, images));
+  m_loadEstimate.reset();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Host memory is measured on demand (after a load, per benchmark sequence, while the memory window
+// is open); only the decoded images SceneVk holds during a load are tracked as they come and go.
+//
+void GltfRenderer::updateHostMemory()
+{
+  nvvkgltf::HostMemoryTracker& tracker = m_resources.hostMemoryTracker;
+  const nvvkgltf::Scene*       scene   = m_resources.getScene();
+  if(scene)
+    scene->reportHostMemory(tracker);
+  m_resources.sceneVk.reportHostMemory(tracker);
+  tracker.set("UndoStack", m_undoStack.sizeInBytes());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Opt-in allocation journal: every GPU tracker forwards its allocations, prefixed by its owner.
+// The current totals in the trackers are reset between scenes; the journal is not, so an allocation
+// that is never untracked stays visible until exit.
+//
+void GltfRenderer::initAllocationJournal()
+{
+  if(m_allocJournalPath.empty())
+    return;
+
+  m_allocJournal = std::make_unique<nvvkgltf::AllocationJournal>();
+  m_resources.appMemoryTracker.setJournal(m_allocJournal.get(), "App");
+  m_resources.sceneVk.getMemoryTracker().setJournal(m_allocJournal.get(), "Scene");
+  m_resources.sceneRtx.getMemoryTracker().setJournal(m_allocJournal.get(), "RTX");
+  m_resources.transformCompute.getMemoryTracker().setJournal(m_allocJournal.get(), "Transform");
+  m_resources.animationVk.getMemoryTracker().setJournal(m_allocJournal.get(), "Animation");
+  m_allocJournal->mark("startup");
+  LOGI("Allocation journal: recording to %s\n", nvutils::utf8FromPath(m_allocJournalPath).c_str());
+}
+
+//--------------------------------------------------------------------------------------------------
+// Called after all resources are destroyed: whatever is still alive was never untracked.
+//
+void GltfRenderer::writeAllocationJournal()
+{
+  if(!m_allocJournal)
+    return;
+
+  m_allocJournal->mark("exit");
+  std::string error;
+  if(!m_allocJournal->save(m_allocJournalPath, &error))
+    LOGW("Cannot write the allocation journal %s: %s\n", nvutils::utf8FromPath(m_allocJournalPath).c_str(), error.c_str());
+
+  const nvvkgltf::JournalSummary summary = nvvkgltf::summarizeJournal(m_allocJournal->getData());
+  if(summary.liveAllocations.empty())
+    LOGI("%s", nvvkgltf::formatJournalSummary(summary).c_str());
+  else
+    LOGW("%s", nvvkgltf::formatJournalSummary(summary).c_str());
+  m_allocJournal.reset();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Hot reload: remember the content of the loaded scene and watch the files it was read from.
+// Only glTF files are watched; OBJ conversions and descriptors have no glTF to reload.
+//
+void GltfRenderer::watchSceneFiles()
+{
+  m_fileWatcher.clear();
+  const nvvkgltf::Scene* scene = m_resources.getScene();
+  if(!m_hotReload || !scene || scene->getFilename().empty()
+     || !(nvutils::extensionMatches(scene->getFilename(), ".gltf") || nvutils::extensionMatches(scene->getFilename(), ".glb")))
+    return;
+
+  m_sceneHashes = nvvkgltf::hashSceneContent(*scene);
+  m_fileWatcher.watch(nvvkgltf::sceneSourceFiles(*scene));
+  LOGI("Hot reload: watching %zu file(s)%s\n", m_fileWatcher.files().size(),
+       m_fileWatcher.usesNotifications() ? "" : " (polling)");
+}
+
+//--------------------------------------------------------------------------------------------------
+// Hot reload, once per frame: changed files start a background load of the scene; a finished load
+// is diffed against the current scene and applied with the least work. Materials, lights and node
+// transforms are patched and picked up by updateSceneChanges(); changed meshes get new vertex/index
+// buffers and acceleration structures; changed images are decoded and uploaded again. A structural
+// change reloads the scene. Nothing is applied while the scene has edits that would be lost.
+// Returns true when GPU work was queued in the loading pipeline.
+//
+bool GltfRenderer::updateHotReload()
+{
+  nvvkgltf::Scene* scene = m_resources.getScene();
+  if(!m_hotReload || !scene || m_fileWatcher.empty())
+    return false;
+
+  for(const std::filesystem::path& file : m_fileWatcher.poll())
+  {
+    LOGI("Hot reload: %s changed\n", nvutils::utf8FromPath(file).c_str());
+    m_hotReloadPending = true;
+  }
+
+  std::optional<nvvkgltf::AsyncSceneReload::Result> result = m_sceneReload.takeResult();
+  if(m_hotReloadPending && !m_sceneReload.isRunning())
+    m_hotReloadPending = !m_sceneReload.start(scene->getFilename(), scene->supportedExtensions());
+
+  if(!result || result->filename != scene->getFilename())
+    return false;  // Nothing finished, or the load was for a scene that has been replaced since
+  const std::filesystem::path filename = result->filename;
+  const std::string           name     = nvutils::utf8FromPath(filename.filename());
+  if(!result->scene)
+  {
+    LOGW("Hot reload: cannot load %s, keeping the current scene\n", name.c_str());
+    return false;
+  }
+
+  const nvvkgltf::SceneDiff diff = nvvkgltf::diffScenes(*scene, m_sceneHashes, *result->scene, result->hashes);
+  if(diff.empty())
+  {
+    LOGI("Hot reload %s: no change\n", name.c_str());
+    return false;
+  }
+
+  // Both paths replace scene content with the file's: the whole scene, or the arrays applySceneDiff()
+  // takes over (buffers, accessors, meshes, ...), which may hold edits the undo stack refers to, or
+  // edits made outside of it (merge, reference, tangent recompute) that cleared it
+  if(m_undoStack.canUndo() || m_undoStack.canRedo() || m_sceneEditedOutsideUndo)
+  {
+    LOGW("Hot reload %s: %s; not reloaded, the scene has edits that would be lost\n", name.c_str(),
+         nvvkgltf::formatSceneDiff(diff).c_str());
+    return false;
+  }
+
+  if(diff.isStructural())
+  {
+    LOGI("Hot reload %s: %s, reloading the scene\n", name.c_str(), nvvkgltf::formatSceneDiff(diff).c_str());
+
+    // Same as a load from onFileDrop(), with the scene that was just read
+    vkQueueWaitIdle(m_app->getQueue(0).queue);
+    clearLoadPipeline();
+    cleanupScene();
+    m_resources.scene = std::move(result->scene);
+    m_busy.start("Reloading");
+    m_sceneTask = nvvkgltf::TaskScheduler::shared().submit(
+        [=, this]() {
+          finalizeSceneSetup(filename);
+          m_busy.stop();
+        },
+        {.name = "Reload scene", .priority = nvvkgltf::TaskPriority::eHigh});
+    return true;
+  }
+
+  // SYNC NOTE: buffers and images being replaced may still be referenced by in-flight frames
+  NVVK_CHECK(vkQueueWaitIdle(m_app->getQueue(0).queue));
+
+  m_animationPrefetch.stop();  // Prepared from the model before the diff
+  const nvvkgltf::SceneDiffUpdate update = nvvkgltf::applySceneDiff(*scene, std::move(result->scene->getModel()), diff);
+  bool                            queued = false;
+  if(update.primitivesChanged)
+  {
+    rebuildVulkanSceneInternal(false);  // Already parsed by applySceneDiff
+    queued = true;
+  }
+  else if(!update.renderPrimitives.empty())
+  {
+    m_resources.transformCompute.destroyGpuBuffers();  // Before the acceleration structures are rebuilt
+
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    m_resources.sceneGpu.updateGeometry(cmd, *scene, update.renderPrimitives);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    m_loadPipeline.enqueue(cmd);
+
+    // The BLAS builder works on the whole scene: all BLAS and the TLAS are rebuilt
+    buildAccelerationStructures();
+    queued = true;
+  }
+  if(update.reparsed)
+    updateUiAfterSceneRebuild();
+
+  if(!diff.images.empty())
+  {
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    m_resources.sceneVk.reloadImages(cmd, m_resources.staging, *scene, diff.images);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    m_loadPipeline.enqueue(cmd, [this] { m_resources.staging.releaseStaging(true); });
+    if(!updateTextures())
+      LOGE("Failed to update textures - scene may not render correctly\n");
+    queued = true;
+  }
+
+  m_resources.recomputeSceneFeatures(dlssGuideRequired());
+  resetFrame();
+  LOGI("Hot reload %s: %s\n", name.c_str(), nvvkgltf::formatSceneDiff(diff).c_str());
+
+  m_sceneHashes = std::move(result->hashes);
+  m_fileWatcher.watch(nvvkgltf::sceneSourceFiles(*scene));  // Images or buffers may have been renamed
+  return queued;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1408,28 +1748,8 @@ void GltfRenderer::createSceneFromDescriptor(const std::filesystem::path& descri
   scn->supportedExtensions().insert(EXT_TEXTURE_WEBP_EXTENSION_NAME);
   nvvkgltf::Scene* scene = scn.get();
 
-  auto instancesByModel = desc.getInstancesByModel();
-
-  for(const auto& [modelIdx, instances] : instancesByModel)
-  {
-    const auto& modelEntry = desc.models[modelIdx];
-    // referenceScene() loads the file on first use and, for repeats of the same model, duplicates the
-    // instance so geometry (meshes/BLAS) is shared. Each call returns the editable instance node that
-    // carries the externalAsset link; we only set its transform/name.
-    for(const auto& instPtr : instances)
-    {
-      const auto& inst            = *instPtr;
-      int         instanceNodeIdx = scene->referenceScene(modelEntry.resolvedPath);
-      if(instanceNodeIdx < 0)
-      {
-        LOGE("Failed to reference model: %s\n", nvutils::utf8FromPath(modelEntry.resolvedPath).c_str());
-        break;  // the file won't load for the remaining instances either
-      }
-      scene->editor().setNodeTRS(instanceNodeIdx, inst.translation, inst.rotation, inst.scale);
-      if(!inst.name.empty())
-        scene->getModel().nodes[instanceNodeIdx].name = inst.name;
-    }
-  }
+  // The distinct model files load concurrently; the instances are then placed in descriptor order
+  referenceDescriptorInstances(*scene, desc);
 
   if(!scene->valid())
   {
@@ -1474,6 +1794,12 @@ void GltfRenderer::createSceneFromDescriptor(const std::filesystem::path& descri
 void GltfRenderer::cleanupScene()
 {
   m_undoStack.clear();
+  m_animationPrefetch.stop();  // Its tasks evaluate with the outgoing scene's animation system
+  m_fileWatcher.clear();  // A running reload is discarded when it finishes (other filename or no scene)
+  m_sceneHashes            = {};
+  m_hotReloadPending       = false;
+  m_sceneEditedOutsideUndo = false;
+  m_asyncSaveScene = nullptr;  // A running save still writes its snapshot, but no longer reports back
   // Drop any renderer-side state tied to the outgoing Scene BEFORE the unique_ptr is reset.
   // The heap allocator is free to hand the same address back to the next Scene instance, so
   // any Scene-pointer-based invalidation inside the render loop would be unreliable -- this is
@@ -1496,6 +1822,9 @@ void GltfRenderer::cleanupScene()
   m_resources.sceneRtx.getMemoryTracker().reset();
   m_resources.transformCompute.getMemoryTracker().reset();
   m_resources.animationVk.getMemoryTracker().reset();
+  m_resources.hostMemoryTracker.reset();
+  if(m_allocJournal)
+    m_allocJournal->mark("unloaded");
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1536,9 +1865,64 @@ void GltfRenderer::rebuildVulkanSceneInternal(bool rebuildTextures)
   }
 
   buildAccelerationStructures();
+  updateUiAfterSceneRebuild();
+
+  // Update textures if requested
+  if(rebuildTextures)
+  {
+    if(!updateTextures())
+    {
+      LOGE("Failed to update textures - scene may not render correctly\n");
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Upload what a merge/reference appended (Scene::takeLastAppend) without rebuilding the GPU scene:
+// vertex/index buffers, images and BLAS are created for the new content only; the per-element
+// buffers (primitives, materials, render nodes, lights), the TLAS and the transform buffers are
+// regrown, and only the new texture descriptors are written.
+// Returns false, with nothing changed, when the append can't be applied in place (caller rebuilds).
+//
+bool GltfRenderer::appendVulkanScene(const nvvkgltf::SceneAppendInfo& info)
+{
+  // SYNC NOTE: same as a full rebuild -- buffers being regrown may still be referenced by in-flight frames.
+  NVVK_CHECK(vkQueueWaitIdle(m_app->getQueue(0).queue));
+
+  nvvkgltf::Scene* scene = m_resources.getScene();
+  if(!scene || !m_resources.sceneVk.canAppend(*scene, info))
+    return false;
+
+  m_resources.transformCompute.destroyGpuBuffers();  // Node count changed; recreated after the TLAS
+
+  {
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    [[maybe_unused]] const bool appended = m_resources.sceneGpu.append(cmd, *scene, info);
+    assert(appended);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    m_loadPipeline.enqueue(cmd);
+  }
+
+  appendAccelerationStructures(info);
+  updateUiAfterSceneRebuild();
 
-  // Update UI system
-  scene = m_resources.getScene();
+  if(!updateTextures(info.textures.begin))
+  {
+    LOGE("Failed to update textures - scene may not render correctly\n");
+  }
+
+  LOGI("Appended %u primitive(s), %u image(s), %u material(s), %u render node(s) to the GPU scene\n",
+       info.renderPrimitives.count(), info.images.count(), info.materials.count(), info.renderNodes.count());
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Point the UI panels at the (re)built scene and pick the animation clip to show.
+//
+void GltfRenderer::updateUiAfterSceneRebuild()
+{
+  nvvkgltf::Scene* scene = m_resources.getScene();
   if(scene)
   {
     m_sceneBrowser.setScene(scene);
@@ -1564,15 +1948,6 @@ void GltfRenderer::rebuildVulkanSceneInternal(bool rebuildTextures)
     if(ui::animation::hasPlayableAnimation(scene))
       animCtrl.showStrip = true;
   }
-
-  // Update textures if requested
-  if(rebuildTextures)
-  {
-    if(!updateTextures())
-    {
-      LOGE("Failed to update textures - scene may not render correctly\n");
-    }
-  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1590,6 +1965,7 @@ void GltfRenderer::rebuildVulkanSceneInternal(bool rebuildTextures)
 void GltfRenderer::rebuildSceneFromModel()
 {
   m_undoStack.clear();  // structural model edit outside the command system invalidates history
+  m_sceneEditedOutsideUndo = true;
   rebuildSceneGeometry();
 }
 
@@ -1690,65 +2066,112 @@ void GltfRenderer::buildAccelerationStructures()
   m_resources.sceneRtx.createBottomLevelAccelerationStructure(*m_resources.getScene(), m_resources.sceneVk, flags);
 
   // Build the bottom-level acceleration structure
-  // Memory-conscious approach: build within a fixed memory budget using multiple command buffers if needed
-  // Each build command is queued separately and (for non-animated scenes) followed by compaction to optimize memory usage
-  {
-    bool finished = false;
+  enqueueBlasBuild(isAnimated);
 
-    // Building BLAS within a memory budget, which could involve multiple calls to cmdBuildBottomLevelAccelerationStructure
-    do
-    {
-      VkCommandBuffer cmd{};
-      nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
-      constexpr VkDeviceSize kBlasBuildMemoryBudget = 512ULL * 1024 * 1024;  // 512 MB per build pass
-      finished = m_resources.sceneRtx.cmdBuildBottomLevelAccelerationStructure(cmd, kBlasBuildMemoryBudget);
-      NVVK_CHECK(vkEndCommandBuffer(cmd));
-      if(isAnimated)
-      {
-        m_loadPipeline.enqueue(cmd);
-      }
-      else
-      {
-        m_loadPipeline.enqueue(cmd, [this] {
-          VkCommandBuffer compactCmd{};
-          nvvk::beginSingleTimeCommands(compactCmd, m_device, m_transientCmdPool);
-          m_resources.sceneRtx.cmdCompactBlas(compactCmd);
-          NVVK_CHECK(vkEndCommandBuffer(compactCmd));
-          m_loadPipeline.enqueue(compactCmd);
-        });
-      }
-
-    } while(!finished);
-
-    // Track all BLAS allocations now that they're all built
-    m_resources.sceneRtx.trackBlasMemory();
-
-    // Queue TLAS building for after all BLAS work completes
-    // TLAS is the top-level structure referencing all bottom-level acceleration structures
-    {
-      VkCommandBuffer cmd{};
-      nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
-      m_resources.sceneRtx.cmdCreateBuildTopLevelAccelerationStructure(cmd, m_resources.staging, *m_resources.getScene());
-      m_resources.staging.cmdUploadAppended(cmd);
-      NVVK_CHECK(vkEndCommandBuffer(cmd));
-      m_loadPipeline.enqueue(cmd, [this] { m_resources.staging.releaseStaging(true); });
-    }
+  // Queue TLAS building for after all BLAS work completes
+  // TLAS is the top-level structure referencing all bottom-level acceleration structures
+  {
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    m_resources.sceneRtx.cmdCreateBuildTopLevelAccelerationStructure(cmd, m_resources.staging, *m_resources.getScene());
+    m_resources.staging.cmdUploadAppended(cmd);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    m_loadPipeline.enqueue(cmd, [this] { m_resources.staging.releaseStaging(true); });
   }
 
   // Avoid double-build: whoever called us (createVulkanScene, rebuildVulkanSceneInternal, or updateSceneChanges) just queued BLAS+TLAS.
   if(m_resources.getScene())
     m_resources.getScene()->getDirtyFlags().primitivesChanged = false;
 
-  // GPU transform SSBOs (hierarchy, matrices, RenderNodeGpuMapping). Queue after TLAS instance buffer exists.
-  if(m_resources.getScene())
+  createTransformGpuBuffers();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Acceleration structures after appendVulkanScene(): BLAS are built (and compacted) for the appended
+// primitives only, then the TLAS instances are rebuilt (in place while the instance slots have headroom).
+//
+void GltfRenderer::appendAccelerationStructures(const nvvkgltf::SceneAppendInfo& info)
+{
+  nvvkgltf::Scene* scene = m_resources.getScene();
+
+  // Same flag policy as buildAccelerationStructures(); the existing BLAS keep the flags they were built with
+  // (only primitives of an animated import can be deformed, and those are among the new ones).
+  const bool isAnimated = scene->animation().hasAnimation();
+  if(!info.renderPrimitives.empty())
   {
-    m_resources.transformCompute.createGpuBuffers(m_resources.staging, *m_resources.getScene());
-    VkCommandBuffer upCmd{};
-    nvvk::beginSingleTimeCommands(upCmd, m_device, m_transientCmdPool);
-    m_resources.staging.cmdUploadAppended(upCmd);
-    NVVK_CHECK(vkEndCommandBuffer(upCmd));
-    m_loadPipeline.enqueue(upCmd);
+    VkBuildAccelerationStructureFlagsKHR flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
+    flags |= isAnimated ? VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR : VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+    m_resources.sceneRtx.appendBottomLevelAccelerationStructure(*scene, m_resources.sceneVk, flags, info.renderPrimitives.begin);
+    enqueueBlasBuild(isAnimated);
+  }
+
+  {
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    m_resources.sceneRtx.updateInstanceFlagsCache(*scene);  // New materials
+    m_resources.sceneRtx.rebuildTopLevelAS(cmd, m_resources.staging, *scene);
+    m_resources.staging.cmdUploadAppended(cmd);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    m_loadPipeline.enqueue(cmd, [this] { m_resources.staging.releaseStaging(true); });
   }
+
+  scene->getDirtyFlags().primitivesChanged = false;
+
+  createTransformGpuBuffers();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Queue the BLAS build prepared by SceneRtx (create or append).
+// Memory-conscious approach: build within a fixed memory budget using multiple command buffers if needed
+// Each build command is queued separately and (for non-animated scenes) followed by compaction to optimize memory usage
+//
+void GltfRenderer::enqueueBlasBuild(bool isAnimated)
+{
+  bool finished = false;
+
+  // Building BLAS within a memory budget, which could involve multiple calls to cmdBuildBottomLevelAccelerationStructure
+  do
+  {
+    VkCommandBuffer cmd{};
+    nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+    constexpr VkDeviceSize kBlasBuildMemoryBudget = 512ULL * 1024 * 1024;  // 512 MB per build pass
+    finished = m_resources.sceneRtx.cmdBuildBottomLevelAccelerationStructure(cmd, kBlasBuildMemoryBudget);
+    NVVK_CHECK(vkEndCommandBuffer(cmd));
+    if(isAnimated)
+    {
+      m_loadPipeline.enqueue(cmd);
+    }
+    else
+    {
+      m_loadPipeline.enqueue(cmd, [this] {
+        VkCommandBuffer compactCmd{};
+        nvvk::beginSingleTimeCommands(compactCmd, m_device, m_transientCmdPool);
+        m_resources.sceneRtx.cmdCompactBlas(compactCmd);
+        NVVK_CHECK(vkEndCommandBuffer(compactCmd));
+        m_loadPipeline.enqueue(compactCmd);
+      });
+    }
+
+  } while(!finished);
+
+  // Track all BLAS allocations now that they're all built
+  m_resources.sceneRtx.trackBlasMemory();
+}
+
+//--------------------------------------------------------------------------------------------------
+// GPU transform SSBOs (hierarchy, matrices, RenderNodeGpuMapping). Queue after TLAS instance buffer exists.
+//
+void GltfRenderer::createTransformGpuBuffers()
+{
+  if(!m_resources.getScene())
+    return;
+
+  m_resources.transformCompute.createGpuBuffers(m_resources.staging, *m_resources.getScene());
+  VkCommandBuffer upCmd{};
+  nvvk::beginSingleTimeCommands(upCmd, m_device, m_transientCmdPool);
+  m_resources.staging.cmdUploadAppended(upCmd);
+  NVVK_CHECK(vkEndCommandBuffer(upCmd));
+  m_loadPipeline.enqueue(upCmd);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1880,7 +2303,7 @@ void GltfRenderer::compileShaders()
 //--------------------------------------------------------------------------------------------------
 // Update the textures: this is called when the scene is loaded
 // Textures are updated in the descriptor set (0)
-bool GltfRenderer::updateTextures()
+bool GltfRenderer::updateTextures(uint32_t firstTexture)
 {
   // Now do the textures
   nvvk::WriteSetContainer write{};
@@ -1889,7 +2312,7 @@ bool GltfRenderer::updateTextures()
 
   uint32_t sceneTextureCount = m_resources.sceneVk.textureCount();
 
-  if(sceneTextureCount == 0)
+  if(sceneTextureCount <= firstTexture)
     return true;
 
   // CRITICAL: Materials directly index into allTextures[] - if scene exceeds capacity,
@@ -1904,9 +2327,11 @@ bool GltfRenderer::updateTextures()
     return false;
   }
 
-  allTextures.descriptorCount = sceneTextureCount;
+  // Descriptors below firstTexture are already written (appended scene)
+  allTextures.dstArrayElement = firstTexture;
+  allTextures.descriptorCount = sceneTextureCount - firstTexture;
 
-  write.append(allTextures, m_resources.sceneVk.textures().data());
+  write.append(allTextures, m_resources.sceneVk.textures().data() + firstTexture);
   vkUpdateDescriptorSets(m_device, write.size(), write.data(), 0, nullptr);
   return true;
 }
@@ -1977,33 +2402,110 @@ bool GltfRenderer::updateFrameCounter()
 }
 
 //--------------------------------------------------------------------------------------------------
-// Create or load the HDR environment map
-// If the filename is empty, a default environment map (empty) is created, which allow the descriptor set to be updated
+// Create or load the HDR environment map, blocking (start-up, command line, automated runs)
+// If the filename is empty, a default environment map (black) is created, which allow the descriptor set to be updated
 void GltfRenderer::createHDR(const std::filesystem::path& hdrFilename)
 {
-  VkCommandBuffer cmd{};
-  nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
-  nvvk::StagingUploader uploader;
-  uploader.init(&m_resources.allocator, true);
-
-  // Load an HDR and create the important sampling acceleration structure
-  std::filesystem::path filename;
+  HdrEnvironmentData data;
   if(!hdrFilename.empty())
-    filename = nvutils::findFile(hdrFilename, nvsamples::getResourcesDirs(), false);
-  m_resources.hdrIbl.destroyEnvironment();
-  m_resources.hdrIbl.loadEnvironment(cmd, uploader, filename, true);
+  {
+    const std::filesystem::path filename = nvutils::findFile(hdrFilename, nvsamples::getResourcesDirs(), false);
+    loadHdrEnvironment(filename, hdrCache(), data);
+  }
+  if(!data.valid())
+    data = makeDefaultHdrEnvironment();
+  applyHdr(data);
+  // addToRecentFiles(hdrFilename);
+}
 
-  uploader.cmdUploadAppended(cmd);
+//--------------------------------------------------------------------------------------------------
+// Load an HDR environment map without stalling the viewport: the file is decoded (or read from the
+// cache) on a worker thread while the current environment keeps rendering; finishHdrLoad() queues
+// its upload in the loading pipeline, and onHdrUploaded() switches to it once the GPU is done.
+void GltfRenderer::loadHdrAsync(const std::filesystem::path& hdrFilename)
+{
+  const std::filesystem::path filename = nvutils::findFile(hdrFilename, nvsamples::getResourcesDirs(), false);
+  if(!m_hdrLoad.start(filename, hdrCache()))
+    LOGW("An HDR environment is still loading, ignoring %s\n", nvutils::utf8FromPath(hdrFilename).c_str());
+}
 
-  // Generate mipmaps for the HDR image
-  VkExtent2D hdrSize = m_resources.hdrIbl.getHdrImageSize();
-  if(hdrSize.width > 1 && hdrSize.height > 1)
+void GltfRenderer::finishHdrLoad()
+{
+  if(m_hdrUpload)
+    return;  // The previous environment is still uploading: the next one waits for it
+  std::optional<AsyncHdrLoad::Result> result = m_hdrLoad.takeResult();
+  if(!result)
+    return;
+  if(!result->loaded)
   {
-    nvvk::cmdGenerateMipmaps(cmd, m_resources.hdrIbl.getHdrImage().image, hdrSize, nvvk::mipLevels(hdrSize));
+    LOGE("Failed to load HDR environment: %s\n", nvutils::utf8FromPath(result->filename).c_str());
+    return;  // The current environment stays
   }
 
+  // The upload goes to resources of its own: the current environment stays bound meanwhile
+  m_hdrUpload         = std::make_unique<HdrUpload>();
+  m_hdrUpload->result = std::move(*result);
+  m_hdrUpload->uploader.init(&m_resources.allocator, true);
+  VkCommandBuffer cmd{};
+  nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+  m_resources.hdrIbl.cmdUpload(cmd, m_hdrUpload->uploader, m_hdrUpload->result.data, true);
+  NVVK_CHECK(vkEndCommandBuffer(cmd));
+  m_loadPipeline.enqueue(cmd, [this] { onHdrUploaded(); });
+}
+
+//--------------------------------------------------------------------------------------------------
+// Loading pipeline callback of finishHdrLoad(): the upload is done, switch to the environment
+void GltfRenderer::onHdrUploaded()
+{
+  m_hdrUpload->uploader.deinit();
+  m_hdrUpload.reset();
+
+  activateHdr();
+  m_resources.settings.envSystem                 = shaderio::EnvSystem::eHdr;
+  m_pathTracer.m_pushConst.fireflyClampThreshold = m_resources.hdrIbl.getIntegral();
+  resetFrame();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Drop the queued loading work, when the scene is replaced (after vkQueueWaitIdle). An environment
+// upload may go with it: it is submitted again, blocking, and switched to.
+void GltfRenderer::clearLoadPipeline()
+{
+  m_loadPipeline.clear();
+  if(!m_hdrUpload)
+    return;
+
+  m_hdrUpload->uploader.deinit();
+  m_hdrUpload->uploader.init(&m_resources.allocator, true);
+  VkCommandBuffer cmd{};
+  nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+  m_resources.hdrIbl.cmdUpload(cmd, m_hdrUpload->uploader, m_hdrUpload->result.data, true);
+  nvvk::endSingleTimeCommands(cmd, m_device, m_transientCmdPool, m_app->getQueue(0).queue);
+  onHdrUploaded();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Upload the environment and switch to it, blocking (createHDR).
+void GltfRenderer::applyHdr(const HdrEnvironmentData& data)
+{
+  VkCommandBuffer cmd{};
+  nvvk::beginSingleTimeCommands(cmd, m_device, m_transientCmdPool);
+  nvvk::StagingUploader uploader;
+  uploader.init(&m_resources.allocator, true);
+  m_resources.hdrIbl.cmdUpload(cmd, uploader, data, true);
   nvvk::endSingleTimeCommands(cmd, m_device, m_transientCmdPool, m_app->getQueue(0).queue);
   uploader.deinit();
+  activateHdr();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Switch to the uploaded environment. Only the switch (descriptor updates and the prefiltered cube
+// maps) waits for the frames in flight.
+void GltfRenderer::activateHdr()
+{
+  // SYNC NOTE: frames in flight may still sample the previous environment, released by activateUploaded()
+  vkQueueWaitIdle(m_app->getQueue(0).queue);
+  m_resources.hdrIbl.activateUploaded();
 
   // Create the diffuse and glossy cube maps for the HDR image (raster)
   m_resources.hdrDome.create(m_resources.hdrIbl.getDescriptorSet(), m_resources.hdrIbl.getDescriptorSetLayout(),
@@ -2013,7 +2515,15 @@ void GltfRenderer::createHDR(const std::filesystem::path& hdrFilename)
   updateHdrImages();
   m_resources.hdrDome.setOutImage(m_resources.gBuffers.getColorStorageImageInfo(Resources::eImgRendered));
   m_rasterizer.resetHdr();
-  // addToRecentFiles(hdrFilename);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decoded environments are cached next to the executable, like the pipeline cache
+HdrEnvCache GltfRenderer::hdrCache() const
+{
+  if(!m_useHdrCache)
+    return {};
+  return HdrEnvCache(nvutils::getExecutablePath().parent_path() / "ibl_cache");
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -2026,6 +2536,11 @@ void GltfRenderer::createHDR(const std::filesystem::path& hdrFilename)
 void GltfRenderer::destroyResources()
 {
   m_loadPipeline.destroy();
+  if(m_hdrUpload)
+  {
+    m_hdrUpload->uploader.deinit();
+    m_hdrUpload.reset();
+  }
 
   m_resources.allocator.destroyBuffer(m_resources.bFrameInfo);
   m_resources.allocator.destroyBuffer(m_resources.bSkyParams);
@@ -2056,6 +2571,37 @@ void GltfRenderer::destroyResources()
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// Evaluate the channels of the current animation frame (see updateAnimation).
+// Headless renders with --animationStep and --animationPipelineDepth take the frame from
+// AnimationPrefetch, evaluated on the task scheduler while the previous frames rendered, world
+// matrices and moved render nodes included; the scene ends up as if updateAnimation() and
+// updateNodeWorldMatrices() had run here. A frame that was not prepared (reset, other clip, other
+// speed) is evaluated in line and the prefetch restarted from it.
+//
+bool GltfRenderer::evaluateAnimationChannels(nvvkgltf::Scene& scn, int animation, float deltaTime, bool& worldMatricesUpdated)
+{
+  worldMatricesUpdated = false;
+  const bool pipelined = isHeadlessMode() && m_animationStep > 0.0f && m_animationPipelineDepth > 0
+                         && nvvkgltf::AnimationPrefetch::canPrefetch(scn, animation);
+  if(!pipelined)
+  {
+    m_animationPrefetch.stop();
+    return scn.animation().updateAnimation(animation);
+  }
+
+  const float time = scn.animation().getAnimationInfo(animation).currentTime;
+  if(m_animationPrefetch.isRunning())
+  {
+    if(std::optional<bool> animated = m_animationPrefetch.apply(scn, animation, time, &worldMatricesUpdated))
+      return *animated;
+  }
+  const bool animated = scn.animation().updateAnimation(animation);
+  // The clip now holds this frame: the prefetch starts from its time, a step ahead
+  m_animationPrefetch.start(scn, animation, deltaTime, uint32_t(m_animationPipelineDepth));
+  return animated;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Update the scene animation
 // - If there is an animation in the scene, and animation is enabled, update the animation
@@ -2085,18 +2631,48 @@ bool GltfRenderer::updateAnimation(VkCommandBuffer cmd)
     nvvkgltf::SceneVk&  scnVk  = m_resources.sceneVk;
     nvvkgltf::SceneRtx& scnRtx = m_resources.sceneRtx;
 
-    float                    deltaTime = animCtrl.deltaTime();
-    nvvkgltf::AnimationInfo& animInfo  = scn.animation().getAnimationInfo(animCtrl.currentAnimation);
+    // --animationStep: the same step every frame, so headless renders don't depend on the frame rate
+    const float deltaTime = (m_animationStep > 0.0f && !animCtrl.runOnce) ? animCtrl.speed * m_animationStep : animCtrl.deltaTime();
+    nvvkgltf::AnimationInfo& animInfo = scn.animation().getAnimationInfo(animCtrl.currentAnimation);
     if(animCtrl.isReset())
       animInfo.reset();
     else
       animInfo.incrementTime(deltaTime);
 
+    // Rigid animations (node TRS channels only) can be evaluated entirely on the GPU: the keyframes
+    // are uploaded once and node_animation.comp writes the animated local matrices every frame.
+    if(m_resources.sceneGpu.useGpuNodeAnimation && !scn.getDirtyFlags().tlasVisibilityNeedsCpuSync)
+    {
+      // Edits may have changed the rest TRS captured by the table; rebuild it (cheap) before playing.
+      scn.animation().invalidateGpuNodeAnimation(scn.getDirtyFlags().nodes);
+      const nvvkgltf::NodeAnimationTable* nodeAnim = scn.animation().prepareGpuNodeAnimation(animCtrl.currentAnimation);
+      if(nodeAnim && m_resources.sceneGpu.shouldUseGpuTransform(scn, true))
+      {
+        animCtrl.clearStates();
+        if(!scn.getDirtyFlags().nodes.empty())
+          scn.updateLocalMatricesAndLights();
+        scnRtx.updateInstanceFlagsCache(scn);
+        (void)scnVk.syncFromScene(m_resources.staging, scn, nvvkgltf::SceneVk::eSyncMaterials | nvvkgltf::SceneVk::eSyncLights);
+        (void)scnVk.flushSceneDescIfDirty(m_resources.staging, scn);
+
+        auto timerSectionAS = m_profilerGpuTimer.cmdFrameSection(cmd, "GPU node animation");
+        m_resources.transformCompute.dispatchAnimatedTransformUpdate(cmd, m_resources.staging, scn, scnVk, scnRtx, *nodeAnim,
+                                                                     scn.animation().getGpuNodeAnimationRevision(),
+                                                                     animInfo.currentTime);
+        scn.animation().markGpuNodeAnimationPlayed();
+        scn.clearDirtyFlags();
+        return true;
+      }
+    }
+    // CPU playback from here on: first catch the model up with any GPU-played frames.
+    scn.animation().syncGpuNodeAnimationToCpu();
+
     // Evaluate animation channels (marks Scene nodes dirty internally; also marks
     // render nodes for skins whose joints moved, and materials/lights for pointer channels)
+    bool worldMatricesUpdated = false;
     {
       auto t = m_profilerGpuTimer.cmdFrameSection(cmd, "Eval channels");
-      if(!scn.animation().updateAnimation(animCtrl.currentAnimation))
+      if(!evaluateAnimationChannels(scn, animCtrl.currentAnimation, deltaTime, worldMatricesUpdated))
         return false;
     }
 
@@ -2106,7 +2682,8 @@ bool GltfRenderer::updateAnimation(VkCommandBuffer cmd)
     // render nodes (including descendants needed for transform-only animated nodes).
     {
       auto t = m_profilerGpuTimer.cmdFrameSection(cmd, "World matrices + dirty");
-      scn.updateNodeWorldMatrices();
+      if(!worldMatricesUpdated)  // Pipelined frames come with them
+        scn.updateNodeWorldMatrices();
     }
 
     scnRtx.updateInstanceFlagsCache(scn);
@@ -2131,8 +2708,11 @@ bool GltfRenderer::updateAnimation(VkCommandBuffer cmd)
       }
     }
 
-    bool hasMorphOrSkin = scn.animation().hasMorphTargets() || scn.animation().hasSkinning();
-    if(hasMorphOrSkin)
+    // On the GPU transform path, compute skinning runs inside the transform update: the joint palettes
+    // are then built on the GPU from this frame's device world matrices, before the TLAS update.
+    const bool hasMorphOrSkin          = scn.animation().hasMorphTargets() || scn.animation().hasSkinning();
+    const bool deformInTransformUpdate = hasMorphOrSkin && gpuTransform && m_resources.sceneGpu.useComputeAnimation;
+    if(hasMorphOrSkin && !deformInTransformUpdate)
     {
       auto timerSectionMorph = m_profilerGpuTimer.cmdFrameSection(cmd, "Morph or Skin");
       m_resources.sceneGpu.applyAnimation(cmd, scn);
@@ -2150,11 +2730,28 @@ bool GltfRenderer::updateAnimation(VkCommandBuffer cmd)
 
     {
       auto timerSectionAS = m_profilerGpuTimer.cmdFrameSection(cmd, "AS update");
-      if(hasMorphOrSkin)
+      if(hasMorphOrSkin && !deformInTransformUpdate)
         scnRtx.updateBottomLevelAS(cmd, scn);
       if(gpuTransform)
       {
-        m_resources.transformCompute.dispatchTransformUpdate(cmd, m_resources.staging, scn, scnVk, scnRtx);
+        bool deformed = false;
+        auto deform   = [&](VkCommandBuffer deformCmd, VkDeviceAddress worldMatrices) {
+          auto timerSectionMorph = m_profilerGpuTimer.cmdFrameSection(deformCmd, "Morph or Skin");
+          m_resources.sceneGpu.applyAnimation(deformCmd, scn, worldMatrices);
+          scnRtx.updateBottomLevelAS(deformCmd, scn);
+          nvvk::accelerationStructureBarrier(deformCmd, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+                                             VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR);
+          deformed = true;
+        };
+        m_resources.transformCompute.dispatchTransformUpdate(cmd, m_resources.staging, scn, scnVk, scnRtx,
+                                                             deformInTransformUpdate ? nvvkgltf::TransformComputeVk::BeforeTlasUpdateFunc(deform) :
+                                                                                       nvvkgltf::TransformComputeVk::BeforeTlasUpdateFunc());
+        if(deformInTransformUpdate && !deformed)
+        {
+          // The transform update recorded nothing; deform from the CPU world matrices instead
+          m_resources.sceneGpu.applyAnimation(cmd, scn);
+          scnRtx.updateBottomLevelAS(cmd, scn);
+        }
       }
       else
       {
@@ -2236,7 +2833,8 @@ void GltfRenderer::updateSceneChanges_TangentUpload(VkCommandBuffer cmd, nvvkglt
   (void)cmd;
   if(m_resources.dirtyFlags.test(DirtyFlags::eDirtyTangents))
   {
-    m_resources.sceneVk.uploadVertexBuffers(m_resources.staging, *scene);
+    m_sceneEditedOutsideUndo = true;  // Recomputed tangents are not on the undo stack
+    m_resources.sceneGpu.uploadVertexBuffers(*scene);
     m_resources.dirtyFlags.reset(DirtyFlags::eDirtyTangents);
     changed = true;
   }
@@ -2278,11 +2876,17 @@ bool GltfRenderer::updateSceneChanges(VkCommandBuffer cmd)
   m_skipGpuSyncValidation = false;
 #endif
 
-  const auto& df             = scene->getDirtyFlags();
+  const auto& df = scene->getDirtyFlags();
+
+  // Something is about to be synced: bring the model up to date with GPU-played node animation first
+  // (marks the animated nodes dirty), so no path below uploads their stale CPU transforms.
+  if(!df.isEmpty())
+    scene->animation().syncGpuNodeAnimationToCpu();
+
   bool        changed        = !df.isEmpty();
   bool        stagingFlushed = false;
 
-  bool renderNodeOrNodeDirty = df.allRenderNodesDirty || !df.renderNodesVk.empty() || !df.nodes.empty();
+  bool renderNodeOrNodeDirty = df.allRenderNodesDirty || df.renderNodesVkDirty() || !df.nodes.empty();
 
   // Material edit may have added or removed a KHR_materials_* extension; refresh the
   // scene feature set so optimal-mode shader rebuild picks it up. Cheap check (walk
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -32,10 +33,14 @@
 #include <nvslang/slang.hpp>
 #include <nvvk/descriptors.hpp>
 #include <nvvk/render_target.hpp>
-#include <nvvk/hdr_ibl.hpp>
 #include <nvvk/ray_picker.hpp>
 #include <nvvk/resource_allocator.hpp>
 #include "gltf_scene.hpp"
+#include "file_watcher.hpp"
+#include "gltf_animation_prefetch.hpp"
+#include "gltf_scene_diff.hpp"
+#include "gltf_scene_estimate.hpp"
+#include "gpu_allocation_journal.hpp"
 #include "gltf_scene_rtx.hpp"
 #include "gltf_scene_vk.hpp"
 #include <nvvk/profiler_vk.hpp>
@@ -47,10 +52,12 @@
 #include "shaders/shaderio.h"  // Shared between host and device
 
 #include "benchmarking.hpp"
+#include "hdr_environment.hpp"
 #include "renderer_pathtracer.hpp"
 #include "renderer_rasterizer.hpp"
 #include "resources.hpp"
 #include "renderer_silhouette.hpp"
+#include "task_scheduler.hpp"
 #include "ui_busy_window.hpp"
 #include "ui_scene_browser.hpp"
 #include "ui_inspector.hpp"
@@ -72,7 +79,7 @@ public:
   // Ensure an editable Scene exists (wired to the UI, no GPU build) so add/import can run from nothing.
   void ensureEmptyScene();
   void createSceneFromDescriptor(const std::filesystem::path& descriptorPath);
-  void createHDR(const std::filesystem::path& hdrFilename);
+  void createHDR(const std::filesystem::path& hdrFilename);  // Blocking; see loadHdrAsync()
   void onMergeScene(const std::filesystem::path& filename);
   void onReferenceScene(const std::filesystem::path& filename);
   // Shared worker for merge (embed) and reference (glTF 2.1 external asset) imports.
@@ -107,13 +114,25 @@ private:
   void reconcileGeometryIfNeeded();  // Rebuild geometry when GPU buffers are behind the render-primitive count (e.g. added primitive)
   void refreshCpuSceneGraphFromModel();
   void rebuildVulkanSceneInternal(bool rebuildTextures);  // GPU upload + AS; CPU scene must already be parsed
+  bool appendVulkanScene(const nvvkgltf::SceneAppendInfo& info);  // Incremental GPU upload after an append-only merge/reference
+  void updateUiAfterSceneRebuild();
   void compileShaders();
   void createDescriptorSets();
   void createResourceBuffers();
   void createVulkanScene();
   void finalizeSceneSetup(const std::filesystem::path& filename);  // Shared GPU build + UI wiring after a load
+  bool checkMemoryBudget(const std::filesystem::path& filename);   // Pre-load estimate against --memoryBudgetMB
+  void logEstimateAccuracy();                                       // Estimate vs. GpuMemoryTracker after the load
+  void updateHostMemory();  // Measure the CPU-side containers into m_resources.hostMemoryTracker
+  void initAllocationJournal();                                    // --allocJournal: route every GPU tracker to the journal
+  void writeAllocationJournal();                                   // Save the journal and log its summary
+  void watchSceneFiles();                                           // --hotReload: hash the scene and watch its files
+  bool updateHotReload();  // --hotReload: start a reload of changed files, apply a finished one; true if GPU work was queued
   void wireSceneToUi();                                            // Wire current scene into browser/inspector panels
   void buildAccelerationStructures();                              // Helper for BLAS/TLAS building
+  void appendAccelerationStructures(const nvvkgltf::SceneAppendInfo& info);  // BLAS for appended primitives + TLAS
+  void enqueueBlasBuild(bool isAnimated);
+  void createTransformGpuBuffers();
   void destroyResources();
   void resetFrame();
   void silhouette(VkCommandBuffer cmd);
@@ -126,11 +145,13 @@ private:
 
   bool dlssGuideRequired() const;  // True when the path tracer currently needs DLSS/OptiX guide-buffer capture code.
   void updateGizmoAttachment();
-  bool updateTextures();
+  bool updateTextures(uint32_t firstTexture = 0);  // Writes texture descriptors [firstTexture, count)
   void updateHdrImages();
 
   bool updateSceneChanges(VkCommandBuffer cmd);
   bool updateAnimation(VkCommandBuffer cmd);
+  // Inline or prepared ahead; `worldMatricesUpdated`: the prepared frame did updateNodeWorldMatrices() too
+  bool evaluateAnimationChannels(nvvkgltf::Scene& scn, int animation, float deltaTime, bool& worldMatricesUpdated);
 
   // Headless / scripted benchmark (shared automation paths)
   [[nodiscard]] bool                             isBenchmarkMode() const;
@@ -176,6 +197,7 @@ private:
   void          onUndoRedo();
   void          renderMenuToolbarAndGizmos();
   void          renderMemoryStatistics();
+  void          renderSaveProgress();  // Background save: progress bar + Cancel, completion hand-off
   void          renderEnvironmentWindow();
   void          renderTonemapperWindow();
   void          renderStatisticsWindow();
@@ -189,6 +211,13 @@ private:
   void          applyGltfCamera(int cameraIndex);
   void          setGltfCameraFromView(int cameraIndex);
   void          loadHdrFileDialog();
+  void          loadHdrAsync(const std::filesystem::path& hdrFilename);  // Decode on a worker, keep rendering the current one
+  void          finishHdrLoad();                                         // Per frame: queue the upload of a finished background load
+  void          onHdrUploaded();                                         // Upload done: replace the current environment
+  void          clearLoadPipeline();                                     // m_loadPipeline.clear(), finishing a dropped environment upload
+  void          applyHdr(const HdrEnvironmentData& data);                // Upload, then replace the current environment (blocking)
+  void          activateHdr();                                           // Switch to the uploaded environment
+  HdrEnvCache   hdrCache() const;
 
   // Recent files management
   std::vector<std::filesystem::path> m_recentFiles;
@@ -222,10 +251,44 @@ private:
   Rasterizer m_rasterizer;  // Rasterizer renderer
 
   // New Scene Browser system (parallel implementation)
-  SceneSelection m_sceneSelection;  // Shared selection state
-  UiSceneBrowser m_sceneBrowser;    // New scene browser
-  UiInspector    m_inspector;       // New inspector
-  BusyWindow     m_busy;
+  SceneSelection       m_sceneSelection;  // Shared selection state
+  UiSceneBrowser       m_sceneBrowser;    // New scene browser
+  UiInspector          m_inspector;       // New inspector
+  BusyWindow           m_busy;
+  nvvkgltf::TaskHandle m_sceneTask;  // Load, merge or reference running under m_busy (eHigh)
+  // Background save (GltfRenderer::save): the snapshot is written while rendering and editing go on
+  nvvkgltf::AsyncSceneSave m_asyncSave;
+  nvvkgltf::Scene*         m_asyncSaveScene = nullptr;  // Scene the running save was taken from, reset by cleanupScene()
+  // Background HDR environment load, and the on-disk cache of decoded environments (--hdrCache)
+  AsyncHdrLoad m_hdrLoad;
+  bool         m_useHdrCache = true;
+  // Finished load uploading through m_loadPipeline, switched to by onHdrUploaded()
+  struct HdrUpload
+  {
+    AsyncHdrLoad::Result  result;
+    nvvk::StagingUploader uploader;
+  };
+  std::unique_ptr<HdrUpload> m_hdrUpload;
+  // Pre-load estimate (--memoryBudgetMB): scenes over the budget are rejected before loading
+  float                                  m_memoryBudgetMB = 0.0f;  // 0: no budget
+  std::optional<nvvkgltf::SceneEstimate> m_loadEstimate;           // Of the scene being loaded
+  // GPU allocation journal (--allocJournal): allocate/free events of all trackers, saved on exit
+  std::filesystem::path                        m_allocJournalPath;
+  std::unique_ptr<nvvkgltf::AllocationJournal> m_allocJournal;
+  uint64_t                                     m_allocJournalFrame = 0;
+  // Hot reload (--hotReload): the scene files are watched, reloaded in the background when they change,
+  // and the content diff against the current scene is applied in place (or the scene reloaded)
+  bool                         m_hotReload        = false;
+  bool                         m_hotReloadPending = false;  // Files changed while a reload was running
+  nvvkgltf::FileWatcher        m_fileWatcher;
+  nvvkgltf::SceneContentHashes m_sceneHashes;  // Of the scene as loaded or last reloaded
+  bool                         m_sceneEditedOutsideUndo = false;  // Merged, referenced or rebuilt since the load (not on the undo stack)
+  nvvkgltf::AsyncSceneReload   m_sceneReload;
+  // Headless animation renders: a fixed time step per frame (--animationStep), and the channels and world
+  // matrices of the next frames computed on the task scheduler while the current one renders (--animationPipelineDepth)
+  float                       m_animationStep          = 0.0f;  // Seconds per frame at speed 1; 0: real time
+  int                         m_animationPipelineDepth = 0;     // Frames prepared ahead; 0: serial
+  nvvkgltf::AnimationPrefetch m_animationPrefetch;
   Silhouette     m_silhouette;     // Silhouette renderer
   VisualHelpers  m_visualHelpers;  // Grid + transform gizmo overlay
 
@@ -26,7 +26,6 @@
 
 #include <fmt/format.h>
 #include <chrono>
-#include <thread>
 #include <vector>
 
 #include <nvapp/elem_dbgprintf.hpp>
@@ -39,6 +38,7 @@
 #include <nvgui/tooltip.hpp>
 
 #include "renderer_pathtracer.hpp"
+#include "shaders/accumulation.h"
 
 #include "scene_shader_macros.hpp"
 #include "ui_linear_color.hpp"
@@ -128,8 +128,14 @@ void PathTracer::registerParameters(nvutils::ParameterRegistry* paramReg)
   paramReg->add({"ptAutoFocus", "PathTracer: Enable auto focus"}, &m_autoFocus);
   paramReg->add({"ptTechnique", "PathTracer: Rendering technique [RayQuery:0, RayTracing:1]"}, (int*)&m_renderTechnique);
   paramReg->add({"ptAdaptiveSampling", "PathTracer: Enable adaptive sampling"}, &m_adaptiveSampling);
+  paramReg->add({"ptAccumWindow",
+                 "PathTracer: Accumulation history cap in samples (0=auto: unbounded at full precision, "
+                 "1024 at half precision)"},
+                &m_accumWindow);
   paramReg->add({"ptPerformanceTarget", "PathTracer: Performance target [Interactive:0, Balanced:1, Quality:2, MaxQuality:3]"},
                 (int*)&m_performanceTarget);
+  paramReg->add({"ptDynamicResolution", "PathTracer: Reduce the internal resolution while the view changes every frame"},
+                &m_dynamicResolutionEnabled);
 #if defined(USE_DLSS)
   m_dlss->registerParameters(paramReg);
 #endif
@@ -146,6 +152,7 @@ void PathTracer::setSettingsHandler(nvgui::SettingsHandler* settingsHandler)
   settingsHandler->setSetting("ptTechnique", (int*)&m_renderTechnique);
   settingsHandler->setSetting("ptAdaptiveSampling", &m_adaptiveSampling);
   settingsHandler->setSetting("ptPerformanceTarget", (int*)&m_performanceTarget);
+  settingsHandler->setSetting("ptDynamicResolution", &m_dynamicResolutionEnabled);
   settingsHandler->setSetting("ptMaxDepth", &m_pushConst.maxDepth);
   settingsHandler->setSetting("ptTexGradScale", &m_pushConst.texGradScale);
 
@@ -163,8 +170,7 @@ void PathTracer::setSettingsHandler(nvgui::SettingsHandler* settingsHandler)
 void PathTracer::onDetach(Resources& resources)
 {
   // Wait for any background compile to finish before destroying the Vulkan objects it owns.
-  if(m_compileThread.joinable())
-    m_compileThread.join();
+  nvvkgltf::TaskScheduler::shared().wait(m_compileTask);
 
   resources.allocator.destroyBuffer(m_sbtBuffer);
 
@@ -175,6 +181,12 @@ void PathTracer::onDetach(Resources& resources)
 #if defined(USE_OPTIX_DENOISER)
   m_optix->deinit(resources);
 #endif
+  if(m_interactionStagingFormat != VK_FORMAT_UNDEFINED)
+  {
+    resources.appMemoryTracker.untrack("PathTracer/Interaction", m_interactionStaging, 2);
+    m_interactionStaging.deinit();
+    m_interactionStagingFormat = VK_FORMAT_UNDEFINED;
+  }
   vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
   vkDestroyShaderModule(m_device, m_shaderModule, nullptr);
   vkDestroyPipeline(m_device, m_rtxPipeline, nullptr);
@@ -333,6 +345,15 @@ bool PathTracer::onUIRender(Resources& resources)
         m_performanceTarget = static_cast<PerformanceTarget>(currentTarget);
       }
     }
+    PE::Checkbox("Dynamic Resolution", &m_dynamicResolutionEnabled,
+                 "While the camera or an object moves, trace at a reduced resolution that meets the performance "
+                 "target, then return to full resolution when the motion stops");
+    if(m_dynamicResolution.isInteracting())
+    {
+      ImGui::SameLine();
+      ImGui::TextDisabled("(%.0f%%)", m_dynamicResolution.scale() * 100.0f);
+    }
+
     // Performance info - always visible
     const int   frames      = resources.frameCount + 1;
     const float sppPerFrame = (frames > 0) ? float(m_totalSamplesAccumulated) / float(frames) : 0.f;
@@ -480,19 +501,21 @@ void PathTracer::ensureShadersAndPipelines(Resources& resources)
 }
 
 //--------------------------------------------------------------------------------------------------
-// Launches a background worker that (re)compiles the Slang shader and builds the ray
-// tracing pipeline for the currently selected technique.
+// Launches a background task that (re)compiles the Slang shader and builds the ray
+// tracing pipeline for the currently selected technique. eInteractive: it runs ahead of the
+// image decodes of a scene load.
 void PathTracer::startAsyncCompile(Resources& resources)
 {
-  if(m_compileThread.joinable())
-    m_compileThread.join();
+  nvvkgltf::TaskScheduler::shared().wait(m_compileTask);
 
   m_busyWindow->start("Preparing path tracer...");
 
-  m_compileThread = std::thread([this, &resources]() {
-    ensureShadersAndPipelines(resources);
-    m_busyWindow->stop();
-  });
+  m_compileTask = nvvkgltf::TaskScheduler::shared().submit(
+      [this, &resources]() {
+        ensureShadersAndPipelines(resources);
+        m_busyWindow->stop();
+      },
+      {.name = "Compile path tracer", .priority = nvvkgltf::TaskPriority::eInteractive});
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -552,6 +575,9 @@ void PathTracer::onRender(VkCommandBuffer cmd, Resources& resources)
   // Handle adaptive sampling (SPP adjustment)
   updateAdaptiveSampling(resources);
 
+  // Interaction mode: may restart accumulation (resources.frameCount) when motion stops
+  updateDynamicResolution(resources);
+
   // Finding the rendering size (needed before setupPushConstant so pixelAngle can be derived).
   VkExtent2D renderingSize = resources.gBuffers.getSize();
 #if defined(USE_DLSS)
@@ -567,6 +593,13 @@ void PathTracer::onRender(VkCommandBuffer cmd, Resources& resources)
     renderingSize = m_optix->getRenderSize();
   }
 #endif
+  // Interaction mode renders into the top-left corner, upscaled after tracing (never combined with the above)
+  const bool reducedResolution = m_dynamicResolution.scale() < 1.0f;
+  if(reducedResolution)
+  {
+    DynamicResolution::scaledSize(renderingSize.width, renderingSize.height, m_dynamicResolution.scale(),
+                                  renderingSize.width, renderingSize.height);
+  }
 
   // Setting up the push constant
   setupPushConstant(cmd, resources, renderingSize);
@@ -588,6 +621,11 @@ void PathTracer::onRender(VkCommandBuffer cmd, Resources& resources)
   // Making sure the rendered image is ready to be used by tonemapper
   nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
 
+  if(reducedResolution)
+  {
+    upscaleInteractionFrame(cmd, resources, renderingSize);
+  }
+
 #if defined(USE_DLSS)
   // If DLSS is effectively enabled for this frame, perform denoising
   if(getEffectiveDlssEnabled(resources))
@@ -613,49 +651,114 @@ void PathTracer::onRender(VkCommandBuffer cmd, Resources& resources)
   updateStatistics(resources);
 }
 
+//--------------------------------------------------------------------------------------------------
+// Stretch the top-left srcSize region of `image` over dstSize.
+// vkCmdBlitImage cannot blit an image to itself with overlapping regions, so the region is
+// copied to a staging image first, then blitted back at full resolution.
+static void cmdUpscaleTopLeft(VkCommandBuffer    cmd,
+                              VkImage            image,
+                              VkImage            staging,
+                              VkImageAspectFlags aspect,
+                              VkExtent2D         srcSize,
+                              VkExtent2D         dstSize,
+                              VkFilter           filter)
+{
+  VkImageSubresourceLayers subresource = {.aspectMask = aspect, .layerCount = 1};
+
+  VkImageCopy copy{
+      .srcSubresource = subresource,
+      .dstSubresource = subresource,
+      .extent         = {srcSize.width, srcSize.height, 1},
+  };
+  vkCmdCopyImage(cmd, image, VK_IMAGE_LAYOUT_GENERAL, staging, VK_IMAGE_LAYOUT_GENERAL, 1, &copy);
+
+  nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COPY_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT,
+                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_TRANSFER_READ_BIT);
+
+  VkOffset3D srcExtent = {int(srcSize.width), int(srcSize.height), 1};
+  VkOffset3D dstExtent = {int(dstSize.width), int(dstSize.height), 1};
+
+  VkImageBlit blit{
+      .srcSubresource = subresource,
+      .srcOffsets     = {{0, 0, 0}, srcExtent},
+      .dstSubresource = subresource,
+      .dstOffsets     = {{0, 0, 0}, dstExtent},
+  };
+  vkCmdBlitImage(cmd, staging, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL, 1, &blit, filter);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Upscale selection ID and depth from render resolution (half) to display resolution (full).
 // In OptiX 2x upscale mode the shader writes into the top-left corner of the full-res GBuffer.
-// vkCmdBlitImage cannot blit an image to itself with overlapping regions, so we copy the
-// half-res data to a staging image first, then blit it back at full resolution.
 void PathTracer::upscaleSelectionAndDepth(VkCommandBuffer cmd, Resources& resources)
 {
 #if defined(USE_OPTIX_DENOISER)
   VkExtent2D srcSize = m_optix->getRenderSize();
   VkExtent2D dstSize = resources.gBuffers.getSize();
 
-  // Copy half-res region to staging, then blit staging back to full-res destination.
-  auto copyAndBlit = [cmd, &srcSize, &dstSize](VkImage image, VkImage staging, VkImageAspectFlags aspect) {
-    VkImageSubresourceLayers subresource = {.aspectMask = aspect, .layerCount = 1};
+  cmdUpscaleTopLeft(cmd, resources.gBuffers.getColorImage(Resources::eImgSelection), m_optix->getStagingSelectionImage(),
+                    VK_IMAGE_ASPECT_COLOR_BIT, srcSize, dstSize, VK_FILTER_NEAREST);
+  cmdUpscaleTopLeft(cmd, resources.gBuffers.getDepthImage(), m_optix->getStagingDepthImage(), VK_IMAGE_ASPECT_DEPTH_BIT,
+                    srcSize, dstSize, VK_FILTER_NEAREST);
 
-    VkImageCopy copy{
-        .srcSubresource = subresource,
-        .dstSubresource = subresource,
-        .extent         = {srcSize.width, srcSize.height, 1},
-    };
-    vkCmdCopyImage(cmd, image, VK_IMAGE_LAYOUT_GENERAL, staging, VK_IMAGE_LAYOUT_GENERAL, 1, &copy);
+  nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_BLIT_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
+#endif
+}
 
-    nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COPY_BIT, VK_PIPELINE_STAGE_2_BLIT_BIT,
-                           VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_TRANSFER_READ_BIT);
+//--------------------------------------------------------------------------------------------------
+// Interaction mode: the frame was traced into the top-left renderingSize corner of the G-Buffer.
+// Stretch the rendered image (linear when the format allows), selection ID and depth (nearest)
+// over the display resolution, so tonemapper, silhouette and picking see a full frame.
+void PathTracer::upscaleInteractionFrame(VkCommandBuffer cmd, Resources& resources, VkExtent2D renderingSize)
+{
+  NVVK_DBG_SCOPE(cmd);
+  auto timerSection = m_profiler->cmdFrameSection(cmd, "Interaction upscale");
 
-    VkOffset3D srcExtent = {int(srcSize.width), int(srcSize.height), 1};
-    VkOffset3D dstExtent = {int(dstSize.width), int(dstSize.height), 1};
+  // Staging at display resolution, created on first use (and again if the color precision changed)
+  const VkFormat   renderedFormat = resources.gBuffers.getColorFormat(Resources::eImgRendered);
+  const VkExtent2D displaySize    = resources.gBuffers.getSize();
+  if(m_interactionStagingFormat != renderedFormat)
+  {
+    if(m_interactionStagingFormat != VK_FORMAT_UNDEFINED)
+    {
+      resources.appMemoryTracker.untrack("PathTracer/Interaction", m_interactionStaging, 2);
+      m_interactionStaging.deinit();
+    }
+    NVVK_CHECK(m_interactionStaging.init({.device       = m_device,
+                                          .alloc        = &resources.allocator,
+                                          .colorFormats = {renderedFormat, VK_FORMAT_R32_SFLOAT},
+                                          .depthFormat  = resources.gBuffers.getDepthFormat(),
+                                          .debugName    = "PathTracer-Interaction"}));
+    m_interactionStagingFormat = renderedFormat;
+
+    VkFormatProperties formatProps{};
+    vkGetPhysicalDeviceFormatProperties(resources.allocator.getPhysicalDevice(), renderedFormat, &formatProps);
+    m_interactionLinearBlit = (formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+  }
+  // Tracked only when the images change; untrack is a no-op while the staging has no size yet
+  const VkExtent2D stagingSize = m_interactionStaging.getSize();
+  if(stagingSize.width != displaySize.width || stagingSize.height != displaySize.height)
+  {
+    resources.appMemoryTracker.untrack("PathTracer/Interaction", m_interactionStaging, 2);
+    NVVK_CHECK(m_interactionStaging.update(cmd, displaySize));
+    resources.appMemoryTracker.track("PathTracer/Interaction", m_interactionStaging, 2);
+  }
 
-    VkImageBlit blit{
-        .srcSubresource = subresource,
-        .srcOffsets     = {{0, 0, 0}, srcExtent},
-        .dstSubresource = subresource,
-        .dstOffsets     = {{0, 0, 0}, dstExtent},
-    };
-    vkCmdBlitImage(cmd, staging, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL, 1, &blit, VK_FILTER_NEAREST);
-  };
+  // Trace (compute or ray tracing) writes -> copy reads
+  nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_2_RAY_TRACING_SHADER_BIT_KHR,
+                         VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_SHADER_WRITE_BIT, VK_ACCESS_2_TRANSFER_READ_BIT);
 
-  copyAndBlit(resources.gBuffers.getColorImage(Resources::eImgSelection), m_optix->getStagingSelectionImage(), VK_IMAGE_ASPECT_COLOR_BIT);
-  copyAndBlit(resources.gBuffers.getDepthImage(), m_optix->getStagingDepthImage(), VK_IMAGE_ASPECT_DEPTH_BIT);
+  cmdUpscaleTopLeft(cmd, resources.gBuffers.getColorImage(Resources::eImgRendered), m_interactionStaging.getColorImage(0),
+                    VK_IMAGE_ASPECT_COLOR_BIT, renderingSize, displaySize, m_interactionLinearBlit ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+  cmdUpscaleTopLeft(cmd, resources.gBuffers.getColorImage(Resources::eImgSelection), m_interactionStaging.getColorImage(1),
+                    VK_IMAGE_ASPECT_COLOR_BIT, renderingSize, displaySize, VK_FILTER_NEAREST);
+  cmdUpscaleTopLeft(cmd, resources.gBuffers.getDepthImage(), m_interactionStaging.getDepthImage(), VK_IMAGE_ASPECT_DEPTH_BIT,
+                    renderingSize, displaySize, VK_FILTER_NEAREST);
 
-  nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_BLIT_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
-                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_SHADER_READ_BIT);
-#endif
+  // Tonemapper, silhouette and the raster overlays read these next
+  nvvk::cmdMemoryBarrier(cmd, VK_PIPELINE_STAGE_2_BLIT_BIT, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                         VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -933,12 +1036,11 @@ void PathTracer::createRtxPipeline(Resources& resources)
 
   if(createResult == VK_OPERATION_DEFERRED_KHR)
   {
-    // Parallelize the compile across worker threads. We spawn (maxConcurrency - 1) workers
-    // and have the calling thread also participate, so we use all available parallelism
-    // reported by the driver without over-subscribing.
-    const uint32_t maxConcurrency = vkGetDeferredOperationMaxConcurrencyKHR(m_device, deferredOp);
-    const uint32_t hwConcurrency  = std::max(1u, std::thread::hardware_concurrency());
-    const uint32_t threadCount    = std::min(maxConcurrency, hwConcurrency);
+    // Parallelize the compile across the scheduler's workers, the calling thread included, up
+    // to the parallelism reported by the driver.
+    nvvkgltf::TaskScheduler& scheduler      = nvvkgltf::TaskScheduler::shared();
+    const uint32_t           maxConcurrency = vkGetDeferredOperationMaxConcurrencyKHR(m_device, deferredOp);
+    const uint32_t           threadCount    = std::max(1u, std::min(maxConcurrency, scheduler.getWorkerCount() + 1));
 
     auto joinLoop = [this, deferredOp]() {
       VkResult r;
@@ -950,13 +1052,7 @@ void PathTracer::createRtxPipeline(Resources& resources)
       // VK_SUCCESS: whole deferred op finished
     };
 
-    std::vector<std::thread> workers;
-    workers.reserve(threadCount > 0 ? threadCount - 1 : 0);
-    for(uint32_t i = 1; i < threadCount; ++i)
-      workers.push_back(std::thread(joinLoop));
-    joinLoop();
-    for(auto& t : workers)
-      t.join();
+    scheduler.parallelFor<1>(threadCount, [&](uint64_t) { joinLoop(); }, nvvkgltf::currentTaskPriority(), threadCount);
 
     // All threads returned either VK_THREAD_DONE_KHR or VK_SUCCESS; poll the final result
     // (per spec, VK_NOT_READY means workers are done but some bookkeeping remains).
@@ -1033,8 +1129,7 @@ void PathTracer::createRtxPipeline(Resources& resources)
 // Compile the shader
 void PathTracer::reloadShader(Resources& resources)
 {
-  if(m_compileThread.joinable())
-    m_compileThread.join();
+  nvvkgltf::TaskScheduler::shared().wait(m_compileTask);
 
   // SYNC NOTE: User-initiated shader reload — cached pipelines may still be in flight from a
   // recent variant switch; live handles are destroyed in compileShader() below.
@@ -1344,17 +1439,9 @@ void PathTracer::updateAdaptiveSampling(Resources& resources)
     return;
 
   // Get timing information for the path tracing section
-  nvutils::ProfilerTimeline::TimerInfo timerInfo;
-  std::string                          apiName;
-
-  // Try both possible timer names based on rendering technique
-  const char* timerName = (m_renderTechnique == RenderTechnique::RayQuery) ? "Path Trace (RQ)" : "Path Trace (RTX)";
-
-  if(m_profilerTimeline->getFrameTimerInfo(timerName, timerInfo, apiName))
+  const double currentFrameTimeMs = getLastTraceTimeMs();
+  if(currentFrameTimeMs >= 0.0)
   {
-    // Convert from microseconds to milliseconds
-    double currentFrameTimeMs = timerInfo.gpu.last / 1000.0;
-
     // Adjust samples based on performance target
     double targetTime = getTargetFrameTimeMs();
     if(currentFrameTimeMs < targetTime * 0.8 && m_pushConst.numSamples < MAX_SAMPLES_PER_PIXEL)
@@ -1374,6 +1461,54 @@ void PathTracer::updateAdaptiveSampling(Resources& resources)
 }
 
 
+//--------------------------------------------------------------------------------------------------
+// GPU time of the last path-trace pass (RQ or RTX timer), in milliseconds; -1 if not available.
+double PathTracer::getLastTraceTimeMs() const
+{
+  if(!m_profilerTimeline)
+    return -1.0;
+
+  nvutils::ProfilerTimeline::TimerInfo timerInfo;
+  std::string                          apiName;
+
+  // Try both possible timer names based on rendering technique
+  const char* timerName = (m_renderTechnique == RenderTechnique::RayQuery) ? "Path Trace (RQ)" : "Path Trace (RTX)";
+  if(!m_profilerTimeline->getFrameTimerInfo(timerName, timerInfo, apiName))
+    return -1.0;
+
+  // Convert from microseconds to milliseconds
+  return timerInfo.gpu.last / 1000.0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Interaction mode: while every frame restarts accumulation (camera or gizmo drag, animation), trace
+// at the reduced resolution chosen by DynamicResolution against the performance target. When the
+// motion stops, the frame restarts accumulation at full resolution.
+// Off with DLSS or OptiX upscaling (they pick their own render size) and for headless renders.
+void PathTracer::updateDynamicResolution(Resources& resources)
+{
+  bool allowed = m_dynamicResolutionEnabled && !resources.app->isHeadless() && !isDlssEnabled();
+#if defined(USE_OPTIX_DENOISER)
+  allowed = allowed && !(getEffectiveOptixEnabled(resources) && m_optix->isUpscaleMode());
+#endif
+
+  if(!allowed)
+  {
+    if(m_dynamicResolution.isInteracting())
+    {
+      m_dynamicResolution.reset();
+      resources.frameCount = 0;  // Last frame was reduced: don't accumulate on top of it
+    }
+    return;
+  }
+
+  m_dynamicResolution.settings().targetFrameTimeMs = getTargetFrameTimeMs();
+  if(m_dynamicResolution.update(resources.frameCount == 0, getLastTraceTimeMs()) == DynamicResolution::Transition::eExit)
+  {
+    resources.frameCount = 0;  // Restart accumulation at full resolution
+  }
+}
+
 void PathTracer::updateStatistics(Resources& resources)
 {
 
@@ -1546,6 +1681,12 @@ void PathTracer::setupPushConstant(VkCommandBuffer cmd, Resources& resources, Vk
 #if defined(USE_OPTIX_DENOISER)
   m_pushConst.flags |= useOptixDenoiser ? shaderio::ePtUseOptixDenoiser : 0;
 #endif
+  // Half-precision result image: a plain running mean stalls once new samples fall below half an ulp,
+  // so cap the history and round stochastically on store (see shaders/accumulation.h).
+  const bool halfPrecision = resources.settings.colorPrecision == ColorPrecision::eHalf;
+  m_pushConst.flags |= halfPrecision ? shaderio::ePtHalfPrecision : 0;
+  m_pushConst.accumWindow = (m_accumWindow > 0) ? m_accumWindow : (halfPrecision ? ACCUM_HALF_DEFAULT_WINDOW : 0);
+
   m_pushConst.totalSamples = m_totalSamplesAccumulated;
   m_pushConst.frameInfo    = (shaderio::SceneFrameInfo*)resources.bFrameInfo.address;
   m_pushConst.skyParams    = (shaderio::SkyPhysicalParameters*)resources.bSkyParams.address;
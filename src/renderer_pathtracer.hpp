@@ -20,7 +20,6 @@
 #pragma once
 
 #include <mutex>
-#include <thread>
 
 #include <glm/glm.hpp>
 
@@ -29,10 +28,12 @@
 
 #include <nvvk/sbt_generator.hpp>
 #include <nvutils/profiler.hpp>
+#include "dynamic_resolution.hpp"
 #include "renderer_base.hpp"
 #include "utils.hpp"
 #include "pipeline_cache_util.hpp"
 #include "scene_feature_detection.hpp"
+#include "task_scheduler.hpp"
 #include "ui_busy_window.hpp"
 
 // #DLSS
@@ -148,9 +149,9 @@ public:
   bool swapVariant(Resources& resources, const VariantKey& newKey);
   void destroyVariantCache(Resources& resources);
 
-  BusyWindow* m_busyWindow{nullptr};  // Modal shown during async shader/pipeline compile.
-  std::mutex  m_compileMutex;         // Guards compile metadata and live pipeline handles.
-  std::thread m_compileThread;        // Joined in onDetach().
+  BusyWindow*          m_busyWindow{nullptr};  // Modal shown during async shader/pipeline compile.
+  std::mutex           m_compileMutex;         // Guards compile metadata and live pipeline handles.
+  nvvkgltf::TaskHandle m_compileTask;          // Waited for in onDetach().
 
   // The default rendering technique
   RenderTechnique m_renderTechnique{RenderTechnique::RayTracing};
@@ -160,9 +161,19 @@ public:
   nvutils::ProfilerTimeline* m_profilerTimeline{nullptr};
   bool                       m_adaptiveSampling{true};
   int                        m_totalSamplesAccumulated{0};  // Track total samples separately
+  int                        m_accumWindow{0};  // Accumulation history cap in samples (0: auto, unbounded at full precision)
 
   nvsamples::RollingAverage<float, 100> m_throughputRollingAvg;  // Rolling average of mega-sample-pixels per second (MSPP/s)
 
+  // Interaction mode: reduced internal resolution while the view changes every frame (see DynamicResolution)
+  void               updateDynamicResolution(Resources& resources);
+  void               upscaleInteractionFrame(VkCommandBuffer cmd, Resources& resources, VkExtent2D renderingSize);
+  DynamicResolution  m_dynamicResolution;
+  bool               m_dynamicResolutionEnabled{true};
+  nvvk::RenderTarget m_interactionStaging;  // Staging copies of rendered/selection/depth for the upscale blit
+  VkFormat           m_interactionStagingFormat{VK_FORMAT_UNDEFINED};  // Format m_interactionStaging was created with
+  bool               m_interactionLinearBlit{false};  // Rendered format supports linear filtering in blits
+
   // Adaptive performance targets
   enum class PerformanceTarget
   {
@@ -239,6 +250,7 @@ private:
   void                 startAsyncCompile(Resources& resources);
   CompileStateSnapshot getCompileStateSnapshot();
   void                 updateStatistics(Resources& resources);
+  double               getLastTraceTimeMs() const;  // GPU time of the last path-trace pass, < 0 if unavailable
   void                 renderRayQuery(VkCommandBuffer cmd, VkExtent2D renderingSize, Resources& resources);
   void                 renderRayTrace(VkCommandBuffer cmd, VkExtent2D& renderingSize, Resources& resources);
   void                 denoiseDlss(VkCommandBuffer cmd, Resources& resources);
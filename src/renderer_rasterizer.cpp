@@ -529,7 +529,7 @@ void Rasterizer::onRender(VkCommandBuffer cmd, Resources& resources)
 // Handles:
 // 1. Material and node-specific constant updates
 // 2. Vertex and index buffer binding
-// 3. Draw calls for each primitive
+// 3. Draw calls for each primitive, instanced over runs of consecutive render nodes
 void Rasterizer::renderNodes(VkCommandBuffer cmd, Resources& resources, const std::vector<uint32_t>& nodeIDs)
 {
   NVVK_DBG_SCOPE(cmd);
@@ -541,7 +541,7 @@ void Rasterizer::renderNodes(VkCommandBuffer cmd, Resources& resources, const st
   nvvkgltf::SceneVk& sceneVk = resources.sceneVk;
 
   const VkDeviceSize                            offsets{0};
-  const std::vector<nvvkgltf::RenderNode>&      renderNodes = scene.getRenderNodes();
+  const nvvkgltf::RenderNodeArrays&             renderNodes = scene.getRenderNodes();
   const std::vector<nvvkgltf::RenderPrimitive>& subMeshes   = scene.getRenderPrimitives();
 
   // Structure to hold only the changing parts
@@ -556,13 +556,34 @@ void Rasterizer::renderNodes(VkCommandBuffer cmd, Resources& resources, const st
   // This assumes materialID is the first field that changes in the struct
   uint32_t offset = static_cast<uint32_t>(offsetof(shaderio::RasterPushConstant, materialID));
 
-  for(const uint32_t& nodeID : nodeIDs)
+  std::span<const int>     materialIDs   = renderNodes.materialIDs();
+  std::span<const int>     renderPrimIDs = renderNodes.renderPrimIDs();
+  std::span<const uint8_t> visibility    = renderNodes.visibility();
+
+  for(size_t i = 0; i < nodeIDs.size();)
   {
-    const nvvkgltf::RenderNode&      renderNode = renderNodes[nodeID];
+    const uint32_t                   nodeID     = nodeIDs[i];
+    const auto&                      renderNode = renderNodes[nodeID];  // View into the render-node columns
     const nvvkgltf::RenderPrimitive& subMesh = subMeshes[renderNode.renderPrimID];  // Mesh referred by the draw object
 
     if(!renderNode.visible)
+    {
+      i++;
       continue;
+    }
+
+    // Consecutive render nodes with the same primitive and material (the instances of an
+    // EXT_mesh_gpu_instancing batch, or copies of a mesh) are one instanced draw: instance k
+    // reads render node `renderNodeID + SV_InstanceID` in the vertex shader.
+    uint32_t instanceCount = 1;
+    while(i + instanceCount < nodeIDs.size() && nodeIDs[i + instanceCount] == nodeID + instanceCount)
+    {
+      const uint32_t next = nodeID + instanceCount;
+      if(!visibility[next] || renderPrimIDs[next] != renderNode.renderPrimID || materialIDs[next] != renderNode.materialID)
+        break;
+      instanceCount++;
+    }
+    i += instanceCount;
 
     // Update only the changing fields
     NodeSpecificConstants nodeConstants{.materialID   = renderNode.materialID,
@@ -575,7 +596,7 @@ void Rasterizer::renderNodes(VkCommandBuffer cmd, Resources& resources, const st
     // Bind vertex and index buffers and draw the mesh
     vkCmdBindVertexBuffers(cmd, 0, 1, &sceneVk.vertexBuffers()[renderNode.renderPrimID].position.buffer, &offsets);
     vkCmdBindIndexBuffer(cmd, sceneVk.indices()[renderNode.renderPrimID].buffer, 0, VK_INDEX_TYPE_UINT32);
-    vkCmdDrawIndexed(cmd, subMesh.indexCount, 1, 0, 0, 0);
+    vkCmdDrawIndexed(cmd, subMesh.indexCount, instanceCount, 0, 0, 0);
   }
 }
 
@@ -952,8 +973,9 @@ void Rasterizer::captureAndMipOpaqueColor(VkCommandBuffer cmd, Resources& resour
   const uint32_t mips = m_opaqueColorImage.mipLevels;
 
   // Source image is whichever color sink was active during the opaque pass: the inner
-  // GBuffer color (Dlss-owned, Kind::SR) when USE_DLSS=ON, else eImgRendered. Both are
-  // R32G32B32A32_SFLOAT and get the same TRANSFER_SRC_OPTIMAL transition.
+  // GBuffer color (Dlss-owned, Kind::SR) when USE_DLSS=ON, else eImgRendered. Both are float
+  // targets (eImgRendered is RGBA16F with colorPrecision=Half) and get the same TRANSFER_SRC_OPTIMAL
+  // transition; the blit converts to the RGBA16F mip chain.
   VkImage    src     = resources.gBuffers.getColorImage(Resources::eImgRendered);
   VkExtent2D srcSize = resources.gBuffers.getSize();
 #if defined(USE_DLSS)
@@ -1073,8 +1095,10 @@ bool Rasterizer::updateSortedBlendNodes(VkCommandBuffer cmd, Resources& resource
     m_sortedBlendNodes.assign(blendNodes.begin(), blendNodes.end());
   }
 
-  const std::vector<nvvkgltf::RenderNode>& renderNodes = scenePtr->getRenderNodes();
-  const std::vector<glm::vec3>&            primCenters = scenePtr->getRenderPrimCenterObj();
+  // Only the world-matrix and primitive columns are read.
+  const std::span<const glm::mat4> worldMatrices = scenePtr->getRenderNodes().worldMatrices();
+  const std::span<const int>       renderPrimIDs = scenePtr->getRenderNodes().renderPrimIDs();
+  const std::vector<glm::vec3>&    primCenters   = scenePtr->getRenderPrimCenterObj();
 
   // Row 2 of viewMatrix pulls the view-space Z coordinate out of a vec4 via a single dot product.
   // In glm's column-major layout row r, column c lives at viewMatrix[c][r].
@@ -1084,18 +1108,18 @@ bool Rasterizer::updateSortedBlendNodes(VkCommandBuffer cmd, Resources& resource
   for(size_t i = 0; i < m_sortedBlendNodes.size(); ++i)
   {
     const uint32_t nodeID = m_sortedBlendNodes[i];
-    if(nodeID >= renderNodes.size())
+    if(nodeID >= worldMatrices.size())
     {
       depths[i] = 0.f;
       continue;
     }
-    const nvvkgltf::RenderNode& rnode = renderNodes[nodeID];
-    if(rnode.renderPrimID < 0 || size_t(rnode.renderPrimID) >= primCenters.size())
+    const int renderPrimID = renderPrimIDs[nodeID];
+    if(renderPrimID < 0 || size_t(renderPrimID) >= primCenters.size())
     {
       depths[i] = 0.f;
       continue;
     }
-    const glm::vec4 centerWS = rnode.worldMatrix * glm::vec4(primCenters[rnode.renderPrimID], 1.f);
+    const glm::vec4 centerWS = worldMatrices[nodeID] * glm::vec4(primCenters[renderPrimID], 1.f);
     // Right-handed view: -Z is forward, so more-negative VS-Z = further. Negate so larger depth
     // = further and the back-to-front order is "descending by depth".
     depths[i] = -glm::dot(viewRow2, centerWS);
@@ -42,7 +42,6 @@
 #include <nvutils/camera_manipulator.hpp>
 #include <nvvk/descriptors.hpp>
 #include <nvvk/render_target.hpp>
-#include <nvvk/hdr_ibl.hpp>
 #include <nvvk/resource_allocator.hpp>
 #include <nvvk/sampler_pool.hpp>
 #include <nvvk/staging.hpp>
@@ -51,6 +50,8 @@
 #include "ui_animation.hpp"
 #include "gltf_scene_transform_vk.hpp"
 #include "gpu_memory_tracker.hpp"
+#include "hdr_environment_vk.hpp"
+#include "host_memory_tracker.hpp"
 #include "scene_feature_detection.hpp"
 #include <nvapp/application.hpp>
 #include <nvapp/imgui_texture.hpp>
@@ -72,6 +73,16 @@ enum class DisplayBuffer
   eOptixDenoised,  // OptiX Denoised output (handled via OptiXDenoiser::getDescriptorImageInfo)
 };
 
+// Storage precision of the rendered (linear HDR) image. Half precision halves the bandwidth of
+// the path tracer's accumulation read-modify-write and of every pass that samples the rendered
+// image; the path tracer then switches to windowed accumulation with stochastic rounding
+// (see shaders/accumulation.h). Chosen at startup: the G-Buffer format is fixed at init.
+enum class ColorPrecision
+{
+  eFull,  // RGBA32F
+  eHalf,  // RGBA16F
+};
+
 enum DirtyFlags
 {
   eDirtyTangents,  // When tangents need to be pushed to GPU
@@ -119,6 +130,7 @@ struct Settings
   bool dlssSrHardwareAvailable = false;  // DLSS Super Resolution / DLAA hardware/extensions available (set at startup)
   bool opacityMicromapSupported = false;  // VK_EXT_opacity_micromap available (set at startup); gates EXT_mesh_opacity_micromap
   DisplayBuffer displayBuffer = DisplayBuffer::eRendered;  // Which buffer to display in viewport
+  ColorPrecision colorPrecision = ColorPrecision::eFull;  // Rendered image storage format (set at startup)
 
   // Enable scene-based shader optimization. When true, only features used by the scene are
   // enabled, reducing shader size and register usage at the cost of a one-time recompile per scene change.
@@ -195,7 +207,7 @@ struct Resources
   const nvvkgltf::Scene* getScene() const { return scene.get(); }
 
   // Resources
-  nvvk::HdrIbl          hdrIbl;  // HDR environment map
+  HdrEnvironmentVk      hdrIbl;  // HDR environment map and its importance sampling
   nvshaders::HdrEnvDome hdrDome;
   // Main frame target (tonemapped + rendered + selection + depth). Accessor cheat sheet:
   //   raster attachment  -> getColorAttachmentView() / getDepthImageView()
@@ -252,7 +264,8 @@ struct Resources
     }
   }
 
-  nvvkgltf::GpuMemoryTracker appMemoryTracker;  // Application-level GPU memory tracking (frame targets, denoisers, etc.)
+  nvvkgltf::GpuMemoryTracker  appMemoryTracker;   // Application-level GPU memory tracking (frame targets, denoisers, etc.)
+  nvvkgltf::HostMemoryTracker hostMemoryTracker;  // CPU memory of the scene, animation, materials and undo history
 
   Settings settings;
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Descriptor instances referenced into a Scene, with the model files loaded concurrently.
+// See scene_descriptor_loader.hpp.
+//
+
+#include "scene_descriptor_loader.hpp"
+
+#include <unordered_map>
+
+#include <nvutils/file_operations.hpp>
+#include <nvutils/logger.hpp>
+#include <nvutils/timers.hpp>
+
+#include "gltf_scene.hpp"
+#include "task_scheduler.hpp"
+
+uint32_t referenceDescriptorInstances(nvvkgltf::Scene& scene, const SceneDescriptor& descriptor, bool parallelLoad)
+{
+  namespace fs = std::filesystem;
+  nvutils::ScopedTimer st(std::string(__FUNCTION__) + "\n");
+
+  // Distinct files in order of first use; model entries resolving to the same file share a slot
+  std::vector<int>                     slotOfModel(descriptor.models.size(), -1);
+  std::vector<fs::path>                files;
+  std::unordered_map<std::string, int> slotOfFile;
+  for(const SceneDescriptorInstance& inst : descriptor.instances)
+  {
+    if(inst.modelIndex < 0 || inst.modelIndex >= static_cast<int>(descriptor.models.size()) || slotOfModel[inst.modelIndex] >= 0)
+      continue;
+    const fs::path&   path = descriptor.models[inst.modelIndex].resolvedPath;
+    std::error_code   ec;
+    const std::string key = fs::weakly_canonical(fs::absolute(path, ec), ec).generic_string();
+    const auto [it, inserted] = slotOfFile.emplace(key, static_cast<int>(files.size()));
+    if(inserted)
+      files.push_back(path);
+    slotOfModel[inst.modelIndex] = it->second;
+  }
+
+  // Parse, validate and flatten every file; nothing modifies the scene meanwhile
+  std::vector<nvvkgltf::Scene::PreparedReference> prepared(files.size());
+  const nvvkgltf::Scene&                          loader = scene;
+  if(parallelLoad)
+  {
+    nvvkgltf::parallelFor<1>(files.size(), [&](uint64_t i) { prepared[i] = loader.prepareReference(files[i]); });
+  }
+  else
+  {
+    for(size_t i = 0; i < files.size(); i++)
+      prepared[i] = loader.prepareReference(files[i]);
+  }
+
+  // Place the instances in descriptor order. referenceScene() merges the prepared model for the
+  // first instance of a file and duplicates that instance (shared geometry) for the next ones.
+  enum class SlotState : uint8_t
+  {
+    eUnused,
+    ePlaced,
+    eFailed,
+  };
+  std::vector<SlotState> state(files.size(), SlotState::eUnused);
+  uint32_t               placed = 0;
+  for(const SceneDescriptorInstance& inst : descriptor.instances)
+  {
+    if(inst.modelIndex < 0 || inst.modelIndex >= static_cast<int>(descriptor.models.size()))
+    {
+      LOGW("Scene descriptor: instance '%s' has an invalid model index %d\n", inst.name.c_str(), inst.modelIndex);
+      continue;
+    }
+    const int slot = slotOfModel[inst.modelIndex];
+    if(state[slot] == SlotState::eFailed)
+      continue;  // The file won't load for the remaining instances either
+
+    const int node = state[slot] == SlotState::eUnused && !prepared[slot].valid ? -1 : scene.referenceScene(files[slot], &prepared[slot]);
+    if(node < 0)
+    {
+      LOGE("Failed to reference model: %s\n", nvutils::utf8FromPath(files[slot]).c_str());
+      state[slot] = SlotState::eFailed;
+      continue;
+    }
+    state[slot] = SlotState::ePlaced;
+
+    scene.editor().setNodeTRS(node, inst.translation, inst.rotation, inst.scale);
+    if(!inst.name.empty())
+      scene.getModel().nodes[node].name = inst.name;
+    placed++;
+  }
+
+  LOGI("%s%u instances of %zu files placed\n", st.indent().c_str(), placed, files.size());
+  return placed;
+}
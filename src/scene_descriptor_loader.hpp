@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "scene_descriptor.hpp"
+
+namespace nvvkgltf {
+class Scene;
+}
+
+//
+// Places the instances of a parsed .scene.json descriptor into a Scene as glTF 2.1 references.
+//
+// The distinct model files are loaded first (Scene::prepareReference), concurrently when
+// parallelLoad is set. The instances are then referenced one by one in descriptor order. The first
+// instance of a file merges its prepared model, and later ones share its geometry. The resulting
+// node order is therefore the same however the files were loaded.
+//
+// Returns the number of instances placed. Instances of a model that fails to load are skipped.
+//
+uint32_t referenceDescriptorInstances(nvvkgltf::Scene& scene, const SceneDescriptor& descriptor, bool parallelLoad = true);
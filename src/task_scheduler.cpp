@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "task_scheduler.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include <nvutils/logger.hpp>
+
+namespace nvvkgltf {
+
+namespace detail {
+struct Task
+{
+  std::function<void()>  fn;
+  std::string            name;
+  TaskPriority           priority = TaskPriority::eInteractive;
+  CancellationToken      token;
+  std::atomic<TaskState> state{TaskState::eWaiting};
+
+  // Guarded by the scheduler mutex
+  uint32_t                           pendingDependencies = 0;
+  bool                               dependencyCancelled = false;
+  std::vector<std::shared_ptr<Task>> dependents;
+};
+}  // namespace detail
+
+namespace {
+thread_local const TaskScheduler* t_workerOf = nullptr;  // Scheduler owning this worker thread
+thread_local TaskPriority         t_priority = TaskPriority::eInteractive;
+std::atomic<uint32_t>             s_sharedWorkerCount{0};
+}  // namespace
+
+TaskPriority currentTaskPriority()
+{
+  return t_priority;
+}
+
+TaskState TaskHandle::state() const
+{
+  return m_task ? m_task->state.load() : TaskState::eDone;
+}
+
+bool TaskHandle::isFinished() const
+{
+  const TaskState s = state();
+  return s == TaskState::eDone || s == TaskState::eCancelled;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Construction
+//
+TaskScheduler::TaskScheduler(uint32_t workerCount)
+{
+  if(workerCount == 0)
+    workerCount = std::max(1u, std::thread::hardware_concurrency());
+  m_workers.reserve(workerCount);
+  for(uint32_t i = 0; i < workerCount; i++)
+    m_workers.emplace_back([this]() { workerLoop(); });
+}
+
+TaskScheduler::~TaskScheduler()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_workAvailable.notify_all();
+  for(std::thread& worker : m_workers)
+    worker.join();
+}
+
+// At least two workers: a scene load holding one still leaves room for a shader compile
+TaskScheduler& TaskScheduler::shared()
+{
+  static TaskScheduler s_shared(std::max(2u, s_sharedWorkerCount.load() == 0 ? std::thread::hardware_concurrency() :
+                                                                               s_sharedWorkerCount.load()));
+  return s_shared;
+}
+
+void TaskScheduler::setSharedWorkerCount(uint32_t workerCount)
+{
+  s_sharedWorkerCount = workerCount;
+}
+
+bool TaskScheduler::isWorkerThread() const
+{
+  return t_workerOf == this;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Submission and completion. All state transitions happen under m_mutex, so a dependency is either
+// finished when the dependent is submitted, or the dependent is registered before it finishes.
+//
+TaskHandle TaskScheduler::submit(std::function<void()> fn, TaskDesc desc)
+{
+  auto task      = std::make_shared<detail::Task>();
+  task->fn       = std::move(fn);
+  task->name     = std::move(desc.name);
+  task->priority = desc.priority;
+  task->token    = desc.token;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.submitted++;
+  m_stats.pendingOrBusy++;
+  for(const TaskHandle& dependency : desc.dependencies)
+  {
+    if(!dependency.valid())
+      continue;
+    const TaskState state = dependency.m_task->state.load();
+    if(state == TaskState::eDone)
+      continue;
+    if(state == TaskState::eCancelled)
+    {
+      task->dependencyCancelled = true;
+      continue;
+    }
+    dependency.m_task->dependents.push_back(task);
+    task->pendingDependencies++;
+  }
+  if(task->pendingDependencies == 0)
+    makeReady(task);
+
+  TaskHandle handle;
+  handle.m_task = task;
+  return handle;
+}
+
+void TaskScheduler::makeReady(const TaskPtr& task)
+{
+  if(task->dependencyCancelled || task->token.isCancelled())
+  {
+    finish(task, TaskState::eCancelled);
+    return;
+  }
+  task->state = TaskState::eReady;
+  m_ready[size_t(task->priority)].push_back(task);
+  m_workAvailable.notify_one();
+  m_taskFinished.notify_all();  // Workers blocked in wait() can help with it
+}
+
+void TaskScheduler::finish(const TaskPtr& task, TaskState finalState)
+{
+  task->state = finalState;
+  if(finalState == TaskState::eCancelled)
+    m_stats.cancelled++;
+  else
+    m_stats.completed++;
+  m_stats.pendingOrBusy--;
+
+  std::vector<TaskPtr> dependents = std::move(task->dependents);
+  for(const TaskPtr& dependent : dependents)
+  {
+    if(finalState == TaskState::eCancelled)
+      dependent->dependencyCancelled = true;
+    if(--dependent->pendingDependencies == 0)
+      makeReady(dependent);
+  }
+  m_taskFinished.notify_all();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Pop the most urgent ready task (FIFO within a priority) and run it without holding the lock.
+//
+bool TaskScheduler::runOne(std::unique_lock<std::mutex>& lock)
+{
+  TaskPtr task;
+  for(std::deque<TaskPtr>& queue : m_ready)
+  {
+    if(!queue.empty())
+    {
+      task = std::move(queue.front());
+      queue.pop_front();
+      break;
+    }
+  }
+  if(!task)
+    return false;
+
+  if(task->token.isCancelled())
+  {
+    finish(task, TaskState::eCancelled);
+    return true;
+  }
+
+  task->state = TaskState::eRunning;
+  m_running++;
+  m_stats.peakRunning = std::max(m_stats.peakRunning, m_running);
+  lock.unlock();
+  {
+    // The captures are released here, outside the lock
+    std::function<void()> fn       = std::move(task->fn);
+    const TaskPriority    previous = t_priority;
+    t_priority                     = task->priority;
+    try
+    {
+      fn();
+    }
+    catch(const std::exception& e)
+    {
+      LOGE("Task '%s' failed: %s\n", task->name.c_str(), e.what());
+    }
+    catch(...)
+    {
+      LOGE("Task '%s' failed\n", task->name.c_str());
+    }
+    t_priority = previous;
+  }
+  lock.lock();
+  m_running--;
+  finish(task, TaskState::eDone);
+  return true;
+}
+
+void TaskScheduler::workerLoop()
+{
+  t_workerOf = this;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(true)
+  {
+    if(runOne(lock))
+      continue;
+    if(m_stop)
+      break;
+    m_workAvailable.wait(lock);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// Waiting. A worker runs other ready tasks while it waits: a task waiting on tasks queued behind it
+// would otherwise hold its worker, and with every worker waiting the pool would deadlock. Other
+// threads (the main thread) only block, they never pick up a long task by accident.
+//
+void TaskScheduler::wait(const TaskHandle& handle)
+{
+  if(!handle.valid())
+    return;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(!handle.isFinished())
+  {
+    if(isWorkerThread() && runOne(lock))
+      continue;
+    m_taskFinished.wait(lock);
+  }
+}
+
+void TaskScheduler::waitIdle()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(m_stats.pendingOrBusy > 0)
+  {
+    if(isWorkerThread() && runOne(lock))
+      continue;
+    m_taskFinished.wait(lock);
+  }
+}
+
+TaskSchedulerStats TaskScheduler::getStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Batches are claimed from an atomic counter by the caller and by up to (workers) helper tasks. A
+// helper that starts after the last batch was claimed returns without touching fn, so the caller
+// only waits for the batches that were claimed, never for queued helpers. fn must not throw.
+//
+void TaskScheduler::parallelBatches(uint64_t count, uint64_t grain, TaskPriority priority, uint32_t maxConcurrency,
+                                    const std::function<void(uint64_t, uint64_t)>& fn)
+{
+  if(count == 0)
+    return;
+  grain                 = std::max<uint64_t>(grain, 1);
+  const uint64_t numBatches = (count + grain - 1) / grain;
+  uint64_t       helpers    = std::min<uint64_t>(numBatches - 1, getWorkerCount());
+  if(maxConcurrency > 0)
+    helpers = std::min<uint64_t>(helpers, maxConcurrency - 1);
+  if(helpers == 0)
+  {
+    fn(0, count);
+    return;
+  }
+
+  struct Batches
+  {
+    std::atomic<uint64_t>                            next{0};
+    std::atomic<uint64_t>                            done{0};
+    uint64_t                                         count      = 0;
+    uint64_t                                         grain      = 0;
+    uint64_t                                         numBatches = 0;
+    const std::function<void(uint64_t, uint64_t)>*   fn         = nullptr;  // Only used while batches remain
+    std::mutex                                       mutex;
+    std::condition_variable                          finished;
+  };
+  auto batches        = std::make_shared<Batches>();
+  batches->count      = count;
+  batches->grain      = grain;
+  batches->numBatches = numBatches;
+  batches->fn         = &fn;
+
+  const auto run = [](Batches& b) {
+    for(uint64_t i = b.next++; i < b.numBatches; i = b.next++)
+    {
+      const uint64_t begin = i * b.grain;
+      (*b.fn)(begin, std::min(begin + b.grain, b.count));
+      if(++b.done == b.numBatches)
+      {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        b.finished.notify_all();
+      }
+    }
+  };
+
+  for(uint64_t h = 0; h < helpers; h++)
+    submit([batches, run]() { run(*batches); }, {.name = "parallelFor", .priority = priority});
+  run(*batches);
+
+  std::unique_lock<std::mutex> lock(batches->mutex);
+  batches->finished.wait(lock, [&]() { return batches->done.load() == numBatches; });
+}
+
+}  // namespace nvvkgltf
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// One pool of worker threads for all background and data-parallel work: scene
+// loads and merges, shader compiles, image decodes, saves and the per-frame
+// parallel loops. A fixed worker count (--workerThreads) keeps many-core
+// machines from being oversubscribed by unrelated thread spawns, and
+// priorities let an interactive shader compile overtake a storm of image
+// decodes.
+//
+// - submit() queues a task with a priority, an optional cancellation token and
+//   dependency edges; a task becomes ready once all its dependencies are done.
+//   A cancelled task (or one whose dependency was cancelled) is skipped.
+// - wait() on a worker thread runs other ready tasks meanwhile, so tasks can
+//   wait on tasks without exhausting the pool.
+// - parallelFor() splits a range into batches; the calling thread takes part,
+//   helpers that start after the range is exhausted return immediately.
+// - Without an explicit priority, work submitted from a task inherits the
+//   task's priority (the image decodes of a load run at the load's priority);
+//   from any other thread it is eInteractive.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nvvkgltf {
+
+enum class TaskPriority : uint8_t
+{
+  eInteractive,  // The user is waiting on it: shader compiles, per-frame loops on the main thread
+  eHigh,         // Scene loads and merges, and the decodes they fan out
+  eNormal,       // Environment loads
+  eBackground,   // Saves
+  eCount
+};
+
+enum class TaskState : uint8_t
+{
+  eWaiting,    // Dependencies not finished
+  eReady,      // Queued
+  eRunning,
+  eDone,
+  eCancelled,  // Skipped: its token or a dependency was cancelled
+};
+
+// Shared flag: copies refer to the same state. Tasks skip when cancelled before they start; running
+// tasks poll isCancelled() themselves.
+class CancellationToken
+{
+public:
+  CancellationToken()
+      : m_flag(std::make_shared<std::atomic<bool>>(false))
+  {
+  }
+  void               cancel() const { m_flag->store(true); }
+  [[nodiscard]] bool isCancelled() const { return m_flag->load(); }
+
+private:
+  std::shared_ptr<std::atomic<bool>> m_flag;
+};
+
+// Priority of the task running on this thread; eInteractive outside tasks
+TaskPriority currentTaskPriority();
+
+namespace detail {
+struct Task;
+}
+
+class TaskHandle
+{
+public:
+  [[nodiscard]] bool      valid() const { return m_task != nullptr; }
+  [[nodiscard]] TaskState state() const;
+  [[nodiscard]] bool      isFinished() const;  // Done or cancelled
+
+private:
+  friend class TaskScheduler;
+  std::shared_ptr<detail::Task> m_task;
+};
+
+struct TaskDesc
+{
+  std::string             name;  // For the error log
+  TaskPriority            priority = currentTaskPriority();
+  CancellationToken       token;
+  std::vector<TaskHandle> dependencies;
+};
+
+struct TaskSchedulerStats
+{
+  uint64_t submitted     = 0;
+  uint64_t completed     = 0;
+  uint64_t cancelled     = 0;
+  uint32_t peakRunning   = 0;  // Never above the worker count
+  uint32_t pendingOrBusy = 0;  // Waiting, ready or running now
+};
+
+class TaskScheduler
+{
+public:
+  explicit TaskScheduler(uint32_t workerCount = 0);  // 0: hardware concurrency
+  ~TaskScheduler();                                  // Runs the queued tasks, then joins the workers
+  TaskScheduler(const TaskScheduler&)            = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  // Process-wide scheduler; setSharedWorkerCount() must come before the first shared()
+  static TaskScheduler& shared();
+  static void           setSharedWorkerCount(uint32_t workerCount);
+
+  [[nodiscard]] uint32_t getWorkerCount() const { return uint32_t(m_workers.size()); }
+  [[nodiscard]] bool     isWorkerThread() const;
+
+  TaskHandle submit(std::function<void()> fn, TaskDesc desc = {});
+
+  void wait(const TaskHandle& handle);
+  void waitIdle();  // Until every submitted task has finished
+
+  TaskSchedulerStats getStats() const;
+
+  // fn(index) for index in [0, count), in batches of Grain. maxConcurrency (0: no limit) counts the
+  // calling thread.
+  template <uint64_t Grain = 128, typename F>
+  void parallelFor(uint64_t count, F&& fn, TaskPriority priority = currentTaskPriority(), uint32_t maxConcurrency = 0)
+  {
+    static_assert(Grain > 0);
+    parallelBatches(count, Grain, priority, maxConcurrency, [&fn](uint64_t begin, uint64_t end) {
+      for(uint64_t i = begin; i < end; i++)
+        fn(i);
+    });
+  }
+
+  // Batch-level form of parallelFor: fn(begin, end)
+  void parallelBatches(uint64_t count, uint64_t grain, TaskPriority priority, uint32_t maxConcurrency,
+                       const std::function<void(uint64_t, uint64_t)>& fn);
+
+private:
+  using TaskPtr = std::shared_ptr<detail::Task>;
+
+  void workerLoop();
+  bool runOne(std::unique_lock<std::mutex>& lock);          // Pops and runs the most urgent ready task
+  void finish(const TaskPtr& task, TaskState finalState);  // Requires m_mutex
+  void makeReady(const TaskPtr& task);                     // Requires m_mutex
+
+  std::vector<std::thread>                                       m_workers;
+  std::array<std::deque<TaskPtr>, size_t(TaskPriority::eCount)> m_ready;
+  mutable std::mutex                                             m_mutex;
+  std::condition_variable                                        m_workAvailable;
+  std::condition_variable                                        m_taskFinished;
+  bool                                                           m_stop    = false;
+  uint32_t                                                       m_running = 0;
+  TaskSchedulerStats                                             m_stats;
+};
+
+// parallelFor on the shared scheduler, the drop-in for nvutils::parallel_batches
+template <uint64_t Grain = 128, typename F>
+void parallelFor(uint64_t count, F&& fn, TaskPriority priority = currentTaskPriority())
+{
+  TaskScheduler::shared().parallelFor<Grain>(count, std::forward<F>(fn), priority);
+}
+
+}  // namespace nvvkgltf
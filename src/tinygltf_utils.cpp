@@ -33,7 +33,7 @@
 
 #include <glm/gtx/norm.hpp>
 #include "nvutils/logger.hpp"
-#include "nvutils/parallel_work.hpp"
+#include "task_scheduler.hpp"
 
 #include "nvshaders/functions.h.slang"
 
@@ -973,7 +973,7 @@ void tinygltf::utils::simpleCreateTangents(tinygltf::Model& model, tinygltf::Pri
 
 
   // Ortho-normalize each tangent and apply the handedness.
-  nvutils::parallel_batches(numVertices, [&](uint64_t i) {
+  nvvkgltf::parallelFor(numVertices, [&](uint64_t i) {
     const uint32_t vertex = static_cast<uint32_t>(i);
     glm::vec4&     t0     = tangents[vertex];
     glm::vec3      n0;
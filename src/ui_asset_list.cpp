@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+//
+// Name index and filtered row mapping for the Scene Browser's flat asset lists.
+// See ui_asset_list.hpp.
+//
+
+#include "ui_asset_list.hpp"
+
+#include <algorithm>
+
+namespace {
+
+char toLowerAscii(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string toLowerAscii(std::string_view s)
+{
+  std::string out(s);
+  for(char& c : out)
+    c = toLowerAscii(c);
+  return out;
+}
+
+bool equalsLowered(std::string_view lowered, std::string_view s)
+{
+  return lowered.size() == s.size()
+         && std::equal(lowered.begin(), lowered.end(), s.begin(), [](char a, char b) { return a == toLowerAscii(b); });
+}
+
+uint32_t trigramKey(const char* p)
+{
+  return uint32_t(uint8_t(p[0])) | (uint32_t(uint8_t(p[1])) << 8) | (uint32_t(uint8_t(p[2])) << 16);
+}
+
+// Distinct trigrams of a (lower-cased) string.
+std::vector<uint32_t> trigramsOf(std::string_view s)
+{
+  std::vector<uint32_t> keys;
+  if(s.size() < 3)
+    return keys;
+  keys.reserve(s.size() - 2);
+  for(size_t i = 0; i + 3 <= s.size(); ++i)
+    keys.push_back(trigramKey(s.data() + i));
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  return keys;
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+// NameIndex
+//--------------------------------------------------------------------------------------------------
+
+void NameIndex::clear()
+{
+  m_names.clear();
+  m_postings.clear();
+  ++m_revision;
+}
+
+void NameIndex::addTrigrams(int id)
+{
+  for(uint32_t key : trigramsOf(m_names[id]))
+  {
+    std::vector<int>& ids = m_postings[key];
+    if(ids.empty() || ids.back() < id)
+      ids.push_back(id);  // Common case: appending items in order
+    else
+      ids.insert(std::lower_bound(ids.begin(), ids.end(), id), id);
+  }
+}
+
+void NameIndex::removeTrigrams(int id)
+{
+  for(uint32_t key : trigramsOf(m_names[id]))
+  {
+    auto it = m_postings.find(key);
+    if(it == m_postings.end())
+      continue;
+    std::vector<int>& ids = it->second;
+    auto              pos = std::lower_bound(ids.begin(), ids.end(), id);
+    if(pos != ids.end() && *pos == id)
+      ids.erase(pos);
+    if(ids.empty())
+      m_postings.erase(it);
+  }
+}
+
+void NameIndex::rebuild()
+{
+  m_postings.clear();
+  for(int id = 0; id < static_cast<int>(m_names.size()); ++id)
+    addTrigrams(id);
+  ++m_revision;
+}
+
+void NameIndex::assign(int id, std::string_view name)
+{
+  if(id < 0 || static_cast<size_t>(id) > m_names.size())
+    return;
+
+  if(static_cast<size_t>(id) == m_names.size())
+  {
+    m_names.push_back(toLowerAscii(name));
+  }
+  else
+  {
+    if(equalsLowered(m_names[id], name))
+      return;
+    removeTrigrams(id);
+    m_names[id] = toLowerAscii(name);
+  }
+  addTrigrams(id);
+  ++m_revision;
+}
+
+size_t NameIndex::sync(size_t count, const std::function<std::string_view(int)>& nameOf)
+{
+  // Removed items: drop from the back so the remaining ids stay valid
+  size_t changed = 0;
+  while(m_names.size() > count)
+  {
+    removeTrigrams(static_cast<int>(m_names.size()) - 1);
+    m_names.pop_back();
+    ++changed;
+  }
+
+  std::vector<int> renamed;
+  for(int id = 0; id < static_cast<int>(m_names.size()); ++id)
+  {
+    if(!equalsLowered(m_names[id], nameOf(id)))
+      renamed.push_back(id);
+  }
+
+  // Past a quarter of the entries, one rebuild is cheaper than editing every posting list.
+  if(renamed.size() > m_names.size() / 4)
+  {
+    for(int id : renamed)
+      m_names[id] = toLowerAscii(nameOf(id));
+    changed += renamed.size() + (count - m_names.size());
+    while(m_names.size() < count)
+      m_names.push_back(toLowerAscii(nameOf(static_cast<int>(m_names.size()))));
+    rebuild();
+    return changed;
+  }
+
+  for(int id : renamed)
+    assign(id, nameOf(id));
+  changed += renamed.size();
+  for(size_t id = m_names.size(); id < count; ++id, ++changed)
+    assign(static_cast<int>(id), nameOf(static_cast<int>(id)));
+  if(changed > 0)
+    ++m_revision;
+  return changed;
+}
+
+void NameIndex::find(std::string_view query, std::vector<int>& out) const
+{
+  out.clear();
+  const std::string needle = toLowerAscii(query);
+
+  if(needle.size() < 3)
+  {
+    for(int id = 0; id < static_cast<int>(m_names.size()); ++id)
+      if(m_names[id].find(needle) != std::string::npos)
+        out.push_back(id);
+    return;
+  }
+
+  // Every trigram of the query must be present; candidates come from the rarest one and are then
+  // checked for the full substring (trigrams alone do not guarantee contiguity).
+  const std::vector<int>* shortest = nullptr;
+  for(uint32_t key : trigramsOf(needle))
+  {
+    auto it = m_postings.find(key);
+    if(it == m_postings.end())
+      return;
+    if(!shortest || it->second.size() < shortest->size())
+      shortest = &it->second;
+  }
+
+  for(int id : *shortest)
+    if(m_names[id].find(needle) != std::string::npos)
+      out.push_back(id);
+}
+
+//--------------------------------------------------------------------------------------------------
+// AssetListView
+//--------------------------------------------------------------------------------------------------
+
+bool AssetListView::update(const NameIndex& index, std::string_view query)
+{
+  if(query == m_query && index.revision() == m_indexRevision)
+    return false;
+
+  m_query         = query;
+  m_indexRevision = index.revision();
+  m_itemCount     = index.size();
+  m_filtered      = !m_query.empty();
+  if(m_filtered)
+    index.find(m_query, m_rows);
+  else
+    m_rows.clear();
+  return true;
+}
+
+int AssetListView::rowOf(int item) const
+{
+  if(item < 0 || static_cast<size_t>(item) >= m_itemCount)
+    return -1;
+  if(!m_filtered)
+    return item;
+  auto it = std::lower_bound(m_rows.begin(), m_rows.end(), item);
+  return (it != m_rows.end() && *it == item) ? static_cast<int>(it - m_rows.begin()) : -1;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+/*
+ * NameIndex / AssetListView - Model side of the Scene Browser's flat asset lists
+ *
+ * The Scene List groups (nodes, meshes, materials, ...) draw only the rows visible in their scroll
+ * region (ImGuiListClipper). These two classes hold everything that does not need ImGui, so they
+ * can be tested on their own:
+ * - NameIndex: trigram index over the item names, kept in sync incrementally (rename, add, delete).
+ * - AssetListView: rows shown for the current filter query (row -> item, item -> row), recomputed
+ *   only when the query or the index changes.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class NameIndex
+{
+public:
+  void clear();
+
+  [[nodiscard]] size_t   size() const { return m_names.size(); }
+  [[nodiscard]] uint64_t revision() const { return m_revision; }  // Bumped on every change
+
+  // Set the name of item `id`; id == size() appends a new item. Only the trigrams of the old and
+  // new name are touched.
+  void assign(int id, std::string_view name);
+
+  // Bring the index in line with `count` items named by nameOf(id): items added or removed at the
+  // end and renamed entries are re-indexed, unchanged ones only cost a string compare. When most
+  // entries changed (e.g. a deletion near the front shifted every later index) the index is rebuilt.
+  // Returns the number of entries that changed.
+  size_t sync(size_t count, const std::function<std::string_view(int)>& nameOf);
+
+  // Ids whose name contains `query` (ASCII case-insensitive), ascending. Queries of three or more
+  // characters only visit the shortest trigram posting list; shorter ones scan every name.
+  void find(std::string_view query, std::vector<int>& out) const;
+
+private:
+  void rebuild();
+  void addTrigrams(int id);
+  void removeTrigrams(int id);
+
+  std::vector<std::string>                       m_names;     // Lower-cased
+  std::unordered_map<uint32_t, std::vector<int>> m_postings;  // Trigram -> ascending ids
+  uint64_t                                       m_revision = 0;
+};
+
+class AssetListView
+{
+public:
+  // Recompute the rows if the query or the index changed since the last call. Returns true if it did.
+  bool update(const NameIndex& index, std::string_view query);
+
+  [[nodiscard]] bool   isFiltered() const { return m_filtered; }
+  [[nodiscard]] size_t rowCount() const { return m_filtered ? m_rows.size() : m_itemCount; }
+  [[nodiscard]] int    itemAt(size_t row) const { return m_filtered ? m_rows[row] : static_cast<int>(row); }
+  // Row showing `item`, or -1 if it is filtered out (used to scroll to a selection).
+  [[nodiscard]] int rowOf(int item) const;
+
+private:
+  std::string      m_query;
+  uint64_t         m_indexRevision = ~0ull;
+  size_t           m_itemCount     = 0;
+  bool             m_filtered      = false;
+  std::vector<int> m_rows;  // Matching items when filtered
+};
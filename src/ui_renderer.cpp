@@ -139,8 +139,8 @@ void GltfRenderer::mouseClickedInViewport()
       const auto&      renderNodes   = scene->getRenderNodes();
       if(renderNodeIdx >= 0 && renderNodeIdx < static_cast<int>(renderNodes.size()))
       {
-        const nvvkgltf::RenderNode& renderNode = renderNodes[renderNodeIdx];
-        const tinygltf::Node&       node       = scene->getModel().nodes[renderNode.refNodeID];
+        const auto&           renderNode = renderNodes[renderNodeIdx];
+        const tinygltf::Node& node       = scene->getModel().nodes[renderNode.refNodeID];
         LOGI("Node Name: %s\n", node.name.c_str());
         LOGI(" - GLTF: NodeID: %d, MeshID: %d, TriangleId: %d\n", renderNode.refNodeID, node.mesh, pickResult.primitiveID);
         LOGI(" - Render: renderNode: %d, RenderPrim: %d\n", renderNodeIdx, pickResult.instanceCustomIndex);
@@ -235,7 +235,7 @@ nvutils::Bbox GltfRenderer::getRenderNodeBbox(int renderNodeIndex)
   if(renderNodeIndex >= static_cast<int>(renderNodes.size()))
     return worldBbox;
 
-  const nvvkgltf::RenderNode&      renderNode      = renderNodes[renderNodeIndex];
+  const auto&                      renderNode      = renderNodes[renderNodeIndex];
   const nvvkgltf::RenderPrimitive& renderPrimitive = scene->getRenderPrimitive(renderNode.renderPrimID);
   const tinygltf::Model&           model           = scene->getModel();
   const tinygltf::Accessor&        accessor = model.accessors[renderPrimitive.pPrimitive->attributes.at("POSITION")];
@@ -256,18 +256,11 @@ nvutils::Bbox GltfRenderer::getRenderNodeBbox(int renderNodeIndex)
 
   // Extension: Instance local matrices for KHR_mesh_gpu_instancing
   const auto& gpuInstMap = scene->getGpuInstanceLocalMatrices();
-  auto        instIt     = gpuInstMap.find(renderNode.refNodeID);
-  if(instIt != gpuInstMap.end() && !instIt->second.empty())
+  if(const nvvkgltf::InstanceBatch* batch = scene->getRenderNodeRegistry().findInstanceBatch(renderNodeIndex))
   {
-    const auto& rnList = scene->getRenderNodeRegistry().getRenderNodesForNode(renderNode.refNodeID);
-    for(size_t k = 0; k < rnList.size(); ++k)
-    {
-      if(rnList[k] == renderNodeIndex)
-      {
-        nodeWorld = nodeWorld * instIt->second[k % instIt->second.size()];
-        break;
-      }
-    }
+    auto instIt = gpuInstMap.find(batch->nodeID);
+    if(instIt != gpuInstMap.end() && size_t(renderNodeIndex - batch->firstRenderNode) < instIt->second.size())
+      nodeWorld = nodeWorld * instIt->second[renderNodeIndex - batch->firstRenderNode];
   }
   worldBbox = objBbox.transform(nodeWorld);
 
@@ -567,6 +560,8 @@ void GltfRenderer::renderUI()
     m_busy.show();
   }
 
+  renderSaveProgress();
+
   // Display memory statistics window
   renderMemoryStatistics();
 
@@ -856,6 +851,7 @@ void GltfRenderer::renderToolsMenu(bool validScene, bool& reloadShader, bool& co
   if(ImGui::MenuItem(ICON_MS_BUILD " Recreate Tangents - Simple"))
   {
     SCOPED_BANNER("Recreate Tangents - Simple");
+    m_resources.getScene()->waitForSaves();
     recomputeTangents(m_resources.getScene()->getModel(), true, false);
     m_resources.dirtyFlags.set(DirtyFlags::eDirtyTangents);
   }
@@ -865,6 +861,7 @@ void GltfRenderer::renderToolsMenu(bool validScene, bool& reloadShader, bool& co
     bool buffersChanged = false;
     {
       SCOPED_BANNER("Recreate Tangents - MikkTSpace");
+      m_resources.getScene()->waitForSaves();
       buffersChanged = recomputeTangents(m_resources.getScene()->getModel(), true, true);
     }
     if(buffersChanged)
@@ -892,6 +889,7 @@ void GltfRenderer::renderDebugMenu()
     ImGui::Separator();
     ImGui::MenuItem("GPU Compute Animation", nullptr, &m_resources.sceneGpu.useComputeAnimation);
     ImGui::MenuItem("GPU Compute Transformation", nullptr, &m_resources.sceneGpu.useComputeTransformation);
+    ImGui::MenuItem("GPU Node Animation", nullptr, &m_resources.sceneGpu.useGpuNodeAnimation);
     ImGui::EndMenu();
   }
 #endif
@@ -1461,7 +1459,50 @@ void GltfRenderer::setGltfCameraFromView(int cameraIndex)
 }
 
 //--------------------------------------------------------------------------------------------------
-// Display GPU memory statistics in an ImGui window
+// Background save started by GltfRenderer::save(): hand the result back to the scene, and show the
+// progress with a Cancel button while it runs
+//
+void GltfRenderer::renderSaveProgress()
+{
+  if(std::optional<nvvkgltf::AsyncSceneSave::Result> result = m_asyncSave.takeResult())
+  {
+    const std::string name = nvutils::utf8FromPath(result->filename);
+    if(result->status == nvvkgltf::SceneSaveStatus::eSaved)
+    {
+      if(m_asyncSaveScene && m_asyncSaveScene == m_resources.getScene())
+        m_asyncSaveScene->onSaved(result->filename);
+      LOGI("Scene saved: %s\n", name.c_str());
+    }
+    else if(result->status == nvvkgltf::SceneSaveStatus::eCancelled)
+      LOGI("Save cancelled: %s\n", name.c_str());
+    else
+      LOGE("Failed to save: %s\n", name.c_str());
+    m_asyncSaveScene = nullptr;
+  }
+
+  if(!m_asyncSave.isRunning())
+    return;
+
+  // Small non-modal window: rendering and editing continue while the snapshot is written
+  const ImGuiViewport* viewport = ImGui::GetMainViewport();
+  ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - 10.0f, viewport->WorkPos.y + 10.0f),
+                          ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+  ImGui::SetNextWindowBgAlpha(0.8f);
+  if(ImGui::Begin("##SaveProgress", nullptr,
+                  ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings
+                      | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav))
+  {
+    ImGui::TextUnformatted(ICON_MS_SAVE " Saving...");
+    ImGui::ProgressBar(m_asyncSave.progress(), ImVec2(200.0f, 0.0f));
+    ImGui::SameLine();
+    if(ImGui::SmallButton("Cancel"))
+      m_asyncSave.cancel();
+  }
+  ImGui::End();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Display GPU and host memory statistics in an ImGui window
 //
 void GltfRenderer::renderMemoryStatistics()
 {
@@ -1712,6 +1753,51 @@ void GltfRenderer::renderMemoryStatistics()
     ImGui::EndTable();
   }
 
+  // --- Host (CPU) memory: measured every frame while this window is open ---
+  updateHostMemory();
+  const HostMemoryTracker& hostTracker = m_resources.hostMemoryTracker;
+  ImGui::SeparatorText("Host Memory");
+  if(ImGui::BeginTable("HostMemoryTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+  {
+    ImGui::TableSetupColumn("Category", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+    ImGui::TableSetupColumn("Current", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+    ImGui::TableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+    ImGui::TableHeadersRow();
+
+    for(const auto& categoryName : hostTracker.getCategories())
+    {
+      HostMemoryStats stats = hostTracker.getStats(categoryName);
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::Text("  %s", categoryName.c_str());
+      ImGui::TableNextColumn();
+      ImGui::Text("%s", formatBytes(stats.currentBytes).c_str());
+      ImGui::TableNextColumn();
+      ImGui::Text("%s", formatBytes(stats.peakBytes).c_str());
+    }
+
+    HostMemoryStats totalHost = hostTracker.getTotalStats();
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "TOTAL");
+    ImGui::TableNextColumn();
+    ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "%s", formatBytes(totalHost.currentBytes).c_str());
+    ImGui::TableNextColumn();
+    ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "%s", formatBytes(totalHost.peakBytes).c_str());
+
+    ImGui::EndTable();
+  }
+
+  // --- Allocation journal (--allocJournal): marks delimit the growth reported on exit ---
+  if(m_allocJournal)
+  {
+    ImGui::SeparatorText("Allocation Journal");
+    ImGui::Text("%zu events, frame %llu", m_allocJournal->getEventCount(), static_cast<unsigned long long>(m_allocJournalFrame));
+    if(ImGui::Button("Add Mark"))
+      m_allocJournal->mark(fmt::format("mark {}", m_allocJournalFrame));
+    nvgui::tooltip("Labelled event in the journal, usable with --journalFrom / --journalTo in --journalSummary");
+  }
+
   ImGui::End();
 }
 
@@ -1758,6 +1844,13 @@ void GltfRenderer::renderEnvironmentWindow()
         loadHdrFileDialog();
         changed = true;
       }
+      if(m_hdrLoad.isRunning() || m_hdrUpload)
+      {
+        PE::entry("", [&] {
+          ImGui::TextDisabled("Loading...");
+          return false;
+        });
+      }
       changed |= PE::SliderFloat("Intensity", &m_resources.settings.hdrEnvIntensity, 0, 100, "%.3f",
                                  ImGuiSliderFlags_Logarithmic, "HDR intensity");
       changed |= PE::SliderAngle("Rotation", &m_resources.settings.hdrEnvRotation, -360, 360, "%.0f deg", 0, "Rotating the environment");
@@ -106,6 +106,8 @@ void UiSceneBrowser::markCachesDirty()
   m_meshToNodeMapDirty   = true;
   m_lightToNodeMapDirty  = true;
   m_cameraToNodeMapDirty = true;
+  for(AssetList& list : m_assetLists)
+    list.namesDirty = true;
   markSceneTransformsDirty();
 }
 
@@ -131,6 +133,13 @@ void UiSceneBrowser::setScene(nvvkgltf::Scene* scene)
   m_lightToNodeMapDirty  = true;
   m_cameraToNodeMapDirty = true;
 
+  // New model: start the name indices from scratch (the first sync is a plain bulk build)
+  for(AssetList& list : m_assetLists)
+  {
+    list.index.clear();
+    list.namesDirty = true;
+  }
+
   m_pendingScrollToImageIndex = -1;
   m_forceImagesSectionOpen    = false;
 
@@ -553,6 +562,10 @@ void UiSceneBrowser::renderSceneGraphTab()
 
 void UiSceneBrowser::renderSceneListTab()
 {
+  // Name filter shared by all groups; each group re-filters only when the query or its names change.
+  ImGui::SetNextItemWidth(-FLT_MIN);
+  ImGui::InputTextWithHint("##SceneListFilter", "Filter by name", m_listFilter, sizeof(m_listFilter));
+
   renderNodesGroup();
   renderMeshesGroup();
   renderMaterialsGroup();
@@ -1063,30 +1076,63 @@ void UiSceneBrowser::renderCameraInHierarchy(int cameraIdx)
 // SCENE LIST GROUPS
 //==================================================================================================
 
+//--------------------------------------------------------------------------------------------------
+// Sync the group's name index when items were added/removed (count changed) or the caches were
+// marked dirty, then refresh the filtered rows. Both steps are no-ops on an unchanged frame.
+const AssetListView& UiSceneBrowser::updateAssetList(AssetGroup group, size_t count, const std::function<std::string_view(int)>& nameOf)
+{
+  AssetList& list = m_assetLists[group];
+  if(list.namesDirty || list.index.size() != count)
+  {
+    list.index.sync(count, nameOf);
+    list.namesDirty = false;
+  }
+  list.view.update(list.index, m_listFilter);
+  return list.view;
+}
+
+std::string UiSceneBrowser::assetGroupHeader(const char* icon, const char* title, AssetGroup group, size_t count) const
+{
+  const AssetListView& view  = m_assetLists[group].view;
+  std::string          shown = view.isFiltered() ? std::to_string(view.rowCount()) + "/" : std::string();
+  return std::string(icon) + " " + title + " (" + shown + std::to_string(count) + ")###" + title;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Draw only the rows inside the scroll region. Every row must be one line of the same height
+// (a Selectable, a bullet or one table row) so the clipper can skip the rest without measuring them.
+void UiSceneBrowser::renderAssetListRows(const AssetListView& view, const std::function<void(int)>& renderRow, int scrollToItem)
+{
+  ImGuiListClipper clipper;
+  clipper.Begin(static_cast<int>(view.rowCount()));
+  const int scrollRow = view.rowOf(scrollToItem);
+  if(scrollRow >= 0)
+    clipper.IncludeItemByIndex(scrollRow);
+  while(clipper.Step())
+  {
+    for(int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+      renderRow(view.itemAt(row));
+  }
+}
+
 void UiSceneBrowser::renderNodesGroup()
 {
   if(!m_scene)
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view =
+      updateAssetList(eGroupNodes, model.nodes.size(), [&](int i) { return std::string_view(model.nodes[i].name); });
 
-  if(ImGui::CollapsingHeader((std::string(ICON_MS_CATEGORY) + " Nodes (" + std::to_string(model.nodes.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_CATEGORY, "Nodes", eGroupNodes, model.nodes.size()).c_str()))
   {
     // Add scrollable child region with max height
     ImGui::BeginChild("NodesScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.nodes.size()); ++i)
-    {
-      const tinygltf::Node& node = model.nodes[i];
-
-      bool isSelected = false;
-      if(m_selection)
-      {
-        auto sel   = m_selection->getSelection();
-        isSelected = (sel.type == SceneSelection::SelectionType::eNode && sel.nodeIndex == i);
-      }
-
-      std::string label = "[" + std::to_string(i) + "] " + node.name;
+    const SceneSelection::SelectionContext sel = m_selection ? m_selection->getSelection() : SceneSelection::SelectionContext{};
+    renderAssetListRows(view, [&](int i) {
+      const bool  isSelected = (sel.type == SceneSelection::SelectionType::eNode && sel.nodeIndex == i);
+      std::string label      = "[" + std::to_string(i) + "] " + model.nodes[i].name;
       if(ImGui::Selectable(label.c_str(), isSelected))
       {
         if(m_selection)
@@ -1097,7 +1143,7 @@ void UiSceneBrowser::renderNodesGroup()
 
       // Context menu must be right after Selectable
       showNodeContextMenu(i);
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1109,24 +1155,18 @@ void UiSceneBrowser::renderMeshesGroup()
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view =
+      updateAssetList(eGroupMeshes, model.meshes.size(), [&](int i) { return std::string_view(model.meshes[i].name); });
 
-  if(ImGui::CollapsingHeader((std::string(ICON_MS_VIEW_IN_AR) + " Meshes (" + std::to_string(model.meshes.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_VIEW_IN_AR, "Meshes", eGroupMeshes, model.meshes.size()).c_str()))
   {
     // Add scrollable child region with max height
     ImGui::BeginChild("MeshesScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.meshes.size()); ++i)
-    {
-      const tinygltf::Mesh& mesh = model.meshes[i];
-
-      bool isSelected = false;
-      if(m_selection)
-      {
-        auto sel   = m_selection->getSelection();
-        isSelected = (sel.type == SceneSelection::SelectionType::eMesh && sel.meshIndex == i);
-      }
-
-      std::string label = "[" + std::to_string(i) + "] " + mesh.name;
+    const SceneSelection::SelectionContext sel = m_selection ? m_selection->getSelection() : SceneSelection::SelectionContext{};
+    renderAssetListRows(view, [&](int i) {
+      const bool  isSelected = (sel.type == SceneSelection::SelectionType::eMesh && sel.meshIndex == i);
+      std::string label      = "[" + std::to_string(i) + "] " + model.meshes[i].name;
       if(ImGui::Selectable(label.c_str(), isSelected))
       {
         if(m_selection)
@@ -1137,7 +1177,7 @@ void UiSceneBrowser::renderMeshesGroup()
 
       // Context menu must be right after Selectable
       showMeshContextMenu(i);
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1149,25 +1189,18 @@ void UiSceneBrowser::renderMaterialsGroup()
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view  = updateAssetList(eGroupMaterials, model.materials.size(),
+                                                 [&](int i) { return std::string_view(model.materials[i].name); });
 
-  if(ImGui::CollapsingHeader(
-         (std::string(ICON_MS_BRUSH) + " Materials (" + std::to_string(model.materials.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_BRUSH, "Materials", eGroupMaterials, model.materials.size()).c_str()))
   {
     // Add scrollable child region with max height
     ImGui::BeginChild("MaterialsScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.materials.size()); ++i)
-    {
-      const tinygltf::Material& material = model.materials[i];
-
-      bool isSelected = false;
-      if(m_selection)
-      {
-        auto sel   = m_selection->getSelection();
-        isSelected = (sel.type == SceneSelection::SelectionType::eMaterial && sel.materialIndex == i);
-      }
-
-      std::string label = "[" + std::to_string(i) + "] " + material.name;
+    const SceneSelection::SelectionContext sel = m_selection ? m_selection->getSelection() : SceneSelection::SelectionContext{};
+    renderAssetListRows(view, [&](int i) {
+      const bool  isSelected = (sel.type == SceneSelection::SelectionType::eMaterial && sel.materialIndex == i);
+      std::string label      = "[" + std::to_string(i) + "] " + model.materials[i].name;
       if(ImGui::Selectable(label.c_str(), isSelected))
       {
         if(m_selection)
@@ -1178,7 +1211,7 @@ void UiSceneBrowser::renderMaterialsGroup()
 
       // Context menu must be right after Selectable
       showMaterialContextMenu(i);
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1190,25 +1223,18 @@ void UiSceneBrowser::renderCamerasGroup()
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view  = updateAssetList(eGroupCameras, model.cameras.size(),
+                                                 [&](int i) { return std::string_view(model.cameras[i].name); });
 
-  if(ImGui::CollapsingHeader(
-         (std::string(ICON_MS_CAMERA_ALT) + " Cameras (" + std::to_string(model.cameras.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_CAMERA_ALT, "Cameras", eGroupCameras, model.cameras.size()).c_str()))
   {
     // Add scrollable child region with max height
     ImGui::BeginChild("CamerasScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.cameras.size()); ++i)
-    {
-      const tinygltf::Camera& camera = model.cameras[i];
-
-      bool isSelected = false;
-      if(m_selection)
-      {
-        auto sel   = m_selection->getSelection();
-        isSelected = (sel.type == SceneSelection::SelectionType::eCamera && sel.cameraIndex == i);
-      }
-
-      std::string label = "[" + std::to_string(i) + "] " + camera.name;
+    const SceneSelection::SelectionContext sel = m_selection ? m_selection->getSelection() : SceneSelection::SelectionContext{};
+    renderAssetListRows(view, [&](int i) {
+      const bool  isSelected = (sel.type == SceneSelection::SelectionType::eCamera && sel.cameraIndex == i);
+      std::string label      = "[" + std::to_string(i) + "] " + model.cameras[i].name;
       if(ImGui::Selectable(label.c_str(), isSelected))
       {
         if(m_selection)
@@ -1216,7 +1242,7 @@ void UiSceneBrowser::renderCamerasGroup()
           m_selection->selectCamera(i);
         }
       }
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1228,9 +1254,10 @@ void UiSceneBrowser::renderLightsGroup()
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view =
+      updateAssetList(eGroupLights, model.lights.size(), [&](int i) { return std::string_view(model.lights[i].name); });
 
-  bool lightsOpen = ImGui::CollapsingHeader(
-      (std::string(ICON_MS_LIGHTBULB) + " Lights (" + std::to_string(model.lights.size()) + ")").c_str());
+  bool lightsOpen = ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_LIGHTBULB, "Lights", eGroupLights, model.lights.size()).c_str());
 
   // "+" button on the same line as the header for quick light creation
   if(m_undoStack && m_scene)
@@ -1253,18 +1280,10 @@ void UiSceneBrowser::renderLightsGroup()
   {
     ImGui::BeginChild("LightsScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.lights.size()); ++i)
-    {
-      const tinygltf::Light& light = model.lights[i];
-
-      bool isSelected = false;
-      if(m_selection)
-      {
-        auto sel   = m_selection->getSelection();
-        isSelected = (sel.type == SceneSelection::SelectionType::eLight && sel.lightIndex == i);
-      }
-
-      std::string label = "[" + std::to_string(i) + "] " + light.name;
+    const SceneSelection::SelectionContext sel = m_selection ? m_selection->getSelection() : SceneSelection::SelectionContext{};
+    renderAssetListRows(view, [&](int i) {
+      const bool  isSelected = (sel.type == SceneSelection::SelectionType::eLight && sel.lightIndex == i);
+      std::string label      = "[" + std::to_string(i) + "] " + model.lights[i].name;
       if(ImGui::Selectable(label.c_str(), isSelected))
       {
         if(m_selection)
@@ -1272,7 +1291,7 @@ void UiSceneBrowser::renderLightsGroup()
           m_selection->selectLight(i);
         }
       }
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1284,8 +1303,11 @@ void UiSceneBrowser::renderTexturesGroup()
     return;
 
   const tinygltf::Model& model = m_scene->getModel();
+  const AssetListView&   view  = updateAssetList(eGroupTextures, model.textures.size(), [&](int i) {
+    return std::string_view(i < static_cast<int>(m_textureNames.size()) ? m_textureNames[i] : model.textures[i].name);
+  });
 
-  if(ImGui::CollapsingHeader((std::string(ICON_MS_IMAGE) + " Textures (" + std::to_string(model.textures.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_IMAGE, "Textures", eGroupTextures, model.textures.size()).c_str()))
   {
     ImGui::TextDisabled("(Display only - not selectable)");
 
@@ -1302,15 +1324,14 @@ void UiSceneBrowser::renderTexturesGroup()
       ImGui::TableSetupColumn("Image source", ImGuiTableColumnFlags_WidthStretch);
       ImGui::TableHeadersRow();
 
-      for(int i = 0; i < static_cast<int>(model.textures.size()); ++i)
-      {
+      renderAssetListRows(view, [&](int i) {
         const tinygltf::Texture& texture = model.textures[i];
 
         ImGui::TableNextRow();
         ImGui::TableNextColumn();
         ImGui::Text("%d", i);
         ImGui::TableNextColumn();
-        ImGui::TextUnformatted(m_textureNames[i].c_str());
+        ImGui::TextUnformatted(i < static_cast<int>(m_textureNames.size()) ? m_textureNames[i].c_str() : texture.name.c_str());
         ImGui::TableNextColumn();
 
         const int imageIdx = tinygltf::utils::getTextureImageIndex(texture);
@@ -1332,7 +1353,7 @@ void UiSceneBrowser::renderTexturesGroup()
         {
           ImGui::TextDisabled("-");
         }
-      }
+      });
 
       ImGui::EndTable();
     }
@@ -1348,6 +1369,21 @@ void UiSceneBrowser::renderImagesGroup()
 
   const tinygltf::Model& model = m_scene->getModel();
 
+  // Same display name as the rows below; the index stores it for filtering.
+  auto imageDisplayName = [&](int i) -> std::string {
+    const tinygltf::Image& image = model.images[i];
+    if(!image.uri.empty())
+      return image.uri;
+    if(!image.name.empty())
+      return image.name;
+    return "Embedded image " + std::to_string(i);
+  };
+  std::string          nameScratch;
+  const AssetListView& view = updateAssetList(eGroupImages, model.images.size(), [&](int i) {
+    nameScratch = imageDisplayName(i);
+    return std::string_view(nameScratch);
+  });
+
   if(m_pendingScrollToImageIndex >= static_cast<int>(model.images.size()))
     m_pendingScrollToImageIndex = -1;
 
@@ -1355,9 +1391,10 @@ void UiSceneBrowser::renderImagesGroup()
   {
     ImGui::SetNextItemOpen(true);
     m_forceImagesSectionOpen = false;
+    m_listFilter[0]          = '\0';  // The jump target must not be filtered out
   }
 
-  if(ImGui::CollapsingHeader((std::string(ICON_MS_PHOTO) + " Images (" + std::to_string(model.images.size()) + ")").c_str()))
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_PHOTO, "Images", eGroupImages, model.images.size()).c_str()))
   {
     ImGui::TextDisabled("(Display only - not selectable)");
 
@@ -1374,37 +1411,32 @@ void UiSceneBrowser::renderImagesGroup()
       ImGui::TableSetupColumn("Resolution", ImGuiTableColumnFlags_WidthFixed, 100.0f);
       ImGui::TableHeadersRow();
 
-      for(int i = 0; i < static_cast<int>(model.images.size()); i++)
-      {
-        const tinygltf::Image& image = model.images[i];
-        std::string            displayName;
-        if(!image.uri.empty())
-          displayName = image.uri;
-        else if(!image.name.empty())
-          displayName = image.name;
-        else
-          displayName = "Embedded image " + std::to_string(i);
-
-        ImGui::TableNextRow();
-        if(m_pendingScrollToImageIndex == i)
-        {
-          ImGui::SetScrollHereY(0.5f);
-          m_pendingScrollToImageIndex = -1;
-        }
-        ImGui::TableNextColumn();
-        ImGui::Text("%d", i);
-        if(ImGui::IsItemHovered())
-        {
-          ImGui::SetTooltip("URI: %s", image.uri.empty() ? "(embedded)" : image.uri.c_str());
-        }
-        ImGui::TableNextColumn();
-        ImGui::TextUnformatted(displayName.c_str());
-        ImGui::TableNextColumn();
-        if(image.width > 0 && image.height > 0)
-          ImGui::Text("%dx%d", image.width, image.height);
-        else
-          ImGui::TextDisabled("-");
-      }
+      renderAssetListRows(
+          view,
+          [&](int i) {
+            const tinygltf::Image& image = model.images[i];
+
+            ImGui::TableNextRow();
+            if(m_pendingScrollToImageIndex == i)
+            {
+              ImGui::SetScrollHereY(0.5f);
+              m_pendingScrollToImageIndex = -1;
+            }
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", i);
+            if(ImGui::IsItemHovered())
+            {
+              ImGui::SetTooltip("URI: %s", image.uri.empty() ? "(embedded)" : image.uri.c_str());
+            }
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(imageDisplayName(i).c_str());
+            ImGui::TableNextColumn();
+            if(image.width > 0 && image.height > 0)
+              ImGui::Text("%dx%d", image.width, image.height);
+            else
+              ImGui::TextDisabled("-");
+          },
+          m_pendingScrollToImageIndex);
 
       ImGui::EndTable();
     }
@@ -1420,20 +1452,27 @@ void UiSceneBrowser::renderAnimationsGroup()
 
   const tinygltf::Model& model = m_scene->getModel();
 
-  if(ImGui::CollapsingHeader(
-         (std::string(ICON_MS_MOVIE) + " Animations (" + std::to_string(model.animations.size()) + ")").c_str()))
+  auto animationLabel = [&](int i) {
+    const tinygltf::Animation& anim = model.animations[i];
+    return anim.name.empty() ? "Animation " + std::to_string(i) : anim.name;
+  };
+  std::string          nameScratch;
+  const AssetListView& view = updateAssetList(eGroupAnimations, model.animations.size(), [&](int i) {
+    nameScratch = animationLabel(i);
+    return std::string_view(nameScratch);
+  });
+
+  if(ImGui::CollapsingHeader(assetGroupHeader(ICON_MS_MOVIE, "Animations", eGroupAnimations, model.animations.size()).c_str()))
   {
     ImGui::TextDisabled("(Display only - not selectable)");
 
     // Add scrollable child region with max height
     ImGui::BeginChild("AnimationsScrollRegion", ImVec2(0, 200), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for(int i = 0; i < static_cast<int>(model.animations.size()); ++i)
-    {
-      const tinygltf::Animation& anim = model.animations[i];
-      std::string label = "[" + std::to_string(i) + "] " + (anim.name.empty() ? "Animation " + std::to_string(i) : anim.name);
+    renderAssetListRows(view, [&](int i) {
+      std::string label = "[" + std::to_string(i) + "] " + animationLabel(i);
       ImGui::BulletText("%s", label.c_str());
-    }
+    });
 
     ImGui::EndChild();
   }
@@ -1498,6 +1537,8 @@ void UiSceneBrowser::showNodeContextMenu(int nodeIdx)
       {
         m_renameState.targetName   = &m_scene->editor().getNodeForEdit(nodeIdx).name;
         m_renameState.nodeIndex    = nodeIdx;
+        m_renameState.group        = eGroupNodes;
+        m_renameState.itemIndex    = nodeIdx;
         m_openRenamePopupNextFrame = true;
       }
 
@@ -1515,6 +1556,8 @@ void UiSceneBrowser::showMeshContextMenu(int meshIdx)
     if(ImGui::MenuItem(ICON_MS_EDIT " Rename"))
     {
       m_renameState.targetName   = &m_scene->getModel().meshes[meshIdx].name;
+      m_renameState.group        = eGroupMeshes;
+      m_renameState.itemIndex    = meshIdx;
       m_openRenamePopupNextFrame = true;
     }
 
@@ -1545,6 +1588,8 @@ void UiSceneBrowser::showMaterialContextMenu(int matIdx)
     if(ImGui::MenuItem(ICON_MS_EDIT " Rename"))
     {
       m_renameState.targetName   = &m_scene->editor().getMaterialForEdit(matIdx).name;
+      m_renameState.group        = eGroupMaterials;
+      m_renameState.itemIndex    = matIdx;
       m_openRenamePopupNextFrame = true;
     }
 
@@ -1711,6 +1756,9 @@ void UiSceneBrowser::renderRenameDialog()
         {
           *m_renameState.targetName = newName;
         }
+        // Update just this entry of the Scene List name index (undo re-syncs via markCachesDirty)
+        if(m_renameState.group != eGroupCount)
+          m_assetLists[m_renameState.group].index.assign(m_renameState.itemIndex, newName);
         LOGI("Renamed: '%s' -> '%s'\n", oldName.c_str(), m_renameState.buffer);
         m_renameState = {};
         ImGui::CloseCurrentPopup();
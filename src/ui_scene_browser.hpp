@@ -28,6 +28,7 @@
  * - Scene List: Flat grouped view (nodes, meshes, materials, cameras, lights, textures, images, animations)
  */
 
+#include <array>
 #include <functional>
 #include <string>
 #include <vector>
@@ -40,6 +41,7 @@
 
 #include "scene_selection.hpp"
 #include "gltf_scene_editor.hpp"  // nvvkgltf::PrimitiveKind, PrimitiveParams
+#include "ui_asset_list.hpp"
 
 class UndoStack;
 
@@ -143,6 +145,25 @@ private:
   void renderImagesGroup();      // Display-only (non-selectable)
   void renderAnimationsGroup();  // Display-only (non-selectable)
 
+  // Flat lists are virtualized: only the rows in view are built. Each group keeps a name index and
+  // the rows matching the filter (see ui_asset_list.hpp).
+  enum AssetGroup
+  {
+    eGroupNodes,
+    eGroupMeshes,
+    eGroupMaterials,
+    eGroupCameras,
+    eGroupLights,
+    eGroupTextures,
+    eGroupImages,
+    eGroupAnimations,
+    eGroupCount
+  };
+  const AssetListView& updateAssetList(AssetGroup group, size_t count, const std::function<std::string_view(int)>& nameOf);
+  std::string assetGroupHeader(const char* icon, const char* title, AssetGroup group, size_t count) const;
+  // Emits renderRow(item) for the visible rows only; scrollToItem is kept in the clipped range.
+  void renderAssetListRows(const AssetListView& view, const std::function<void(int)>& renderRow, int scrollToItem = -1);
+
   //==================================================================================================
   // CONTEXT MENUS
   //==================================================================================================
@@ -194,6 +215,16 @@ private:
   std::unordered_set<int> m_expandedNodes;     // Only force-open these nodes (from selection)
   bool                    m_doScroll = false;  // Auto-scroll to selection
 
+  // Scene List: per-group name index + filtered rows, and the shared name filter
+  struct AssetList
+  {
+    NameIndex     index;
+    AssetListView view;
+    bool          namesDirty = true;  // Re-sync the index (add/delete/undo); renames go through index.assign
+  };
+  std::array<AssetList, eGroupCount> m_assetLists;
+  char                               m_listFilter[128] = {};
+
   // Scene List: jump from texture row to Images group (scroll to image index)
   int  m_pendingScrollToImageIndex = -1;
   bool m_forceImagesSectionOpen    = false;
@@ -226,6 +257,8 @@ private:
   {
     std::string* targetName  = nullptr;
     int          nodeIndex   = -1;  // >= 0 when renaming a node (for undo support)
+    AssetGroup   group       = eGroupCount;  // Scene List name index to update
+    int          itemIndex   = -1;
     char         buffer[256] = {};
   };
   RenameState m_renameState;
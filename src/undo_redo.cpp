@@ -25,11 +25,33 @@
 
 #include "undo_redo.hpp"
 #include "gltf_scene_editor.hpp"
+#include "host_memory_tracker.hpp"
 #include "scene_selection.hpp"
 
 #include <fmt/format.h>
 #include <nvutils/logger.hpp>
 
+namespace {
+
+// tinygltf objects at their struct size, plus the index arrays (names and extensions not walked)
+uint64_t snapshotBytes(const nvvkgltf::SceneGraphSnapshot* snapshot)
+{
+  if(!snapshot)
+    return 0;
+  uint64_t bytes = sizeof(*snapshot) + nvvkgltf::containerBytes(snapshot->nodes) + nvvkgltf::containerBytes(snapshot->sceneRoots)
+                   + nvvkgltf::containerBytes(snapshot->animations) + nvvkgltf::containerBytes(snapshot->skins)
+                   + nvvkgltf::containerBytes(snapshot->lights);
+  for(const tinygltf::Node& node : snapshot->nodes)
+    bytes += nvvkgltf::containerBytes(node.children);
+  for(const tinygltf::Animation& animation : snapshot->animations)
+    bytes += nvvkgltf::containerBytes(animation.channels) + nvvkgltf::containerBytes(animation.samplers);
+  for(const tinygltf::Skin& skin : snapshot->skins)
+    bytes += nvvkgltf::containerBytes(skin.joints);
+  return bytes;
+}
+
+}  // namespace
+
 //--------------------------------------------------------------------------------------------------
 // UndoStack
 //--------------------------------------------------------------------------------------------------
@@ -112,6 +134,16 @@ std::string UndoStack::redoDescription() const
   return m_redoStack.empty() ? "" : m_redoStack.back()->description();
 }
 
+uint64_t UndoStack::sizeInBytes() const
+{
+  uint64_t bytes = nvvkgltf::containerBytes(m_undoStack) + nvvkgltf::containerBytes(m_redoStack);
+  for(const auto& cmd : m_undoStack)
+    bytes += cmd->sizeInBytes();
+  for(const auto& cmd : m_redoStack)
+    bytes += cmd->sizeInBytes();
+  return bytes;
+}
+
 void UndoStack::trimToMaxSize()
 {
   while(m_undoStack.size() > m_maxSize)
@@ -269,6 +301,11 @@ std::string DeleteNodeCommand::description() const
   return fmt::format("Delete '{}'", m_nodeName);
 }
 
+uint64_t DeleteNodeCommand::sizeInBytes() const
+{
+  return snapshotBytes(m_snapshot.get());
+}
+
 //--------------------------------------------------------------------------------------------------
 // AddNodeCommand
 //--------------------------------------------------------------------------------------------------
@@ -372,6 +409,11 @@ std::string EditMaterialCommand::description() const
   return fmt::format("Edit Material '{}'", m_materialName);
 }
 
+uint64_t EditMaterialCommand::sizeInBytes() const
+{
+  return (m_oldMaterial ? sizeof(tinygltf::Material) : 0) + (m_newMaterial ? sizeof(tinygltf::Material) : 0);
+}
+
 bool EditMaterialCommand::canMergeWith(const ICommand& other) const
 {
   auto* o = dynamic_cast<const EditMaterialCommand*>(&other);
@@ -423,6 +465,11 @@ std::string AddLightCommand::description() const
   return fmt::format("Add {} Light '{}'", m_lightType, m_name);
 }
 
+uint64_t AddLightCommand::sizeInBytes() const
+{
+  return snapshotBytes(m_snapshot.get());
+}
+
 //--------------------------------------------------------------------------------------------------
 // AddPrimitiveCommand
 //--------------------------------------------------------------------------------------------------
@@ -493,6 +540,11 @@ std::string AddPrimitiveCommand::description() const
   return fmt::format("Add {}", nvvkgltf::primitiveKindName(m_kind));
 }
 
+uint64_t AddPrimitiveCommand::sizeInBytes() const
+{
+  return snapshotBytes(m_snapshot.get());
+}
+
 //--------------------------------------------------------------------------------------------------
 // EditLightCommand
 //--------------------------------------------------------------------------------------------------
@@ -529,6 +581,11 @@ std::string EditLightCommand::description() const
   return fmt::format("Edit Light '{}'", m_lightName);
 }
 
+uint64_t EditLightCommand::sizeInBytes() const
+{
+  return (m_oldLight ? sizeof(tinygltf::Light) : 0) + (m_newLight ? sizeof(tinygltf::Light) : 0);
+}
+
 bool EditLightCommand::canMergeWith(const ICommand& other) const
 {
   auto* o = dynamic_cast<const EditLightCommand*>(&other);
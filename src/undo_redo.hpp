@@ -33,6 +33,7 @@
  */
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -71,6 +72,9 @@ public:
   // can be merged into one undo step. Override in continuous-edit commands only.
   [[nodiscard]] virtual bool canMergeWith(const ICommand& /*other*/) const { return false; }
   virtual void               mergeWith(const ICommand& /*other*/) {}
+
+  // Heap memory the command keeps for undo (snapshots, material / light copies)
+  [[nodiscard]] virtual uint64_t sizeInBytes() const { return 0; }
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -95,6 +99,9 @@ public:
   [[nodiscard]] std::string undoDescription() const;
   [[nodiscard]] std::string redoDescription() const;
 
+  // Host memory of the undo and redo history ("UndoStack" in the memory statistics)
+  [[nodiscard]] uint64_t sizeInBytes() const;
+
 private:
   std::vector<std::unique_ptr<ICommand>> m_undoStack;
   std::vector<std::unique_ptr<ICommand>> m_redoStack;
@@ -196,6 +203,7 @@ public:
   void                      execute() override;
   void                      undo() override;
   [[nodiscard]] std::string description() const override;
+  [[nodiscard]] uint64_t    sizeInBytes() const override;
 
 private:
   nvvkgltf::Scene&                              m_scene;
@@ -265,6 +273,7 @@ public:
   void                      execute() override;
   void                      undo() override;
   [[nodiscard]] std::string description() const override;
+  [[nodiscard]] uint64_t    sizeInBytes() const override;
   [[nodiscard]] bool        canMergeWith(const ICommand& other) const override;
   void                      mergeWith(const ICommand& other) override;
 
@@ -294,6 +303,7 @@ public:
   void                      execute() override;
   void                      undo() override;
   [[nodiscard]] std::string description() const override;
+  [[nodiscard]] uint64_t    sizeInBytes() const override;
   [[nodiscard]] int         getNewNodeIndex() const { return m_newNodeIndex; }
 
 private:
@@ -327,6 +337,7 @@ public:
   void                      execute() override;
   void                      undo() override;
   [[nodiscard]] std::string description() const override;
+  [[nodiscard]] uint64_t    sizeInBytes() const override;
 
 private:
   nvvkgltf::Scene&                              m_scene;
@@ -355,6 +366,7 @@ public:
   void                      execute() override;
   void                      undo() override;
   [[nodiscard]] std::string description() const override;
+  [[nodiscard]] uint64_t    sizeInBytes() const override;
   [[nodiscard]] bool        canMergeWith(const ICommand& other) const override;
   void                      mergeWith(const ICommand& other) override;
 
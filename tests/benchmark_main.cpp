@@ -1,7 +1,25 @@
+#include <array>
 #include <benchmark/benchmark.h>
 #include <gltf_scene.hpp>
+#include <gltf_scene_validator.hpp>
+#include <host_memory_tracker.hpp>
+#include <task_scheduler.hpp>
 #include "common/test_utils.hpp"
 
+// Host memory held by a loaded scene, measured outside the timed loop
+static void setHostMemoryCounters(benchmark::State& state, const std::filesystem::path& path)
+{
+  nvvkgltf::Scene scene;
+  if(!scene.load(path))
+    return;
+  nvvkgltf::HostMemoryTracker tracker;
+  scene.reportHostMemory(tracker);
+  state.counters["host_bytes"] = double(tracker.getTotalStats().currentBytes);
+  state.counters["host_model_bytes"] =
+      double(tracker.getStats("Model/Buffers").currentBytes + tracker.getStats("Model/Images").currentBytes
+             + tracker.getStats("Model/Objects").currentBytes);
+}
+
 // Benchmark scene loading
 static void BM_SceneLoad_Simple(benchmark::State& state)
 {
@@ -15,6 +33,7 @@ static void BM_SceneLoad_Simple(benchmark::State& state)
         state.SkipWithError("load failed");
       benchmark::DoNotOptimize(scene.getRenderNodes().size());
     }
+    setHostMemoryCounters(state, path);
   }
   catch(const std::runtime_error& e)
   {
@@ -36,6 +55,7 @@ static void BM_SceneLoad_Complex(benchmark::State& state)
         state.SkipWithError("load failed");
       benchmark::DoNotOptimize(scene.getRenderNodes().size());
     }
+    setHostMemoryCounters(state, path);
   }
   catch(const std::runtime_error& e)
   {
@@ -139,4 +159,264 @@ static void BM_UpdateNodeWorldMatrices(benchmark::State& state)
 }
 BENCHMARK(BM_UpdateNodeWorldMatrices);
 
+// Generated model for validation benchmarks: numNodes nodes where node i is a child of
+// (i - 1) / fanout (fanout 1 gives a single deep chain), each node instancing one mesh.
+static void makeLargeHierarchy(tinygltf::Model& model, int numNodes, int fanout)
+{
+  model = {};
+  model.materials.resize(1);
+  model.meshes.resize(1);
+  model.meshes[0].primitives.resize(1);
+  model.meshes[0].primitives[0].material = 0;
+  model.nodes.resize(numNodes);
+  for(int i = 0; i < numNodes; ++i)
+  {
+    model.nodes[i].mesh = 0;
+    if(i > 0)
+      model.nodes[(i - 1) / fanout].children.push_back(i);
+  }
+  model.scenes.resize(1);
+  model.scenes[0].nodes.push_back(0);
+  model.defaultScene = 0;
+}
+
+// Benchmark full-model validation on generated large hierarchies (nodes, fanout)
+static void BM_ValidateModel_LargeHierarchy(benchmark::State& state)
+{
+  nvvkgltf::Scene scene;
+  makeLargeHierarchy(scene.getModel(), static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+
+  for(auto _ : state)
+  {
+    auto result = scene.validator().validateBeforeSave();
+    if(!result.valid)
+      state.SkipWithError("generated model failed validation");
+    benchmark::DoNotOptimize(result.errors.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValidateModel_LargeHierarchy)
+    ->Args({100000, 1})
+    ->Args({1000000, 1})
+    ->Args({1000000, 8})
+    ->Unit(benchmark::kMillisecond);
+
+// Generated million-instance render-node set: 64 materials, 256 primitives, every 7th node hidden.
+static constexpr int kRenderNodePassWorld  = 0;  // Write every world matrix (animation / transform update)
+static constexpr int kRenderNodePassVis    = 1;  // Count visible nodes (TLAS / raster culling)
+static constexpr int kRenderNodePassBucket = 2;  // Bucket by material (shaded-nodes cache rebuild)
+
+static nvvkgltf::RenderNode makeBenchRenderNode(int i)
+{
+  nvvkgltf::RenderNode rn;
+  rn.worldMatrix[3] = glm::vec4(float(i % 1000), float(i / 1000), 0.f, 1.f);
+  rn.materialID     = i % 64;
+  rn.renderPrimID   = i % 256;
+  rn.refNodeID      = i;
+  rn.visible        = (i % 7) != 0;
+  return rn;
+}
+
+// Same pass over the render-node data, laid out as array of structs (std::vector<RenderNode>, the
+// former registry storage) or as RenderNodeArrays columns.
+template <typename Nodes>
+static void runRenderNodePass(benchmark::State& state, Nodes& nodes, const std::vector<glm::mat4>& nodeWorld)
+{
+  const int               pass = static_cast<int>(state.range(0));
+  const size_t            n    = nodes.size();
+  std::array<uint8_t, 64> bucketKey{};
+  for(size_t m = 0; m < bucketKey.size(); ++m)
+    bucketKey[m] = uint8_t(m % 3);
+
+  for(auto _ : state)
+  {
+    if(pass == kRenderNodePassWorld)
+    {
+      if constexpr(std::is_same_v<Nodes, nvvkgltf::RenderNodeArrays>)
+      {
+        std::span<glm::mat4> world = nodes.worldMatrices();
+        for(size_t i = 0; i < n; ++i)
+          world[i] = nodeWorld[i & 4095];
+      }
+      else
+      {
+        for(size_t i = 0; i < n; ++i)
+          nodes[i].worldMatrix = nodeWorld[i & 4095];
+      }
+      benchmark::ClobberMemory();
+    }
+    else if(pass == kRenderNodePassVis)
+    {
+      size_t visible = 0;
+      if constexpr(std::is_same_v<Nodes, nvvkgltf::RenderNodeArrays>)
+      {
+        for(uint8_t v : nodes.visibility())
+          visible += v;
+      }
+      else
+      {
+        for(const nvvkgltf::RenderNode& rn : nodes)
+          visible += rn.visible ? 1 : 0;
+      }
+      benchmark::DoNotOptimize(visible);
+    }
+    else
+    {
+      std::array<size_t, 3> buckets{};
+      if constexpr(std::is_same_v<Nodes, nvvkgltf::RenderNodeArrays>)
+      {
+        for(int matID : nodes.materialIDs())
+          ++buckets[bucketKey[matID]];
+      }
+      else
+      {
+        for(const nvvkgltf::RenderNode& rn : nodes)
+          ++buckets[bucketKey[rn.materialID]];
+      }
+      benchmark::DoNotOptimize(buckets);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * int64_t(n));
+}
+
+static std::vector<glm::mat4> makeBenchNodeWorld()
+{
+  std::vector<glm::mat4> nodeWorld(4096, glm::mat4(1.f));
+  for(size_t i = 0; i < nodeWorld.size(); ++i)
+    nodeWorld[i][3] = glm::vec4(float(i), 0.f, 0.f, 1.f);
+  return nodeWorld;
+}
+
+static void BM_RenderNodes_ArrayOfStructs(benchmark::State& state)
+{
+  std::vector<nvvkgltf::RenderNode> nodes;
+  nodes.reserve(state.range(1));
+  for(int i = 0; i < state.range(1); ++i)
+    nodes.push_back(makeBenchRenderNode(i));
+  runRenderNodePass(state, nodes, makeBenchNodeWorld());
+}
+BENCHMARK(BM_RenderNodes_ArrayOfStructs)
+    ->ArgsProduct({{kRenderNodePassWorld, kRenderNodePassVis, kRenderNodePassBucket}, {1000000}})
+    ->ArgNames({"pass", "nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_RenderNodes_StructOfArrays(benchmark::State& state)
+{
+  nvvkgltf::RenderNodeArrays nodes;
+  nodes.reserve(state.range(1));
+  for(int i = 0; i < state.range(1); ++i)
+    nodes.push_back(makeBenchRenderNode(i));
+  runRenderNodePass(state, nodes, makeBenchNodeWorld());
+}
+BENCHMARK(BM_RenderNodes_StructOfArrays)
+    ->ArgsProduct({{kRenderNodePassWorld, kRenderNodePassVis, kRenderNodePassBucket}, {1000000}})
+    ->ArgNames({"pass", "nodes"})
+    ->Unit(benchmark::kMillisecond);
+
+// Generated KHR_materials_variants scene from Box.glb: nodes spread over 16 copies of the mesh,
+// each mapping every variant to one of 8 materials.
+static bool makeVariantScene(nvvkgltf::Scene& scene, int numNodes, int numVariants)
+{
+  nvvkgltf::Scene source;
+  if(!source.load(gltf_test::TestResources::getResourcePath("Box.glb")) || source.getModel().meshes.empty())
+    return false;
+
+  tinygltf::Model model = source.getModel();
+  model.materials.resize(8, model.materials.empty() ? tinygltf::Material{} : model.materials[0]);
+
+  tinygltf::Value::Array variants;
+  for(int v = 0; v < numVariants; ++v)
+    variants.emplace_back(tinygltf::Value::Object{{"name", tinygltf::Value("v" + std::to_string(v))}});
+  model.extensions[KHR_MATERIALS_VARIANTS_EXTENSION_NAME] = tinygltf::Value(tinygltf::Value::Object{{"variants", tinygltf::Value(variants)}});
+
+  const tinygltf::Mesh mesh = model.meshes[0];
+  model.meshes.clear();
+  for(int m = 0; m < 16; ++m)
+  {
+    tinygltf::Value::Array mappings;
+    for(int v = 0; v < numVariants; ++v)
+    {
+      mappings.emplace_back(tinygltf::Value::Object{{"material", tinygltf::Value((m + v) % 8)},
+                                                    {"variants", tinygltf::Value(tinygltf::Value::Array{tinygltf::Value(v)})}});
+    }
+    model.meshes.push_back(mesh);
+    model.meshes.back().primitives[0].extensions[KHR_MATERIALS_VARIANTS_EXTENSION_NAME] =
+        tinygltf::Value(tinygltf::Value::Object{{"mappings", tinygltf::Value(mappings)}});
+  }
+
+  model.nodes.resize(numNodes);
+  model.scenes.resize(1);
+  model.scenes[0].nodes.clear();
+  for(int i = 0; i < numNodes; ++i)
+  {
+    model.nodes[i]             = {};
+    model.nodes[i].mesh        = i % 16;
+    model.nodes[i].translation = {double(i % 1000), double(i / 1000), 0.0};
+    model.scenes[0].nodes.push_back(i);
+  }
+  model.defaultScene = 0;
+
+  scene.takeModel(std::move(model));
+  return scene.valid();
+}
+
+// Benchmark variant switching (nodes, variants): one pass over the resolved variant table
+static void BM_SetCurrentVariant(benchmark::State& state)
+{
+  try
+  {
+    const int       numVariants = static_cast<int>(state.range(1));
+    nvvkgltf::Scene scene;
+    if(!makeVariantScene(scene, static_cast<int>(state.range(0)), numVariants))
+    {
+      state.SkipWithError("load failed");
+      return;
+    }
+
+    int variant = 0;
+    for(auto _ : state)
+    {
+      variant = (variant + 1) % numVariants;
+      scene.setCurrentVariant(variant);
+      benchmark::DoNotOptimize(scene.getDirtyFlags().allRenderNodesVk);
+      scene.clearDirtyFlags();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  catch(const std::runtime_error& e)
+  {
+    state.SkipWithError(e.what());
+  }
+}
+BENCHMARK(BM_SetCurrentVariant)->Args({10000, 16})->Args({100000, 64})->ArgNames({"nodes", "variants"})->Unit(benchmark::kMicrosecond);
+
+// Benchmark the cost of one task: submit and wait, on a scheduler of its own (workers)
+static void BM_TaskScheduler_SubmitWait(benchmark::State& state)
+{
+  nvvkgltf::TaskScheduler scheduler(static_cast<uint32_t>(state.range(0)));
+  int                     value = 0;
+  for(auto _ : state)
+  {
+    const nvvkgltf::TaskHandle task = scheduler.submit([&value]() { value++; });
+    scheduler.wait(task);
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TaskScheduler_SubmitWait)->Arg(1)->Arg(4)->ArgName("workers")->Unit(benchmark::kMicrosecond);
+
+// Benchmark parallelFor over a transform of (count) floats, the shape of the per-frame scene loops
+static void BM_TaskScheduler_ParallelFor(benchmark::State& state)
+{
+  nvvkgltf::TaskScheduler scheduler(4);
+  std::vector<float>      values(static_cast<size_t>(state.range(0)), 1.0f);
+  for(auto _ : state)
+  {
+    scheduler.parallelFor<1024>(values.size(), [&values](uint64_t i) { values[i] = values[i] * 0.5f + 1.0f; });
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TaskScheduler_ParallelFor)->Arg(10000)->Arg(1000000)->ArgName("count")->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// CPU model of the path tracer's progressive accumulation (shaders/accumulation.h).
+// Simulates one pixel accumulated into a half-precision store and compares it against the
+// same blend evaluated in double precision.
+
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+#include "shaders/accumulation.h"
+
+namespace {
+
+// Round-to-nearest float -> half -> float, i.e. what a plain RGBA16F store does.
+// A fixed dither of 0.5 turns the stochastic rounding into round-half-up.
+float roundToHalfNearest(float v)
+{
+  return shaderio::stochasticRoundToHalf(v, 0.5f);
+}
+
+struct AccumulationRun
+{
+  double reference = 0.0;  // Same blend in double precision, no quantization
+  float  stored    = 0.0f;  // Value as held by the render target
+};
+
+// Accumulate `numFrames` frames of one sample each. Radiance samples are exponentially
+// distributed (mean 0.5): noisy like a path-traced pixel, always positive.
+AccumulationRun accumulate(int numFrames, int window, bool halfStore, bool stochastic, uint32_t seed = 1)
+{
+  std::mt19937                          rng(seed);
+  std::exponential_distribution<float>  radiance(2.0f);
+  std::uniform_real_distribution<float> dither(0.0f, 1.0f);
+
+  AccumulationRun run;
+  for(int frame = 0; frame < numFrames; ++frame)
+  {
+    const float sample = radiance(rng);
+    const float weight = shaderio::accumulationBlendWeight(frame, 1, window);
+
+    run.reference = run.reference + (double(sample) - run.reference) * double(weight);
+
+    float value = run.stored + (sample - run.stored) * weight;
+    if(halfStore)
+      value = stochastic ? shaderio::stochasticRoundToHalf(value, dither(rng)) : roundToHalfNearest(value);
+    run.stored = value;
+  }
+  return run;
+}
+
+}  // namespace
+
+TEST(AccumulationPrecision, BlendWeightIsRunningMeanWithoutWindow)
+{
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(0, 1, 0), 1.0f);
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(3, 1, 0), 0.25f);
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(6, 2, 0), 0.25f);
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(100000, 1, 0), 1.0f / 100001.0f);
+}
+
+TEST(AccumulationPrecision, BlendWeightIsCappedByWindow)
+{
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(10, 1, 64), 1.0f / 11.0f);  // Below the cap: exact mean
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(64, 1, 64), 1.0f / 65.0f);
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(5000, 1, 64), 1.0f / 65.0f);
+  EXPECT_FLOAT_EQ(shaderio::accumulationBlendWeight(5000, 4, 64), 4.0f / 68.0f);
+}
+
+TEST(AccumulationPrecision, StochasticRoundingIsExactInHalf)
+{
+  std::mt19937                          rng(7);
+  std::uniform_real_distribution<float> value(-1000.0f, 1000.0f);
+  std::uniform_real_distribution<float> dither(0.0f, 1.0f);
+  for(int i = 0; i < 10000; ++i)
+  {
+    const float r = shaderio::stochasticRoundToHalf(value(rng), dither(rng));
+    // Exactly representable in half: at most 11 significant bits
+    EXPECT_EQ(shaderio::accumAsUint(r) & 0x1FFFu, 0u);
+  }
+  EXPECT_EQ(shaderio::stochasticRoundToHalf(1.0f, 0.999f), 1.0f);  // Already representable
+  EXPECT_LE(shaderio::stochasticRoundToHalf(1.0e9f, 0.999f), ACCUM_HALF_MAX);
+  EXPECT_GE(shaderio::stochasticRoundToHalf(-1.0e9f, 0.999f), -ACCUM_HALF_MAX);
+}
+
+TEST(AccumulationPrecision, StochasticRoundingIsUnbiased)
+{
+  // 1 + 0.3 ulp must round up 30% of the time, so the mean stays at 1 + 0.3 ulp.
+  const float ulp   = 1.0f / 1024.0f;
+  const float value = 1.0f + 0.3f * ulp;
+
+  std::mt19937                          rng(3);
+  std::uniform_real_distribution<float> dither(0.0f, 1.0f);
+  double                                sum = 0.0;
+  constexpr int                         kN  = 200000;
+  for(int i = 0; i < kN; ++i)
+    sum += shaderio::stochasticRoundToHalf(value, dither(rng));
+  EXPECT_NEAR(sum / kN, double(value), 0.01 * ulp);
+}
+
+TEST(AccumulationPrecision, FullPrecisionMatchesRunningMean)
+{
+  const AccumulationRun run = accumulate(20000, 0, false, false);
+  EXPECT_NEAR(run.stored, run.reference, 1e-4 * run.reference);
+}
+
+// The error model: with a capped window and stochastic rounding, the deviation of the half store
+// from the double-precision blend does not grow with the number of accumulated frames.
+TEST(AccumulationPrecision, HalfPrecisionErrorStaysBounded)
+{
+  constexpr int    kWindow = ACCUM_HALF_DEFAULT_WINDOW;
+  constexpr double kU      = 1.0 / 2048.0;  // Half-precision unit roundoff
+  // Expected standard deviation ~ kU * sqrt(window / 12) relative; allow 5 sigma plus one ulp
+  const double bound = 5.0 * kU * std::sqrt(kWindow / 12.0) + 2.0 * kU;
+
+  for(int frames : {1000, 10000, 100000})
+  {
+    double worst = 0.0;
+    for(uint32_t seed = 1; seed <= 8; ++seed)
+    {
+      const AccumulationRun run = accumulate(frames, kWindow, true, true, seed);
+      worst                     = std::max(worst, std::fabs(run.stored - run.reference) / run.reference);
+    }
+    EXPECT_LT(worst, bound) << frames << " frames";
+  }
+}
+
+// Without the window and stochastic rounding a half store stalls: late samples are lost and the
+// result drifts away from the true running mean.
+TEST(AccumulationPrecision, NaiveHalfPrecisionStalls)
+{
+  constexpr double kU = 1.0 / 2048.0;
+
+  double naiveWorst = 0.0;
+  for(uint32_t seed = 1; seed <= 8; ++seed)
+  {
+    const AccumulationRun naive = accumulate(100000, 0, true, false, seed);
+    naiveWorst                  = std::max(naiveWorst, std::fabs(naive.stored - naive.reference) / naive.reference);
+  }
+  EXPECT_GT(naiveWorst, 20.0 * kU);
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// GPU allocation journal on synthetic event streams: live allocations at the end, growth between
+// marks, churn per category, file round trip.
+
+#include <gtest/gtest.h>
+#include <fstream>
+
+#include "common/test_utils.hpp"
+#include "gpu_allocation_journal.hpp"
+
+using namespace gltf_test;
+
+namespace {
+
+constexpr uint64_t kMB = 1024 * 1024;
+
+// Two scene loads: the second one leaks a texture, a render target is resized in between
+void recordSession(nvvkgltf::AllocationJournal& journal)
+{
+  journal.setFrame(0);
+  journal.recordAllocate("App/GBuffers", 0x10, 8 * kMB, "GBuffers");
+  journal.mark("startup");
+
+  journal.setFrame(1);
+  journal.recordAllocate("Scene/Geometry", 0x20, 4 * kMB, "positions");
+  journal.recordAllocate("Scene/Images", 0x21, 16 * kMB, "albedo texture");
+  journal.mark("loaded a");
+
+  journal.setFrame(50);
+  journal.recordFree("App/GBuffers", 0x10);
+  journal.recordAllocate("App/GBuffers", 0x11, 12 * kMB, "GBuffers");
+  journal.recordFree("Scene/Geometry", 0x20);
+  journal.recordFree("Scene/Images", 0x21);
+  journal.mark("unloaded");
+
+  journal.setFrame(51);
+  journal.recordAllocate("Scene/Geometry", 0x20, 4 * kMB, "positions");  // Id reused after its free
+  journal.recordAllocate("Scene/Images", 0x22, 16 * kMB, "albedo texture");
+  journal.recordAllocate("Scene/Images", 0x23, 2 * kMB, "normal texture");
+  journal.mark("loaded b");
+
+  journal.setFrame(90);
+  journal.recordFree("Scene/Geometry", 0x20);
+  journal.recordFree("Scene/Images", 0x22);  // 0x23 is never freed
+  journal.mark("unloaded");
+  journal.recordFree("App/GBuffers", 0x11);
+  journal.mark("exit");
+}
+
+nvvkgltf::AllocationJournalData sessionData()
+{
+  nvvkgltf::AllocationJournal journal;
+  recordSession(journal);
+  return journal.getData();
+}
+
+const nvvkgltf::JournalCategoryChurn* findChurn(const nvvkgltf::JournalSummary& summary, const std::string& category)
+{
+  for(const auto& c : summary.churn)
+  {
+    if(c.category == category)
+      return &c;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(AllocationJournal, LiveAllocationsAtExit)
+{
+  const nvvkgltf::JournalSummary summary = nvvkgltf::summarizeJournal(sessionData());
+  EXPECT_EQ(summary.events, 19u);
+  EXPECT_EQ(summary.frames, 90u);
+  ASSERT_EQ(summary.liveAllocations.size(), 1u);
+  EXPECT_EQ(summary.liveAllocations[0].id, 0x23u);
+  EXPECT_EQ(summary.liveAllocations[0].category, "Scene/Images");
+  EXPECT_EQ(summary.liveAllocations[0].name, "normal texture");
+  EXPECT_EQ(summary.liveAllocations[0].frame, 51u);
+  EXPECT_EQ(summary.liveBytes, 2 * kMB);
+  EXPECT_EQ(summary.unmatchedFrees, 0u);
+  EXPECT_EQ(summary.replacedAllocations, 0u);
+}
+
+TEST(AllocationJournal, ChurnPerCategory)
+{
+  const nvvkgltf::JournalSummary summary = nvvkgltf::summarizeJournal(sessionData());
+  ASSERT_EQ(summary.churn.size(), 3u);
+  EXPECT_EQ(summary.churn[0].category, "App/GBuffers") << "Sorted by category";
+
+  const nvvkgltf::JournalCategoryChurn* images = findChurn(summary, "Scene/Images");
+  ASSERT_NE(images, nullptr);
+  EXPECT_EQ(images->allocations, 3u);
+  EXPECT_EQ(images->frees, 2u);
+  EXPECT_EQ(images->allocatedBytes, 34 * kMB);
+  EXPECT_EQ(images->freedBytes, 32 * kMB);
+  EXPECT_EQ(images->liveBytes, 2 * kMB);
+  EXPECT_EQ(images->liveCount, 1u);
+
+  const nvvkgltf::JournalCategoryChurn* gbuffers = findChurn(summary, "App/GBuffers");
+  ASSERT_NE(gbuffers, nullptr);
+  EXPECT_EQ(gbuffers->allocations, 2u);
+  EXPECT_EQ(gbuffers->frees, 2u);
+  EXPECT_EQ(gbuffers->liveBytes, 0u);
+}
+
+TEST(AllocationJournal, GrowthBetweenMarks)
+{
+  const nvvkgltf::AllocationJournalData data = sessionData();
+
+  // Default window: first mark ("startup") to last mark ("exit")
+  nvvkgltf::JournalSummary summary = nvvkgltf::summarizeJournal(data);
+  ASSERT_TRUE(summary.hasGrowth);
+  EXPECT_EQ(summary.fromMark, "startup");
+  EXPECT_EQ(summary.toMark, "exit");
+  ASSERT_EQ(summary.growth.size(), 2u);
+  EXPECT_EQ(summary.growth[0].category, "Scene/Images");
+  EXPECT_EQ(summary.growth[0].bytes, int64_t(2 * kMB));
+  EXPECT_EQ(summary.growth[1].category, "App/GBuffers");
+  EXPECT_EQ(summary.growth[1].bytes, -int64_t(8 * kMB));
+  EXPECT_EQ(summary.growth[1].count, -1);
+
+  // Between the two unloads: the second scene left one image behind
+  summary = nvvkgltf::summarizeJournal(data, {.fromMark = "unloaded", .toMark = "unloaded"});
+  ASSERT_TRUE(summary.hasGrowth);
+  EXPECT_EQ(summary.fromFrame, 50u);
+  EXPECT_EQ(summary.toFrame, 90u);
+  ASSERT_EQ(summary.growth.size(), 1u);
+  EXPECT_EQ(summary.growth[0].bytes, int64_t(2 * kMB));
+  EXPECT_EQ(summary.growth[0].count, 1);
+  ASSERT_EQ(summary.growthAllocations.size(), 1u);
+  EXPECT_EQ(summary.growthAllocations[0].id, 0x23u);
+
+  // While the first scene was loaded everything it created was still alive
+  summary = nvvkgltf::summarizeJournal(data, {.fromMark = "startup", .toMark = "loaded a"});
+  ASSERT_TRUE(summary.hasGrowth);
+  EXPECT_EQ(summary.growthAllocations.size(), 2u);
+  EXPECT_EQ(summary.growthAllocations[0].bytes, 16 * kMB) << "Largest first";
+
+  // Unknown label, or a window that runs backwards
+  EXPECT_FALSE(nvvkgltf::summarizeJournal(data, {.fromMark = "missing"}).hasGrowth);
+  EXPECT_FALSE(nvvkgltf::summarizeJournal(data, {.fromMark = "exit", .toMark = "startup"}).hasGrowth);
+  EXPECT_FALSE(nvvkgltf::formatJournalSummary(summary).empty());
+}
+
+TEST(AllocationJournal, InconsistentEvents)
+{
+  nvvkgltf::AllocationJournal journal;
+  journal.recordFree("Scene/Geometry", 0x1);  // Allocated before the journal started
+  journal.recordAllocate("Scene/Geometry", 0x2, 100, "a");
+  journal.recordAllocate("Scene/Geometry", 0x2, 300, "b");  // Free of the first one was missed
+
+  const nvvkgltf::JournalSummary summary = nvvkgltf::summarizeJournal(journal.getData());
+  EXPECT_EQ(summary.unmatchedFrees, 1u);
+  EXPECT_EQ(summary.replacedAllocations, 1u);
+  ASSERT_EQ(summary.liveAllocations.size(), 1u);
+  EXPECT_EQ(summary.liveAllocations[0].name, "b");
+  EXPECT_EQ(summary.liveBytes, 300u);
+  EXPECT_FALSE(summary.hasGrowth);
+}
+
+TEST(AllocationJournal, FileRoundTrip)
+{
+  nvvkgltf::AllocationJournal journal;
+  recordSession(journal);
+  journal.recordAllocate("Scene/Images", 0xffffffffffff0000ull, 1, "name with spaces\nand a newline");
+
+  const std::filesystem::path path = TestResources::getTempPath("journal.txt");
+  std::string                 error;
+  ASSERT_TRUE(journal.save(path, &error)) << error;
+
+  nvvkgltf::AllocationJournalData loaded;
+  ASSERT_TRUE(nvvkgltf::loadAllocationJournal(path, loaded, &error)) << error;
+  const nvvkgltf::AllocationJournalData original = journal.getData();
+  EXPECT_EQ(loaded.strings, original.strings);
+  ASSERT_EQ(loaded.events.size(), original.events.size());
+  for(size_t i = 0; i < loaded.events.size(); i++)
+  {
+    EXPECT_EQ(loaded.events[i].type, original.events[i].type);
+    EXPECT_EQ(loaded.events[i].frame, original.events[i].frame);
+    EXPECT_EQ(loaded.events[i].id, original.events[i].id);
+    EXPECT_EQ(loaded.events[i].bytes, original.events[i].bytes);
+    EXPECT_EQ(loaded.events[i].category, original.events[i].category);
+    EXPECT_EQ(loaded.events[i].name, original.events[i].name);
+  }
+  EXPECT_EQ(nvvkgltf::summarizeJournal(loaded).liveAllocations.back().name, "name with spaces and a newline");
+
+  // Compact: interned strings, one short line per event
+  EXPECT_LT(std::filesystem::file_size(path), 1024u);
+
+  // Truncated or foreign files are rejected
+  std::ofstream(path, std::ios::trunc) << "gpujournal 1\na 1 zz\n";
+  EXPECT_FALSE(nvvkgltf::loadAllocationJournal(path, loaded, &error));
+  std::ofstream(path, std::ios::trunc) << "{\"asset\":{}}\n";
+  EXPECT_FALSE(nvvkgltf::loadAllocationJournal(path, loaded, &error));
+  EXPECT_FALSE(nvvkgltf::loadAllocationJournal(TestResources::getTempPath("missing_journal.txt"), loaded, &error));
+  std::filesystem::remove(path);
+}
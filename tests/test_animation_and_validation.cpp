@@ -17,6 +17,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include "common/test_utils.hpp"
 #include "gltf_scene.hpp"
@@ -80,3 +81,98 @@ TEST(AnimationAndValidation, AnimationApiReachable)
     GTEST_SKIP() << "Test resource not found: " << e.what();
   }
 }
+
+// Deep hierarchies must not overflow the stack: the cycle check is iterative.
+TEST(AnimationAndValidation, ValidatorHandlesDeepChain)
+{
+  nvvkgltf::Scene scene;
+  auto&           model = scene.getModel();
+
+  constexpr int kDepth = 200000;
+  model.nodes.resize(kDepth);
+  for(int i = 0; i + 1 < kDepth; ++i)
+    model.nodes[i].children.push_back(i + 1);
+  model.scenes.resize(1);
+  model.scenes[0].nodes.push_back(0);
+  model.defaultScene = 0;
+
+  auto result = scene.validator().validateModel();
+  EXPECT_TRUE(result.valid) << (result.errors.empty() ? "" : result.errors[0]);
+
+  // Close the chain into a single cycle: exactly one cycle error
+  model.nodes[kDepth - 1].children.push_back(0);
+  result = scene.validator().validateModel();
+  EXPECT_FALSE(result.valid);
+  EXPECT_EQ(std::count_if(result.errors.begin(), result.errors.end(),
+                          [](const std::string& e) { return e.find("Cycle detected") != std::string::npos; }),
+            1);
+}
+
+// A node listed as child by two parents is reported
+TEST(AnimationAndValidation, ValidatorDetectsMultipleParents)
+{
+  nvvkgltf::Scene scene;
+  auto&           model = scene.getModel();
+
+  model.nodes.resize(3);
+  model.nodes[0].children.push_back(2);
+  model.nodes[1].children.push_back(2);
+  model.scenes.resize(1);
+  model.scenes[0].nodes = {0, 1};
+
+  auto result = scene.validator().validateModel();
+  EXPECT_FALSE(result.valid);
+  ASSERT_EQ(result.errors.size(), 1u);
+  EXPECT_NE(result.errors[0].find("multiple parents"), std::string::npos);
+}
+
+// Accessors that read past their buffer view are reported
+TEST(AnimationAndValidation, ValidatorDetectsAccessorOutOfRange)
+{
+  nvvkgltf::Scene scene;
+  auto&           model = scene.getModel();
+
+  model.buffers.resize(1);
+  model.buffers[0].data.resize(64);
+  model.bufferViews.resize(1);
+  model.bufferViews[0].buffer     = 0;
+  model.bufferViews[0].byteLength = 64;
+  model.accessors.resize(2);
+  model.accessors[0].bufferView    = 0;
+  model.accessors[0].componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  model.accessors[0].type          = TINYGLTF_TYPE_VEC4;
+  model.accessors[0].count         = 4;  // 64 bytes: fits exactly
+  model.accessors[1]               = model.accessors[0];
+  model.accessors[1].count         = 5;  // 80 bytes: overflows
+
+  auto result = scene.validator().validateModel();
+  EXPECT_FALSE(result.valid);
+  ASSERT_EQ(result.errors.size(), 1u);
+  EXPECT_NE(result.errors[0].find("Accessor 1"), std::string::npos);
+}
+
+// Checks run in parallel but results must be merged in a fixed order
+TEST(AnimationAndValidation, ValidatorOutputIsDeterministic)
+{
+  nvvkgltf::Scene scene;
+  auto&           model = scene.getModel();
+
+  model.nodes.resize(1000);
+  for(int i = 0; i < 1000; i += 7)
+    model.nodes[i].mesh = 5;  // No meshes: invalid
+  model.nodes[10].children.push_back(11);
+  model.nodes[11].children.push_back(10);
+  model.meshes.resize(0);
+  model.materials.resize(1);
+  model.materials[0].normalTexture.index = 3;  // No textures: invalid
+  model.skins.resize(1);
+  model.skins[0].joints.push_back(5000);
+
+  const auto reference = scene.validator().validateModel();
+  EXPECT_FALSE(reference.valid);
+  for(int run = 0; run < 10; ++run)
+  {
+    const auto result = scene.validator().validateModel();
+    EXPECT_EQ(result.errors, reference.errors);
+  }
+}
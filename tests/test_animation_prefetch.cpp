@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Pipelined headless animation (--animationPipelineDepth): frames prepared ahead by AnimationPrefetch
+// must leave the scene bit-identical to the serial evaluation. Each frame runs the CPU side of
+// GltfRenderer::updateAnimation and hashes everything the GPU would be given from it: node and
+// render-node world matrices, lights, dirty sets, skinned and morphed vertices.
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+#include <tinygltf/tiny_gltf.h>
+
+#include "common/test_utils.hpp"
+#include "gltf_animation_prefetch.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_animation.hpp"
+
+using namespace gltf_test;
+
+namespace {
+
+constexpr float kStep = 1.0f / 60.0f;
+
+// Append `data` to buffer 0 and return the index of a FLOAT accessor of `type` over it.
+int addAccessor(tinygltf::Model& model, const std::vector<float>& data, int type)
+{
+  if(model.buffers.empty())
+    model.buffers.emplace_back();
+  tinygltf::Buffer& buffer = model.buffers[0];
+
+  tinygltf::BufferView view;
+  view.buffer     = 0;
+  view.byteOffset = buffer.data.size();
+  view.byteLength = data.size() * sizeof(float);
+  buffer.data.resize(buffer.data.size() + view.byteLength);
+  std::memcpy(buffer.data.data() + view.byteOffset, data.data(), view.byteLength);
+  model.bufferViews.push_back(view);
+
+  const int components = (type == TINYGLTF_TYPE_VEC4) ? 4 : (type == TINYGLTF_TYPE_VEC3) ? 3 : 1;
+
+  tinygltf::Accessor accessor;
+  accessor.bufferView    = static_cast<int>(model.bufferViews.size()) - 1;
+  accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type          = type;
+  accessor.count         = data.size() / components;
+  model.accessors.push_back(accessor);
+  return static_cast<int>(model.accessors.size()) - 1;
+}
+
+void addChannel(tinygltf::Model&          model,
+                tinygltf::Animation&      anim,
+                int                       node,
+                const std::string&        path,
+                const std::string&        interpolation,
+                const std::vector<float>& times,
+                const std::vector<float>& values)
+{
+  const int type = (path == "rotation") ? TINYGLTF_TYPE_VEC4 : TINYGLTF_TYPE_VEC3;
+
+  tinygltf::AnimationSampler sampler;
+  sampler.input         = addAccessor(model, times, TINYGLTF_TYPE_SCALAR);
+  sampler.output        = addAccessor(model, values, type);
+  sampler.interpolation = interpolation;
+  anim.samplers.push_back(sampler);
+
+  tinygltf::AnimationChannel channel;
+  channel.sampler     = static_cast<int>(anim.samplers.size()) - 1;
+  channel.target_node = node;
+  channel.target_path = path;
+  anim.channels.push_back(channel);
+}
+
+// Nodes: 0 Parent (children 1, 2), 1 Spinner, 2 Bouncer, 3 Holder (child 4), 4 Lamp (light).
+// Animation 0 "All": TRS channels on 0, 1, 2, 3 with linear, step and cubic-spline samplers; the
+// light moves with node 3.
+tinygltf::Model makeAnimatedModel()
+{
+  tinygltf::Model model;
+
+  model.nodes.resize(5);
+  model.nodes[0].name        = "Parent";
+  model.nodes[0].translation = {1.0, 0.0, 0.0};
+  model.nodes[0].children    = {1, 2};
+  model.nodes[1].name        = "Spinner";
+  model.nodes[1].scale       = {2.0, 2.0, 2.0};
+  model.nodes[2].name        = "Bouncer";
+  model.nodes[2].rotation    = {0.0, 0.70710678, 0.0, 0.70710678};
+  model.nodes[3].name        = "Holder";
+  model.nodes[3].children    = {4};
+  model.nodes[4].name        = "Lamp";
+  model.nodes[4].light       = 0;
+
+  tinygltf::Light light;
+  light.type = "point";
+  model.lights.push_back(light);
+
+  model.scenes.emplace_back();
+  model.scenes[0].nodes = {0, 3};
+  model.defaultScene    = 0;
+
+  const std::vector<float> times = {0.0f, 0.5f, 1.0f, 2.0f};
+
+  tinygltf::Animation all;
+  all.name = "All";
+  addChannel(model, all, 1, "rotation", "LINEAR", times,
+             {0.0f, 0.0f, 0.0f, 1.0f,                //
+              0.0f, 0.38268343f, 0.0f, 0.92387953f,  //
+              0.0f, 0.0f, 0.70710678f, 0.70710678f,  //
+              0.0f, 0.0f, -1.0f, 0.0f});
+  addChannel(model, all, 1, "translation", "STEP", times, {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 2, 0});
+  // Cubic spline: (in-tangent, value, out-tangent) per key
+  addChannel(model, all, 2, "translation", "CUBICSPLINE", times,
+             {0, 0, 0, 0, 0, 0, 0, 2, 0,   //
+              0, -1, 0, 0, 1, 0, 1, 0, 0,  //
+              0, 0, 1, 2, 1, 0, 0, 0, 0,   //
+              1, 1, 1, 0, 0, 3, 0, 0, 0});
+  addChannel(model, all, 2, "scale", "LINEAR", times, {1, 1, 1, 2, 1, 1, 2, 3, 1, 0.5f, 0.5f, 0.5f});
+  addChannel(model, all, 0, "scale", "LINEAR", {0.0f, 2.0f}, {1, 1, 1, 3, 3, 3});
+  addChannel(model, all, 3, "translation", "LINEAR", {0.0f, 1.5f}, {0, 0, 0, 0, 5, 0});
+  model.animations.push_back(all);
+
+  return model;
+}
+
+// FNV-1a over raw bytes: equal only if bit-identical
+struct Hasher
+{
+  uint64_t value = 14695981039346656037ull;
+
+  void bytes(const void* data, size_t size)
+  {
+    const auto* p = static_cast<const uint8_t*>(data);
+    for(size_t i = 0; i < size; i++)
+    {
+      value ^= p[i];
+      value *= 1099511628211ull;
+    }
+  }
+  template <typename T>
+  void vector(const std::vector<T>& v)
+  {
+    uint64_t count = v.size();
+    bytes(&count, sizeof(count));
+    if(!v.empty())
+      bytes(v.data(), v.size() * sizeof(T));
+  }
+  void set(const std::unordered_set<int>& s)
+  {
+    std::vector<int> sorted(s.begin(), s.end());
+    std::sort(sorted.begin(), sorted.end());
+    vector(sorted);
+  }
+};
+
+// Frames evaluated in line, or taken from `prefetch` like GltfRenderer::evaluateAnimationChannels
+struct Player
+{
+  nvvkgltf::AnimationPrefetch* prefetch = nullptr;
+  uint32_t                     depth    = 0;
+  int                          restarts = 0;  // Frames evaluated in line while pipelined
+  int                          prepared = 0;  // Frames whose world matrices were prepared too
+
+  bool evaluate(nvvkgltf::Scene& scene, int animation, float step, bool& worldMatricesUpdated)
+  {
+    worldMatricesUpdated = false;
+    if(!prefetch)
+      return scene.animation().updateAnimation(animation);
+    const float time = scene.animation().getAnimationInfo(animation).currentTime;
+    if(prefetch->isRunning())
+    {
+      if(std::optional<bool> animated = prefetch->apply(scene, animation, time, &worldMatricesUpdated))
+      {
+        prepared += worldMatricesUpdated ? 1 : 0;
+        return *animated;
+      }
+    }
+    restarts++;
+    const bool animated = scene.animation().updateAnimation(animation);
+    prefetch->start(scene, animation, step, depth);
+    return animated;
+  }
+};
+
+// The CPU side of one GltfRenderer::updateAnimation frame; returns the hash of its results
+uint64_t renderFrame(nvvkgltf::Scene& scene, int animation, float step, Player& player)
+{
+  nvvkgltf::AnimationSystem& anim = scene.animation();
+  anim.getAnimationInfo(animation).incrementTime(step);
+
+  Hasher     hash;
+  bool       worldMatricesUpdated = false;
+  const bool animated             = player.evaluate(scene, animation, step, worldMatricesUpdated);
+  hash.bytes(&animated, sizeof(animated));
+
+  if(!worldMatricesUpdated)
+    scene.updateNodeWorldMatrices();
+
+  const nvvkgltf::Scene::DirtyFlags& dirty = scene.getDirtyFlags();
+  hash.set(dirty.nodes);
+  hash.set(dirty.lights);
+  hash.set(dirty.materials);
+  hash.set(dirty.renderNodesVk);
+  hash.set(dirty.renderNodesRtx);
+  const bool allDirty[] = {dirty.allRenderNodesVk, dirty.allRenderNodesRtx, dirty.allRenderNodesDirty};
+  hash.bytes(allDirty, sizeof(allDirty));
+
+  hash.vector(scene.getNodesWorldMatrices());
+  for(const auto& renderNode : scene.getRenderNodes())
+    hash.bytes(&renderNode.worldMatrix, sizeof(glm::mat4));
+  for(const nvvkgltf::RenderLight& light : scene.getRenderLights())
+    hash.bytes(&light.worldMatrix, sizeof(glm::mat4));
+  for(const tinygltf::Mesh& mesh : scene.getModel().meshes)
+    hash.vector(mesh.weights);
+
+  if(anim.hasMorphTargets() || anim.hasSkinning())
+  {
+    anim.updateDeformationChanges();
+    if(anim.hasMorphTargets())
+    {
+      anim.computeMorphTargets();
+      for(size_t i = 0; i < anim.getMorphPrimitives().size(); i++)
+        hash.vector(anim.getMorphResult(i).blendedPositions);
+    }
+    if(anim.hasSkinning())
+    {
+      anim.computeSkinning();
+      for(size_t i = 0; i < anim.getSkinTasks().size(); i++)
+      {
+        hash.vector(anim.getSkinningResult(i).positions);
+        hash.vector(anim.getSkinningResult(i).normals);
+      }
+    }
+  }
+
+  scene.clearDirtyFlags();
+  return hash.value;
+}
+
+std::vector<uint64_t> renderFrames(nvvkgltf::Scene& scene, int frameCount, Player& player)
+{
+  std::vector<uint64_t> hashes;
+  for(int frame = 0; frame < frameCount; frame++)
+    hashes.push_back(renderFrame(scene, 0, kStep, player));
+  return hashes;
+}
+
+// Serial, then pipelined at several depths, each on a fresh scene from `load`
+template <typename Load>
+void expectPipelinedMatchesSerial(Load load, int frameCount)
+{
+  nvvkgltf::Scene serialScene;
+  if(!load(serialScene))
+    GTEST_SKIP() << "Model not found";
+  Player                      serial;
+  const std::vector<uint64_t> expected = renderFrames(serialScene, frameCount, serial);
+
+  for(uint32_t depth : {1u, 3u, 8u})
+  {
+    SCOPED_TRACE("depth " + std::to_string(depth));
+    nvvkgltf::Scene pipelinedScene;
+    ASSERT_TRUE(load(pipelinedScene));
+    nvvkgltf::AnimationPrefetch prefetch;
+    Player                      pipelined{.prefetch = &prefetch, .depth = depth};
+    const std::vector<uint64_t> hashes = renderFrames(pipelinedScene, frameCount, pipelined);
+
+    EXPECT_EQ(pipelined.restarts, 1) << "Only the first frame is evaluated in line";
+    EXPECT_EQ(pipelined.prepared, frameCount - 1) << "The other frames come with their world matrices";
+    ASSERT_EQ(hashes.size(), expected.size());
+    for(size_t frame = 0; frame < hashes.size(); frame++)
+      EXPECT_EQ(hashes[frame], expected[frame]) << "frame " << frame;
+  }
+}
+
+bool loadSampleModel(nvvkgltf::Scene& scene, const std::string& modelPath)
+{
+  auto assetsPath = TestResources::getSampleAssetsPath();
+  if(assetsPath.empty())
+    return false;
+  return scene.load(assetsPath / modelPath);
+}
+
+}  // namespace
+
+// Longer than the clip: the time wraps around the end a few times
+TEST(AnimationPrefetch, PipelinedMatchesSerial)
+{
+  expectPipelinedMatchesSerial(
+      [](nvvkgltf::Scene& scene) {
+        scene.takeModel(makeAnimatedModel());
+        return scene.valid();
+      },
+      300);
+}
+
+// Skin expansion of the dirty set (joints moved -> skinned nodes) and the skinned vertices
+TEST(AnimationPrefetch, PipelinedMatchesSerialSkinned)
+{
+  expectPipelinedMatchesSerial([](nvvkgltf::Scene& scene) { return loadSampleModel(scene, "Models/SimpleSkin/glTF/SimpleSkin.gltf"); },
+                               200);
+}
+
+// Weights channels: mesh weights and the morphed vertices
+TEST(AnimationPrefetch, PipelinedMatchesSerialMorphed)
+{
+  expectPipelinedMatchesSerial([](nvvkgltf::Scene& scene) { return loadSampleModel(scene, "Models/SimpleMorph/glTF/SimpleMorph.gltf"); },
+                               200);
+}
+
+// A frame that was not prepared (reset, other step) is refused, and the scene left untouched
+TEST(AnimationPrefetch, OtherFrameIsRefused)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  nvvkgltf::AnimationInfo& info = scene.animation().getAnimationInfo(0);
+
+  nvvkgltf::AnimationPrefetch prefetch;
+  prefetch.start(scene, 0, kStep, 2);
+  ASSERT_TRUE(prefetch.isRunning());
+
+  const std::vector<double> rotation = scene.getModel().nodes[1].rotation;
+  info.incrementTime(2.0f * kStep);  // Skips the prepared frame
+  EXPECT_FALSE(prefetch.apply(scene, 0, info.currentTime).has_value());
+  EXPECT_FALSE(prefetch.isRunning());
+  EXPECT_EQ(scene.getModel().nodes[1].rotation, rotation);
+  EXPECT_TRUE(scene.getDirtyFlags().nodes.empty());
+
+  // Restarted from the current frame: the next one is prepared
+  prefetch.start(scene, 0, kStep, 2);
+  info.incrementTime(kStep);
+  const std::optional<bool> animated = prefetch.apply(scene, 0, info.currentTime);
+  ASSERT_TRUE(animated.has_value());
+  EXPECT_TRUE(*animated);
+  EXPECT_FALSE(scene.getDirtyFlags().nodes.empty());
+  EXPECT_FALSE(prefetch.apply(scene, 1, info.currentTime).has_value()) << "other clip";
+}
+
+// Editing a node the clip does not animate, under an animated one, invalidates the prepared frames
+TEST(AnimationPrefetch, EditedChildRestarts)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  nvvkgltf::AnimationInfo& info = scene.animation().getAnimationInfo(0);
+  scene.updateNodeWorldMatrices();
+  scene.clearDirtyFlags();
+
+  nvvkgltf::AnimationPrefetch prefetch;
+  prefetch.start(scene, 0, kStep, 2);
+  info.incrementTime(kStep);
+  bool worldMatricesUpdated = false;
+  ASSERT_TRUE(prefetch.apply(scene, 0, info.currentTime, &worldMatricesUpdated).has_value());
+  EXPECT_TRUE(worldMatricesUpdated);
+  scene.clearDirtyFlags();
+
+  // The lamp moves with the holder; edited and committed before the next frame
+  scene.getModel().nodes[4].translation = {0.0, 1.0, 0.0};
+  scene.markNodeDirty(4);
+  scene.updateNodeWorldMatrices();
+  scene.clearDirtyFlags();
+
+  info.incrementTime(kStep);
+  EXPECT_FALSE(prefetch.apply(scene, 0, info.currentTime, &worldMatricesUpdated).has_value());
+  EXPECT_FALSE(worldMatricesUpdated);
+  EXPECT_FALSE(prefetch.isRunning());
+}
+
+TEST(AnimationPrefetch, PointerChannelsAreNotPrefetched)
+{
+  tinygltf::Model model = makeAnimatedModel();
+
+  tinygltf::AnimationChannel pointer;
+  pointer.sampler     = 1;  // VEC3 translation
+  pointer.target_path = "pointer";
+  tinygltf::Value::Object ext;
+  ext["pointer"]                                     = tinygltf::Value(std::string("/nodes/2/translation"));
+  pointer.target_extensions["KHR_animation_pointer"] = tinygltf::Value(ext);
+  model.animations.push_back(model.animations[0]);
+  model.animations[1].channels.push_back(pointer);
+
+  nvvkgltf::Scene scene;
+  scene.takeModel(std::move(model));
+  EXPECT_TRUE(nvvkgltf::AnimationPrefetch::canPrefetch(scene, 0));
+  EXPECT_FALSE(nvvkgltf::AnimationPrefetch::canPrefetch(scene, 1));
+  EXPECT_FALSE(nvvkgltf::AnimationPrefetch::canPrefetch(scene, 2)) << "out of range";
+
+  nvvkgltf::AnimationPrefetch prefetch;
+  prefetch.start(scene, 1, kStep, 2);
+  EXPECT_FALSE(prefetch.isRunning());
+}
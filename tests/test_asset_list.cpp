@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Scene Browser asset lists without ImGui: name index (search, incremental sync) and the
+// filtered row mapping used by the virtualized lists.
+
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "ui_asset_list.hpp"
+
+namespace {
+
+// Reference: linear case-insensitive substring scan.
+std::vector<int> bruteForceFind(const std::vector<std::string>& names, std::string query)
+{
+  auto lower = [](std::string s) {
+    for(char& c : s)
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return s;
+  };
+  query = lower(query);
+  std::vector<int> ids;
+  for(int i = 0; i < static_cast<int>(names.size()); ++i)
+    if(lower(names[i]).find(query) != std::string::npos)
+      ids.push_back(i);
+  return ids;
+}
+
+void syncFrom(NameIndex& index, const std::vector<std::string>& names)
+{
+  index.sync(names.size(), [&](int id) { return std::string_view(names[id]); });
+}
+
+std::vector<int> find(const NameIndex& index, std::string_view query)
+{
+  std::vector<int> ids;
+  index.find(query, ids);
+  return ids;
+}
+
+std::vector<std::string> makeNames(int count)
+{
+  std::vector<std::string> names;
+  for(int i = 0; i < count; ++i)
+    names.push_back((i % 3 == 0 ? "Wheel_" : i % 3 == 1 ? "Door_" : "Body Panel ") + std::to_string(i));
+  return names;
+}
+
+}  // namespace
+
+TEST(AssetList, FindMatchesLinearScan)
+{
+  const std::vector<std::string> names = makeNames(1000);
+  NameIndex                      index;
+  syncFrom(index, names);
+  ASSERT_EQ(index.size(), names.size());
+
+  for(const char* query : {"wheel", "DOOR_1", "panel 99", "el_", "_12", "9", "", "zzz", "body panel 999"})
+    EXPECT_EQ(find(index, query), bruteForceFind(names, query)) << "query '" << query << "'";
+}
+
+TEST(AssetList, RenameUpdatesIndex)
+{
+  std::vector<std::string> names = makeNames(100);
+  NameIndex                index;
+  syncFrom(index, names);
+
+  const uint64_t revision = index.revision();
+  index.assign(42, "Steering Wheel");
+  names[42] = "Steering Wheel";
+  EXPECT_NE(index.revision(), revision);
+  EXPECT_EQ(find(index, "steering"), std::vector<int>{42});
+  EXPECT_EQ(find(index, "door_42"), std::vector<int>{});
+
+  // Re-assigning the same name (any case) is a no-op
+  const uint64_t afterRename = index.revision();
+  index.assign(42, "STEERING WHEEL");
+  EXPECT_EQ(index.revision(), afterRename);
+}
+
+TEST(AssetList, SyncHandlesAddRenameAndDelete)
+{
+  std::vector<std::string> names = makeNames(200);
+  NameIndex                index;
+  syncFrom(index, names);
+
+  // Add at the end
+  names.push_back("Spare Wheel");
+  EXPECT_EQ(index.sync(names.size(), [&](int id) { return std::string_view(names[id]); }), 1u);
+  EXPECT_EQ(find(index, "spare"), std::vector<int>{200});
+
+  // Rename in place
+  names[7] = "Hood";
+  EXPECT_EQ(index.sync(names.size(), [&](int id) { return std::string_view(names[id]); }), 1u);
+  EXPECT_EQ(find(index, "hood"), std::vector<int>{7});
+
+  // Nothing changed
+  EXPECT_EQ(index.sync(names.size(), [&](int id) { return std::string_view(names[id]); }), 0u);
+
+  // Delete from the middle: later indices shift down, as in the glTF arrays
+  names.erase(names.begin() + 50);
+  syncFrom(index, names);
+  for(const char* query : {"wheel", "door", "hood", "panel 5", "spare"})
+    EXPECT_EQ(find(index, query), bruteForceFind(names, query)) << "query '" << query << "'";
+
+  // Delete near the front (rebuild path)
+  names.erase(names.begin() + 1);
+  syncFrom(index, names);
+  for(const char* query : {"wheel", "door", "hood", "panel 5", "spare"})
+    EXPECT_EQ(find(index, query), bruteForceFind(names, query)) << "query '" << query << "'";
+}
+
+TEST(AssetList, ViewMapsRowsToItems)
+{
+  const std::vector<std::string> names = makeNames(30);
+  NameIndex                      index;
+  syncFrom(index, names);
+
+  AssetListView view;
+  EXPECT_TRUE(view.update(index, ""));
+  EXPECT_FALSE(view.isFiltered());
+  EXPECT_EQ(view.rowCount(), 30u);
+  EXPECT_EQ(view.itemAt(12), 12);
+  EXPECT_EQ(view.rowOf(29), 29);
+  EXPECT_EQ(view.rowOf(30), -1);
+
+  EXPECT_TRUE(view.update(index, "door"));
+  EXPECT_TRUE(view.isFiltered());
+  ASSERT_EQ(view.rowCount(), 10u);  // 1, 4, ..., 28
+  EXPECT_EQ(view.itemAt(0), 1);
+  EXPECT_EQ(view.itemAt(9), 28);
+  EXPECT_EQ(view.rowOf(4), 1);
+  EXPECT_EQ(view.rowOf(3), -1) << "filtered out";
+}
+
+TEST(AssetList, ViewRecomputesOnlyOnChange)
+{
+  std::vector<std::string> names = makeNames(30);
+  NameIndex                index;
+  syncFrom(index, names);
+
+  AssetListView view;
+  EXPECT_TRUE(view.update(index, "wheel"));
+  EXPECT_FALSE(view.update(index, "wheel")) << "same query, same index";
+
+  names[1] = "Wheel Cover";
+  syncFrom(index, names);
+  EXPECT_TRUE(view.update(index, "wheel")) << "index changed";
+  EXPECT_EQ(view.itemAt(1), 1);
+
+  EXPECT_TRUE(view.update(index, "wheel_")) << "query changed";
+}
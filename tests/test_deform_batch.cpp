@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Batched morph / skin dispatch layout: DeformBatchTable is the CPU reference of the task search in
+// skinning.comp.slang / morph.comp.slang and of the joint palette pass (joint_palette.comp.slang).
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "gltf_deform_batch.hpp"
+
+using nvvkgltf::DeformBatchTable;
+
+namespace {
+
+void expectMatNear(const glm::mat4& a, const glm::mat4& b, float eps = 1e-4f)
+{
+  for(int c = 0; c < 4; c++)
+    for(int r = 0; r < 4; r++)
+      EXPECT_NEAR(a[c][r], b[c][r], eps) << "[" << c << "][" << r << "]";
+}
+
+glm::mat4 trs(const glm::vec3& t, float angle, const glm::vec3& axis, const glm::vec3& s)
+{
+  return glm::scale(glm::rotate(glm::translate(glm::mat4(1), t), angle, axis), s);
+}
+
+}  // namespace
+
+TEST(DeformBatch, TaskStructsMatchShaderLayout)
+{
+  // Pointers first, then four uints: no padding, same size in C++ and Slang
+  EXPECT_EQ(sizeof(shaderio::SkinBatchTask), 8 * sizeof(void*) + 4 * sizeof(uint32_t));
+  EXPECT_EQ(sizeof(shaderio::MorphBatchTask), 11 * sizeof(void*) + 4 * sizeof(uint32_t));
+  EXPECT_EQ(sizeof(shaderio::JointPaletteEntry), 2 * sizeof(int));
+}
+
+TEST(DeformBatch, SkinTasksAreBackToBack)
+{
+  DeformBatchTable table;
+  const int        joints[] = {1, 2, 3};
+  EXPECT_EQ(table.addSkin(100, 0, 0, joints, {}), 0u);
+  EXPECT_EQ(table.addSkin(37, 0, 4, joints, {}), 1u);
+  EXPECT_EQ(table.addSkin(5, 0, 0, joints, {}), 2u);
+
+  ASSERT_EQ(table.skinTasks.size(), 3u);
+  EXPECT_EQ(table.skinTasks[0].firstVertex, 0u);
+  EXPECT_EQ(table.skinTasks[1].firstVertex, 100u);
+  EXPECT_EQ(table.skinTasks[2].firstVertex, 137u);
+  EXPECT_EQ(table.skinVertexCount, 142u);
+  EXPECT_EQ(table.skinFirstVertex, (std::vector<uint32_t>{0, 100, 137}));
+  for(const auto& task : table.skinTasks)
+    EXPECT_EQ(task.numJoints, 3u);
+}
+
+TEST(DeformBatch, PaletteSharedPerSkinAndReferenceNode)
+{
+  DeformBatchTable table;
+  const int        skinA[] = {1, 2, 3};
+  const int        skinB[] = {5, 6};
+  table.addSkin(10, 0, 0, skinA, {});  // Palette 0..2
+  table.addSkin(10, 0, 0, skinA, {});  // Same skin, same reference: shared
+  table.addSkin(10, 0, 7, skinA, {});  // Same skin, other reference: 3..5
+  table.addSkin(10, 1, 0, skinB, {});  // Other skin: 6..7
+
+  EXPECT_EQ(table.skinTasks[0].paletteOffset, 0u);
+  EXPECT_EQ(table.skinTasks[1].paletteOffset, 0u);
+  EXPECT_EQ(table.skinTasks[2].paletteOffset, 3u);
+  EXPECT_EQ(table.skinTasks[3].paletteOffset, 6u);
+  ASSERT_EQ(table.palette.size(), 8u);
+  ASSERT_EQ(table.paletteInverseBind.size(), 8u);
+  EXPECT_EQ(table.palette[4].jointNode, 2);
+  EXPECT_EQ(table.palette[4].refNode, 7);
+  EXPECT_EQ(table.palette[7].jointNode, 6);
+}
+
+TEST(DeformBatch, MorphTasksPackWeights)
+{
+  DeformBatchTable table;
+  table.addMorph(50, 2);
+  table.addMorph(8, 3);
+  table.addMorph(20, 1);
+
+  EXPECT_EQ(table.morphTasks[1].firstVertex, 50u);
+  EXPECT_EQ(table.morphTasks[2].firstVertex, 58u);
+  EXPECT_EQ(table.morphTasks[0].weightsOffset, 0u);
+  EXPECT_EQ(table.morphTasks[1].weightsOffset, 2u);
+  EXPECT_EQ(table.morphTasks[2].weightsOffset, 5u);
+  EXPECT_EQ(table.morphWeightCount, 6u);
+  EXPECT_EQ(table.morphVertexCount, 78u);
+}
+
+TEST(DeformBatch, FindTaskCoversEveryVertexOnce)
+{
+  DeformBatchTable table;
+  const uint32_t   counts[] = {3, 256, 0, 1, 255, 0, 700, 2};
+  for(uint32_t count : counts)
+    table.addMorph(count, 1);
+
+  for(uint32_t v = 0; v < table.morphVertexCount; v++)
+  {
+    const int task = DeformBatchTable::findTask(table.morphFirstVertex, table.morphVertexCount, v);
+    ASSERT_GE(task, 0) << "vertex " << v;
+    const auto& t = table.morphTasks[task];
+    EXPECT_GE(v, t.firstVertex) << "vertex " << v;
+    EXPECT_LT(v, t.firstVertex + t.vertexCount) << "vertex " << v << ": empty tasks are never selected";
+  }
+  EXPECT_EQ(DeformBatchTable::findTask(table.morphFirstVertex, table.morphVertexCount, table.morphVertexCount), -1);
+  EXPECT_EQ(DeformBatchTable::findTask({}, 0, 0), -1);
+}
+
+TEST(DeformBatch, CrowdIsOneRange)
+{
+  // 5000 small characters sharing one skin, each with its own reference node
+  DeformBatchTable table;
+  const int        joints[] = {0, 1, 2, 3};
+  for(int i = 0; i < 5000; i++)
+    table.addSkin(64, 0, 10 + i, joints, {});
+
+  EXPECT_EQ(table.skinTasks.size(), 5000u);
+  EXPECT_EQ(table.skinVertexCount, 5000u * 64u);
+  EXPECT_EQ(table.palette.size(), 5000u * 4u);
+  EXPECT_EQ(DeformBatchTable::findTask(table.skinFirstVertex, table.skinVertexCount, 64 * 1234 + 63), 1234);
+  EXPECT_EQ(DeformBatchTable::findTask(table.skinFirstVertex, table.skinVertexCount, 64 * 1235), 1235);
+}
+
+TEST(DeformBatch, PaletteMatchesJointMatrixFormula)
+{
+  std::vector<glm::mat4> world = {
+      trs({1, 2, 3}, 0.3f, {0, 1, 0}, {1, 1, 1}),        // 0: reference node
+      trs({0, 1, 0}, 0.7f, {1, 0, 0}, {2, 2, 2}),        // 1: joint
+      trs({-1, 0, 4}, 1.1f, {0, 0, 1}, {1, 0.5f, 1}),    // 2: joint, non-uniform scale
+  };
+  const glm::mat4 ibm0 = glm::inverse(trs({0, 1, 0}, 0.2f, {1, 0, 0}, {1, 1, 1}));
+
+  DeformBatchTable table;
+  const int        joints[] = {1, 2};
+  const glm::mat4  ibms[]   = {ibm0};  // Second joint has no IBM: identity
+  table.addSkin(4, 0, 0, joints, ibms);
+
+  std::vector<glm::mat4> jointMats(table.palette.size());
+  std::vector<glm::mat3> normalMats(table.palette.size());
+  table.evaluatePalette(world, jointMats, normalMats);
+
+  expectMatNear(jointMats[0], glm::inverse(world[0]) * world[1] * ibm0);
+  expectMatNear(jointMats[1], glm::inverse(world[0]) * world[2]);
+
+  const glm::mat3 expectedNormal = glm::transpose(glm::inverse(glm::mat3(jointMats[1])));
+  for(int c = 0; c < 3; c++)
+    for(int r = 0; r < 3; r++)
+      EXPECT_NEAR(normalMats[1][c][r], expectedNormal[c][r], 1e-4f);
+}
+
+TEST(DeformBatch, InvalidJointGivesIdentity)
+{
+  std::vector<glm::mat4> world = {glm::translate(glm::mat4(1), {1, 0, 0}), glm::translate(glm::mat4(1), {0, 3, 0})};
+
+  DeformBatchTable table;
+  const int        joints[] = {-1, 1, 9};
+  table.addSkin(1, 0, 0, joints, {});
+
+  std::vector<glm::mat4> jointMats(3);
+  std::vector<glm::mat3> normalMats(3);
+  table.evaluatePalette(world, jointMats, normalMats);
+  expectMatNear(jointMats[0], glm::mat4(1));
+  expectMatNear(jointMats[1], glm::translate(glm::mat4(1), {-1, 3, 0}));
+  expectMatNear(jointMats[2], glm::mat4(1));
+}
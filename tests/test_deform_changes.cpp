@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Deformation skipping: DeformChangeTracker decisions and stats, and the repacking of the changed
+// tasks into a compact dispatch (DeformBatchTable::selectTasks).
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "gltf_deform_batch.hpp"
+#include "gltf_deform_changes.hpp"
+
+using nvvkgltf::DeformBatchTable;
+using nvvkgltf::DeformChangeTracker;
+using Change = DeformChangeTracker::Change;
+
+namespace {
+
+// Decide and commit one morph primitive, as AnimationSystem::updateDeformationChanges() does
+Change stepMorph(DeformChangeTracker& tracker, std::vector<float> weights, uint32_t vertexCount = 10)
+{
+  const bool changed = tracker.morphInputsChanged(0, weights);
+  tracker.commitMorph(0, weights, changed, vertexCount);
+  return tracker.morphChange(0);
+}
+
+Change stepSkin(DeformChangeTracker& tracker, std::vector<glm::mat4> palette, uint32_t vertexCount = 10)
+{
+  const bool changed = tracker.skinInputsChanged(0, palette);
+  tracker.commitSkin(0, palette, changed, vertexCount);
+  return tracker.skinChange(0);
+}
+
+}  // namespace
+
+TEST(DeformChanges, EverythingChangedBeforeFirstCommit)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(2, 1);
+  EXPECT_TRUE(tracker.morphChanged(0));
+  EXPECT_TRUE(tracker.morphChanged(1));
+  EXPECT_TRUE(tracker.skinChanged(0));
+  EXPECT_TRUE(tracker.morphInputsChanged(0, std::vector<float>{0.5f}));
+  // Out of range queries never skip
+  EXPECT_TRUE(tracker.morphChanged(5));
+  EXPECT_TRUE(tracker.skinInputsChanged(3, {}));
+}
+
+TEST(DeformChanges, SameWeightsAreSkipped)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(1, 0);
+  EXPECT_EQ(stepMorph(tracker, {0.25f, 0.5f}), Change::eChanged);
+  EXPECT_EQ(stepMorph(tracker, {0.25f, 0.5f}), Change::eUnchanged);
+  EXPECT_EQ(stepMorph(tracker, {0.25f, 0.5f}), Change::eUnchanged);
+  EXPECT_EQ(stepMorph(tracker, {0.25f, 0.51f}), Change::eChanged);
+  EXPECT_EQ(stepMorph(tracker, {0.25f, 0.51f, 0.0f}), Change::eChanged);  // Different target count
+}
+
+TEST(DeformChanges, ZeroWeightsReportRestOnce)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(1, 0);
+  EXPECT_EQ(stepMorph(tracker, {0.0f, 0.0f}), Change::eRest);
+  EXPECT_EQ(stepMorph(tracker, {0.0f, 0.0f}), Change::eUnchanged);
+  EXPECT_EQ(stepMorph(tracker, {1.0f, 0.0f}), Change::eChanged);
+  EXPECT_EQ(stepMorph(tracker, {0.0f, 0.0f}), Change::eRest);
+  EXPECT_TRUE(tracker.morphChanged(0));  // Rest still rewrites the vertex buffers and refits the BLAS
+}
+
+TEST(DeformChanges, PaletteComparedWithTolerance)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(0, 1);
+  const glm::mat4 joint = glm::rotate(glm::translate(glm::mat4(1), glm::vec3(100.0f, 2.0f, 0.0f)), 0.3f, glm::vec3(0, 1, 0));
+
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1), joint}), Change::eChanged);
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1), joint}), Change::eUnchanged);
+
+  // Rounding noise from re-deriving the same pose (relative to the element magnitude)
+  glm::mat4 noisy = joint;
+  noisy[3][0] += 100.0f * 1e-7f;
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1), noisy}), Change::eUnchanged);
+
+  // A real pose change
+  const glm::mat4 moved = glm::rotate(joint, 0.01f, glm::vec3(1, 0, 0));
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1), moved}), Change::eChanged);
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1)}), Change::eChanged);  // Different joint count
+}
+
+TEST(DeformChanges, DriftIsMeasuredFromLastDeformation)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(0, 1);
+  tracker.paletteTolerance = 1e-3f;
+
+  glm::mat4 joint(1);
+  EXPECT_EQ(stepSkin(tracker, {joint}), Change::eChanged);
+  // Each step is below the tolerance, but the accumulated motion is not
+  int changes = 0;
+  for(int i = 0; i < 10; i++)
+  {
+    joint[3][0] += 4e-4f;
+    changes += stepSkin(tracker, {joint}) == Change::eChanged ? 1 : 0;
+  }
+  EXPECT_GE(changes, 3);
+  EXPECT_LE(changes, 5);
+}
+
+TEST(DeformChanges, InvalidateForcesChange)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(1, 1);
+  stepMorph(tracker, {0.5f});
+  stepSkin(tracker, {glm::mat4(1)});
+  EXPECT_EQ(stepMorph(tracker, {0.5f}), Change::eUnchanged);
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1)}), Change::eUnchanged);
+
+  tracker.invalidate();
+  EXPECT_TRUE(tracker.morphChanged(0));
+  EXPECT_TRUE(tracker.skinChanged(0));
+  EXPECT_EQ(stepMorph(tracker, {0.5f}), Change::eChanged);
+  EXPECT_EQ(stepSkin(tracker, {glm::mat4(1)}), Change::eChanged);
+}
+
+TEST(DeformChanges, StatsCountEvaluatedAndSkipped)
+{
+  DeformChangeTracker tracker;
+  tracker.reset(1, 1);
+  for(int frame = 0; frame < 4; frame++)
+  {
+    stepMorph(tracker, {frame < 2 ? 0.0f : 0.5f}, 100);
+    stepSkin(tracker, {glm::mat4(1)}, 50);
+    tracker.countFrame();
+  }
+
+  const nvvkgltf::DeformSkipStats stats = tracker.takeStats();
+  EXPECT_EQ(stats.frames, 4u);
+  EXPECT_EQ(stats.morphAtRest, 1u);
+  EXPECT_EQ(stats.morphEvaluated, 1u);
+  EXPECT_EQ(stats.morphUnchanged, 2u);
+  EXPECT_EQ(stats.skinEvaluated, 1u);
+  EXPECT_EQ(stats.skinUnchanged, 3u);
+  EXPECT_EQ(stats.verticesSkipped, 2u * 100u + 3u * 50u);
+
+  EXPECT_EQ(tracker.stats().frames, 0u);  // Restarted
+}
+
+TEST(DeformChanges, SelectTasksRepacksChangedOnly)
+{
+  DeformBatchTable table;
+  const int        joints[] = {1};
+  table.addSkin(100, 0, 0, joints, {});
+  table.addSkin(37, 0, 0, joints, {});
+  table.addSkin(5, 0, 0, joints, {});
+
+  std::vector<shaderio::SkinBatchTask> selected;
+  std::vector<uint32_t>                firstVertex;
+  const std::vector<uint8_t>           changed = {0, 1, 1};
+  const uint32_t vertexCount = DeformBatchTable::selectTasks(std::span<const shaderio::SkinBatchTask>(table.skinTasks),
+                                                             changed, selected, firstVertex);
+
+  EXPECT_EQ(vertexCount, 42u);
+  ASSERT_EQ(selected.size(), 2u);
+  EXPECT_EQ(selected[0].vertexCount, 37u);
+  EXPECT_EQ(selected[1].vertexCount, 5u);
+  EXPECT_EQ(firstVertex, (std::vector<uint32_t>{0, 37}));
+  EXPECT_EQ(selected[0].firstVertex, 0u);
+  EXPECT_EQ(selected[1].firstVertex, 37u);
+
+  // The shader's task search works on the compact table
+  EXPECT_EQ(DeformBatchTable::findTask(firstVertex, vertexCount, 36), 0);
+  EXPECT_EQ(DeformBatchTable::findTask(firstVertex, vertexCount, 37), 1);
+  EXPECT_EQ(DeformBatchTable::findTask(firstVertex, vertexCount, 42), -1);
+
+  const std::vector<uint8_t> none(3, 0);
+  EXPECT_EQ(DeformBatchTable::selectTasks(std::span<const shaderio::SkinBatchTask>(table.skinTasks), none, selected, firstVertex), 0u);
+  EXPECT_TRUE(selected.empty());
+  EXPECT_TRUE(firstVertex.empty());
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Interaction-mode resolution controller replayed against frame-time traces (no GPU).
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "dynamic_resolution.hpp"
+
+namespace {
+
+// Simulated GPU: trace time proportional to the pixel count, plus optional per-frame noise.
+struct TraceModel
+{
+  double fullResMs = 120.0;  // Trace time at scale 1
+
+  double frameTime(float scale, double noise = 0.0) const { return fullResMs * double(scale) * double(scale) + noise; }
+};
+
+// Replays `changed` per frame; each frame's time is reported to the next update() (one frame lag).
+std::vector<float> replay(DynamicResolution& controller, const TraceModel& gpu, const std::vector<bool>& changed,
+                          const std::vector<double>& noise = {})
+{
+  std::vector<float> scales;
+  double             lastMs = -1.0;
+  for(size_t i = 0; i < changed.size(); i++)
+  {
+    controller.update(changed[i], lastMs);
+    const float scale = controller.scale();
+    scales.push_back(scale);
+    lastMs = gpu.frameTime(scale, i < noise.size() ? noise[i] : 0.0);
+  }
+  return scales;
+}
+
+}  // namespace
+
+TEST(DynamicResolution, SingleChangeKeepsFullResolution)
+{
+  DynamicResolution controller;
+  EXPECT_EQ(controller.update(true, 100.0), DynamicResolution::Transition::eNone);
+  EXPECT_FLOAT_EQ(controller.scale(), 1.0f);
+  EXPECT_EQ(controller.update(false, 100.0), DynamicResolution::Transition::eNone) << "Never entered, nothing to restart";
+  EXPECT_FALSE(controller.isInteracting());
+}
+
+TEST(DynamicResolution, EntersOnSustainedMotionAndExitsWhenItStops)
+{
+  DynamicResolution controller;
+  EXPECT_EQ(controller.update(true, 120.0), DynamicResolution::Transition::eNone);
+  EXPECT_EQ(controller.update(true, 120.0), DynamicResolution::Transition::eEnter);
+  EXPECT_LT(controller.scale(), 1.0f);
+  EXPECT_EQ(controller.update(true, 30.0), DynamicResolution::Transition::eNone);
+  EXPECT_EQ(controller.update(false, 30.0), DynamicResolution::Transition::eExit);
+  EXPECT_FLOAT_EQ(controller.scale(), 1.0f) << "Full resolution as soon as motion stops";
+}
+
+TEST(DynamicResolution, ConvergesToTargetOnHeavyScene)
+{
+  DynamicResolution controller;  // Target 33.3 ms
+  TraceModel        gpu{.fullResMs = 120.0};
+  const std::vector<float> scales = replay(controller, gpu, std::vector<bool>(60, true));
+
+  // Settles inside the dead band and stays there
+  const double settledMs = gpu.frameTime(scales.back());
+  EXPECT_GE(settledMs, controller.settings().targetFrameTimeMs * 0.8);
+  EXPECT_LE(settledMs, controller.settings().targetFrameTimeMs * 1.1);
+  for(size_t i = 40; i < scales.size(); i++)
+    EXPECT_FLOAT_EQ(scales[i], scales.back()) << "frame " << i;
+}
+
+TEST(DynamicResolution, LightSceneStaysAtFullResolution)
+{
+  DynamicResolution        controller;
+  TraceModel               gpu{.fullResMs = 10.0};
+  const std::vector<float> scales = replay(controller, gpu, std::vector<bool>(30, true));
+  for(float scale : scales)
+    EXPECT_FLOAT_EQ(scale, 1.0f);
+}
+
+TEST(DynamicResolution, ClampsToMinimumScale)
+{
+  DynamicResolution        controller;
+  TraceModel               gpu{.fullResMs = 5000.0};
+  const std::vector<float> scales = replay(controller, gpu, std::vector<bool>(30, true));
+  EXPECT_FLOAT_EQ(scales.back(), controller.settings().minScale);
+}
+
+TEST(DynamicResolution, NoisyTraceDoesNotOscillate)
+{
+  DynamicResolution controller;
+  TraceModel        gpu{.fullResMs = 120.0};
+
+  // Recorded-style jitter of +-2 ms around the model
+  std::vector<double> noise(120);
+  for(size_t i = 0; i < noise.size(); i++)
+    noise[i] = 2.0 * std::sin(double(i) * 1.7);
+
+  const std::vector<float> scales = replay(controller, gpu, std::vector<bool>(noise.size(), true), noise);
+  int                      moves  = 0;
+  for(size_t i = 41; i < scales.size(); i++)
+    moves += (scales[i] != scales[i - 1]) ? 1 : 0;
+  EXPECT_EQ(moves, 0) << "Dead band and quantization absorb the jitter";
+}
+
+TEST(DynamicResolution, DragReleaseDragTrace)
+{
+  DynamicResolution controller;
+  TraceModel        gpu{.fullResMs = 120.0};
+
+  // Drag for 20 frames, release for 10 (accumulating), drag again
+  std::vector<bool> changed;
+  changed.insert(changed.end(), 20, true);
+  changed.insert(changed.end(), 10, false);
+  changed.insert(changed.end(), 20, true);
+  const std::vector<float> scales = replay(controller, gpu, changed);
+
+  EXPECT_FLOAT_EQ(scales[0], 1.0f);
+  EXPECT_LT(scales[19], 1.0f);
+  for(size_t i = 20; i < 30; i++)
+    EXPECT_FLOAT_EQ(scales[i], 1.0f) << "Accumulating at full resolution, frame " << i;
+  EXPECT_FLOAT_EQ(scales[30], 1.0f) << "First frame of the second drag is a single change";
+  EXPECT_LT(scales[31], 1.0f);
+  EXPECT_NEAR(scales.back(), scales[19], 0.07f) << "Second drag settles at the same scale";
+}
+
+TEST(DynamicResolution, ScaledSize)
+{
+  uint32_t w = 0, h = 0;
+  DynamicResolution::scaledSize(1920, 1080, 0.5f, w, h);
+  EXPECT_EQ(w, 960u);
+  EXPECT_EQ(h, 540u);
+  DynamicResolution::scaledSize(3, 1, 0.01f, w, h);
+  EXPECT_EQ(w, 1u);
+  EXPECT_EQ(h, 1u);
+  DynamicResolution::scaledSize(1920, 1080, 2.0f, w, h);
+  EXPECT_EQ(w, 1920u) << "Never larger than the output";
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Streaming GLB writer: chunk layout and padding, buffers merged into the BIN chunk, and files that
+// tinygltf reads back with the same buffer-view content.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+
+#include <tinygltf/json.hpp>
+
+#include "common/test_utils.hpp"
+#include "gltf_glb_writer.hpp"
+#include "gltf_scene.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+tinygltf::Buffer makeBuffer(const std::string& bytes)
+{
+  tinygltf::Buffer buffer;
+  buffer.data.assign(bytes.begin(), bytes.end());
+  return buffer;
+}
+
+tinygltf::BufferView makeView(int buffer, size_t offset, size_t length)
+{
+  tinygltf::BufferView view;
+  view.buffer     = buffer;
+  view.byteOffset = offset;
+  view.byteLength = length;
+  return view;
+}
+
+bool loadGlb(const fs::path& file, tinygltf::Model& model)
+{
+  tinygltf::TinyGLTF loader;
+  std::string        error;
+  std::string        warn;
+  return loader.LoadBinaryFromFile(&model, &error, &warn, file.string());
+}
+
+// Content of each buffer view, from whichever buffer it lives in
+std::vector<std::vector<unsigned char>> viewContents(const tinygltf::Model& model)
+{
+  std::vector<std::vector<unsigned char>> contents;
+  for(const tinygltf::BufferView& view : model.bufferViews)
+  {
+    const auto& data  = model.buffers[view.buffer].data;
+    const auto  begin = data.begin() + view.byteOffset;
+    contents.emplace_back(begin, begin + view.byteLength);
+  }
+  return contents;
+}
+
+uint32_t readU32(const std::vector<char>& file, size_t offset)
+{
+  uint32_t value = 0;
+  std::memcpy(&value, file.data() + offset, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+TEST(GlbWriter, BinChunkLayout)
+{
+  tinygltf::Model model;
+  for(const char* bytes : {"12345", "abc", "", "0123456789"})
+    model.buffers.push_back(makeBuffer(bytes));
+
+  const nvvkgltf::GlbBinLayout layout = nvvkgltf::planGlbBinChunk(model);
+  EXPECT_EQ(layout.bufferOffsets, (std::vector<uint64_t>{0, 16, 32, 32}));
+  EXPECT_EQ(layout.dataSize, 42u);
+  EXPECT_EQ(layout.chunkSize, 44u);
+
+  EXPECT_EQ(nvvkgltf::planGlbBinChunk(tinygltf::Model{}).chunkSize, 0u);
+}
+
+TEST(GlbWriter, MergesBuffersAndRestoresModel)
+{
+  tinygltf::Model model;
+  model.asset.version = "2.0";
+  model.buffers.push_back(makeBuffer("first buffer"));
+  model.buffers.push_back(makeBuffer("second"));
+  model.buffers[0].name = "main";
+  model.bufferViews.push_back(makeView(0, 0, 5));
+  model.bufferViews.push_back(makeView(1, 1, 4));
+  model.bufferViews.push_back(makeView(0, 6, 6));
+  const auto expected = viewContents(model);
+
+  const fs::path file = TestResources::getTempPath("glb_writer_merge.glb");
+  std::string    error;
+  ASSERT_TRUE(nvvkgltf::canStreamGlb(model));
+  ASSERT_TRUE(nvvkgltf::writeGlbStreamed(model, file, &error)) << error;
+  EXPECT_FALSE(fs::exists(fs::path(file.string() + ".tmp")));
+
+  // The caller's model is unchanged
+  ASSERT_EQ(model.buffers.size(), 2u);
+  EXPECT_EQ(model.bufferViews[1].buffer, 1);
+  EXPECT_EQ(model.bufferViews[1].byteOffset, 1u);
+  EXPECT_EQ(viewContents(model), expected);
+
+  tinygltf::Model loaded;
+  ASSERT_TRUE(loadGlb(file, loaded));
+  ASSERT_EQ(loaded.buffers.size(), 1u);
+  EXPECT_EQ(loaded.buffers[0].name, "main");
+  EXPECT_TRUE(loaded.buffers[0].uri.empty());
+  EXPECT_EQ(loaded.buffers[0].data.size(), nvvkgltf::planGlbBinChunk(model).dataSize);
+  EXPECT_EQ(loaded.bufferViews[1].buffer, 0);
+  EXPECT_EQ(loaded.bufferViews[1].byteOffset, nvvkgltf::kGlbBufferAlignment + 1);
+  EXPECT_EQ(viewContents(loaded), expected);
+  fs::remove(file);
+}
+
+TEST(GlbWriter, SceneRoundTrip)
+{
+  nvvkgltf::Scene scene;
+  try
+  {
+    if(!scene.load(TestResources::getResourcePath("Box.glb")))
+      GTEST_SKIP() << "Test resource not found: Box.glb";
+  }
+  catch(const std::runtime_error&)
+  {
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  }
+
+  tinygltf::Model& model = scene.getModel();
+  const fs::path   file  = TestResources::getTempPath("glb_writer_box.glb");
+  std::string      error;
+  ASSERT_TRUE(nvvkgltf::writeGlbStreamed(model, file, &error)) << error;
+
+  // Header and chunk lengths agree with the file, everything 4-byte aligned
+  std::ifstream     stream(file, std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+  ASSERT_GE(bytes.size(), 20u);
+  EXPECT_EQ(std::memcmp(bytes.data(), "glTF", 4), 0);
+  EXPECT_EQ(readU32(bytes, 4), 2u);
+  EXPECT_EQ(readU32(bytes, 8), bytes.size());
+  const uint32_t jsonLength = readU32(bytes, 12);
+  EXPECT_EQ(jsonLength % 4, 0u);
+  ASSERT_EQ(20u + jsonLength + 8u + nvvkgltf::planGlbBinChunk(model).chunkSize, bytes.size());
+  EXPECT_EQ(std::memcmp(bytes.data() + 20 + jsonLength + 4, "BIN", 4), 0);
+
+  tinygltf::Model loaded;
+  ASSERT_TRUE(loadGlb(file, loaded));
+  EXPECT_EQ(loaded.accessors.size(), model.accessors.size());
+  EXPECT_EQ(loaded.meshes.size(), model.meshes.size());
+  EXPECT_EQ(viewContents(loaded), viewContents(model));
+  fs::remove(file);
+}
+
+TEST(GlbWriter, BufferViewExtensionsNeedTinygltf)
+{
+  tinygltf::Model model;
+  model.buffers.push_back(makeBuffer("a"));
+  model.bufferViews.push_back(makeView(0, 0, 1));
+  model.bufferViews[0].extensions["EXT_meshopt_compression"] = tinygltf::Value(tinygltf::Value::Object());
+  EXPECT_TRUE(nvvkgltf::canStreamGlb(model));  // Single buffer: nothing to rebase
+
+  model.buffers.push_back(makeBuffer("b"));
+  EXPECT_FALSE(nvvkgltf::canStreamGlb(model));
+}
+
+TEST(GlbWriter, MeshoptFallbackBufferStaysSeparate)
+{
+  tinygltf::Model model;
+  model.asset.version = "2.0";
+  model.buffers.push_back(makeBuffer("0123"));
+  model.buffers.push_back(makeBuffer("ENCODED!"));
+  tinygltf::Buffer fallback;
+  fallback.byteLength = 8;
+  fallback.extensions["EXT_meshopt_compression"] =
+      tinygltf::Value(tinygltf::Value::Object{{"fallback", tinygltf::Value(true)}});
+  model.buffers.push_back(fallback);
+  model.bufferViews.push_back(makeView(0, 0, 4));
+  model.bufferViews.push_back(makeView(2, 0, 8));
+  model.bufferViews[1].extensions["EXT_meshopt_compression"] = tinygltf::Value(tinygltf::Value::Object{
+      {"buffer", tinygltf::Value(1)}, {"byteOffset", tinygltf::Value(2)}, {"byteLength", tinygltf::Value(6)},
+      {"byteStride", tinygltf::Value(4)}, {"count", tinygltf::Value(2)}, {"mode", tinygltf::Value(std::string("ATTRIBUTES"))}});
+
+  EXPECT_TRUE(nvvkgltf::isMeshoptFallbackBuffer(model.buffers[2]));
+  EXPECT_FALSE(nvvkgltf::isMeshoptFallbackBuffer(model.buffers[1]));
+  const nvvkgltf::GlbBinLayout layout = nvvkgltf::planGlbBinChunk(model);
+  EXPECT_EQ(layout.bufferIndices, (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(layout.dataSize, nvvkgltf::kGlbBufferAlignment + 8) << "The fallback buffer has no storage";
+  ASSERT_TRUE(nvvkgltf::canStreamGlb(model));
+
+  const fs::path file = TestResources::getTempPath("glb_writer_meshopt.glb");
+  std::string    error;
+  ASSERT_TRUE(nvvkgltf::writeGlbStreamed(model, file, &error)) << error;
+  std::ifstream     stream(file, std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+  ASSERT_GE(bytes.size(), 20u);
+  const nlohmann::json json = nlohmann::json::parse(std::string(bytes.data() + 20, readU32(bytes, 12)));
+
+  ASSERT_EQ(json["buffers"].size(), 2u);
+  EXPECT_EQ(json["buffers"][0]["byteLength"], layout.dataSize);
+  EXPECT_FALSE(json["buffers"][1].contains("uri"));
+  EXPECT_EQ(json["buffers"][1]["byteLength"], 8);
+  EXPECT_EQ(json["buffers"][1]["extensions"]["EXT_meshopt_compression"]["fallback"], true);
+
+  const nlohmann::json& view = json["bufferViews"][1];
+  EXPECT_EQ(view["buffer"], 1);
+  EXPECT_EQ(view.value("byteOffset", 0), 0);
+  EXPECT_EQ(view["extensions"]["EXT_meshopt_compression"]["buffer"], 0);
+  EXPECT_EQ(view["extensions"]["EXT_meshopt_compression"]["byteOffset"], nvvkgltf::kGlbBufferAlignment + 2);
+
+  // The encoded bytes are in the BIN chunk where the extension points
+  const size_t bin = 20 + readU32(bytes, 12) + 8;
+  EXPECT_EQ(std::string(bytes.data() + bin + nvvkgltf::kGlbBufferAlignment + 2, 6), "CODED!");
+  fs::remove(file);
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// HDR environments: importance-sampling table built from the pixels, cache keys following the file
+// content, cache entries read back identical and rejected when they don't match.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+
+#include <glm/ext/scalar_constants.hpp>
+#include <stb/stb_image_write.h>
+
+#include "common/test_utils.hpp"
+#include "hdr_environment.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+// RGBA pixels with a bright spot, a colored band and a dark corner
+std::vector<float> makePixels(uint32_t width, uint32_t height)
+{
+  std::vector<float> rgba(size_t(width) * height * 4);
+  for(uint32_t y = 0; y < height; y++)
+  {
+    for(uint32_t x = 0; x < width; x++)
+    {
+      float* px = &rgba[(size_t(y) * width + x) * 4];
+      px[0]     = 0.1f + 0.05f * float(x);
+      px[1]     = y == 1 ? 2.0f : 0.2f;
+      px[2]     = 0.3f;
+      px[3]     = 1.0f;
+    }
+  }
+  rgba[(size_t(2) * width + 5) * 4] = 50.0f;  // Sun
+  for(int c = 0; c < 3; c++)
+    rgba[c] = 0.0f;  // Black texel: never sampled
+  return rgba;
+}
+
+void expectSameData(const HdrEnvironmentData& a, const HdrEnvironmentData& b)
+{
+  EXPECT_EQ(a.width, b.width);
+  EXPECT_EQ(a.height, b.height);
+  EXPECT_EQ(a.integral, b.integral);
+  EXPECT_EQ(a.average, b.average);
+  EXPECT_EQ(a.pixels, b.pixels);
+  ASSERT_EQ(a.accel.size(), b.accel.size());
+  for(size_t i = 0; i < a.accel.size(); i++)
+  {
+    EXPECT_EQ(a.accel[i].alias, b.accel[i].alias) << i;
+    EXPECT_EQ(a.accel[i].q, b.accel[i].q) << i;
+  }
+}
+
+class HdrEnvCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "ibl_cache";
+    fs::remove_all(m_dir);
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  fs::path m_dir;
+};
+
+}  // namespace
+
+TEST(HdrEnvironment, AliasTableFollowsImportance)
+{
+  constexpr uint32_t       width  = 8;
+  constexpr uint32_t       height = 4;
+  const std::vector<float> rgba   = makePixels(width, height);
+  const HdrEnvironmentData data   = buildHdrEnvironmentData(std::vector<float>(rgba), width, height);
+  ASSERT_TRUE(data.valid());
+
+  // Importance: brightest channel x solid angle of the texel
+  const size_t       count = size_t(width) * height;
+  std::vector<float> importance(count);
+  double             sum = 0.0;
+  for(uint32_t y = 0; y < height; y++)
+  {
+    const float area = (std::cos(glm::pi<float>() * y / height) - std::cos(glm::pi<float>() * (y + 1) / height))
+                       * 2.0f * glm::pi<float>() / width;
+    for(uint32_t x = 0; x < width; x++)
+    {
+      const size_t i = size_t(y) * width + x;
+      importance[i]  = area * std::max(rgba[i * 4], std::max(rgba[i * 4 + 1], rgba[i * 4 + 2]));
+      sum += importance[i];
+    }
+  }
+  EXPECT_NEAR(data.integral, sum, 1e-4 * sum);
+
+  // Probability of drawing each texel: picked uniformly and kept (q), or reached as an alias
+  std::vector<double> probability(count, 0.0);
+  for(size_t i = 0; i < count; i++)
+  {
+    EXPECT_LT(data.accel[i].alias, count);
+    probability[i] += data.accel[i].q / double(count);
+    if(data.accel[i].alias != i)
+      probability[data.accel[i].alias] += (1.0 - data.accel[i].q) / double(count);
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    EXPECT_NEAR(probability[i], importance[i] / sum, 1e-5) << "texel " << i;
+    // Alpha: PDF of the texel, brightest channel over the integral
+    EXPECT_NEAR(data.pixels[i * 4 + 3], std::max(rgba[i * 4], std::max(rgba[i * 4 + 1], rgba[i * 4 + 2])) / data.integral, 1e-6f);
+  }
+  EXPECT_EQ(probability[0], 0.0);
+}
+
+TEST(HdrEnvironment, BlackEnvironmentSamplesUniformly)
+{
+  const HdrEnvironmentData data = makeDefaultHdrEnvironment();
+  ASSERT_TRUE(data.valid());
+  EXPECT_EQ(data.integral, 1.0f);
+  EXPECT_EQ(data.accel[0].alias, 0u);
+  EXPECT_EQ(data.accel[0].q, 1.0f);
+  EXPECT_EQ(data.pixels[3], 0.0f);
+}
+
+TEST(HdrEnvironment, CacheKeyFollowsContent)
+{
+  std::string a = "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n";
+  std::string b = a;
+  b.back()      = ' ';
+  EXPECT_EQ(hdrEnvCacheKey(a.data(), a.size()), hdrEnvCacheKey(a.data(), a.size()));
+  EXPECT_NE(hdrEnvCacheKey(a.data(), a.size()), hdrEnvCacheKey(b.data(), b.size()));
+  EXPECT_NE(hdrEnvCacheKey(a.data(), a.size()), hdrEnvCacheKey(a.data(), a.size() - 1));
+}
+
+TEST_F(HdrEnvCacheTest, RoundTrip)
+{
+  const HdrEnvCache        cache(m_dir);
+  const HdrEnvironmentData data = buildHdrEnvironmentData(makePixels(8, 4), 8, 4);
+  HdrEnvironmentData       loaded;
+  EXPECT_FALSE(cache.load(42, loaded));
+
+  ASSERT_TRUE(cache.store(42, data));
+  EXPECT_TRUE(fs::exists(cache.entryPath(42)));
+  EXPECT_FALSE(fs::exists(fs::path(cache.entryPath(42).string() + ".tmp")));
+  ASSERT_TRUE(cache.load(42, loaded));
+  expectSameData(data, loaded);
+
+  EXPECT_FALSE(cache.load(43, loaded));  // Other content
+  EXPECT_FALSE(loaded.valid());
+
+  const HdrEnvCache disabled;
+  EXPECT_FALSE(disabled.store(42, data));
+  EXPECT_FALSE(disabled.load(42, loaded));
+}
+
+TEST_F(HdrEnvCacheTest, RejectsDamagedEntries)
+{
+  const HdrEnvCache        cache(m_dir);
+  const HdrEnvironmentData data = buildHdrEnvironmentData(makePixels(8, 4), 8, 4);
+  HdrEnvironmentData       loaded;
+
+  // Truncated
+  ASSERT_TRUE(cache.store(1, data));
+  fs::resize_file(cache.entryPath(1), fs::file_size(cache.entryPath(1)) - 4);
+  EXPECT_FALSE(cache.load(1, loaded));
+
+  // Entry renamed to another key: the key in the header no longer matches
+  ASSERT_TRUE(cache.store(2, data));
+  fs::rename(cache.entryPath(2), cache.entryPath(3));
+  EXPECT_FALSE(cache.load(3, loaded));
+
+  // Foreign file
+  {
+    std::ofstream out(cache.entryPath(4), std::ios::binary);
+    out << std::string(256, 'x');
+  }
+  EXPECT_FALSE(cache.load(4, loaded));
+  EXPECT_FALSE(loaded.valid());
+}
+
+TEST_F(HdrEnvCacheTest, EvictsLeastRecentlyUsed)
+{
+  const HdrEnvironmentData data = buildHdrEnvironmentData(makePixels(8, 4), 8, 4);
+  ASSERT_TRUE(HdrEnvCache(m_dir).store(1, data));
+  const uint64_t entrySize = fs::file_size(HdrEnvCache(m_dir).entryPath(1));
+
+  // Room for two entries
+  const HdrEnvCache cache(m_dir, entrySize * 2);
+  const auto        past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+  fs::last_write_time(cache.entryPath(1), past);
+  ASSERT_TRUE(cache.store(2, data));
+  fs::last_write_time(cache.entryPath(2), past - std::chrono::hours(1));
+
+  HdrEnvironmentData loaded;
+  ASSERT_TRUE(cache.load(1, loaded));  // Used: now the most recent
+  ASSERT_TRUE(cache.store(3, data));
+  EXPECT_TRUE(fs::exists(cache.entryPath(1)));
+  EXPECT_FALSE(fs::exists(cache.entryPath(2)));
+  EXPECT_TRUE(fs::exists(cache.entryPath(3)));
+}
+
+TEST_F(HdrEnvCacheTest, SecondLoadComesFromCache)
+{
+  constexpr int            width  = 16;
+  constexpr int            height = 8;
+  const std::vector<float> rgba   = makePixels(width, height);
+  fs::create_directories(m_dir);
+  const fs::path file = m_dir / "env.hdr";
+  ASSERT_NE(stbi_write_hdr(file.string().c_str(), width, height, 4, rgba.data()), 0);
+
+  const HdrEnvCache  cache(m_dir / "cache");
+  HdrEnvironmentData decoded;
+  HdrEnvironmentData cached;
+  bool               fromCache = true;
+  ASSERT_TRUE(loadHdrEnvironment(file, cache, decoded, &fromCache));
+  EXPECT_FALSE(fromCache);
+  ASSERT_TRUE(loadHdrEnvironment(file, cache, cached, &fromCache));
+  EXPECT_TRUE(fromCache);
+  expectSameData(decoded, cached);
+
+  // Edited file: new key, decoded again
+  std::vector<float> edited = rgba;
+  edited[4]                 = 10.0f;
+  ASSERT_NE(stbi_write_hdr(file.string().c_str(), width, height, 4, edited.data()), 0);
+  ASSERT_TRUE(loadHdrEnvironment(file, cache, decoded, &fromCache));
+  EXPECT_FALSE(fromCache);
+
+  EXPECT_FALSE(loadHdrEnvironment(m_dir / "missing.hdr", cache, decoded));
+}
+
+TEST_F(HdrEnvCacheTest, AsyncLoad)
+{
+  const std::vector<float> rgba = makePixels(8, 4);
+  fs::create_directories(m_dir);
+  const fs::path file = m_dir / "env.hdr";
+  ASSERT_NE(stbi_write_hdr(file.string().c_str(), 8, 4, 4, rgba.data()), 0);
+
+  AsyncHdrLoad load;
+  ASSERT_TRUE(load.start(file, HdrEnvCache()));
+  load.wait();
+  std::optional<AsyncHdrLoad::Result> result = load.takeResult();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->loaded);
+  EXPECT_EQ(result->filename, file);
+  EXPECT_TRUE(result->data.valid());
+  EXPECT_FALSE(load.takeResult().has_value());
+}
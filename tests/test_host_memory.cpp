@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Host memory accounting: tracker current/peak semantics, and the per-subsystem sizes reported by
+// Scene, AnimationSystem and MaterialCache.
+
+#include <gtest/gtest.h>
+
+#include "common/test_utils.hpp"
+#include "gltf_material_cache.hpp"
+#include "gltf_scene.hpp"
+#include "host_memory_tracker.hpp"
+
+using namespace gltf_test;
+
+TEST(HostMemoryTracker, SetReplacesAndKeepsPeak)
+{
+  nvvkgltf::HostMemoryTracker tracker;
+  tracker.set("A", 1000);
+  tracker.set("A", 400);
+  EXPECT_EQ(tracker.getStats("A").currentBytes, 400u);
+  EXPECT_EQ(tracker.getStats("A").peakBytes, 1000u);
+
+  tracker.set("B", 300);
+  const nvvkgltf::HostMemoryStats total = tracker.getTotalStats();
+  EXPECT_EQ(total.currentBytes, 700u);
+  EXPECT_EQ(total.peakBytes, 1000u) << "Peak of the sum, not the sum of the peaks";
+
+  EXPECT_EQ(tracker.getStats("Missing").currentBytes, 0u);
+}
+
+TEST(HostMemoryTracker, TransientTrackingRaisesPeak)
+{
+  nvvkgltf::HostMemoryTracker tracker;
+  tracker.set("Model", 100);
+  tracker.track("Images/Decoded", 64);
+  tracker.track("Images/Decoded", 64);
+  tracker.untrack("Images/Decoded", 128);
+  tracker.untrack("Images/Decoded", 1);  // More than tracked: clamped
+  tracker.untrack("Unknown", 10);        // Never tracked: ignored
+
+  EXPECT_EQ(tracker.getStats("Images/Decoded").currentBytes, 0u);
+  EXPECT_EQ(tracker.getStats("Images/Decoded").peakBytes, 128u);
+  EXPECT_EQ(tracker.getTotalStats().currentBytes, 100u);
+  EXPECT_EQ(tracker.getTotalStats().peakBytes, 228u);
+
+  // Released categories keep showing while their peak is non-zero
+  const std::vector<std::string> categories = tracker.getCategories();
+  EXPECT_EQ(categories, (std::vector<std::string>{"Images/Decoded", "Model"}));
+}
+
+TEST(HostMemoryTracker, ResetRestartsFromZero)
+{
+  nvvkgltf::HostMemoryTracker tracker;
+  tracker.set("A", 500);
+  tracker.track("B", 200);
+  tracker.reset();
+
+  EXPECT_EQ(tracker.getTotalStats().currentBytes, 0u);
+  EXPECT_EQ(tracker.getTotalStats().peakBytes, 0u);
+  EXPECT_TRUE(tracker.getCategories().empty());
+
+  tracker.set("A", 50);
+  EXPECT_EQ(tracker.getStats("A").peakBytes, 50u);
+}
+
+TEST(HostMemoryTracker, ContainerBytesUsesCapacity)
+{
+  std::vector<uint32_t> values;
+  values.reserve(100);
+  EXPECT_EQ(nvvkgltf::containerBytes(values), 100u * sizeof(uint32_t));
+  EXPECT_EQ(nvvkgltf::containerBytes(std::string("short")), 0u) << "Small strings live in the object";
+  EXPECT_GE(nvvkgltf::containerBytes(std::string(1000, 'x')), 1000u);
+}
+
+TEST(HostMemory, SceneReportsModelAndRenderNodes)
+{
+  nvvkgltf::Scene scene;
+  try
+  {
+    if(!scene.load(TestResources::getResourcePath("Box.glb")))
+      GTEST_SKIP() << "Failed to load Box.glb";
+  }
+  catch(const std::runtime_error&)
+  {
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  }
+
+  nvvkgltf::HostMemoryTracker tracker;
+  scene.reportHostMemory(tracker);
+
+  uint64_t bufferBytes = 0;
+  for(const tinygltf::Buffer& buffer : scene.getModel().buffers)
+    bufferBytes += buffer.data.size();
+  EXPECT_GE(tracker.getStats("Model/Buffers").currentBytes, bufferBytes);
+  EXPECT_GT(tracker.getStats("Model/Objects").currentBytes, 0u);
+  EXPECT_GT(tracker.getStats("RenderNodes").currentBytes, 0u);
+  EXPECT_GT(tracker.getStats("SceneGraph").currentBytes, 0u);
+
+  // Measuring again replaces the values instead of adding to them
+  const uint64_t total = tracker.getTotalStats().currentBytes;
+  scene.reportHostMemory(tracker);
+  EXPECT_EQ(tracker.getTotalStats().currentBytes, total);
+}
+
+TEST(HostMemory, AnimationReportsKeyframes)
+{
+  auto assetsPath = TestResources::getSampleAssetsPath();
+  if(assetsPath.empty())
+    GTEST_SKIP() << "glTF-Sample-Assets not found at: " << GLTF_SAMPLE_ASSETS_PATH;
+
+  nvvkgltf::Scene scene;
+  if(!scene.load(assetsPath / "Models/AnimatedCube/glTF/AnimatedCube.gltf"))
+    GTEST_SKIP() << "AnimatedCube not found";
+
+  nvvkgltf::HostMemoryTracker tracker;
+  scene.reportHostMemory(tracker);
+  EXPECT_GT(tracker.getStats("Animation/Keyframes").currentBytes, 0u);
+}
+
+TEST(HostMemory, MaterialCacheGrowsWithMaterials)
+{
+  nvvkgltf::MaterialCache empty;
+  empty.buildFromMaterials({});
+
+  nvvkgltf::MaterialCache         cache;
+  std::vector<tinygltf::Material> materials(16);
+  cache.buildFromMaterials(materials);
+  EXPECT_GT(cache.sizeInBytes(), empty.sizeInBytes());
+}
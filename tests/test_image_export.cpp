@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Image export of Scene::save: the plan (URIs, dedup, name collisions) and the parallel copies must
+// give the same output tree as a serial copy, reuse identical destinations and never leave
+// temporary files behind.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <map>
+
+#include <tinygltf/tiny_gltf.h>
+
+#include "gltf_image_export.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void writeFile(const fs::path& path, const std::string& content)
+{
+  fs::create_directories(path.parent_path());
+  std::ofstream(path, std::ios::binary) << content;
+}
+
+std::string readFile(const fs::path& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Relative path -> content of every file under root
+std::map<std::string, std::string> snapshotTree(const fs::path& root)
+{
+  std::map<std::string, std::string> tree;
+  for(const auto& entry : fs::recursive_directory_iterator(root))
+    if(entry.is_regular_file())
+      tree[fs::relative(entry.path(), root).generic_string()] = readFile(entry.path());
+  return tree;
+}
+
+class ImageExportTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_root = fs::temp_directory_path() / "gltf_renderer_tests" / "image_export";
+    fs::remove_all(m_root);
+    m_src = m_root / "src";
+
+    // Two different files with the same name, and a shared texture referenced several times
+    writeFile(m_src / "a" / "albedo.png", "albedo A");
+    writeFile(m_src / "b" / "albedo.png", "albedo B (different)");
+    writeFile(m_src / "shared.jpg", "shared texture");
+    for(int i = 0; i < 24; i++)
+      writeFile(m_src / "many" / ("tex" + std::to_string(i) + ".png"), std::string(1000 + i, char('a' + i % 26)));
+
+    for(const char* uri : {"a/albedo.png", "b/albedo.png", "shared.jpg", "missing.png", "shared.jpg", "data:image/png;base64,AAAA"})
+      addImage(uri);
+    for(int i = 0; i < 24; i++)
+      addImage("many/tex" + std::to_string(i) + ".png");
+    addImage("a/albedo.png");  // Same file again, after many others
+  }
+  void TearDown() override { fs::remove_all(m_root); }
+
+  void addImage(const std::string& uri)
+  {
+    tinygltf::Image image;
+    image.uri = uri;
+    m_model.images.push_back(image);
+  }
+
+  nvvkgltf::ImageExportPlan plan(const fs::path& dst) const
+  {
+    const std::vector<fs::path> searchPaths = {m_src};
+    return nvvkgltf::planImageExport(m_model, searchPaths, dst);
+  }
+
+  fs::path        m_root;
+  fs::path        m_src;
+  tinygltf::Model m_model;
+};
+
+}  // namespace
+
+TEST_F(ImageExportTest, PlanNamesAndDeduplicates)
+{
+  const nvvkgltf::ImageExportPlan p = plan(m_root / "out");
+  ASSERT_EQ(p.uris.size(), m_model.images.size());
+
+  EXPECT_EQ(p.uris[0], "images/albedo.png");
+  EXPECT_EQ(p.uris[1], "images/albedo_1.png");  // Name collision, different content
+  EXPECT_EQ(p.uris[2], "images/shared.jpg");
+  EXPECT_TRUE(p.uris[3].empty());  // Not found: URI kept
+  EXPECT_EQ(p.uris[4], p.uris[2]);  // Same source: same destination
+  EXPECT_TRUE(p.uris[5].empty());  // Data URI
+  EXPECT_EQ(p.uris.back(), p.uris[0]);
+  EXPECT_EQ(p.copyJob.back(), p.copyJob[0]);
+
+  EXPECT_EQ(p.copies.size(), 3u + 24u);  // One copy per distinct source file
+}
+
+TEST_F(ImageExportTest, ParallelMatchesSerial)
+{
+  const nvvkgltf::ImageExportPlan serial   = plan(m_root / "serial");
+  const nvvkgltf::ImageExportPlan parallel = plan(m_root / "parallel");
+  EXPECT_EQ(serial.uris, parallel.uris);
+
+  const nvvkgltf::ImageCopyStats serialStats   = nvvkgltf::copyImages(serial.copies, 1);
+  const nvvkgltf::ImageCopyStats parallelStats = nvvkgltf::copyImages(parallel.copies, 8);
+  EXPECT_EQ(serialStats.copied, serial.copies.size());
+  EXPECT_EQ(parallelStats.copied, parallel.copies.size());
+  EXPECT_EQ(parallelStats.failed, 0u);
+
+  const auto serialTree = snapshotTree(m_root / "serial");
+  EXPECT_EQ(serialTree, snapshotTree(m_root / "parallel"));
+  EXPECT_EQ(serialTree.size(), serial.copies.size());  // No temporary files left
+  EXPECT_EQ(serialTree.at("images/albedo_1.png"), "albedo B (different)");
+}
+
+TEST_F(ImageExportTest, IdenticalDestinationIsReused)
+{
+  const nvvkgltf::ImageExportPlan p = plan(m_root / "out");
+  EXPECT_EQ(nvvkgltf::copyImages(p.copies).copied, p.copies.size());
+
+  // Saving again into the same folder rewrites nothing
+  nvvkgltf::ImageCopyStats again = nvvkgltf::copyImages(p.copies);
+  EXPECT_EQ(again.copied, 0u);
+  EXPECT_EQ(again.reused, p.copies.size());
+
+  // A changed source of the same size is detected by its content
+  writeFile(m_src / "shared.jpg", "SHARED texture");
+  std::vector<nvvkgltf::ImageCopyOutcome> outcomes;
+  again = nvvkgltf::copyImages(p.copies, 4, &outcomes);
+  EXPECT_EQ(again.copied, 1u);
+  EXPECT_EQ(outcomes[p.copyJob[2]], nvvkgltf::ImageCopyOutcome::eCopied);
+  EXPECT_EQ(readFile(m_root / "out" / "images" / "shared.jpg"), "SHARED texture");
+}
+
+TEST_F(ImageExportTest, ImageNextToDestinationStaysInPlace)
+{
+  // Saving into the source folder: every found image already resolves at its URI
+  const nvvkgltf::ImageExportPlan p = plan(m_src);
+  EXPECT_TRUE(p.copies.empty());
+  EXPECT_EQ(p.uris[0], "a/albedo.png");
+  EXPECT_EQ(p.uris[1], "b/albedo.png");
+}
+
+TEST_F(ImageExportTest, FailedCopyLeavesNothingBehind)
+{
+  const fs::path                            dst  = m_root / "out" / "images" / "gone.png";
+  const std::vector<nvvkgltf::ImageCopyJob> jobs = {{m_src / "does_not_exist.png", dst}};
+  std::vector<nvvkgltf::ImageCopyOutcome>   outcomes;
+  const nvvkgltf::ImageCopyStats            stats = nvvkgltf::copyImages(jobs, 2, &outcomes);
+  EXPECT_EQ(stats.failed, 1u);
+  ASSERT_EQ(outcomes.size(), 1u);
+  EXPECT_EQ(outcomes[0], nvvkgltf::ImageCopyOutcome::eFailed);
+  EXPECT_FALSE(fs::exists(dst));
+  EXPECT_TRUE(snapshotTree(m_root / "out").empty());
+}
+
+TEST(ImageExport, HashFollowsContent)
+{
+  const fs::path dir = fs::temp_directory_path() / "gltf_renderer_tests" / "image_hash";
+  writeFile(dir / "x.bin", "same");
+  writeFile(dir / "y.bin", "same");
+  writeFile(dir / "z.bin", "diff");
+  uint64_t x = 0, y = 0, z = 0;
+  ASSERT_TRUE(nvvkgltf::hashFileContent(dir / "x.bin", x));
+  ASSERT_TRUE(nvvkgltf::hashFileContent(dir / "y.bin", y));
+  ASSERT_TRUE(nvvkgltf::hashFileContent(dir / "z.bin", z));
+  EXPECT_EQ(x, y);
+  EXPECT_NE(x, z);
+  EXPECT_FALSE(nvvkgltf::hashFileContent(dir / "none.bin", x));
+  fs::remove_all(dir);
+}
+
+TEST(ImageExport, SameContentComparesBytes)
+{
+  const fs::path dir = fs::temp_directory_path() / "gltf_renderer_tests" / "image_compare";
+  // Past one read chunk, differing only in the last byte
+  const std::string large(200000, 'a');
+  writeFile(dir / "x.bin", large);
+  writeFile(dir / "y.bin", large);
+  writeFile(dir / "z.bin", large.substr(0, large.size() - 1) + "b");
+  writeFile(dir / "short.bin", large.substr(0, 1000));
+  EXPECT_TRUE(nvvkgltf::sameFileContent(dir / "x.bin", dir / "y.bin"));
+  EXPECT_FALSE(nvvkgltf::sameFileContent(dir / "x.bin", dir / "z.bin"));
+  EXPECT_FALSE(nvvkgltf::sameFileContent(dir / "x.bin", dir / "short.bin"));
+  EXPECT_FALSE(nvvkgltf::sameFileContent(dir / "short.bin", dir / "x.bin"));
+  EXPECT_FALSE(nvvkgltf::sameFileContent(dir / "x.bin", dir / "none.bin"));
+  fs::remove_all(dir);
+}
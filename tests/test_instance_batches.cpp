@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// EXT_mesh_gpu_instancing: an instanced primitive is one InstanceBatch over a contiguous range of
+// render nodes. World matrices are generated from the batch, and moving the parent of a large batch
+// sets one dirty flag instead of inserting every instance.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_editor.hpp"
+
+using namespace gltf_test;
+
+namespace {
+
+constexpr int kInstanceCount = 1000;
+
+glm::vec3 instanceTranslation(int i)
+{
+  return {float(i % 10), 0.0f, float(i / 10)};
+}
+
+// Box.glb with its mesh node instanced kInstanceCount times under a new "Forest" root, plus a plain
+// root node sharing the mesh
+struct InstancedBox
+{
+  nvvkgltf::Scene scene;
+  int             instancedNode = -1;
+  int             forestNode    = -1;
+  int             plainNode     = -1;
+};
+
+bool loadInstancedBox(InstancedBox& box)
+{
+  nvvkgltf::Scene source;
+  try
+  {
+    if(!source.load(TestResources::getResourcePath("Box.glb")))
+      return false;
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+
+  tinygltf::Model model = source.getModel();
+  for(size_t n = 0; n < model.nodes.size() && box.instancedNode < 0; n++)
+  {
+    if(model.nodes[n].mesh >= 0)
+      box.instancedNode = int(n);
+  }
+  if(box.instancedNode < 0)
+    return false;
+
+  std::vector<glm::vec3> translations(kInstanceCount);
+  for(int i = 0; i < kInstanceCount; i++)
+    translations[i] = instanceTranslation(i);
+
+  tinygltf::Buffer buffer;
+  buffer.data.resize(translations.size() * sizeof(glm::vec3));
+  std::memcpy(buffer.data.data(), translations.data(), buffer.data.size());
+  tinygltf::BufferView view;
+  view.buffer     = int(model.buffers.size());
+  view.byteLength = buffer.data.size();
+  model.buffers.push_back(std::move(buffer));
+  tinygltf::Accessor accessor;
+  accessor.bufferView    = int(model.bufferViews.size());
+  accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type          = TINYGLTF_TYPE_VEC3;
+  accessor.count         = translations.size();
+  model.bufferViews.push_back(view);
+  model.accessors.push_back(accessor);
+
+  tinygltf::Value::Object attributes{{"TRANSLATION", tinygltf::Value(int(model.accessors.size()) - 1)}};
+  tinygltf::Value::Object extension{{"attributes", tinygltf::Value(attributes)}};
+  model.nodes[box.instancedNode].extensions[EXT_MESH_GPU_INSTANCING_EXTENSION_NAME] = tinygltf::Value(extension);
+  model.extensionsUsed.push_back(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+
+  tinygltf::Node forest;
+  forest.name     = "Forest";
+  forest.children = {box.instancedNode};
+  box.forestNode  = int(model.nodes.size());
+  model.nodes.push_back(forest);
+
+  tinygltf::Node plain;
+  plain.name     = "Plain";
+  plain.mesh     = model.nodes[box.instancedNode].mesh;
+  box.plainNode  = int(model.nodes.size());
+  model.nodes.push_back(plain);
+
+  std::vector<int>& roots = model.scenes[0].nodes;
+  std::replace(roots.begin(), roots.end(), box.instancedNode, box.forestNode);
+  roots.push_back(box.plainNode);
+
+  box.scene.takeModel(std::move(model));
+  return box.scene.valid();
+}
+
+void expectMatrixNear(const glm::mat4& actual, const glm::mat4& expected, int renderNodeID)
+{
+  for(int c = 0; c < 4; c++)
+    for(int r = 0; r < 4; r++)
+      EXPECT_NEAR(actual[c][r], expected[c][r], 1e-5f) << "render node " << renderNodeID;
+}
+
+}  // namespace
+
+TEST(InstanceBatches, InstancedPrimitiveIsOneBatch)
+{
+  InstancedBox box;
+  if(!loadInstancedBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  const nvvkgltf::RenderNodeRegistry& registry = box.scene.getRenderNodeRegistry();
+  ASSERT_EQ(registry.getInstanceBatches().size(), 1u) << "One primitive, one batch";
+  const nvvkgltf::InstanceBatch& batch = registry.getInstanceBatches()[0];
+  EXPECT_EQ(batch.nodeID, box.instancedNode);
+  EXPECT_EQ(batch.primIndex, 0);
+  EXPECT_EQ(batch.instanceCount, kInstanceCount);
+  EXPECT_EQ(box.scene.getRenderNodes().size(), size_t(kInstanceCount) + 1);
+
+  ASSERT_EQ(registry.getInstanceBatchesForNode(box.instancedNode).size(), 1u);
+  EXPECT_TRUE(registry.getInstanceBatchesForNode(box.plainNode).empty());
+  EXPECT_EQ(registry.findInstanceBatch(batch.firstRenderNode + kInstanceCount - 1), &batch);
+  EXPECT_EQ(registry.findInstanceBatch(-1), nullptr);
+
+  const int plainRenderNode = registry.getRenderNodeID(box.plainNode, 0);
+  ASSERT_GE(plainRenderNode, 0);
+  EXPECT_FALSE(batch.contains(plainRenderNode));
+  EXPECT_EQ(registry.findInstanceBatch(plainRenderNode), nullptr);
+
+  const auto world = box.scene.getRenderNodes().worldMatrices();
+  for(int i = 0; i < kInstanceCount; i++)
+  {
+    const glm::mat4 expected = box.scene.getNodesWorldMatrices()[box.instancedNode] * glm::translate(glm::mat4(1.0f), instanceTranslation(i));
+    expectMatrixNear(world[batch.firstRenderNode + i], expected, batch.firstRenderNode + i);
+  }
+}
+
+TEST(InstanceBatches, ParentMoveRegeneratesInstancesWithOneFlag)
+{
+  InstancedBox box;
+  if(!loadInstancedBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  box.scene.clearDirtyFlags();
+  box.scene.editor().setNodeTRS(box.forestNode, glm::vec3(0.0f, 5.0f, 0.0f), {1, 0, 0, 0}, {1, 1, 1});
+  box.scene.updateNodeWorldMatrices();
+
+  const nvvkgltf::InstanceBatch& batch = box.scene.getRenderNodeRegistry().getInstanceBatches()[0];
+  const auto                     world = box.scene.getRenderNodes().worldMatrices();
+  for(int i = 0; i < kInstanceCount; i++)
+  {
+    const glm::mat4 expected = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 5.0f, 0.0f) + instanceTranslation(i));
+    expectMatrixNear(world[batch.firstRenderNode + i], expected, batch.firstRenderNode + i);
+  }
+
+  const auto& df = box.scene.getDirtyFlags();
+  EXPECT_TRUE(df.allRenderNodesVk);
+  EXPECT_TRUE(df.allRenderNodesRtx);
+  EXPECT_TRUE(df.renderNodesVk.empty()) << "No per-instance entries";
+  EXPECT_TRUE(df.renderNodesRtx.empty());
+  EXPECT_FALSE(df.allRenderNodesDirty) << "Same render-node structure";
+  EXPECT_TRUE(df.renderNodesVkDirty());
+  EXPECT_FALSE(df.isEmpty());
+
+  box.scene.clearDirtyFlags();
+  EXPECT_TRUE(box.scene.getDirtyFlags().isEmpty());
+}
+
+TEST(InstanceBatches, SmallMoveMarksRenderNodes)
+{
+  InstancedBox box;
+  if(!loadInstancedBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  box.scene.clearDirtyFlags();
+  box.scene.editor().setNodeTRS(box.plainNode, glm::vec3(1.0f, 2.0f, 3.0f), {1, 0, 0, 0}, {1, 1, 1});
+  box.scene.updateNodeWorldMatrices();
+
+  const int   plainRenderNode = box.scene.getRenderNodeRegistry().getRenderNodeID(box.plainNode, 0);
+  const auto& df              = box.scene.getDirtyFlags();
+  EXPECT_FALSE(df.allRenderNodesVk);
+  EXPECT_FALSE(df.allRenderNodesRtx);
+  EXPECT_EQ(df.renderNodesVk, std::unordered_set<int>{plainRenderNode});
+  EXPECT_EQ(df.renderNodesRtx, std::unordered_set<int>{plainRenderNode});
+  expectMatrixNear(box.scene.getRenderNodes().worldMatrices()[plainRenderNode],
+                   glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)), plainRenderNode);
+}
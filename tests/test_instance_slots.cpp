@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// TLAS instance slot policy (no Vulkan): headroom, compaction threshold.
+
+#include <gtest/gtest.h>
+#include "gltf_instance_slots.hpp"
+
+using nvvkgltf::InstanceSlotAllocator;
+
+namespace {
+
+InstanceSlotAllocator::Policy smallPolicy()
+{
+  InstanceSlotAllocator::Policy policy;
+  policy.growthFactor     = 1.5f;
+  policy.minCapacity      = 4;
+  policy.compactThreshold = 0.5f;
+  return policy;
+}
+
+}  // namespace
+
+TEST(InstanceSlots, ResetLeavesHeadroom)
+{
+  InstanceSlotAllocator slots(smallPolicy());
+  slots.reset(100);
+  EXPECT_EQ(slots.capacity(), 150u);
+  EXPECT_EQ(slots.activeCount(), 100u);
+  EXPECT_EQ(slots.parkedCount(), 50u);
+  EXPECT_TRUE(slots.isActive(99));
+  EXPECT_FALSE(slots.isActive(100));
+
+  slots.reset(0);
+  EXPECT_EQ(slots.capacity(), 4u) << "Minimum capacity, so an empty scene still has an (inactive) instance";
+}
+
+TEST(InstanceSlots, ResizeWithinCapacityIsInPlace)
+{
+  InstanceSlotAllocator slots(smallPolicy());
+  slots.reset(100);  // Capacity 150
+
+  // Adds and deletes within the headroom touch no storage
+  EXPECT_EQ(slots.resize(120), InstanceSlotAllocator::Change::eInPlace);
+  EXPECT_EQ(slots.resize(149), InstanceSlotAllocator::Change::eInPlace);
+  EXPECT_EQ(slots.resize(90), InstanceSlotAllocator::Change::eInPlace);
+  EXPECT_EQ(slots.capacity(), 150u);
+  EXPECT_EQ(slots.activeCount(), 90u);
+  EXPECT_TRUE(slots.isActive(89));
+  EXPECT_FALSE(slots.isActive(90));
+}
+
+TEST(InstanceSlots, ResizePastCapacityReallocates)
+{
+  InstanceSlotAllocator slots(smallPolicy());
+  slots.reset(100);
+  EXPECT_EQ(slots.resize(151), InstanceSlotAllocator::Change::eReallocate);
+  EXPECT_EQ(slots.activeCount(), 151u);
+  EXPECT_GE(slots.capacity(), 226u);
+}
+
+TEST(InstanceSlots, CompactsOnlyPastThreshold)
+{
+  InstanceSlotAllocator slots(smallPolicy());
+  slots.reset(100);  // Capacity 150
+
+  // 75 / 150 parked: exactly at the threshold, not past it
+  EXPECT_EQ(slots.resize(75), InstanceSlotAllocator::Change::eInPlace);
+  EXPECT_FALSE(slots.needsCompaction());
+
+  // 76 / 150 parked: compacted, capacity shrinks back to the headroom for 74 slots
+  EXPECT_EQ(slots.resize(74), InstanceSlotAllocator::Change::eReallocate);
+  EXPECT_EQ(slots.capacity(), slots.capacityFor(74));
+  EXPECT_FALSE(slots.needsCompaction());
+}
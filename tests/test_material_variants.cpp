@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// KHR_materials_variants: the variant table holds only the render nodes with mappings, a switch
+// applies the resolved materials and marks exactly the render nodes that changed.
+
+#include <gtest/gtest.h>
+
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_editor.hpp"
+
+using namespace gltf_test;
+
+namespace {
+
+constexpr int kMappedNodes = 3;
+constexpr int kPlainNodes  = 20;
+
+// Box.glb with three variants: variant 0 -> material 1, variant 1 -> material 2, variant 2 not
+// mapped. kMappedNodes nodes draw the mapped mesh, kPlainNodes a copy of it without mappings.
+struct VariantBox
+{
+  nvvkgltf::Scene  scene;
+  std::vector<int> mappedNodes;
+  std::vector<int> plainNodes;
+};
+
+bool loadVariantBox(VariantBox& box)
+{
+  nvvkgltf::Scene source;
+  try
+  {
+    if(!source.load(TestResources::getResourcePath("Box.glb")))
+      return false;
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+
+  tinygltf::Model model = source.getModel();
+  if(model.meshes.empty() || model.materials.empty())
+    return false;
+  model.materials.resize(4, model.materials[0]);
+
+  tinygltf::Mesh plainMesh = model.meshes[0];
+  plainMesh.primitives[0].extensions.erase(KHR_MATERIALS_VARIANTS_EXTENSION_NAME);
+  const int plainMeshID = int(model.meshes.size());
+  model.meshes.push_back(plainMesh);
+
+  tinygltf::Value::Array variants;
+  for(const char* name : {"Red", "Green", "Blue"})
+    variants.emplace_back(tinygltf::Value::Object{{"name", tinygltf::Value(std::string(name))}});
+  model.extensions[KHR_MATERIALS_VARIANTS_EXTENSION_NAME] = tinygltf::Value(tinygltf::Value::Object{{"variants", tinygltf::Value(variants)}});
+  model.extensionsUsed.push_back(KHR_MATERIALS_VARIANTS_EXTENSION_NAME);
+
+  tinygltf::Value::Array mappings;
+  for(int v : {0, 1})
+  {
+    mappings.emplace_back(tinygltf::Value::Object{{"material", tinygltf::Value(v + 1)},
+                                                  {"variants", tinygltf::Value(tinygltf::Value::Array{tinygltf::Value(v)})}});
+  }
+  model.meshes[0].primitives[0].material = 0;
+  model.meshes[0].primitives[0].extensions[KHR_MATERIALS_VARIANTS_EXTENSION_NAME] =
+      tinygltf::Value(tinygltf::Value::Object{{"mappings", tinygltf::Value(mappings)}});
+
+  tinygltf::Scene scene;
+  for(int i = 0; i < kMappedNodes + kPlainNodes; i++)
+  {
+    tinygltf::Node node;
+    node.mesh        = i < kMappedNodes ? 0 : plainMeshID;
+    node.translation = {double(i), 0.0, 0.0};
+    (i < kMappedNodes ? box.mappedNodes : box.plainNodes).push_back(int(model.nodes.size()));
+    scene.nodes.push_back(int(model.nodes.size()));
+    model.nodes.push_back(node);
+  }
+  model.scenes       = {scene};
+  model.defaultScene = 0;
+
+  box.scene.takeModel(std::move(model));
+  return box.scene.valid();
+}
+
+int materialOf(const VariantBox& box, int nodeID)
+{
+  const int rnID = box.scene.getRenderNodeRegistry().getRenderNodeID(nodeID, 0);
+  return rnID < 0 ? -1 : box.scene.getRenderNodes().materialIDs()[rnID];
+}
+
+}  // namespace
+
+TEST(MaterialVariants, TableHoldsMappedRenderNodesOnly)
+{
+  VariantBox box;
+  if(!loadVariantBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  const nvvkgltf::Scene::VariantMaterialTable& table = box.scene.getVariantMaterialTable();
+  EXPECT_EQ(table.variantCount, 3);
+  EXPECT_EQ(table.renderNodes.size(), size_t(kMappedNodes));
+  EXPECT_EQ(table.rows, std::vector<int>(kMappedNodes, 0)) << "One row shared by the nodes drawing the primitive";
+  EXPECT_EQ(table.materials, (std::vector<int>{1, 2, 0, 0}));
+  EXPECT_EQ(table.renderNodeCount, box.scene.getRenderNodes().size());
+  for(int nodeID : box.mappedNodes)
+    EXPECT_EQ(materialOf(box, nodeID), 1) << "Variant 0 is current after load";
+}
+
+TEST(MaterialVariants, SwitchAppliesResolvedMaterials)
+{
+  VariantBox box;
+  if(!loadVariantBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  const struct
+  {
+    int variant;
+    int material;
+  } cases[] = {{1, 2}, {2, 0}, {0, 1}, {7, 0}, {-1, 0}};
+  for(const auto& c : cases)
+  {
+    box.scene.setCurrentVariant(c.variant);
+    EXPECT_EQ(box.scene.getCurrentVariant(), c.variant);
+    for(int nodeID : box.mappedNodes)
+      EXPECT_EQ(materialOf(box, nodeID), c.material) << "variant " << c.variant;
+    for(int nodeID : box.plainNodes)
+      EXPECT_EQ(materialOf(box, nodeID), 0) << "variant " << c.variant;
+  }
+}
+
+TEST(MaterialVariants, SwitchMarksChangedRenderNodes)
+{
+  VariantBox box;
+  if(!loadVariantBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  box.scene.clearDirtyFlags();
+  const uint64_t revision = box.scene.getSceneGraphRevision();
+  box.scene.setCurrentVariant(1);
+
+  std::unordered_set<int> expected;
+  for(int nodeID : box.mappedNodes)
+    expected.insert(box.scene.getRenderNodeRegistry().getRenderNodeID(nodeID, 0));
+  const auto& df = box.scene.getDirtyFlags();
+  EXPECT_EQ(df.renderNodesVk, expected);
+  EXPECT_FALSE(df.allRenderNodesVk) << "3 of 23 render nodes is below the full-update ratio";
+  EXPECT_GT(box.scene.getSceneGraphRevision(), revision);
+
+  // Same variant again: nothing to do
+  box.scene.clearDirtyFlags();
+  const uint64_t switched = box.scene.getSceneGraphRevision();
+  box.scene.setCurrentVariant(1);
+  EXPECT_TRUE(box.scene.getDirtyFlags().isEmpty());
+  EXPECT_EQ(box.scene.getSceneGraphRevision(), switched);
+}
+
+TEST(MaterialVariants, TableFollowsMaterialEdits)
+{
+  VariantBox box;
+  if(!loadVariantBox(box))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  box.scene.editor().setPrimitiveMaterial(0, 0, 3);
+  box.scene.setCurrentVariant(2);  // Not mapped: the primitive's own material, now 3
+  for(int nodeID : box.mappedNodes)
+    EXPECT_EQ(materialOf(box, nodeID), 3);
+  EXPECT_EQ(box.scene.getVariantMaterialTable().materials, (std::vector<int>{1, 2, 0, 3}));
+
+  box.scene.setCurrentVariant(0);
+  for(int nodeID : box.mappedNodes)
+    EXPECT_EQ(materialOf(box, nodeID), 1);
+}
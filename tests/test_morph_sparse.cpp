@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Sparse morph targets: compaction, preserved glTF sparse accessors, CPU blend vs. dense
+// reference, and the vertex-major layout of the compute shader.
+
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <tinygltf/tiny_gltf.h>
+
+#include "gltf_morph_sparse.hpp"
+
+using nvvkgltf::SparseMorphTargets;
+
+namespace {
+
+// Dense deltas of `vertexCount` vertices with a few moved ones
+std::vector<glm::vec3> denseDeltas(uint32_t vertexCount, std::initializer_list<std::pair<uint32_t, glm::vec3>> moved)
+{
+  std::vector<glm::vec3> deltas(vertexCount, glm::vec3(0.0f));
+  for(const auto& [v, delta] : moved)
+    deltas[v] = delta;
+  return deltas;
+}
+
+// Reference blend: every target expanded to all vertices
+void denseBlend(const std::vector<std::vector<glm::vec3>>& targets, const std::vector<float>& weights, std::vector<glm::vec3>& positions)
+{
+  for(size_t t = 0; t < targets.size(); t++)
+    for(size_t v = 0; v < positions.size(); v++)
+      positions[v] += weights[t] * targets[t][v];
+}
+
+// Append raw bytes as a buffer view of buffer 0
+int addBufferView(tinygltf::Model& model, const void* data, size_t bytes)
+{
+  if(model.buffers.empty())
+    model.buffers.emplace_back();
+  auto&        buffer = model.buffers[0].data;
+  const size_t offset = buffer.size();
+  buffer.resize(offset + bytes);
+  std::memcpy(buffer.data() + offset, data, bytes);
+
+  tinygltf::BufferView view;
+  view.buffer     = 0;
+  view.byteOffset = offset;
+  view.byteLength = bytes;
+  model.bufferViews.push_back(view);
+  return static_cast<int>(model.bufferViews.size()) - 1;
+}
+
+// VEC3 float accessor with no buffer view: all zero except the sparse (index, value) pairs
+int addSparseOnlyAccessor(tinygltf::Model& model, size_t count, const std::vector<uint32_t>& indices, const std::vector<glm::vec3>& values)
+{
+  tinygltf::Accessor accessor;
+  accessor.componentType                = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type                         = TINYGLTF_TYPE_VEC3;
+  accessor.count                        = count;
+  accessor.sparse.isSparse              = true;
+  accessor.sparse.count                 = static_cast<int>(indices.size());
+  accessor.sparse.indices.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+  accessor.sparse.indices.bufferView    = addBufferView(model, indices.data(), indices.size() * sizeof(uint32_t));
+  accessor.sparse.values.bufferView     = addBufferView(model, values.data(), values.size() * sizeof(glm::vec3));
+  model.accessors.push_back(accessor);
+  return static_cast<int>(model.accessors.size()) - 1;
+}
+
+int addDenseAccessor(tinygltf::Model& model, const std::vector<glm::vec3>& values)
+{
+  tinygltf::Accessor accessor;
+  accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type          = TINYGLTF_TYPE_VEC3;
+  accessor.count         = values.size();
+  accessor.bufferView    = addBufferView(model, values.data(), values.size() * sizeof(glm::vec3));
+  model.accessors.push_back(accessor);
+  return static_cast<int>(model.accessors.size()) - 1;
+}
+
+}  // namespace
+
+TEST(MorphSparse, CompactKeepsNonZeroDeltas)
+{
+  const auto deltas = SparseMorphTargets::compact(denseDeltas(6, {{1, {1, 0, 0}}, {4, {0, -2, 0}}}));
+  ASSERT_EQ(deltas.indices.size(), 2u);
+  EXPECT_EQ(deltas.indices[0], 1u);
+  EXPECT_EQ(deltas.indices[1], 4u);
+  EXPECT_EQ(deltas.values[1], glm::vec3(0, -2, 0));
+}
+
+TEST(MorphSparse, AddTargetMergesAttributes)
+{
+  SparseMorphTargets morph;
+  morph.vertexCount = 8;
+  morph.addTarget(SparseMorphTargets::compact(denseDeltas(8, {{2, {1, 1, 1}}, {5, {2, 0, 0}}})),
+                  SparseMorphTargets::compact(denseDeltas(8, {{3, {0, 0, 1}}, {5, {0, 1, 0}}})), {});
+
+  ASSERT_EQ(morph.targets.size(), 1u);
+  const SparseMorphTargets::Target& target = morph.targets[0];
+  EXPECT_EQ(target.indices, (std::vector<uint32_t>{2, 3, 5}));
+  EXPECT_EQ(target.positions[1], glm::vec3(0.0f)) << "Vertex 3 only has a normal delta";
+  EXPECT_EQ(target.normals[2], glm::vec3(0, 1, 0));
+  EXPECT_TRUE(target.tangents.empty());
+  EXPECT_TRUE(morph.hasNormals());
+  EXPECT_FALSE(morph.hasTangents());
+}
+
+TEST(MorphSparse, ZeroAndOutOfRangeEntriesAreDropped)
+{
+  SparseMorphTargets morph;
+  morph.vertexCount = 4;
+  SparseMorphTargets::Deltas positions;
+  positions.indices = {0, 2, 9};
+  positions.values  = {glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(1.0f)};
+  morph.addTarget(positions, {}, {});
+  EXPECT_EQ(morph.targets[0].indices, (std::vector<uint32_t>{2}));
+}
+
+TEST(MorphSparse, SparseAccessorIsPreserved)
+{
+  tinygltf::Model model;
+  const int       sparse = addSparseOnlyAccessor(model, 1000, {10, 500, 999}, {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}});
+  const int       dense  = addDenseAccessor(model, denseDeltas(1000, {{7, {3, 3, 3}}}));
+
+  SparseMorphTargets morph;
+  morph.vertexCount = 1000;
+  morph.addTarget(model, sparse, -1, -1);
+  morph.addTarget(model, dense, sparse, -1);
+
+  EXPECT_EQ(morph.targets[0].indices, (std::vector<uint32_t>{10, 500, 999}));
+  EXPECT_EQ(morph.targets[0].positions[2], glm::vec3(0, 0, 1));
+  EXPECT_EQ(morph.targets[1].indices, (std::vector<uint32_t>{7, 10, 500, 999}));
+  EXPECT_EQ(morph.nonZeroCount(), 7u);
+  EXPECT_LT(morph.sizeInBytes(), morph.denseSizeInBytes() / 100);
+}
+
+TEST(MorphSparse, MismatchedAccessorCountIsIgnored)
+{
+  tinygltf::Model model;
+  const int       accessor = addDenseAccessor(model, denseDeltas(3, {{1, {1, 0, 0}}}));
+
+  SparseMorphTargets morph;
+  morph.vertexCount = 4;
+  morph.addTarget(model, accessor, -1, -1);
+  ASSERT_EQ(morph.targets.size(), 1u) << "Target kept so indices still match the mesh weights";
+  EXPECT_TRUE(morph.targets[0].indices.empty());
+}
+
+TEST(MorphSparse, ApplyMatchesDenseBlend)
+{
+  const uint32_t                      vertexCount = 64;
+  std::vector<std::vector<glm::vec3>> dense       = {
+      denseDeltas(vertexCount, {{0, {1, 0, 0}}, {10, {0, 2, 0}}, {63, {0, 0, 3}}}),
+      denseDeltas(vertexCount, {{10, {0.5f, 0, 0}}, {11, {0, 0, -1}}}),
+      denseDeltas(vertexCount, {{20, {4, 4, 4}}}),
+  };
+  SparseMorphTargets morph;
+  morph.vertexCount = vertexCount;
+  for(const auto& target : dense)
+    morph.addTarget(SparseMorphTargets::compact(target), {}, {});
+
+  const std::vector<float> weights = {0.25f, 0.0f, 1.5f};
+  std::vector<glm::vec3>   expected(vertexCount, glm::vec3(1.0f));
+  std::vector<glm::vec3>   positions(vertexCount, glm::vec3(1.0f));
+  denseBlend(dense, weights, expected);
+  morph.apply(weights, positions, {}, {});
+
+  for(uint32_t v = 0; v < vertexCount; v++)
+    EXPECT_EQ(positions[v], expected[v]) << "vertex " << v;
+}
+
+TEST(MorphSparse, ApplyHonorsShortWeightList)
+{
+  SparseMorphTargets morph;
+  morph.vertexCount = 2;
+  morph.addTarget(SparseMorphTargets::compact(denseDeltas(2, {{0, {1, 0, 0}}})), {}, {});
+  morph.addTarget(SparseMorphTargets::compact(denseDeltas(2, {{0, {0, 1, 0}}})), {}, {});
+
+  std::vector<glm::vec3> positions(2, glm::vec3(0.0f));
+  morph.apply(std::vector<float>{1.0f}, positions, {}, {});
+  EXPECT_EQ(positions[0], glm::vec3(1, 0, 0)) << "Targets without a weight are not applied";
+}
+
+TEST(MorphSparse, VertexMajorMatchesTargetMajor)
+{
+  const uint32_t     vertexCount = 32;
+  SparseMorphTargets morph;
+  morph.vertexCount = vertexCount;
+  for(uint32_t t = 0; t < 5; t++)
+  {
+    std::vector<glm::vec3> pos(vertexCount, glm::vec3(0.0f)), nrm(vertexCount, glm::vec3(0.0f)), tan(vertexCount, glm::vec3(0.0f));
+    for(uint32_t v = t; v < vertexCount; v += 3 + t)
+    {
+      pos[v] = glm::vec3(float(t) + 0.1f, float(v) * 0.01f, -1.0f);
+      nrm[(v + 1) % vertexCount] = glm::vec3(0.0f, 0.3f, float(t));
+      tan[v] = glm::vec3(0.2f, 0.0f, 0.0f);
+    }
+    morph.addTarget(SparseMorphTargets::compact(pos), SparseMorphTargets::compact(nrm), SparseMorphTargets::compact(tan));
+  }
+
+  const std::vector<float> weights = {0.3f, 0.0f, -0.7f, 1.0f, 0.5f};
+  std::vector<glm::vec3>   posA(vertexCount, glm::vec3(1.0f)), nrmA(vertexCount, glm::vec3(0, 0, 1));
+  std::vector<glm::vec4>   tanA(vertexCount, glm::vec4(1, 0, 0, -1));
+  std::vector<glm::vec3>   posB = posA, nrmB = nrmA;
+  std::vector<glm::vec4>   tanB = tanA;
+
+  const SparseMorphTargets::VertexMajor csr = morph.toVertexMajor(5, true, true);
+  ASSERT_EQ(csr.rowStart.size(), vertexCount + 1u);
+  EXPECT_EQ(csr.rowStart.back(), morph.nonZeroCount());
+  for(uint32_t v = 0; v < vertexCount; v++)
+    for(uint32_t e = csr.rowStart[v]; e + 1 < csr.rowStart[v + 1]; e++)
+      EXPECT_LT(csr.targets[e], csr.targets[e + 1]) << "Targets ascending within a vertex";
+
+  morph.apply(weights, posA, nrmA, tanA);
+  csr.apply(weights, posB, nrmB, tanB);
+  for(uint32_t v = 0; v < vertexCount; v++)
+  {
+    EXPECT_EQ(posA[v], posB[v]) << "vertex " << v;
+    EXPECT_EQ(nrmA[v], nrmB[v]) << "vertex " << v;
+    EXPECT_EQ(tanA[v], tanB[v]) << "vertex " << v;
+  }
+}
+
+TEST(MorphSparse, VertexMajorDropsTargetsWithoutWeightsAndUnusedAttributes)
+{
+  SparseMorphTargets morph;
+  morph.vertexCount = 4;
+  morph.addTarget(SparseMorphTargets::compact(denseDeltas(4, {{1, {1, 0, 0}}})),
+                  SparseMorphTargets::compact(denseDeltas(4, {{1, {0, 1, 0}}})), {});
+  morph.addTarget(SparseMorphTargets::compact(denseDeltas(4, {{2, {1, 0, 0}}})), {}, {});
+
+  const SparseMorphTargets::VertexMajor csr = morph.toVertexMajor(1, false, true);
+  EXPECT_EQ(csr.targets.size(), 1u);
+  EXPECT_TRUE(csr.normals.empty()) << "Normals not requested";
+  EXPECT_TRUE(csr.tangents.empty()) << "No target has tangent deltas";
+  EXPECT_EQ(csr.sizeInBytes(), 5 * sizeof(uint32_t) + sizeof(uint32_t) + sizeof(glm::vec3));
+}
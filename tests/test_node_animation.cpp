@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// GPU node animation: NodeAnimationTable is the CPU reference of node_animation.comp.slang.
+// These tests check the table built by AnimationSystem against the CPU channel evaluation
+// (AnimationSystem::updateAnimation) on a synthetic model covering all interpolation modes.
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <glm/gtc/quaternion.hpp>
+#include <tinygltf/tiny_gltf.h>
+
+#include "gltf_node_animation.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_animation.hpp"
+#include "tinygltf_utils.hpp"
+
+namespace {
+
+// Append `data` to buffer 0 and return the index of a FLOAT accessor of `type` over it.
+int addAccessor(tinygltf::Model& model, const std::vector<float>& data, int type)
+{
+  if(model.buffers.empty())
+    model.buffers.emplace_back();
+  tinygltf::Buffer& buffer = model.buffers[0];
+
+  tinygltf::BufferView view;
+  view.buffer     = 0;
+  view.byteOffset = buffer.data.size();
+  view.byteLength = data.size() * sizeof(float);
+  buffer.data.resize(buffer.data.size() + view.byteLength);
+  std::memcpy(buffer.data.data() + view.byteOffset, data.data(), view.byteLength);
+  model.bufferViews.push_back(view);
+
+  const int components = (type == TINYGLTF_TYPE_VEC4) ? 4 : (type == TINYGLTF_TYPE_VEC3) ? 3 : 1;
+
+  tinygltf::Accessor accessor;
+  accessor.bufferView    = static_cast<int>(model.bufferViews.size()) - 1;
+  accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type          = type;
+  accessor.count         = data.size() / components;
+  model.accessors.push_back(accessor);
+  return static_cast<int>(model.accessors.size()) - 1;
+}
+
+void addChannel(tinygltf::Model&          model,
+                tinygltf::Animation&      anim,
+                int                       node,
+                const std::string&        path,
+                const std::string&        interpolation,
+                const std::vector<float>& times,
+                const std::vector<float>& values)
+{
+  const int type = (path == "rotation") ? TINYGLTF_TYPE_VEC4 : (path == "weights") ? TINYGLTF_TYPE_SCALAR : TINYGLTF_TYPE_VEC3;
+
+  tinygltf::AnimationSampler sampler;
+  sampler.input         = addAccessor(model, times, TINYGLTF_TYPE_SCALAR);
+  sampler.output        = addAccessor(model, values, type);
+  sampler.interpolation = interpolation;
+  anim.samplers.push_back(sampler);
+
+  tinygltf::AnimationChannel channel;
+  channel.sampler     = static_cast<int>(anim.samplers.size()) - 1;
+  channel.target_node = node;
+  channel.target_path = path;
+  anim.channels.push_back(channel);
+}
+
+// Nodes: 0 Parent (children 1, 2), 1 Spinner, 2 Bouncer, 3 Holder (child 4), 4 Lamp (light).
+// Animation 0 "Rigid"  : rigid TRS channels on 0, 1, 2 using linear, step and cubic-spline samplers.
+// Animation 1 "Weights": a weights channel (CPU only).
+// Animation 2 "Light"  : moves node 3, whose subtree holds a light (CPU only).
+tinygltf::Model makeAnimatedModel()
+{
+  tinygltf::Model model;
+
+  model.nodes.resize(5);
+  model.nodes[0].name        = "Parent";
+  model.nodes[0].translation = {1.0, 0.0, 0.0};
+  model.nodes[0].children    = {1, 2};
+  model.nodes[1].name        = "Spinner";
+  model.nodes[1].scale       = {2.0, 2.0, 2.0};
+  model.nodes[2].name        = "Bouncer";
+  model.nodes[2].rotation    = {0.0, 0.70710678, 0.0, 0.70710678};
+  model.nodes[3].name        = "Holder";
+  model.nodes[3].children    = {4};
+  model.nodes[4].name        = "Lamp";
+  model.nodes[4].light       = 0;
+
+  tinygltf::Light light;
+  light.type = "point";
+  model.lights.push_back(light);
+
+  model.scenes.emplace_back();
+  model.scenes[0].nodes = {0, 3};
+  model.defaultScene    = 0;
+
+  const std::vector<float> times = {0.0f, 0.5f, 1.0f, 2.0f};
+
+  tinygltf::Animation rigid;
+  rigid.name = "Rigid";
+  addChannel(model, rigid, 1, "rotation", "LINEAR", times,
+             {0.0f, 0.0f, 0.0f, 1.0f,                //
+              0.0f, 0.38268343f, 0.0f, 0.92387953f,  //
+              0.0f, 0.0f, 0.70710678f, 0.70710678f,  //
+              0.0f, 0.0f, -1.0f, 0.0f});
+  addChannel(model, rigid, 1, "translation", "STEP", times, {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 2, 0});
+  // Cubic spline: (in-tangent, value, out-tangent) per key
+  addChannel(model, rigid, 2, "translation", "CUBICSPLINE", times,
+             {0, 0, 0, 0, 0, 0, 0, 2, 0,   //
+              0, -1, 0, 0, 1, 0, 1, 0, 0,  //
+              0, 0, 1, 2, 1, 0, 0, 0, 0,   //
+              1, 1, 1, 0, 0, 3, 0, 0, 0});
+  addChannel(model, rigid, 2, "scale", "LINEAR", times, {1, 1, 1, 2, 1, 1, 2, 3, 1, 0.5f, 0.5f, 0.5f});
+  addChannel(model, rigid, 0, "scale", "LINEAR", {0.0f, 2.0f}, {1, 1, 1, 3, 3, 3});
+  model.animations.push_back(rigid);
+
+  tinygltf::Animation weights;
+  weights.name = "Weights";
+  addChannel(model, weights, 1, "weights", "LINEAR", {0.0f, 1.0f}, {0.0f, 1.0f});
+  model.animations.push_back(weights);
+
+  tinygltf::Animation lightAnim;
+  lightAnim.name = "Light";
+  addChannel(model, lightAnim, 3, "translation", "LINEAR", {0.0f, 1.0f}, {0, 0, 0, 0, 5, 0});
+  model.animations.push_back(lightAnim);
+
+  return model;
+}
+
+void expectMatrixNear(const glm::mat4& a, const glm::mat4& b, float tolerance)
+{
+  for(int c = 0; c < 4; ++c)
+    for(int r = 0; r < 4; ++r)
+      EXPECT_NEAR(a[c][r], b[c][r], tolerance) << "column " << c << " row " << r;
+}
+
+}  // namespace
+
+TEST(NodeAnimation, RigidAnimationIsEligible)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  ASSERT_EQ(scene.animation().getNumAnimations(), 3);
+
+  const nvvkgltf::NodeAnimationTable* table = scene.animation().prepareGpuNodeAnimation(0);
+  ASSERT_NE(table, nullptr);
+  EXPECT_EQ(table->targets.size(), 3u);  // Spinner, Bouncer, Parent
+  EXPECT_EQ(table->tracks.size(), 5u);
+  EXPECT_EQ(table->keyTimes.size(), 4u * 4u + 2u);
+  EXPECT_EQ(table->keyValues.size(), 4u + 4u + 12u + 4u + 2u);  // Cubic spline: 3 values per key
+}
+
+TEST(NodeAnimation, CpuOnlyAnimationsAreRejected)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+
+  EXPECT_EQ(scene.animation().prepareGpuNodeAnimation(1), nullptr) << "weights channel";
+  EXPECT_EQ(scene.animation().prepareGpuNodeAnimation(2), nullptr) << "light under an animated node";
+  EXPECT_EQ(scene.animation().prepareGpuNodeAnimation(7), nullptr) << "out of range";
+}
+
+// The reference evaluator must reproduce the CPU channel evaluation for every interpolation mode.
+TEST(NodeAnimation, TableMatchesCpuAnimation)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+
+  // Table built from the rest pose, before any CPU evaluation moved the nodes
+  const nvvkgltf::NodeAnimationTable table = *scene.animation().prepareGpuNodeAnimation(0);
+
+  nvvkgltf::AnimationInfo& info = scene.animation().getAnimationInfo(0);
+  for(float time : {0.0f, 0.1f, 0.5f, 0.75f, 1.0f, 1.3f, 1.99f, 2.0f})
+  {
+    info.currentTime = time;
+    ASSERT_TRUE(scene.animation().updateAnimation(0));
+
+    for(size_t i = 0; i < table.targets.size(); ++i)
+    {
+      const tinygltf::Node& node = scene.getModel().nodes[table.targets[i].nodeID];
+      SCOPED_TRACE(node.name + " at t=" + std::to_string(time));
+      expectMatrixNear(table.evaluateLocalMatrix(i, time), tinygltf::utils::getNodeMatrix(node), 1e-5f);
+    }
+  }
+}
+
+TEST(NodeAnimation, EvaluateWritesOnlyAnimatedNodes)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  const nvvkgltf::NodeAnimationTable* table = scene.animation().prepareGpuNodeAnimation(0);
+  ASSERT_NE(table, nullptr);
+
+  const glm::mat4        sentinel(7.0f);
+  std::vector<glm::mat4> locals(scene.getModel().nodes.size(), sentinel);
+  table->evaluate(0.75f, locals);
+
+  for(size_t nodeID = 0; nodeID < locals.size(); ++nodeID)
+  {
+    const bool animated = nodeID <= 2;
+    EXPECT_EQ(locals[nodeID] != sentinel, animated) << "node " << nodeID;
+  }
+}
+
+TEST(NodeAnimation, TimeIsClampedToKeyRange)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  const nvvkgltf::NodeAnimationTable* table = scene.animation().prepareGpuNodeAnimation(0);
+  ASSERT_NE(table, nullptr);
+
+  for(size_t i = 0; i < table->targets.size(); ++i)
+  {
+    expectMatrixNear(table->evaluateLocalMatrix(i, -1.0f), table->evaluateLocalMatrix(i, 0.0f), 1e-6f);
+    expectMatrixNear(table->evaluateLocalMatrix(i, 5.0f), table->evaluateLocalMatrix(i, 2.0f), 1e-6f);
+  }
+}
+
+// After GPU playback the model lags behind; the sync writes the animated TRS back and marks the nodes dirty.
+TEST(NodeAnimation, SyncToCpuWritesNodesAndMarksDirty)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  nvvkgltf::AnimationSystem&          anim  = scene.animation();
+  const nvvkgltf::NodeAnimationTable* table = anim.prepareGpuNodeAnimation(0);
+  ASSERT_NE(table, nullptr);
+
+  EXPECT_FALSE(anim.syncGpuNodeAnimationToCpu()) << "nothing played yet";
+
+  anim.getAnimationInfo(0).currentTime = 1.3f;
+  anim.markGpuNodeAnimationPlayed();
+  scene.clearDirtyFlags();
+
+  ASSERT_TRUE(anim.syncGpuNodeAnimationToCpu());
+  const auto& df = scene.getDirtyFlags();
+  for(const shaderio::NodeAnimTarget& target : table->targets)
+    EXPECT_TRUE(df.nodes.count(target.nodeID)) << "node " << target.nodeID;
+  EXPECT_FALSE(df.nodes.count(3));
+
+  for(size_t i = 0; i < table->targets.size(); ++i)
+    expectMatrixNear(tinygltf::utils::getNodeMatrix(scene.getModel().nodes[table->targets[i].nodeID]),
+                     table->evaluateLocalMatrix(i, 1.3f), 1e-5f);
+
+  // Un-animated paths keep their rest value
+  EXPECT_DOUBLE_EQ(scene.getModel().nodes[0].translation[0], 1.0);
+
+  EXPECT_FALSE(anim.syncGpuNodeAnimationToCpu()) << "already in sync";
+}
+
+// Dirty nodes only rebuild the table when the rest TRS of an animated node changed; the GPU-played
+// TRS are synced into the model before the table is dropped.
+TEST(NodeAnimation, InvalidateOnlyOnRestChange)
+{
+  nvvkgltf::Scene scene;
+  scene.takeModel(makeAnimatedModel());
+  nvvkgltf::AnimationSystem& anim = scene.animation();
+  ASSERT_NE(anim.prepareGpuNodeAnimation(0), nullptr);
+  const uint64_t revision = anim.getGpuNodeAnimationRevision();
+
+  // Synced animated paths and un-animated nodes leave the table valid
+  anim.getAnimationInfo(0).currentTime = 1.3f;
+  anim.markGpuNodeAnimationPlayed();
+  ASSERT_TRUE(anim.syncGpuNodeAnimationToCpu());
+  scene.markNodeDirty(3);
+  anim.invalidateGpuNodeAnimation(scene.getDirtyFlags().nodes);
+  ASSERT_NE(anim.prepareGpuNodeAnimation(0), nullptr);
+  EXPECT_EQ(anim.getGpuNodeAnimationRevision(), revision);
+
+  // Node 0 only animates its scale: moving it changes the rest translation of the table
+  anim.getAnimationInfo(0).currentTime = 1.7f;
+  anim.markGpuNodeAnimationPlayed();
+  scene.clearDirtyFlags();
+  scene.getModel().nodes[0].translation = {4.0, 0.0, 0.0};
+  scene.markNodeDirty(0);
+  anim.invalidateGpuNodeAnimation(scene.getDirtyFlags().nodes);
+  EXPECT_FALSE(anim.syncGpuNodeAnimationToCpu()) << "synced before the table was dropped";
+  EXPECT_NEAR(scene.getModel().nodes[0].scale[0], 2.7, 1e-5);
+
+  const nvvkgltf::NodeAnimationTable* table = anim.prepareGpuNodeAnimation(0);
+  ASSERT_NE(table, nullptr);
+  EXPECT_GT(anim.getGpuNodeAnimationRevision(), revision);
+  bool found = false;
+  for(const shaderio::NodeAnimTarget& target : table->targets)
+  {
+    if(target.nodeID == 0)
+    {
+      found = true;
+      EXPECT_FLOAT_EQ(target.restTranslation.x, 4.0f);
+    }
+  }
+  EXPECT_TRUE(found);
+}
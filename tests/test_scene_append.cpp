@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Scene::takeLastAppend(): the ranges a merge/reference appended, which the renderer uploads
+// on top of the existing GPU scene instead of rebuilding it.
+
+#include <gtest/gtest.h>
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+
+using namespace gltf_test;
+
+namespace {
+
+bool loadOrSkip(nvvkgltf::Scene& scene, const std::string& filename)
+{
+  try
+  {
+    return scene.load(TestResources::getResourcePath(filename));
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+}
+
+}  // namespace
+
+TEST(SceneAppend, MergeReportsAppendedRanges)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  const tinygltf::Model&                       model          = scene.getModel();
+  const size_t                                 meshCount      = model.meshes.size();
+  const size_t                                 materialCount  = model.materials.size();
+  const std::vector<nvvkgltf::RenderPrimitive> prevPrimitives = scene.getRenderPrimitives();
+  const size_t                                 prevNodeCount  = scene.getRenderNodes().size();
+  const std::vector<int> prevRenderPrimIDs(scene.getRenderNodes().renderPrimIDs().begin(),
+                                           scene.getRenderNodes().renderPrimIDs().end());
+
+  ASSERT_GE(scene.mergeScene(TestResources::getResourcePath("Box.glb")), 0);
+
+  const std::optional<nvvkgltf::SceneAppendInfo> info = scene.takeLastAppend();
+  ASSERT_TRUE(info.has_value()) << "A merge into a parsed scene only appends";
+  EXPECT_FALSE(scene.takeLastAppend().has_value()) << "Consumed once";
+
+  EXPECT_EQ(info->meshes.begin, meshCount);
+  EXPECT_EQ(info->meshes.end, model.meshes.size());
+  EXPECT_EQ(info->materials.begin, materialCount);
+  EXPECT_EQ(info->materials.end, model.materials.size());
+  EXPECT_EQ(info->renderPrimitives.begin, prevPrimitives.size());
+  EXPECT_EQ(info->renderPrimitives.end, scene.getNumRenderPrimitives());
+  EXPECT_EQ(info->renderNodes.begin, prevNodeCount);
+  EXPECT_EQ(info->renderNodes.end, scene.getRenderNodes().size());
+  EXPECT_FALSE(info->renderPrimitives.empty());
+  EXPECT_FALSE(info->renderNodes.empty());
+
+  // The prefix the GPU already holds is untouched
+  for(size_t i = 0; i < prevPrimitives.size(); i++)
+  {
+    EXPECT_EQ(scene.getRenderPrimitives()[i].meshID, prevPrimitives[i].meshID);
+    EXPECT_EQ(scene.getRenderPrimitives()[i].vertexCount, prevPrimitives[i].vertexCount);
+    EXPECT_EQ(scene.getRenderPrimitives()[i].indexCount, prevPrimitives[i].indexCount);
+  }
+  for(size_t i = 0; i < prevRenderPrimIDs.size(); i++)
+    EXPECT_EQ(scene.getRenderNodes().renderPrimIDs()[i], prevRenderPrimIDs[i]);
+
+  // Appending gives the same result as parsing the merged model from scratch
+  nvvkgltf::Scene fresh;
+  fresh.takeModel(tinygltf::Model(model));
+  ASSERT_EQ(fresh.getNumRenderPrimitives(), scene.getNumRenderPrimitives());
+  ASSERT_EQ(fresh.getRenderNodes().size(), scene.getRenderNodes().size());
+  for(size_t i = 0; i < fresh.getRenderNodes().size(); i++)
+  {
+    EXPECT_EQ(fresh.getRenderNodes().renderPrimIDs()[i], scene.getRenderNodes().renderPrimIDs()[i]);
+    EXPECT_EQ(fresh.getRenderNodes().materialIDs()[i], scene.getRenderNodes().materialIDs()[i]);
+  }
+}
+
+TEST(SceneAppend, SharedReferenceAppendsRenderNodesOnly)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  const auto path = TestResources::getResourcePath("Box.glb");
+  ASSERT_GE(scene.referenceScene(path), 0);
+  (void)scene.takeLastAppend();
+
+  const size_t primCount = scene.getNumRenderPrimitives();
+  ASSERT_GE(scene.referenceScene(path), 0) << "Second reference shares the first one's content";
+
+  const std::optional<nvvkgltf::SceneAppendInfo> info = scene.takeLastAppend();
+  ASSERT_TRUE(info.has_value());
+  EXPECT_TRUE(info->renderPrimitives.empty()) << "Geometry (and BLAS) is shared";
+  EXPECT_TRUE(info->meshes.empty());
+  EXPECT_TRUE(info->materials.empty());
+  EXPECT_EQ(scene.getNumRenderPrimitives(), primCount);
+  EXPECT_FALSE(info->renderNodes.empty());
+}
+
+TEST(SceneAppend, FailedMergeReportsNothing)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  EXPECT_LT(scene.mergeScene("/nonexistent/path/model.glb"), 0);
+  EXPECT_FALSE(scene.takeLastAppend().has_value());
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Scene descriptors: loading the model files concurrently must build the same scene, node for node,
+// as loading them one after another, with the instances placed in descriptor order.
+
+#include <gtest/gtest.h>
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+#include "scene_descriptor_loader.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+class SceneDescriptorLoaderTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const fs::path box = TestResources::getResourcePath("Box.glb");
+    if(!fs::exists(box))
+      GTEST_SKIP() << "Test resource not found: Box.glb";
+
+    // Distinct files (distinct paths) with the same content
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "scene_descriptor";
+    fs::remove_all(m_dir);
+    fs::create_directories(m_dir);
+    for(const char* name : {"a.glb", "b.glb", "c.glb", "d.glb"})
+      fs::copy_file(box, m_dir / name);
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  // `instances` model indices interleaved over `modelFiles`, each instance named and placed apart
+  SceneDescriptor makeDescriptor(const std::vector<std::string>& modelFiles, const std::vector<int>& instances) const
+  {
+    SceneDescriptor desc;
+    for(const std::string& file : modelFiles)
+      desc.models.push_back({file, m_dir / file});
+    for(size_t i = 0; i < instances.size(); i++)
+    {
+      SceneDescriptorInstance inst;
+      inst.modelIndex  = instances[i];
+      inst.translation = glm::vec3(float(i) * 2.0f, 0.0f, 0.0f);
+      inst.name        = "instance_" + std::to_string(i);
+      desc.instances.push_back(inst);
+    }
+    return desc;
+  }
+
+  fs::path m_dir;
+};
+
+void expectSameScene(const nvvkgltf::Scene& serial, const nvvkgltf::Scene& parallel)
+{
+  const tinygltf::Model& a = serial.getModel();
+  const tinygltf::Model& b = parallel.getModel();
+  ASSERT_EQ(a.nodes.size(), b.nodes.size());
+  for(size_t i = 0; i < a.nodes.size(); i++)
+  {
+    EXPECT_EQ(a.nodes[i].name, b.nodes[i].name) << "node " << i;
+    EXPECT_EQ(a.nodes[i].mesh, b.nodes[i].mesh) << "node " << i;
+    EXPECT_EQ(a.nodes[i].children, b.nodes[i].children) << "node " << i;
+    EXPECT_EQ(a.nodes[i].translation, b.nodes[i].translation) << "node " << i;
+    EXPECT_EQ(a.nodes[i].externalAsset, b.nodes[i].externalAsset) << "node " << i;
+  }
+  ASSERT_EQ(a.scenes.size(), b.scenes.size());
+  EXPECT_EQ(a.scenes[0].nodes, b.scenes[0].nodes);
+  EXPECT_EQ(a.meshes.size(), b.meshes.size());
+  EXPECT_EQ(a.materials.size(), b.materials.size());
+  ASSERT_EQ(a.files.size(), b.files.size());
+  for(size_t i = 0; i < a.files.size(); i++)
+    EXPECT_EQ(a.files[i].uri, b.files[i].uri);
+}
+
+}  // namespace
+
+TEST_F(SceneDescriptorLoaderTest, ParallelMatchesSerial)
+{
+  // Interleaved instances; model 4 is a second entry for the same file as model 0
+  const SceneDescriptor desc = makeDescriptor({"a.glb", "b.glb", "c.glb", "d.glb", "a.glb"}, {2, 0, 1, 0, 4, 3, 2, 1, 0, 3});
+
+  nvvkgltf::Scene serial;
+  nvvkgltf::Scene parallel;
+  EXPECT_EQ(referenceDescriptorInstances(serial, desc, false), desc.instances.size());
+  EXPECT_EQ(referenceDescriptorInstances(parallel, desc, true), desc.instances.size());
+  expectSameScene(serial, parallel);
+
+  // Root instance nodes follow the descriptor order
+  const tinygltf::Model& model = parallel.getModel();
+  ASSERT_EQ(model.scenes[0].nodes.size(), desc.instances.size());
+  for(size_t i = 0; i < desc.instances.size(); i++)
+    EXPECT_EQ(model.nodes[model.scenes[0].nodes[i]].name, desc.instances[i].name);
+
+  // One file entry per distinct file, in order of first use
+  ASSERT_EQ(model.files.size(), 4u);
+  EXPECT_NE(model.files[0].uri.find("c.glb"), std::string::npos);
+  EXPECT_NE(model.files[1].uri.find("a.glb"), std::string::npos);
+}
+
+TEST_F(SceneDescriptorLoaderTest, MissingFileSkipsItsInstances)
+{
+  const SceneDescriptor desc = makeDescriptor({"a.glb", "missing.glb", "b.glb"}, {1, 0, 1, 2, 7});
+
+  nvvkgltf::Scene serial;
+  nvvkgltf::Scene parallel;
+  EXPECT_EQ(referenceDescriptorInstances(serial, desc, false), 2u);
+  EXPECT_EQ(referenceDescriptorInstances(parallel, desc, true), 2u);
+  expectSameScene(serial, parallel);
+
+  const tinygltf::Model& model = parallel.getModel();
+  ASSERT_EQ(model.scenes[0].nodes.size(), 2u);
+  EXPECT_EQ(model.nodes[model.scenes[0].nodes[0]].name, "instance_1");
+  EXPECT_EQ(model.nodes[model.scenes[0].nodes[1]].name, "instance_3");
+}
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Hot reload: two loads of shader_ball variants written to disk are diffed by content (materials,
+// node transforms, mesh geometry, image files, structural changes), the diff is applied in place,
+// and the file watcher reports a rewritten file once it settles.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include <stb/stb_image_write.h>
+
+#include "common/test_utils.hpp"
+#include "file_watcher.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_diff.hpp"
+#include "tinygltf_utils.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+bool loadScene(nvvkgltf::Scene& scene, const fs::path& path)
+{
+  try
+  {
+    return scene.load(path);
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+}
+
+fs::path resource(const std::string& name)
+{
+  try
+  {
+    return TestResources::getResourcePath(name);
+  }
+  catch(const std::runtime_error&)
+  {
+    return {};
+  }
+}
+
+bool writeImage(const fs::path& file, uint8_t red)
+{
+  std::vector<uint8_t> pixels(4 * 4 * 4, 255);
+  for(size_t i = 0; i < pixels.size(); i += 4)
+    pixels[i] = red;
+  return stbi_write_png(file.string().c_str(), 4, 4, 4, pixels.data(), 4 * 4) != 0;
+}
+
+}  // namespace
+
+class HotReload : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "scene_diff";
+    fs::remove_all(m_dir);
+    fs::create_directories(m_dir);
+
+    const fs::path path = resource("shader_ball.gltf");
+    if(path.empty() || !loadScene(m_source, path))
+      GTEST_SKIP() << "shader_ball.gltf not available";
+    ASSERT_TRUE(writeImage(m_dir / "albedo.png", 255));
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  // shader_ball with an external base color texture, after `edit`, saved as m_dir / name
+  fs::path writeVariant(const std::string& name, const std::function<void(tinygltf::Model&)>& edit = {})
+  {
+    tinygltf::Model model = m_source.getModel();
+    tinygltf::Image image;
+    image.uri = "albedo.png";
+    model.images.push_back(image);
+    tinygltf::Texture texture;
+    texture.source = 0;
+    model.textures.push_back(texture);
+    model.materials[0].pbrMetallicRoughness.baseColorTexture.index = 0;
+    if(edit)
+      edit(model);
+
+    nvvkgltf::Scene scene;
+    scene.takeModel(std::move(model));
+    const fs::path file = m_dir / name;
+    EXPECT_TRUE(scene.save(file)) << name;
+    return file;
+  }
+
+  // Loads `a` and `b` and diffs them, like a hot reload of `a` that found `b` on disk
+  nvvkgltf::SceneDiff diff(const fs::path& a, const fs::path& b)
+  {
+    nvvkgltf::Scene current, incoming;
+    EXPECT_TRUE(loadScene(current, a));
+    EXPECT_TRUE(loadScene(incoming, b));
+    return nvvkgltf::diffScenes(current, nvvkgltf::hashSceneContent(current), incoming, nvvkgltf::hashSceneContent(incoming));
+  }
+
+  static int shaderBallNode(const tinygltf::Model& model)
+  {
+    for(size_t i = 0; i < model.nodes.size(); i++)
+      if(model.nodes[i].mesh >= 0)
+        return int(i);
+    return -1;
+  }
+
+  // Scaled copy of the positions of every primitive of mesh 0
+  static void scalePositions(tinygltf::Model& model, float scale)
+  {
+    for(tinygltf::Primitive& primitive : model.meshes[0].primitives)
+    {
+      std::vector<glm::vec3> positions;
+      ASSERT_TRUE(tinygltf::utils::copyAccessorData<glm::vec3>(model, model.accessors[primitive.attributes.at("POSITION")], positions));
+      for(glm::vec3& position : positions)
+        position *= scale;
+      primitive.attributes["POSITION"] =
+          tinygltf::utils::appendAccessor(model, 0, positions.data(), positions.size() * sizeof(glm::vec3),
+                                          TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, positions.size());
+    }
+  }
+
+  fs::path        m_dir;
+  nvvkgltf::Scene m_source;
+};
+
+TEST_F(HotReload, SameFilesHaveNoChange)
+{
+  const fs::path a = writeVariant("a.glb");
+  const fs::path b = writeVariant("b.glb");
+
+  const nvvkgltf::SceneDiff result = diff(a, b);
+  EXPECT_TRUE(result.empty()) << nvvkgltf::formatSceneDiff(result);
+  EXPECT_EQ(nvvkgltf::formatSceneDiff(result), "no change");
+}
+
+TEST_F(HotReload, MaterialChange)
+{
+  const fs::path a = writeVariant("a.glb");
+  const fs::path b = writeVariant("b.glb", [](tinygltf::Model& model) {
+    model.materials[0].pbrMetallicRoughness.roughnessFactor = 0.125;
+  });
+
+  const nvvkgltf::SceneDiff result = diff(a, b);
+  EXPECT_FALSE(result.isStructural()) << result.structuralChange;
+  EXPECT_EQ(result.materials, std::vector<int>{0});
+  EXPECT_TRUE(result.meshes.empty());
+  EXPECT_TRUE(result.images.empty());
+  EXPECT_TRUE(result.nodes.empty());
+}
+
+TEST_F(HotReload, NodeTransformChange)
+{
+  const fs::path a    = writeVariant("a.glb");
+  int            node = -1;
+  const fs::path b    = writeVariant("b.glb", [&node](tinygltf::Model& model) {
+    node                         = shaderBallNode(model);
+    model.nodes[node].translation = {0.0, 2.0, 0.0};
+  });
+  ASSERT_GE(node, 0);
+
+  const nvvkgltf::SceneDiff result = diff(a, b);
+  EXPECT_FALSE(result.isStructural()) << result.structuralChange;
+  EXPECT_EQ(result.nodes, std::vector<int>{node});
+  EXPECT_TRUE(result.materials.empty());
+  EXPECT_TRUE(result.meshes.empty());
+}
+
+TEST_F(HotReload, ImageFileChange)
+{
+  const fs::path file = writeVariant("a.glb");
+
+  nvvkgltf::Scene current;
+  ASSERT_TRUE(loadScene(current, file));
+  const nvvkgltf::SceneContentHashes currentHashes = nvvkgltf::hashSceneContent(current);
+
+  // Same scene file, new pixels
+  ASSERT_TRUE(writeImage(m_dir / "albedo.png", 0));
+  nvvkgltf::Scene incoming;
+  ASSERT_TRUE(loadScene(incoming, file));
+
+  const nvvkgltf::SceneDiff result = nvvkgltf::diffScenes(current, currentHashes, incoming, nvvkgltf::hashSceneContent(incoming));
+  EXPECT_FALSE(result.isStructural()) << result.structuralChange;
+  EXPECT_EQ(result.images, std::vector<int>{0});
+  EXPECT_TRUE(result.meshes.empty());
+  EXPECT_TRUE(result.materials.empty());
+}
+
+TEST_F(HotReload, MeshContentChange)
+{
+  const fs::path a = writeVariant("a.glb");
+  const fs::path b = writeVariant("b.glb", [](tinygltf::Model& model) { scalePositions(model, 2.0f); });
+
+  const nvvkgltf::SceneDiff result = diff(a, b);
+  EXPECT_FALSE(result.isStructural()) << result.structuralChange;
+  EXPECT_EQ(result.meshes, std::vector<int>{0});
+  EXPECT_TRUE(result.materials.empty());
+  EXPECT_TRUE(result.images.empty());
+}
+
+TEST_F(HotReload, StructuralChanges)
+{
+  const fs::path a = writeVariant("a.glb");
+
+  const fs::path extraNode = writeVariant("node.glb", [](tinygltf::Model& model) {
+    tinygltf::Node node;
+    node.mesh = 0;
+    model.nodes.push_back(node);
+    model.scenes[0].nodes.push_back(int(model.nodes.size()) - 1);
+  });
+  const nvvkgltf::SceneDiff nodeDiff = diff(a, extraNode);
+  EXPECT_TRUE(nodeDiff.isStructural());
+  EXPECT_FALSE(nodeDiff.empty());
+
+  const fs::path noTexCoords = writeVariant("layout.glb", [](tinygltf::Model& model) {
+    for(tinygltf::Primitive& primitive : model.meshes[0].primitives)
+      primitive.attributes.erase("TEXCOORD_0");
+  });
+  EXPECT_TRUE(diff(a, noTexCoords).isStructural());
+
+  const fs::path otherSampler = writeVariant("sampler.glb", [](tinygltf::Model& model) {
+    tinygltf::Sampler sampler;
+    sampler.magFilter = TINYGLTF_TEXTURE_FILTER_NEAREST;
+    model.samplers.push_back(sampler);
+    model.textures[0].sampler = 0;
+  });
+  const nvvkgltf::SceneDiff samplerDiff = diff(a, otherSampler);
+  EXPECT_TRUE(samplerDiff.isStructural());
+  EXPECT_NE(nvvkgltf::formatSceneDiff(samplerDiff).find("structural"), std::string::npos);
+}
+
+// The current scene takes the changed parts of the incoming one and then hashes like it
+TEST_F(HotReload, ApplyInPlace)
+{
+  const fs::path a    = writeVariant("a.glb");
+  int            node = -1;
+  const fs::path b    = writeVariant("b.glb", [&node](tinygltf::Model& model) {
+    scalePositions(model, 0.5f);
+    model.materials[0].pbrMetallicRoughness.metallicFactor = 0.25;
+    node                                                   = shaderBallNode(model);
+    model.nodes[node].scale                                = {2.0, 2.0, 2.0};
+  });
+
+  nvvkgltf::Scene current, incoming;
+  ASSERT_TRUE(loadScene(current, a));
+  ASSERT_TRUE(loadScene(incoming, b));
+  const nvvkgltf::SceneContentHashes incomingHashes = nvvkgltf::hashSceneContent(incoming);
+  const nvvkgltf::SceneDiff result = nvvkgltf::diffScenes(current, nvvkgltf::hashSceneContent(current), incoming, incomingHashes);
+  ASSERT_FALSE(result.isStructural()) << result.structuralChange;
+  EXPECT_EQ(result.meshes, std::vector<int>{0});
+  EXPECT_EQ(result.materials, std::vector<int>{0});
+  EXPECT_EQ(result.nodes, std::vector<int>{node});
+
+  const tinygltf::Material material = incoming.getModel().materials[0];
+  const nvvkgltf::SceneDiffUpdate update = nvvkgltf::applySceneDiff(current, std::move(incoming.getModel()), result);
+  EXPECT_TRUE(update.reparsed);
+  EXPECT_FALSE(update.primitivesChanged);
+  ASSERT_FALSE(update.renderPrimitives.empty());
+  for(int primID : update.renderPrimitives)
+    EXPECT_EQ(current.getRenderPrimitive(primID).meshID, 0);
+
+  EXPECT_TRUE(current.getModel().materials[0] == material);
+  EXPECT_EQ(current.getModel().nodes[node].scale, (std::vector<double>{2.0, 2.0, 2.0}));
+  EXPECT_EQ(nvvkgltf::hashSceneContent(current).meshes, incomingHashes.meshes);
+  EXPECT_TRUE(current.getDirtyFlags().materials.count(0));
+  EXPECT_TRUE(current.getDirtyFlags().nodes.count(node));
+}
+
+TEST_F(HotReload, SourceFiles)
+{
+  const fs::path file = writeVariant("a.glb");
+  nvvkgltf::Scene scene;
+  ASSERT_TRUE(loadScene(scene, file));
+
+  const std::vector<fs::path> files = nvvkgltf::sceneSourceFiles(scene);
+  const auto                  has   = [&files](const fs::path& expected) {
+    return std::find(files.begin(), files.end(), fs::absolute(expected).lexically_normal()) != files.end();
+  };
+  EXPECT_TRUE(has(file));
+  EXPECT_TRUE(has(m_dir / "albedo.png"));
+  EXPECT_EQ(files.size(), 2u);  // The GLB holds the buffer
+}
+
+TEST_F(HotReload, FileWatcherReportsSettledWrite)
+{
+  const fs::path file = m_dir / "watched.txt";
+  std::ofstream(file) << "first";
+
+  nvvkgltf::FileWatcher watcher;
+  watcher.watch({file, m_dir / "not_yet.txt"});
+  EXPECT_EQ(watcher.files().size(), 2u);
+  EXPECT_TRUE(watcher.poll(std::chrono::milliseconds(0)).empty());
+
+  std::ofstream(file) << "second, longer";
+
+  std::vector<fs::path> changed;
+  const auto            deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+  while(changed.empty() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    changed = watcher.poll(std::chrono::milliseconds(50));
+  }
+  ASSERT_EQ(changed.size(), 1u);
+  EXPECT_EQ(changed[0], fs::absolute(file).lexically_normal());
+  EXPECT_TRUE(watcher.poll(std::chrono::milliseconds(0)).empty());  // Reported once
+}
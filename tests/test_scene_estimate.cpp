@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Pre-load scene estimate: counts and geometry sizes match a real Scene load, EXT_mesh_gpu_instancing
+// is expanded, and image sizes come from PNG / KTX2 / DDS headers.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstring>
+#include <fstream>
+
+#include <stb/stb_image_write.h>
+
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_estimate.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+bool loadScene(nvvkgltf::Scene& scene, const fs::path& path)
+{
+  try
+  {
+    return scene.load(path);
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+}
+
+fs::path resource(const std::string& name)
+{
+  try
+  {
+    return TestResources::getResourcePath(name);
+  }
+  catch(const std::runtime_error&)
+  {
+    return {};
+  }
+}
+
+// The same sizes SceneVk allocates, measured on the loaded model (tangents already generated)
+uint64_t loadedGeometryBytes(const nvvkgltf::Scene& scene)
+{
+  const tinygltf::Model& model = scene.getModel();
+  uint64_t               bytes = 0;
+  for(size_t i = 0; i < scene.getNumRenderPrimitives(); i++)
+  {
+    const nvvkgltf::RenderPrimitive& prim = scene.getRenderPrimitive(i);
+    for(const auto& [name, elementBytes] : {std::pair<const char*, uint64_t>{"POSITION", 12},
+                                            {"NORMAL", 12},
+                                            {"TEXCOORD_0", 8},
+                                            {"TEXCOORD_1", 8},
+                                            {"TANGENT", 16},
+                                            {"COLOR_0", 4}})
+    {
+      const auto it = prim.pPrimitive->attributes.find(name);
+      if(it != prim.pPrimitive->attributes.end())
+        bytes += model.accessors[it->second].count * elementBytes;
+    }
+    bytes += uint64_t(prim.indexCount) * sizeof(uint32_t);
+  }
+  return bytes;
+}
+
+void expectMatchesLoad(const fs::path& path)
+{
+  nvvkgltf::SceneEstimate estimate;
+  std::string             error;
+  ASSERT_TRUE(nvvkgltf::estimateScene(path, estimate, {}, &error)) << error;
+
+  nvvkgltf::Scene scene;
+  ASSERT_TRUE(loadScene(scene, path));
+  uint64_t vertices = 0, triangles = 0;
+  for(size_t i = 0; i < scene.getNumRenderPrimitives(); i++)
+  {
+    vertices += scene.getRenderPrimitive(i).vertexCount;
+    triangles += scene.getRenderPrimitive(i).indexCount / 3;
+  }
+
+  EXPECT_EQ(estimate.renderNodes, scene.getRenderNodes().size());
+  EXPECT_EQ(estimate.renderPrimitives, scene.getNumRenderPrimitives());
+  EXPECT_EQ(estimate.nodes, scene.getModel().nodes.size());
+  EXPECT_EQ(estimate.vertices, vertices);
+  EXPECT_EQ(estimate.triangles, triangles);
+  EXPECT_EQ(estimate.geometryBytes, loadedGeometryBytes(scene));
+  EXPECT_GT(estimate.blasBytes, 0u);
+  EXPECT_GT(estimate.loadSeconds, 0.0);
+  EXPECT_FALSE(nvvkgltf::formatSceneEstimate(estimate).empty());
+}
+
+void writeFile(const fs::path& path, const void* data, size_t size)
+{
+  std::ofstream out(path, std::ios::binary);
+  out.write(static_cast<const char*>(data), std::streamsize(size));
+}
+
+void writeFile(const fs::path& path, const std::string& text)
+{
+  writeFile(path, text.data(), text.size());
+}
+
+void putU32(std::vector<uint8_t>& b, size_t offset, uint32_t v)
+{
+  std::memcpy(&b[offset], &v, sizeof(v));
+}
+
+void putU64(std::vector<uint8_t>& b, size_t offset, uint64_t v)
+{
+  std::memcpy(&b[offset], &v, sizeof(v));
+}
+
+class SceneEstimateImages : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "estimate";
+    fs::remove_all(m_dir);
+    fs::create_directories(m_dir);
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  fs::path m_dir;
+};
+
+}  // namespace
+
+TEST(SceneEstimate, MatchesLoadedBox)
+{
+  const fs::path path = resource("Box.glb");
+  if(path.empty())
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  expectMatchesLoad(path);
+}
+
+TEST(SceneEstimate, MatchesLoadedShaderBall)
+{
+  const fs::path path = resource("shader_ball.gltf");
+  if(path.empty())
+    GTEST_SKIP() << "Test resource not found: shader_ball.gltf";
+  expectMatchesLoad(path);
+}
+
+TEST(SceneEstimate, ExpandsGpuInstancing)
+{
+  nvvkgltf::Scene source;
+  const fs::path  path = resource("Box.glb");
+  if(path.empty() || !loadScene(source, path))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  // 250 instances of the mesh node
+  tinygltf::Model model    = source.getModel();
+  int             meshNode = -1;
+  for(size_t n = 0; n < model.nodes.size() && meshNode < 0; n++)
+  {
+    if(model.nodes[n].mesh >= 0)
+      meshNode = int(n);
+  }
+  ASSERT_GE(meshNode, 0);
+  constexpr int      kInstances = 250;
+  std::vector<float> translations(kInstances * 3);
+  for(int i = 0; i < kInstances; i++)
+    translations[i * 3] = float(i);
+  tinygltf::Buffer buffer;
+  buffer.data.resize(translations.size() * sizeof(float));
+  std::memcpy(buffer.data.data(), translations.data(), buffer.data.size());
+  tinygltf::BufferView view;
+  view.buffer     = int(model.buffers.size());
+  view.byteLength = buffer.data.size();
+  model.buffers.push_back(std::move(buffer));
+  tinygltf::Accessor accessor;
+  accessor.bufferView    = int(model.bufferViews.size());
+  accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+  accessor.type          = TINYGLTF_TYPE_VEC3;
+  accessor.count         = kInstances;
+  model.bufferViews.push_back(view);
+  model.accessors.push_back(accessor);
+  tinygltf::Value::Object attributes{{"TRANSLATION", tinygltf::Value(int(model.accessors.size()) - 1)}};
+  model.nodes[meshNode].extensions[EXT_MESH_GPU_INSTANCING_EXTENSION_NAME] =
+      tinygltf::Value(tinygltf::Value::Object{{"attributes", tinygltf::Value(attributes)}});
+  model.extensionsUsed.push_back(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+
+  nvvkgltf::Scene instanced;
+  instanced.takeModel(std::move(model));
+  const fs::path saved = TestResources::getTempPath("estimate_instanced.glb");
+  ASSERT_TRUE(instanced.save(saved));
+
+  nvvkgltf::SceneEstimate estimate;
+  ASSERT_TRUE(nvvkgltf::estimateScene(saved, estimate));
+  nvvkgltf::Scene loaded;
+  ASSERT_TRUE(loadScene(loaded, saved));
+  EXPECT_EQ(estimate.renderNodes, loaded.getRenderNodes().size());
+  EXPECT_GE(estimate.renderNodes, uint64_t(kInstances));
+  EXPECT_EQ(estimate.renderPrimitives, loaded.getNumRenderPrimitives()) << "Instances share the primitive";
+  fs::remove(saved);
+}
+
+TEST_F(SceneEstimateImages, ReadsImageHeaders)
+{
+  // PNG 64x32 RGBA: decoded to RGBA8, generated chain 64x32 .. 1x1 = 2731 texels
+  std::vector<uint8_t> rgba(64 * 32 * 4, 128);
+  ASSERT_NE(stbi_write_png((m_dir / "a.png").string().c_str(), 64, 32, 4, rgba.data(), 64 * 4), 0);
+
+  // KTX2 BC7 64x64 with two levels: sizes from the level index
+  std::vector<uint8_t>           ktx2(80 + 2 * 24, 0);
+  const std::array<uint8_t, 12> ktx2Id = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+  std::memcpy(ktx2.data(), ktx2Id.data(), ktx2Id.size());
+  putU32(ktx2, 12, 145);  // VK_FORMAT_BC7_UNORM_BLOCK
+  putU32(ktx2, 20, 64);
+  putU32(ktx2, 24, 64);
+  putU32(ktx2, 40, 2);
+  putU64(ktx2, 80 + 16, 4096);
+  putU64(ktx2, 80 + 24 + 16, 1024);
+  writeFile(m_dir / "b.ktx2", ktx2.data(), ktx2.size());
+
+  // DDS DXT1 32x32, one level: 8x8 blocks of 8 bytes, no generated chain for block formats
+  std::vector<uint8_t> dds(128, 0);
+  std::memcpy(dds.data(), "DDS ", 4);
+  putU32(dds, 8, 0x20000);
+  putU32(dds, 12, 32);
+  putU32(dds, 16, 32);
+  putU32(dds, 28, 1);
+  putU32(dds, 80, 0x4);
+  std::memcpy(&dds[84], "DXT1", 4);
+  writeFile(m_dir / "c.dds", dds.data(), dds.size());
+
+  writeFile(m_dir / "d.bin", std::string(64, 'x'));
+  writeFile(m_dir / "images.gltf",
+            R"({"asset":{"version":"2.0"},"images":[{"uri":"a.png"},{"uri":"b.ktx2"},{"uri":"c.dds"},{"uri":"d.bin"}]})");
+
+  nvvkgltf::SceneEstimate estimate;
+  std::string             error;
+  ASSERT_TRUE(nvvkgltf::estimateScene(m_dir / "images.gltf", estimate, {}, &error)) << error;
+  EXPECT_EQ(estimate.images, 4u);
+  EXPECT_EQ(estimate.unknownImages, 1u);
+  EXPECT_EQ(estimate.imageBytes, 2731u * 4 + 5120 + 512);
+  EXPECT_EQ(estimate.decodedPixels, 64u * 32);
+  EXPECT_EQ(estimate.decodedImageBytes, 64u * 32 * 4 + 5120 + 512);
+
+  nvvkgltf::SceneEstimateOptions noMips;
+  noMips.generateMipmaps = false;
+  ASSERT_TRUE(nvvkgltf::estimateScene(m_dir / "images.gltf", estimate, noMips));
+  EXPECT_EQ(estimate.imageBytes, 64u * 32 * 4 + 5120 + 512);
+}
+
+TEST_F(SceneEstimateImages, RejectsUnreadableFiles)
+{
+  nvvkgltf::SceneEstimate estimate;
+  std::string             error;
+  EXPECT_FALSE(nvvkgltf::estimateScene(m_dir / "missing.gltf", estimate, {}, &error));
+  EXPECT_FALSE(error.empty());
+
+  writeFile(m_dir / "broken.gltf", std::string("{\"asset\": "));
+  EXPECT_FALSE(nvvkgltf::estimateScene(m_dir / "broken.gltf", estimate, {}, &error));
+
+  writeFile(m_dir / "wrong_types.gltf", std::string(R"({"asset":{"version":"2.0"},"accessors":[{"count":"many"}],
+    "meshes":[{"primitives":[{"attributes":{"POSITION":0}}]}]})"));
+  EXPECT_FALSE(nvvkgltf::estimateScene(m_dir / "wrong_types.gltf", estimate, {}, &error));
+}
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Offline scene optimizer: the sample models and a scene with duplicates, a normal map and GPU
+// instancing round-trip through every pass and render the same (render nodes, world matrices,
+// materials, triangles, vertex attributes); each pass does what it reports.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <meshoptimizer/src/meshoptimizer.h>
+#include <stb/stb_image_write.h>
+
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+#include "gltf_scene_optimizer.hpp"
+#include "tinygltf_utils.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+bool loadScene(nvvkgltf::Scene& scene, const fs::path& path)
+{
+  try
+  {
+    return scene.load(path);
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+}
+
+fs::path resource(const std::string& name)
+{
+  try
+  {
+    return TestResources::getResourcePath(name);
+  }
+  catch(const std::runtime_error&)
+  {
+    return {};
+  }
+}
+
+nvvkgltf::SceneOptimizeOptions passes(const std::string& list)
+{
+  nvvkgltf::SceneOptimizeOptions options;
+  EXPECT_TRUE(nvvkgltf::parseSceneOptimizePasses(list, options));
+  return options;
+}
+
+template <typename T>
+void expectSameAttribute(const tinygltf::Model& a, int accessorA, const tinygltf::Model& b, int accessorB, float tolerance, const std::string& name)
+{
+  std::vector<T> valuesA, valuesB;
+  ASSERT_TRUE(tinygltf::utils::copyAccessorData<T>(a, a.accessors[accessorA], valuesA)) << name;
+  ASSERT_TRUE(tinygltf::utils::copyAccessorData<T>(b, b.accessors[accessorB], valuesB)) << name;
+  ASSERT_EQ(valuesA.size(), valuesB.size()) << name;
+  for(size_t i = 0; i < valuesA.size(); i++)
+  {
+    for(int c = 0; c < T::length(); c++)
+      ASSERT_NEAR(valuesA[i][c], valuesB[i][c], tolerance) << name << " vertex " << i;
+  }
+}
+
+// Triangles as a sorted list: the vertex cache pass reorders them, never their vertices
+std::vector<std::array<uint32_t, 3>> sortedTriangles(const tinygltf::Model& model, const tinygltf::Primitive& primitive)
+{
+  std::vector<uint32_t> indices;
+  if(primitive.indices < 0)
+    return {};
+  EXPECT_TRUE(tinygltf::utils::copyAccessorData<uint32_t>(model, model.accessors[primitive.indices], indices));
+  std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+  for(size_t t = 0; t < triangles.size(); t++)
+    triangles[t] = {indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]};
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+// Everything the renderer draws, within `tolerance` for the quantized attributes
+void expectSameRendering(const nvvkgltf::Scene& a, const nvvkgltf::Scene& b, float tolerance)
+{
+  const tinygltf::Model&            modelA = a.getModel();
+  const tinygltf::Model&            modelB = b.getModel();
+  const nvvkgltf::RenderNodeArrays& nodesA = a.getRenderNodes();
+  const nvvkgltf::RenderNodeArrays& nodesB = b.getRenderNodes();
+  ASSERT_EQ(nodesA.size(), nodesB.size());
+
+  for(size_t i = 0; i < nodesA.size(); i++)
+  {
+    for(int c = 0; c < 4; c++)
+      for(int r = 0; r < 4; r++)
+        EXPECT_NEAR(nodesA.worldMatrices()[i][c][r], nodesB.worldMatrices()[i][c][r], 1e-5f) << "render node " << i;
+
+    tinygltf::Material materialA = modelA.materials[nodesA.materialIDs()[i]];
+    tinygltf::Material materialB = modelB.materials[nodesB.materialIDs()[i]];
+    materialA.name.clear();
+    materialB.name.clear();
+    EXPECT_TRUE(materialA == materialB) << "render node " << i;
+
+    const tinygltf::Primitive& primA = *a.getRenderPrimitive(nodesA.renderPrimIDs()[i]).pPrimitive;
+    const tinygltf::Primitive& primB = *b.getRenderPrimitive(nodesB.renderPrimIDs()[i]).pPrimitive;
+    ASSERT_EQ(primA.mode, primB.mode);
+    ASSERT_EQ(primA.attributes.size(), primB.attributes.size()) << "render node " << i;
+    EXPECT_EQ(sortedTriangles(modelA, primA), sortedTriangles(modelB, primB)) << "render node " << i;
+    for(const auto& [name, accessorA] : primA.attributes)
+    {
+      ASSERT_TRUE(primB.attributes.count(name)) << name;
+      const int accessorB = primB.attributes.at(name);
+      if(name == "POSITION")
+        expectSameAttribute<glm::vec3>(modelA, accessorA, modelB, accessorB, 0.0f, name);
+      else if(name == "NORMAL")
+        expectSameAttribute<glm::vec3>(modelA, accessorA, modelB, accessorB, tolerance, name);
+      else if(name == "TANGENT")
+        expectSameAttribute<glm::vec4>(modelA, accessorA, modelB, accessorB, tolerance, name);
+      else if(name.rfind("TEXCOORD_", 0) == 0)
+        expectSameAttribute<glm::vec2>(modelA, accessorA, modelB, accessorB, tolerance, name);
+    }
+  }
+}
+
+class SceneOptimizer : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "optimizer";
+    fs::remove_all(m_dir);
+    fs::create_directories(m_dir);
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  // shader_ball with a copy of its mesh and material (identical data, other indices and name), a
+  // normal map on both, and the copy drawn as three EXT_mesh_gpu_instancing instances
+  fs::path writeDuplicatesScene()
+  {
+    nvvkgltf::Scene source;
+    const fs::path  path = resource("shader_ball.gltf");
+    if(path.empty() || !loadScene(source, path))
+      return {};
+
+    std::vector<uint8_t> normalMap(4 * 4 * 4, 0);
+    for(size_t i = 0; i < normalMap.size(); i += 4)
+    {
+      normalMap[i] = normalMap[i + 1] = 128;  // Flat: +Z
+      normalMap[i + 2] = normalMap[i + 3] = 255;
+    }
+    if(stbi_write_png((m_dir / "normal.png").string().c_str(), 4, 4, 4, normalMap.data(), 4 * 4) == 0)
+      return {};
+
+    tinygltf::Model model = source.getModel();
+    tinygltf::Image image;
+    image.uri = "normal.png";
+    model.images.push_back(image);
+    tinygltf::Texture texture;
+    texture.source = int(model.images.size()) - 1;
+    model.textures.push_back(texture);
+    model.materials[0].normalTexture.index = int(model.textures.size()) - 1;
+    model.materials.push_back(model.materials[0]);
+    model.materials.back().name = "copy";
+
+    const int        firstCopy = int(model.accessors.size());
+    tinygltf::Mesh   mesh      = model.meshes[0];
+    std::vector<int> copied(model.accessors.size(), -1);
+    for(tinygltf::Primitive& primitive : mesh.primitives)
+    {
+      const auto copy = [&](int& index) {
+        if(copied[index] < 0)
+        {
+          copied[index] = int(model.accessors.size());
+          model.accessors.push_back(model.accessors[index]);
+        }
+        index = copied[index];
+      };
+      for(auto& [name, index] : primitive.attributes)
+        copy(index);
+      copy(primitive.indices);
+      primitive.material = int(model.materials.size()) - 1;
+    }
+    EXPECT_GT(int(model.accessors.size()), firstCopy);
+    model.meshes.push_back(mesh);
+
+    const std::array<float, 9> translations = {4.0f, 0.0f, 0.0f, 8.0f, 0.0f, 0.0f, 0.0f, 4.0f, 0.0f};
+    const int translation = tinygltf::utils::appendAccessor(model, 0, translations.data(), sizeof(translations), TINYGLTF_COMPONENT_TYPE_FLOAT,
+                                                            TINYGLTF_TYPE_VEC3, 3);
+    tinygltf::Node node;
+    node.mesh = int(model.meshes.size()) - 1;
+    tinygltf::Value::Object attributes{{"TRANSLATION", tinygltf::Value(translation)}};
+    node.extensions[EXT_MESH_GPU_INSTANCING_EXTENSION_NAME] =
+        tinygltf::Value(tinygltf::Value::Object{{"attributes", tinygltf::Value(attributes)}});
+    model.nodes.push_back(node);
+    model.scenes[0].nodes.push_back(int(model.nodes.size()) - 1);
+    model.extensionsUsed.push_back(EXT_MESH_GPU_INSTANCING_EXTENSION_NAME);
+
+    // Written without the tangents the loader would add, like a file from another tool
+    nvvkgltf::Scene scene;
+    scene.setCreateMissingTangents(false);
+    scene.takeModel(std::move(model));
+    const fs::path file = m_dir / "duplicates.glb";
+    return scene.save(file) ? file : fs::path();
+  }
+
+  // Optimizes `input` into m_dir and checks the result renders like the input
+  nvvkgltf::SceneOptimizeReport expectRoundTrip(const fs::path&                       input,
+                                                const std::string&                    outputName,
+                                                const nvvkgltf::SceneOptimizeOptions& options,
+                                                float                                 tolerance)
+  {
+    nvvkgltf::SceneOptimizeReport report;
+    const fs::path                output = m_dir / outputName;
+    std::string                   error;
+    EXPECT_TRUE(nvvkgltf::optimizeSceneFile(input, output, options, report, &error)) << error;
+
+    nvvkgltf::Scene original, optimized;
+    EXPECT_TRUE(loadScene(original, input));
+    EXPECT_TRUE(loadScene(optimized, output)) << outputName;
+    expectSameRendering(original, optimized, tolerance);
+    EXPECT_FALSE(nvvkgltf::formatSceneOptimizeReport(report).empty());
+    return report;
+  }
+
+  fs::path m_dir;
+};
+
+}  // namespace
+
+TEST(SceneOptimizerPasses, ParseAndFormat)
+{
+  nvvkgltf::SceneOptimizeOptions options;
+  ASSERT_TRUE(nvvkgltf::parseSceneOptimizePasses("vcache, meshopt", options));
+  EXPECT_FALSE(options.removeUnused);
+  EXPECT_FALSE(options.mergeDuplicates);
+  EXPECT_TRUE(options.vertexCache);
+  EXPECT_TRUE(options.meshopt);
+  EXPECT_EQ(nvvkgltf::formatSceneOptimizePasses(options), "vcache,meshopt");
+
+  ASSERT_TRUE(nvvkgltf::parseSceneOptimizePasses("all", options));
+  EXPECT_EQ(nvvkgltf::formatSceneOptimizePasses(options), "dedup,compact,tangents,vcache,quantize,meshopt");
+  ASSERT_TRUE(nvvkgltf::parseSceneOptimizePasses("none", options));
+  EXPECT_EQ(nvvkgltf::formatSceneOptimizePasses(options), "none");
+
+  std::string error;
+  options.quantize = true;
+  EXPECT_FALSE(nvvkgltf::parseSceneOptimizePasses("dedup,draco", options, &error));
+  EXPECT_NE(error.find("draco"), std::string::npos);
+  EXPECT_TRUE(options.quantize) << "Unchanged on error";
+  EXPECT_EQ(nvvkgltf::formatSceneOptimizePasses({}), "dedup,compact,tangents,vcache");
+}
+
+TEST_F(SceneOptimizer, SampleModelsRoundTrip)
+{
+  for(const char* name : {"Box.glb", "shader_ball.gltf"})
+  {
+    const fs::path input = resource(name);
+    if(input.empty())
+      GTEST_SKIP() << "Test resource not found: " << name;
+    SCOPED_TRACE(name);
+
+    // Quantized normals and texture coordinates are within a 16-bit step
+    const nvvkgltf::SceneOptimizeReport glb = expectRoundTrip(input, "all.glb", passes("all"), 1e-4f);
+    EXPECT_GT(glb.stats.accessorsQuantized, 0u);
+    EXPECT_EQ(glb.after.meshoptViews, glb.stats.meshoptViews);
+    EXPECT_LE(glb.stats.meshoptBytes, glb.stats.meshoptRawBytes) << "Only streams smaller than the data are kept";
+    EXPECT_EQ(glb.after.renderPrimitives, glb.before.renderPrimitives);
+    EXPECT_EQ(glb.after.renderNodes, glb.before.renderNodes);
+
+    // meshopt is .glb only; the default passes are lossless
+    const nvvkgltf::SceneOptimizeReport gltf = expectRoundTrip(input, "all.gltf", passes("all"), 1e-4f);
+    EXPECT_EQ(gltf.stats.meshoptViews, 0u);
+    expectRoundTrip(input, "default.gltf", {}, 0.0f);
+  }
+}
+
+TEST_F(SceneOptimizer, MeshoptIsLossless)
+{
+  const fs::path input = resource("shader_ball.gltf");
+  if(input.empty())
+    GTEST_SKIP() << "Test resource not found: shader_ball.gltf";
+
+  const nvvkgltf::SceneOptimizeReport report = expectRoundTrip(input, "meshopt.glb", passes("meshopt"), 0.0f);
+  EXPECT_LT(report.stats.meshoptBytes, report.stats.meshoptRawBytes);
+  EXPECT_EQ(report.after.meshoptViews, report.stats.meshoptViews);
+  EXPECT_GT(report.stats.meshoptViews, 0u);
+  EXPECT_LE(report.stats.meshoptViews, 4u) << "Positions, normals, texture coordinates and indices at most";
+  EXPECT_LT(report.after.bytesRead, report.before.bytesRead);
+}
+
+TEST_F(SceneOptimizer, VertexCacheOrderDoesNotRegress)
+{
+  const fs::path input = resource("shader_ball.gltf");
+  if(input.empty())
+    GTEST_SKIP() << "Test resource not found: shader_ball.gltf";
+  const nvvkgltf::SceneOptimizeReport report = expectRoundTrip(input, "vcache.gltf", passes("vcache"), 0.0f);
+  EXPECT_EQ(report.stats.indexBuffersOrdered, 1u);
+
+  nvvkgltf::Scene original, optimized;
+  ASSERT_TRUE(loadScene(original, input));
+  ASSERT_TRUE(loadScene(optimized, m_dir / "vcache.gltf"));
+  const auto acmr = [](const nvvkgltf::Scene& scene) {
+    const tinygltf::Model&     model     = scene.getModel();
+    const tinygltf::Primitive& primitive = *scene.getRenderPrimitive(0).pPrimitive;
+    std::vector<uint32_t>      indices;
+    EXPECT_TRUE(tinygltf::utils::copyAccessorData<uint32_t>(model, model.accessors[primitive.indices], indices));
+    return meshopt_analyzeVertexCache(indices.data(), indices.size(), scene.getRenderPrimitive(0).vertexCount, 16, 0, 0).acmr;
+  };
+  EXPECT_LE(acmr(optimized), acmr(original));
+}
+
+TEST_F(SceneOptimizer, MergesDuplicatesAndKeepsInstancing)
+{
+  const fs::path input = writeDuplicatesScene();
+  if(input.empty())
+    GTEST_SKIP() << "Test resource not found: shader_ball.gltf";
+
+  nvvkgltf::Scene before;
+  ASSERT_TRUE(loadScene(before, input));
+  ASSERT_EQ(before.getNumRenderPrimitives(), 2u);
+  ASSERT_EQ(before.getRenderNodes().size(), 4u) << "The original and three instances of the copy";
+
+  const nvvkgltf::SceneOptimizeReport report = expectRoundTrip(input, "dedup.glb", passes("dedup,compact"), 0.0f);
+  EXPECT_EQ(report.stats.accessorsMerged, 4u);
+  EXPECT_EQ(report.stats.materialsMerged, 1u);
+  EXPECT_EQ(report.stats.materialsAfter, 1u);
+  EXPECT_EQ(report.after.renderPrimitives, 1u) << "Both meshes now share one primitive";
+  EXPECT_EQ(report.after.renderNodes, 4u) << "Compaction kept the instancing accessor";
+  EXPECT_LT(report.after.geometryBytes, report.before.geometryBytes);
+}
+
+TEST_F(SceneOptimizer, TangentsAreBakedOnlyWhenSelected)
+{
+  const fs::path input = writeDuplicatesScene();
+  if(input.empty())
+    GTEST_SKIP() << "Test resource not found: shader_ball.gltf";
+
+  const auto writtenTangents = [&](const fs::path& file) {
+    nvvkgltf::Scene scene;
+    scene.setCreateMissingTangents(false);
+    EXPECT_TRUE(loadScene(scene, file));
+    size_t count = 0;
+    for(const tinygltf::Mesh& mesh : scene.getModel().meshes)
+      for(const tinygltf::Primitive& primitive : mesh.primitives)
+        count += primitive.attributes.count("TANGENT");
+    return count;
+  };
+  ASSERT_EQ(writtenTangents(input), 0u);
+
+  // The loader's tangents, generated offline: same values as a load of the input
+  const nvvkgltf::SceneOptimizeReport baked = expectRoundTrip(input, "tangents.glb", passes("tangents"), 1e-6f);
+  EXPECT_EQ(baked.stats.tangentsBaked, 2u);
+  EXPECT_EQ(writtenTangents(m_dir / "tangents.glb"), 2u);
+
+  const nvvkgltf::SceneOptimizeReport skipped = expectRoundTrip(input, "no_tangents.glb", passes("compact"), 0.0f);
+  EXPECT_EQ(skipped.stats.tangentsBaked, 0u);
+  EXPECT_EQ(writtenTangents(m_dir / "no_tangents.glb"), 0u);
+
+  // Quantized tangents
+  const nvvkgltf::SceneOptimizeReport quantized = expectRoundTrip(input, "quantized.glb", passes("tangents,quantize"), 1e-4f);
+  EXPECT_GE(quantized.stats.accessorsQuantized, 2u);
+}
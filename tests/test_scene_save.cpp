@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Background save: the file written from a SceneSaveSnapshot holds the scene as it was when the
+// snapshot was taken, whatever is edited while the save runs; buffer changes wait for the write;
+// cancellation writes nothing.
+
+#include <gtest/gtest.h>
+#include "common/test_utils.hpp"
+#include "gltf_scene.hpp"
+
+using namespace gltf_test;
+namespace fs = std::filesystem;
+
+namespace {
+
+bool loadOrSkip(nvvkgltf::Scene& scene, const std::string& filename)
+{
+  try
+  {
+    return scene.load(TestResources::getResourcePath(filename));
+  }
+  catch(const std::runtime_error&)
+  {
+    return false;
+  }
+}
+
+// Edits of the live scene that must not reach a snapshot taken before them
+void editLiveScene(nvvkgltf::Scene& scene)
+{
+  tinygltf::Model& model = scene.getModel();
+  for(tinygltf::Node& node : model.nodes)
+    node.name = "edited";
+  tinygltf::Node extra;
+  extra.name = "added during save";
+  model.nodes.push_back(extra);
+}
+
+// The buffers are shared with the snapshots: they are changed once the saves are done
+void editLiveBuffers(nvvkgltf::Scene& scene)
+{
+  scene.waitForSaves();
+  tinygltf::Model& model = scene.getModel();
+  if(!model.buffers.empty() && !model.buffers[0].data.empty())
+    model.buffers[0].data[0] ^= 0xFF;
+}
+
+class SceneSaveTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = fs::temp_directory_path() / "gltf_renderer_tests" / "scene_save";
+    fs::remove_all(m_dir);
+    fs::create_directories(m_dir);
+  }
+  void TearDown() override { fs::remove_all(m_dir); }
+
+  // Check the saved file against the model captured before the edits
+  void expectSavedAsBefore(const fs::path& file, const tinygltf::Model& before) const
+  {
+    nvvkgltf::Scene saved;
+    ASSERT_TRUE(saved.load(file));
+    const tinygltf::Model& model = saved.getModel();
+    ASSERT_EQ(model.nodes.size(), before.nodes.size());
+    for(size_t i = 0; i < model.nodes.size(); i++)
+      EXPECT_EQ(model.nodes[i].name, before.nodes[i].name);
+    ASSERT_EQ(model.buffers.size(), before.buffers.size());
+    if(!model.buffers.empty())
+      EXPECT_EQ(model.buffers[0].data, before.buffers[0].data);
+  }
+
+  fs::path m_dir;
+};
+
+}  // namespace
+
+TEST_F(SceneSaveTest, EditsAfterSnapshotDoNotLeak)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  const tinygltf::Model before = scene.getModel();
+
+  std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(m_dir / "box.glb");
+  ASSERT_TRUE(snapshot.has_value());
+  editLiveScene(scene);
+
+  nvvkgltf::SceneSaveProgress progress;
+  EXPECT_EQ(nvvkgltf::writeSceneSnapshot(*snapshot, &progress), nvvkgltf::SceneSaveStatus::eSaved);
+  EXPECT_TRUE(progress.written.load());
+  EXPECT_FLOAT_EQ(progress.fraction(), 1.0f);
+  expectSavedAsBefore(m_dir / "box.glb", before);
+}
+
+TEST_F(SceneSaveTest, AsyncSaveWhileEditing)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  const tinygltf::Model before = scene.getModel();
+
+  nvvkgltf::AsyncSceneSave                   save;
+  std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(m_dir / "box.gltf");
+  ASSERT_TRUE(snapshot.has_value());
+  ASSERT_TRUE(save.start(std::move(*snapshot)));
+
+  // The scene is edited while the save runs
+  editLiveScene(scene);
+  editLiveBuffers(scene);
+  save.wait();
+
+  const std::optional<nvvkgltf::AsyncSceneSave::Result> result = save.takeResult();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_FALSE(save.takeResult().has_value()) << "Consumed once";
+  EXPECT_EQ(result->status, nvvkgltf::SceneSaveStatus::eSaved);
+  EXPECT_EQ(result->filename, m_dir / "box.gltf");
+  expectSavedAsBefore(result->filename, before);
+
+  scene.onSaved(result->filename);
+  EXPECT_EQ(scene.getFilename(), m_dir / "box.gltf");
+}
+
+TEST_F(SceneSaveTest, SnapshotSharesBuffers)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+  const tinygltf::Model before = scene.getModel();
+  ASSERT_FALSE(before.buffers.empty());
+
+  for(const char* name : {"box.glb", "box.gltf"})
+  {
+    std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(m_dir / name);
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->payloads, &scene.getModel()) << name;
+    ASSERT_EQ(snapshot->model.buffers.size(), before.buffers.size()) << name;
+    for(const tinygltf::Buffer& buffer : snapshot->model.buffers)
+      EXPECT_TRUE(buffer.data.empty()) << name;
+    EXPECT_EQ(scene.getModel().buffers[0].data, before.buffers[0].data) << "Put back after the copy";
+    EXPECT_TRUE(scene.isSaving()) << name;
+
+    EXPECT_EQ(nvvkgltf::writeSceneSnapshot(*snapshot), nvvkgltf::SceneSaveStatus::eSaved) << name;
+    EXPECT_FALSE(scene.isSaving()) << "Lease dropped once written";
+    expectSavedAsBefore(m_dir / name, before);
+  }
+}
+
+TEST_F(SceneSaveTest, CancelledSaveWritesNothing)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(m_dir / "box.glb");
+  ASSERT_TRUE(snapshot.has_value());
+
+  nvvkgltf::SceneSaveProgress progress;
+  progress.cancel = true;
+  EXPECT_EQ(nvvkgltf::writeSceneSnapshot(*snapshot, &progress), nvvkgltf::SceneSaveStatus::eCancelled);
+  EXPECT_FALSE(progress.written.load());
+  EXPECT_FALSE(fs::exists(m_dir / "box.glb"));
+}
+
+TEST_F(SceneSaveTest, FailedWriteIsReported)
+{
+  nvvkgltf::Scene scene;
+  if(!loadOrSkip(scene, "Box.glb"))
+    GTEST_SKIP() << "Test resource not found: Box.glb";
+
+  // The destination folder does not exist: neither writer can create the file
+  for(const char* name : {"box.glb", "box.gltf"})
+  {
+    std::optional<nvvkgltf::SceneSaveSnapshot> snapshot = scene.makeSaveSnapshot(m_dir / "missing" / name);
+    ASSERT_TRUE(snapshot.has_value());
+
+    nvvkgltf::SceneSaveProgress progress;
+    EXPECT_EQ(nvvkgltf::writeSceneSnapshot(*snapshot, &progress), nvvkgltf::SceneSaveStatus::eFailed) << name;
+    EXPECT_FALSE(progress.written.load()) << name;
+  }
+}
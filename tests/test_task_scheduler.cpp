@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Task scheduler: priority order, cancellation, dependency edges, fixed worker count, nested waits and
+// parallelFor coverage.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "task_scheduler.hpp"
+
+using nvvkgltf::CancellationToken;
+using nvvkgltf::TaskHandle;
+using nvvkgltf::TaskPriority;
+using nvvkgltf::TaskScheduler;
+using nvvkgltf::TaskState;
+
+namespace {
+
+// Holds the only worker of a scheduler until release(), so tasks queue up behind it
+class Gate
+{
+public:
+  TaskHandle block(TaskScheduler& scheduler)
+  {
+    return scheduler.submit([this]() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this]() { return m_open; });
+    });
+  }
+  void release()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_open = true;
+    }
+    m_cv.notify_all();
+  }
+
+private:
+  std::mutex              m_mutex;
+  std::condition_variable m_cv;
+  bool                    m_open = false;
+};
+
+}  // namespace
+
+TEST(TaskScheduler, RunsByPriorityThenSubmissionOrder)
+{
+  TaskScheduler scheduler(1);
+  Gate          gate;
+  gate.block(scheduler);
+
+  std::mutex       mutex;
+  std::vector<int> order;
+  const auto       record = [&](int id) {
+    return [&, id]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(id);
+    };
+  };
+  scheduler.submit(record(4), {.priority = TaskPriority::eBackground});
+  scheduler.submit(record(2), {.priority = TaskPriority::eHigh});
+  scheduler.submit(record(3), {.priority = TaskPriority::eHigh});
+  scheduler.submit(record(1), {.priority = TaskPriority::eInteractive});
+  gate.release();
+  scheduler.waitIdle();
+
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4})) << "A decode backlog does not delay an interactive compile";
+}
+
+TEST(TaskScheduler, CancelledTasksAreSkipped)
+{
+  TaskScheduler scheduler(1);
+  Gate          gate;
+  gate.block(scheduler);
+
+  CancellationToken token;
+  std::atomic<int>  ran{0};
+  const TaskHandle  a = scheduler.submit([&]() { ran++; }, {.token = token});
+  const TaskHandle  b = scheduler.submit([&]() { ran++; }, {.token = token});
+  const TaskHandle  c = scheduler.submit([&]() { ran++; });
+  token.cancel();
+  gate.release();
+  scheduler.wait(c);
+  scheduler.waitIdle();
+
+  EXPECT_EQ(ran.load(), 1);
+  EXPECT_EQ(a.state(), TaskState::eCancelled);
+  EXPECT_EQ(b.state(), TaskState::eCancelled);
+  EXPECT_EQ(c.state(), TaskState::eDone);
+  EXPECT_EQ(scheduler.getStats().cancelled, 2u);
+
+  // A running task sees the cancellation through its token
+  CancellationToken running;
+  std::atomic<bool> started{false};
+  const TaskHandle  loop = scheduler.submit(
+      [&]() {
+        started = true;
+        while(!running.isCancelled())
+          std::this_thread::yield();
+      },
+      {.token = running});
+  while(!started)
+    std::this_thread::yield();
+  running.cancel();
+  scheduler.wait(loop);
+  EXPECT_EQ(loop.state(), TaskState::eDone) << "Started before the cancel: finishes normally";
+}
+
+TEST(TaskScheduler, DependenciesRunFirst)
+{
+  TaskScheduler    scheduler(4);
+  std::atomic<int> step{0};
+  std::atomic<int> decodedAt{-1}, uploadedAt{-1}, finalizedAt{-1};
+
+  const TaskHandle decodeA = scheduler.submit([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    step++;
+  });
+  const TaskHandle decodeB = scheduler.submit([&]() { decodedAt = step++; });
+  const TaskHandle upload  = scheduler.submit([&]() { uploadedAt = step++; }, {.dependencies = {decodeA, decodeB}});
+  const TaskHandle finalize = scheduler.submit([&]() { finalizedAt = step++; }, {.dependencies = {upload}});
+  scheduler.wait(finalize);
+
+  EXPECT_EQ(uploadedAt.load(), 2) << "After both decodes";
+  EXPECT_EQ(finalizedAt.load(), 3);
+  EXPECT_TRUE(decodeA.isFinished());
+
+  // Depending on a finished task is immediate
+  const TaskHandle late = scheduler.submit([]() {}, {.dependencies = {finalize}});
+  scheduler.wait(late);
+  EXPECT_EQ(late.state(), TaskState::eDone);
+}
+
+TEST(TaskScheduler, CancellationPropagatesToDependents)
+{
+  TaskScheduler scheduler(1);
+  Gate          gate;
+  gate.block(scheduler);
+
+  CancellationToken load;
+  std::atomic<int>  ran{0};
+  const TaskHandle  parse  = scheduler.submit([&]() { ran++; }, {.token = load});
+  const TaskHandle  upload = scheduler.submit([&]() { ran++; }, {.dependencies = {parse}});
+  const TaskHandle  after  = scheduler.submit([&]() { ran++; }, {.dependencies = {upload}});
+  load.cancel();
+  gate.release();
+  scheduler.waitIdle();
+
+  EXPECT_EQ(ran.load(), 0);
+  EXPECT_EQ(upload.state(), TaskState::eCancelled);
+  EXPECT_EQ(after.state(), TaskState::eCancelled);
+
+  const TaskHandle again = scheduler.submit([&]() { ran++; }, {.dependencies = {parse}});
+  scheduler.wait(again);
+  EXPECT_EQ(again.state(), TaskState::eCancelled);
+}
+
+TEST(TaskScheduler, FixedWorkerCount)
+{
+  TaskScheduler scheduler(3);
+  EXPECT_EQ(scheduler.getWorkerCount(), 3u);
+
+  std::atomic<int> running{0}, peak{0};
+  for(int i = 0; i < 32; i++)
+  {
+    scheduler.submit([&]() {
+      const int now = ++running;
+      int       old = peak.load();
+      while(now > old && !peak.compare_exchange_weak(old, now))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      running--;
+    });
+  }
+  scheduler.waitIdle();
+  EXPECT_LE(peak.load(), 3);
+  EXPECT_LE(scheduler.getStats().peakRunning, 3u);
+  EXPECT_EQ(scheduler.getStats().completed, 32u);
+  EXPECT_EQ(scheduler.getStats().pendingOrBusy, 0u);
+}
+
+TEST(TaskScheduler, NestedWaitsDoNotExhaustThePool)
+{
+  // Every worker runs a task that waits on tasks queued behind it
+  TaskScheduler    scheduler(2);
+  std::atomic<int> leaves{0};
+  std::vector<TaskHandle> outer;
+  for(int i = 0; i < 4; i++)
+  {
+    outer.push_back(scheduler.submit([&]() {
+      std::vector<TaskHandle> inner;
+      for(int j = 0; j < 8; j++)
+        inner.push_back(scheduler.submit([&]() { leaves++; }));
+      for(const TaskHandle& h : inner)
+        scheduler.wait(h);
+    }));
+  }
+  for(const TaskHandle& h : outer)
+    scheduler.wait(h);
+  EXPECT_EQ(leaves.load(), 32);
+}
+
+TEST(TaskScheduler, ParallelForCoversEveryIndexOnce)
+{
+  TaskScheduler scheduler(4);
+  for(uint64_t count : {0ull, 1ull, 7ull, 128ull, 129ull, 10000ull})
+  {
+    std::vector<std::atomic<int>> hits(count);
+    scheduler.parallelFor<16>(count, [&](uint64_t i) { hits[i]++; });
+    for(uint64_t i = 0; i < count; i++)
+      ASSERT_EQ(hits[i].load(), 1) << "count " << count << " index " << i;
+  }
+
+  // Serial when limited to the calling thread
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<bool>     elsewhere{false};
+  scheduler.parallelFor<1>(
+      64, [&](uint64_t) { elsewhere = elsewhere || std::this_thread::get_id() != caller; }, TaskPriority::eInteractive, 1);
+  EXPECT_FALSE(elsewhere.load());
+}
+
+TEST(TaskScheduler, NestedParallelForOnSingleWorker)
+{
+  TaskScheduler         scheduler(1);
+  std::atomic<uint64_t> sum{0};
+  const TaskHandle      load = scheduler.submit(
+      [&]() {
+        EXPECT_EQ(nvvkgltf::currentTaskPriority(), TaskPriority::eHigh) << "Inherited by the decodes";
+        scheduler.parallelFor<1>(100, [&](uint64_t i) { sum += i; });
+      },
+      {.priority = TaskPriority::eHigh});
+  scheduler.wait(load);
+  EXPECT_EQ(sum.load(), 4950u);
+  EXPECT_EQ(nvvkgltf::currentTaskPriority(), TaskPriority::eInteractive);
+}
@@ -75,6 +75,12 @@ def build_parser() -> argparse.ArgumentParser:
         default=5.0,
         help="Flag regression if candidate GPU time is slower by more than this percent",
     )
+    cmp_p.add_argument(
+        "--ram-regression-threshold-mb",
+        type=float,
+        default=64.0,
+        help="Flag regression if the candidate's scene host-memory peak grows by more than this many MB",
+    )
     return parser
 
 
@@ -87,6 +93,7 @@ def main() -> int:
             args.candidate_csv,
             args.output,
             args.regression_threshold_pct,
+            ram_regression_threshold_mb=args.ram_regression_threshold_mb,
         )
 
     if args.command == "headless-compare":
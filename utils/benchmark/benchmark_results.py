@@ -186,6 +186,7 @@ def _parse_json_memory_records(log_text: str) -> dict[int, dict[str, dict[str, i
             category = str(sample.get("category", "Unknown"))
             memory[category] = {
                 "Host Used": int(sample.get("host_used", 0)),
+                "Host Peak": int(sample.get("host_peak", 0)),
                 "Device Used": int(sample.get("device_used", 0)),
                 "Device Allocated": int(sample.get("device_allocated", 0)),
             }
@@ -215,6 +216,24 @@ def _parse_legacy_memory_records(log_text: str) -> dict[int, dict[str, dict[str,
     return records
 
 
+def _parse_json_deformation_records(log_text: str) -> dict[int, dict[str, int]]:
+    fields = [
+        "frames",
+        "morph_evaluated",
+        "morph_at_rest",
+        "morph_skipped",
+        "skin_evaluated",
+        "skin_skipped",
+        "vertices_skipped",
+    ]
+    records: dict[int, dict[str, int]] = {}
+    for record in iter_benchmark_records(log_text):
+        if record.get("type") != "sequence_deformation":
+            continue
+        records[int(record.get("id", 0))] = {key: int(record.get(key, 0)) for key in fields}
+    return records
+
+
 def parse_benchmark(log_text: str, scene_name: str) -> list[dict[str, Any]]:
     benchmark_pattern = re.compile(r'ParameterSequence\s+(\d+)\s+"([^"]+)"\s*=')
     timer_pattern = re.compile(r'Timer\s+"([^"]+)"\s*;\s*GPU;\s*avg\s+(\d+);.*?CPU;\s*avg\s+(\d+);')
@@ -239,12 +258,16 @@ def parse_benchmark(log_text: str, scene_name: str) -> list[dict[str, Any]]:
             "name": benchmark_name,
             "timers": timers,
             "memory": {},
+            "deformation": {},
         }
 
     memory_records = _parse_json_memory_records(log_text) or _parse_legacy_memory_records(log_text)
     for benchmark_id, memory_data in memory_records.items():
         if benchmark_id in benchmark_data:
             benchmark_data[benchmark_id]["memory"] = memory_data
+    for benchmark_id, deformation in _parse_json_deformation_records(log_text).items():
+        if benchmark_id in benchmark_data:
+            benchmark_data[benchmark_id]["deformation"] = deformation
 
     return list(benchmark_data.values())
 
@@ -262,10 +285,20 @@ def primary_timer_ms(benchmark: dict[str, Any], device: str, preferred_stages: l
 def save_to_csv(benchmarks: list[dict[str, Any]], filename: str) -> None:
     stages = sorted({stage for benchmark in benchmarks for stage in benchmark["timers"]})
     memory_types = sorted({mtype for benchmark in benchmarks for mtype in benchmark.get("memory", {})})
-    fieldnames = ["Scene", "Benchmark ID", "Benchmark Name", "Primary GPU ms", "Primary CPU ms", "Scene VRAM peak MB"]
+    fieldnames = [
+        "Scene",
+        "Benchmark ID",
+        "Benchmark Name",
+        "Primary GPU ms",
+        "Primary CPU ms",
+        "Scene VRAM peak MB",
+        "Scene RAM peak MB",
+    ]
     fieldnames += [f"{stage} VK ms" for stage in stages] + [f"{stage} CPU ms" for stage in stages]
     for mtype in memory_types:
         fieldnames += [f"{mtype} Device Used", f"{mtype} Device Allocated"]
+    deformation_keys = sorted({key for benchmark in benchmarks for key in benchmark.get("deformation", {})})
+    fieldnames += [f"Deform {key}" for key in deformation_keys]
 
     with open(filename, "w", newline="", encoding="utf-8") as csvfile:
         writer = csv.DictWriter(csvfile, fieldnames=fieldnames)
@@ -276,6 +309,8 @@ def save_to_csv(benchmarks: list[dict[str, Any]], filename: str) -> None:
             cpu_ms = primary_timer_ms(benchmark, "CPU", preferred)
             scene_peak = benchmark.get("memory", {}).get("Scene", {}).get("Device Allocated")
             scene_peak_mb = f"{scene_peak / (1024 * 1024):.2f}" if scene_peak is not None else "N/A"
+            host_peak = benchmark.get("memory", {}).get("Scene", {}).get("Host Peak")
+            host_peak_mb = f"{host_peak / (1024 * 1024):.2f}" if host_peak is not None else "N/A"
 
             row: dict[str, Any] = {
                 "Scene": benchmark["scene"],
@@ -284,6 +319,7 @@ def save_to_csv(benchmarks: list[dict[str, Any]], filename: str) -> None:
                 "Primary GPU ms": f"{gpu_ms:.4f}" if gpu_ms is not None else "N/A",
                 "Primary CPU ms": f"{cpu_ms:.4f}" if cpu_ms is not None else "N/A",
                 "Scene VRAM peak MB": scene_peak_mb,
+                "Scene RAM peak MB": host_peak_mb,
             }
             for stage in stages:
                 row[f"{stage} VK ms"] = benchmark["timers"].get(stage, {}).get("VK", "N/A")
@@ -291,6 +327,8 @@ def save_to_csv(benchmarks: list[dict[str, Any]], filename: str) -> None:
             for mtype in memory_types:
                 row[f"{mtype} Device Used"] = benchmark["memory"].get(mtype, {}).get("Device Used", "N/A")
                 row[f"{mtype} Device Allocated"] = benchmark["memory"].get(mtype, {}).get("Device Allocated", "N/A")
+            for key in deformation_keys:
+                row[f"Deform {key}"] = benchmark.get("deformation", {}).get(key, "N/A")
             writer.writerow(row)
 
 
@@ -315,6 +353,7 @@ def compare_csv(
     output_csv: str,
     regression_threshold_pct: float,
     vram_regression_threshold_mb: float = 64.0,
+    ram_regression_threshold_mb: float = 64.0,
 ) -> int:
     baseline = {(row["Scene"], row["Benchmark Name"]): row for row in load_csv_rows(baseline_csv)}
     candidate = {(row["Scene"], row["Benchmark Name"]): row for row in load_csv_rows(candidate_csv)}
@@ -328,11 +367,20 @@ def compare_csv(
         "Baseline VRAM peak MB",
         "Candidate VRAM peak MB",
         "VRAM delta MB",
+        "Baseline RAM peak MB",
+        "Candidate RAM peak MB",
+        "RAM delta MB",
         "Regression",
     ]
     regressions = 0
     gpu_regressions = 0
     vram_regressions = 0
+    ram_regressions = 0
+
+    def peak_mb(row: dict[str, str] | None, column: str) -> float | None:
+        # Older CSVs have no RAM column
+        value = row.get(column, "N/A") if row else "N/A"
+        return float(value) if value not in ("", "N/A") else None
 
     with open(output_csv, "w", newline="", encoding="utf-8") as file:
         writer = csv.DictWriter(file, fieldnames=fieldnames)
@@ -372,6 +420,16 @@ def compare_csv(
                     row_regressed = True
                     vram_regressions += 1
 
+            baseline_ram = peak_mb(baseline_row, "Scene RAM peak MB")
+            candidate_ram = peak_mb(candidate_row, "Scene RAM peak MB")
+            ram_delta = ""
+            if baseline_ram is not None and candidate_ram is not None:
+                ram_delta_val = candidate_ram - baseline_ram
+                ram_delta = f"{ram_delta_val:+.2f}"
+                if ram_delta_val > ram_regression_threshold_mb:
+                    row_regressed = True
+                    ram_regressions += 1
+
             regression = "yes" if row_regressed else "no"
             if row_regressed:
                 regressions += 1
@@ -386,6 +444,9 @@ def compare_csv(
                     "Baseline VRAM peak MB": baseline_row["Scene VRAM peak MB"] if baseline_row else "N/A",
                     "Candidate VRAM peak MB": candidate_row["Scene VRAM peak MB"] if candidate_row else "N/A",
                     "VRAM delta MB": vram_delta or "N/A",
+                    "Baseline RAM peak MB": baseline_row.get("Scene RAM peak MB", "N/A") if baseline_row else "N/A",
+                    "Candidate RAM peak MB": candidate_row.get("Scene RAM peak MB", "N/A") if candidate_row else "N/A",
+                    "RAM delta MB": ram_delta or "N/A",
                     "Regression": regression,
                 }
             )
@@ -393,7 +454,8 @@ def compare_csv(
     print(
         f"Comparison written to {output_csv} "
         f"({regressions} regressed rows: {gpu_regressions} GPU > {regression_threshold_pct}%, "
-        f"{vram_regressions} VRAM > {vram_regression_threshold_mb} MB)"
+        f"{vram_regressions} VRAM > {vram_regression_threshold_mb} MB, "
+        f"{ram_regressions} RAM > {ram_regression_threshold_mb} MB)"
     )
     return 1 if regressions > 0 else 0
 
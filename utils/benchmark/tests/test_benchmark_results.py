@@ -37,7 +37,7 @@ class BenchmarkResultTests(unittest.TestCase):
             '  Timer "GltfRenderer::onRender"; GPU; avg 12000; CPU; avg 3400;\n'
             "}\n"
             'BENCHMARK_JSON {"schema":1,"type":"sequence_memory","id":0,"memory":['
-            '{"category":"Scene","host_used":0,"device_used":100,"device_allocated":200},'
+            '{"category":"Scene","host_used":50,"host_peak":70,"device_used":100,"device_allocated":200},'
             '{"category":"PathTracer","host_used":0,"device_used":30,"device_allocated":40}]}\n'
         )
 
@@ -47,6 +47,25 @@ class BenchmarkResultTests(unittest.TestCase):
         self.assertEqual(rows[0]["timers"]["GltfRenderer::onRender"]["VK"], 12.0)
         self.assertEqual(rows[0]["memory"]["Scene"]["Device Allocated"], 200)
         self.assertEqual(rows[0]["memory"]["PathTracer"]["Device Used"], 30)
+        self.assertEqual(rows[0]["memory"]["Scene"]["Host Used"], 50)
+        self.assertEqual(rows[0]["memory"]["Scene"]["Host Peak"], 70)
+
+    def test_parse_benchmark_attaches_deformation_record(self) -> None:
+        log_text = (
+            'ParameterSequence 0 "Paused" = {\n'
+            '  Timer "GltfRenderer::onRender"; GPU; avg 12000; CPU; avg 3400;\n'
+            "}\n"
+            'BENCHMARK_JSON {"schema":1,"type":"sequence_deformation","id":0,"frames":10,'
+            '"morph_evaluated":1,"morph_at_rest":0,"morph_skipped":9,"skin_evaluated":2,'
+            '"skin_skipped":18,"vertices_skipped":5000}\n'
+        )
+
+        rows = parse_benchmark(log_text, "fox")
+
+        self.assertEqual(len(rows), 1)
+        self.assertEqual(rows[0]["deformation"]["morph_skipped"], 9)
+        self.assertEqual(rows[0]["deformation"]["skin_skipped"], 18)
+        self.assertEqual(rows[0]["deformation"]["vertices_skipped"], 5000)
 
     def test_parse_headless_summary_legacy_fallback(self) -> None:
         log_text = (
@@ -111,6 +130,36 @@ class BenchmarkResultTests(unittest.TestCase):
                 rows = list(csv.DictReader(file))
             self.assertEqual(rows[0]["Regression"], "yes")
             self.assertEqual(rows[0]["GPU delta %"], "+10.00")
+            self.assertEqual(rows[0]["RAM delta MB"], "N/A")
+
+    def test_compare_csv_flags_ram_regression(self) -> None:
+        with tempfile.TemporaryDirectory() as tmpdir:
+            root = Path(tmpdir)
+            baseline = root / "baseline.csv"
+            candidate = root / "candidate.csv"
+            output = root / "diff.csv"
+            fieldnames = ["Scene", "Benchmark Name", "Primary GPU ms", "Scene VRAM peak MB", "Scene RAM peak MB"]
+            for path, ram in ((baseline, "100.0"), (candidate, "200.0")):
+                with path.open("w", newline="", encoding="utf-8") as file:
+                    writer = csv.DictWriter(file, fieldnames=fieldnames)
+                    writer.writeheader()
+                    writer.writerow(
+                        {
+                            "Scene": "s",
+                            "Benchmark Name": "b",
+                            "Primary GPU ms": "10.0",
+                            "Scene VRAM peak MB": "1.0",
+                            "Scene RAM peak MB": ram,
+                        }
+                    )
+
+            rc = compare_csv(str(baseline), str(candidate), str(output), 5.0)
+
+            self.assertEqual(rc, 1)
+            with output.open(newline="", encoding="utf-8") as file:
+                rows = list(csv.DictReader(file))
+            self.assertEqual(rows[0]["Regression"], "yes")
+            self.assertEqual(rows[0]["RAM delta MB"], "+100.00")
 
 
 if __name__ == "__main__":